@@ -9,12 +9,16 @@
 #include "src/battery/BATTERIES.h"
 #include "src/charger/CHARGERS.h"
 #include "src/communication/Transmitter.h"
+#include "src/communication/can/CanScheduler.h"
+#include "src/communication/can/CanSupervisor.h"
 #include "src/communication/can/comm_can.h"
 #include "src/communication/contactorcontrol/comm_contactorcontrol.h"
 #include "src/communication/equipmentstopbutton/comm_equipmentstopbutton.h"
 #include "src/communication/nvm/comm_nvm.h"
 #include "src/communication/precharge_control/precharge_control.h"
 #include "src/communication/rs485/comm_rs485.h"
+#include "src/communication/usb/comm_usb.h"
+#include "src/datalayer/calculated_values.h"
 #include "src/datalayer/datalayer.h"
 #include "src/devboard/display/display.h"
 #include "src/devboard/mqtt/mqtt.h"
@@ -134,6 +138,12 @@ void logging_loop(void*) {
     if (datalayer.system.info.CAN_SD_logging_active) {
       write_can_frame_to_sdcard();
     }
+
+    save_can_flight_recording();
+    if (!datalayer.system.info.SD_logging_active && !datalayer.system.info.CAN_SD_logging_active) {
+      // Nothing waits on a log buffer, only the flight recorder is watched
+      vTaskDelay(pdMS_TO_TICKS(100));
+    }
   }
   // Delete the logging task only if SD failed to initialize to prevent panic.
   vTaskDelete(NULL);
@@ -200,209 +210,6 @@ void check_interconnect_available(uint8_t batteryNumber) {
   }
 }
 
-void update_calculated_values(unsigned long currentMillis) {
-  /* Update CPU temperature*/
-  union {
-    float temp;
-    uint32_t hex;
-  } temp = {.temp = temperatureRead()};
-  if (temp.hex != 0x42555555) {
-    // Ignoring erroneous temperature value that ESP32 sometimes returns
-    datalayer.system.info.CPU_temperature = temp.temp;
-  }
-
-  /*Update free heap*/
-  datalayer.system.info.CPU_free_heap = ESP.getFreeHeap();
-
-  /* Check is remote set limits have timed out */
-  if (currentMillis > datalayer.battery.settings.remote_set_timestamp + datalayer.battery.settings.remote_set_timeout) {
-    datalayer.battery.settings.remote_settings_limit_charge = false;
-    datalayer.battery.settings.remote_settings_limit_discharge = false;
-    datalayer.battery.settings.max_remote_set_charge_dA = 0;
-    datalayer.battery.settings.max_remote_set_discharge_dA = 0;
-  }
-
-  /* Calculate allowed charge/discharge currents*/
-  if (datalayer.battery.status.voltage_dV > 10) {
-    // Only update value when we have voltage available to avoid div0. TODO: This should be based on nominal voltage
-    datalayer.battery.status.max_charge_current_dA =
-        ((datalayer.battery.status.max_charge_power_W * 100) / datalayer.battery.status.voltage_dV);
-    datalayer.battery.status.max_discharge_current_dA =
-        ((datalayer.battery.status.max_discharge_power_W * 100) / datalayer.battery.status.voltage_dV);
-  }
-
-  /* Apply remote restrictions if set*/
-  if (datalayer.battery.settings.remote_settings_limit_charge) {
-    if (datalayer.battery.status.max_charge_current_dA > datalayer.battery.settings.max_remote_set_charge_dA) {
-      datalayer.battery.status.max_charge_current_dA = datalayer.battery.settings.max_remote_set_charge_dA;
-    }
-  } else {
-    /* Restrict values from user settings if needed*/
-    if (datalayer.battery.status.max_charge_current_dA > datalayer.battery.settings.max_user_set_charge_dA) {
-      datalayer.battery.status.max_charge_current_dA = datalayer.battery.settings.max_user_set_charge_dA;
-      datalayer.battery.settings.user_settings_limit_charge = true;
-    } else {
-      datalayer.battery.settings.user_settings_limit_charge = false;
-    }
-  }
-
-  /* Apply remote restrictions if set*/
-  if (datalayer.battery.settings.remote_settings_limit_discharge) {
-    if (datalayer.battery.status.max_discharge_current_dA > datalayer.battery.settings.max_remote_set_charge_dA) {
-      datalayer.battery.status.max_discharge_current_dA = datalayer.battery.settings.max_remote_set_discharge_dA;
-    }
-  } else {
-    /* Restrict values from user settings if needed*/
-    if (datalayer.battery.status.max_discharge_current_dA > datalayer.battery.settings.max_user_set_discharge_dA) {
-      datalayer.battery.status.max_discharge_current_dA = datalayer.battery.settings.max_user_set_discharge_dA;
-      datalayer.battery.settings.user_settings_limit_discharge = true;
-    } else {
-      datalayer.battery.settings.user_settings_limit_discharge = false;
-    }
-  }
-
-  /* Calculate sum of all currents from all batteries*/
-  if (battery3) {
-    datalayer.battery.status.reported_current_dA =
-        (datalayer.battery.status.current_dA + datalayer.battery2.status.current_dA +
-         datalayer.battery3.status.current_dA);
-  } else if (battery2) {
-    datalayer.battery.status.reported_current_dA =
-        (datalayer.battery.status.current_dA + datalayer.battery2.status.current_dA);
-  } else {  // Only one battery in use
-    datalayer.battery.status.reported_current_dA = datalayer.battery.status.current_dA;
-  }
-
-  /* Calculate active power based on voltage and current*/
-  datalayer.battery.status.active_power_W =
-      (datalayer.battery.status.current_dA * (datalayer.battery.status.voltage_dV / 100));
-  /* Calculate if battery or inverter is limiting factor*/
-
-  if (datalayer.battery.status.current_dA == 0) {  //Battery idle
-    if (datalayer.battery.status.max_discharge_current_dA > 0) {
-      //We allow discharge, but inverter does nothing. Inverter is limiting
-      datalayer.battery.settings.inverter_limits_discharge = true;
-    } else {
-      datalayer.battery.settings.inverter_limits_discharge = false;
-    }
-    if (datalayer.battery.status.max_charge_current_dA > 0) {
-      //We allow charge, but inverter does nothing. Inverter is limiting
-      datalayer.battery.settings.inverter_limits_charge = true;
-    } else {
-      datalayer.battery.settings.inverter_limits_charge = false;
-    }
-  } else if (datalayer.battery.status.current_dA < 0) {  //Battery discharging
-    if (-datalayer.battery.status.current_dA < datalayer.battery.status.max_discharge_current_dA) {
-      datalayer.battery.settings.inverter_limits_discharge = true;
-    } else {
-      datalayer.battery.settings.inverter_limits_discharge = false;
-    }
-  } else {  // > 0 Battery charging
-    //If actual current is smaller than max we allow, inverter is limiting factor
-    if (datalayer.battery.status.current_dA < datalayer.battery.status.max_charge_current_dA) {
-      datalayer.battery.settings.inverter_limits_charge = true;
-    } else {
-      datalayer.battery.settings.inverter_limits_charge = false;
-    }
-  }
-
-  if (battery2) {
-    /* Calculate active power based on voltage and current for battery 2*/
-    datalayer.battery2.status.active_power_W =
-        (datalayer.battery2.status.current_dA * (datalayer.battery2.status.voltage_dV / 100));
-  }
-  if (battery3) {
-    /* Calculate active power based on voltage and current for battery 2*/
-    datalayer.battery3.status.active_power_W =
-        (datalayer.battery3.status.current_dA * (datalayer.battery3.status.voltage_dV / 100));
-  }
-
-  if (datalayer.battery.settings.soc_scaling_active) {
-    /** SOC Scaling
-   * A static version of a stochastic oscillator. The scaled SoC is calculated as:
-   * 
-   *     10000 * (real_soc - min_percentage)
-   * ---------------------------------------
-   *     (max_percentage - min_percentage)
-   * 
-   * And scaled capacity is:
-   * 
-   *     reported_total_capacity_Wh = total_capacity_Wh * (max - min) / 10000
-   *     reported_remaining_capacity_Wh = reported_total_capacity_Wh * scaled_soc / 10000
-   */
-    // Compute delta_pct and clamped_soc
-    int32_t delta_pct = datalayer.battery.settings.max_percentage - datalayer.battery.settings.min_percentage;
-    int32_t clamped_soc = CONSTRAIN(datalayer.battery.status.real_soc, datalayer.battery.settings.min_percentage,
-                                    datalayer.battery.settings.max_percentage);
-    int32_t scaled_soc = 0;
-    int32_t scaled_total_capacity = 0;
-    if (delta_pct != 0) {  //Safeguard against division by 0
-      scaled_soc = 10000 * (clamped_soc - datalayer.battery.settings.min_percentage) / delta_pct;
-    }
-
-    datalayer.battery.status.reported_soc = scaled_soc;
-
-    // If battery info is valid
-    if (datalayer.battery.info.total_capacity_Wh > 0 && datalayer.battery.status.real_soc > 0) {
-      // Scale total usable capacity
-      scaled_total_capacity = (datalayer.battery.info.total_capacity_Wh * delta_pct) / 10000;
-      datalayer.battery.info.reported_total_capacity_Wh = scaled_total_capacity;
-
-      // Scale remaining capacity based on scaled SOC
-      datalayer.battery.status.reported_remaining_capacity_Wh = (scaled_total_capacity * scaled_soc) / 10000;
-
-    } else {
-      // Fallback if scaling cannot be performed
-      datalayer.battery.info.reported_total_capacity_Wh = datalayer.battery.info.total_capacity_Wh;
-      datalayer.battery.status.reported_remaining_capacity_Wh = datalayer.battery.status.remaining_capacity_Wh;
-    }
-
-    if (battery2) {
-      // If battery info is valid
-      if (datalayer.battery2.info.total_capacity_Wh > 0 && datalayer.battery.status.real_soc > 0) {
-
-        datalayer.battery2.info.reported_total_capacity_Wh = scaled_total_capacity;
-        // Scale remaining capacity based on scaled SOC
-        datalayer.battery2.status.reported_remaining_capacity_Wh = (scaled_total_capacity * scaled_soc) / 10000;
-
-      } else {
-        // Fallback if scaling cannot be performed
-        datalayer.battery2.info.reported_total_capacity_Wh = datalayer.battery2.info.total_capacity_Wh;
-        datalayer.battery2.status.reported_remaining_capacity_Wh = datalayer.battery2.status.remaining_capacity_Wh;
-      }
-
-      //Since we are running double battery, the scaled value of battery1 becomes the sum of battery1+battery2
-      //This way the inverter connected to the system sees both batteries as one large battery
-      datalayer.battery.info.reported_total_capacity_Wh += datalayer.battery2.info.reported_total_capacity_Wh;
-      datalayer.battery.status.reported_remaining_capacity_Wh +=
-          datalayer.battery2.status.reported_remaining_capacity_Wh;
-    }
-
-  } else {  // soc_scaling_active == false. No SOC window wanted. Set scaled to same as real.
-    datalayer.battery.status.reported_soc = datalayer.battery.status.real_soc;
-    datalayer.battery.status.reported_remaining_capacity_Wh = datalayer.battery.status.remaining_capacity_Wh;
-    datalayer.battery.info.reported_total_capacity_Wh = datalayer.battery.info.total_capacity_Wh;
-
-    if (battery2) {
-      datalayer.battery2.status.reported_soc = datalayer.battery2.status.real_soc;
-      datalayer.battery2.status.reported_remaining_capacity_Wh = datalayer.battery2.status.remaining_capacity_Wh;
-      datalayer.battery2.info.reported_total_capacity_Wh = datalayer.battery2.info.total_capacity_Wh;
-    }
-  }
-
-  //Check each extra battery, and if they are at the extremes, report the SOC from these batteries instead
-  if (battery2 && datalayer.system.status.battery2_allowed_contactor_closing) {  //Battery2 is in the mix
-    if ((datalayer.battery2.status.real_soc < 100) || (datalayer.battery2.status.real_soc > 9900)) {
-      datalayer.battery.status.reported_soc = datalayer.battery2.status.real_soc;
-    }
-  }
-  if (battery3 && datalayer.system.status.battery3_allowed_contactor_closing) {  //Battery3 is in the mix
-    if ((datalayer.battery3.status.real_soc < 100) || (datalayer.battery3.status.real_soc > 9900)) {
-      datalayer.battery.status.reported_soc = datalayer.battery3.status.real_soc;
-    }
-  }
-}
-
 void check_reset_reason() {
   esp_reset_reason_t reason = esp_reset_reason();
   switch (reason) {
@@ -493,6 +300,7 @@ void core_loop(void*) {
         START_TIME_MEASUREMENT(10ms);
       }
       led_exe();
+      can_supervisor.check(currentMillis);  // Flag supervised CAN IDs that stopped arriving
       handle_contactors();  // Take care of startup precharge/contactor closing
       if (precharge_control_enabled) {
         handle_precharge_control(currentMillis);  //Drive the hia4v1 via PWM
@@ -509,6 +317,9 @@ void core_loop(void*) {
         START_TIME_MEASUREMENT(values);
       }
       update_pause_state();  // Check if we are OK to send CAN or need to pause
+      update_can_rx_statistics();
+      update_can_tx_statistics();
+      update_can_bus_statistics();
 
       // Fetch battery values
       if (battery) {
@@ -533,6 +344,12 @@ void core_loop(void*) {
 
       if (datalayer.system.info.performance_measurement_active) {
         END_TIME_MEASUREMENT_MAX(values, datalayer.system.status.time_values_us);
+        START_TIME_MEASUREMENT(snapshot);
+      }
+      // The values of this cycle are complete, hand them to the MQTT, webserver and display tasks
+      datalayer_snapshot.publish(datalayer);
+      if (datalayer.system.info.performance_measurement_active) {
+        END_TIME_MEASUREMENT_MAX(snapshot, datalayer.system.status.time_snapshot_us);
       }
     }
     if (datalayer.system.info.performance_measurement_active) {
@@ -543,6 +360,10 @@ void core_loop(void*) {
     for (auto& transmitter : transmitters) {
       transmitter->transmit(currentMillis);
     }
+    // Periodic frames registered with the scheduler
+    can_scheduler.run(currentMillis);
+    // Whatever the controllers could not take right away
+    transmit_queued_can_frames();
 
     if (datalayer.system.info.performance_measurement_active) {
       END_TIME_MEASUREMENT_MAX(cantx, datalayer.system.status.time_cantx_us);
@@ -566,6 +387,7 @@ void core_loop(void*) {
         datalayer.system.status.time_10ms_us = 0;
         datalayer.system.status.time_values_us = 0;
         datalayer.system.status.time_cantx_us = 0;
+        datalayer.system.status.time_snapshot_us = 0;
         datalayer.system.status.core_task_10s_max_us = 0;
         datalayer.system.status.wifi_task_10s_max_us = 0;
         datalayer.system.status.mqtt_task_10s_max_us = 0;
@@ -599,6 +421,10 @@ void setup() {
 
   init_stored_settings();
 
+  init_usb_output();
+
+  init_deferred_logging();
+
   if (wifi_enabled) {
     xTaskCreatePinnedToCore((TaskFunction_t)&connectivity_loop, "connectivity_loop", 8192, NULL, TASK_CONNECTIVITY_PRIO,
                             &connectivity_loop_task, esp32hal->WIFICORE());
@@ -622,6 +448,7 @@ void setup() {
 
   // Init CAN only after any CAN receivers have had a chance to register.
   init_CAN();
+  init_can_flight_recorder();
 
   init_rs485();
 
@@ -653,6 +480,9 @@ void setup() {
 
   // Start tasks
 
+  // Give the other tasks the settings and defaults until the core task publishes its first values
+  datalayer_snapshot.publish(datalayer);
+
   if (mqtt_enabled) {
     init_mqtt();
 
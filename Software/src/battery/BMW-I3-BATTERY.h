@@ -30,7 +30,7 @@ class BmwI3Battery : public CanBattery {
   }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "BMW i3";
@@ -123,182 +123,194 @@ class BmwI3Battery : public CanBattery {
      3E9 32F 19E 326 55E 515 509 50A 51A 2F5 3A4 432 3C9 
      */
 
-  CAN_frame BMW_10B = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 3,
-                       .ID = 0x10B,
-                       .data = {0xCD, 0x00, 0xFC}};  // Contactor closing command
-  CAN_frame BMW_12F = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x12F,
-                       .data = {0xE6, 0x24, 0x86, 0x1A, 0xF1, 0x31, 0x30, 0x00}};  //0x12F Wakeup VCU
-  CAN_frame BMW_13E = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x13E,
-                       .data = {0xFF, 0x31, 0xFA, 0xFA, 0xFA, 0xFA, 0x0C, 0x00}};
-  static constexpr CAN_frame BMW_192 = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 8,
-                                        .ID = 0x192,
-                                        .data = {0xFF, 0xFF, 0xA3, 0x8F, 0x93, 0xFF, 0xFF, 0xFF}};
-  CAN_frame BMW_19B = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x19B,
-                       .data = {0x20, 0x40, 0x40, 0x55, 0xFD, 0xFF, 0xFF, 0xFF}};
-  CAN_frame BMW_1D0 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x1D0,
-                       .data = {0x4D, 0xF0, 0xAE, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF}};
-  static constexpr CAN_frame BMW_2CA = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x2CA, .data = {0x57, 0x57}};
-  static constexpr CAN_frame BMW_2E2 = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 8,
-                                        .ID = 0x2E2,
-                                        .data = {0x4F, 0xDB, 0x7F, 0xB9, 0x07, 0x51, 0xff, 0x00}};
-  CAN_frame BMW_30B = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x30B,
-                       .data = {0xe1, 0xf0, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff}};
-  CAN_frame BMW_328 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 6,
-                       .ID = 0x328,
-                       .data = {0xB0, 0xE4, 0x87, 0x0E, 0x30, 0x22}};
-  static constexpr CAN_frame BMW_37B = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 6,
-                                        .ID = 0x37B,
-                                        .data = {0x40, 0x00, 0x00, 0xFF, 0xFF, 0x00}};
-  static constexpr CAN_frame BMW_380 = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 7,
-                                        .ID = 0x380,
-                                        .data = {0x56, 0x5A, 0x37, 0x39, 0x34, 0x34, 0x34}};
-  static constexpr CAN_frame BMW_3A0 = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 8,
-                                        .ID = 0x3A0,
-                                        .data = {0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC}};
-  CAN_frame BMW_3A7 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 7,
-                       .ID = 0x3A7,
-                       .data = {0x05, 0xF5, 0x0A, 0x00, 0x4F, 0x11, 0xF0}};
-  CAN_frame BMW_3C5 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x3C5,
-                       .data = {0x30, 0x05, 0x47, 0x70, 0x2c, 0xce, 0xc3, 0x34}};
-  static constexpr CAN_frame BMW_3CA = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 8,
-                                        .ID = 0x3CA,
-                                        .data = {0x87, 0x80, 0x30, 0x0C, 0x0C, 0x81, 0xFF, 0xFF}};
-  static constexpr CAN_frame BMW_3D0 = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x3D0, .data = {0xFD, 0xFF}};
-  static constexpr CAN_frame BMW_3E4 = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 6,
-                                        .ID = 0x3E4,
-                                        .data = {0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF}};
-  CAN_frame BMW_3E5 = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x3E5, .data = {0xFC, 0xFF, 0xFF}};
-  CAN_frame BMW_3E8 = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x3E8, .data = {0xF0, 0xFF}};  //1000ms OBD reset
-  CAN_frame BMW_3EC = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x3EC,
-                       .data = {0xF5, 0x10, 0x00, 0x00, 0x80, 0x25, 0x0F, 0xFC}};
-  CAN_frame BMW_3F9 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x3F9,
-                       .data = {0xA7, 0x2A, 0x00, 0xE2, 0xA6, 0x30, 0xC3, 0xFF}};
-  static constexpr CAN_frame BMW_3FB = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 6,
-                                        .ID = 0x3FB,
-                                        .data = {0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00}};
-  CAN_frame BMW_3FC = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x3FC, .data = {0xC0, 0xF9, 0x0F}};
-  static constexpr CAN_frame BMW_418 = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 8,
-                                        .ID = 0x418,
-                                        .data = {0xFF, 0x7C, 0xFF, 0x00, 0xC0, 0x3F, 0xFF, 0xFF}};
-  static constexpr CAN_frame BMW_41D = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 4,
-                                        .ID = 0x41D,
-                                        .data = {0xFF, 0xF7, 0x7F, 0xFF}};
-  CAN_frame BMW_433 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 4,
-                       .ID = 0x433,
-                       .data = {0xFF, 0x00, 0x0F, 0xFF}};  // HV specification
-  static constexpr CAN_frame BMW_512 = {
+  CAN_classic_frame BMW_10B = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 3,
+                               .ID = 0x10B,
+                               .data = {0xCD, 0x00, 0xFC}};  // Contactor closing command
+  CAN_classic_frame BMW_12F = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x12F,
+                               .data = {0xE6, 0x24, 0x86, 0x1A, 0xF1, 0x31, 0x30, 0x00}};  //0x12F Wakeup VCU
+  CAN_classic_frame BMW_13E = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x13E,
+                               .data = {0xFF, 0x31, 0xFA, 0xFA, 0xFA, 0xFA, 0x0C, 0x00}};
+  static constexpr CAN_classic_frame BMW_192 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 8,
+                                                .ID = 0x192,
+                                                .data = {0xFF, 0xFF, 0xA3, 0x8F, 0x93, 0xFF, 0xFF, 0xFF}};
+  CAN_classic_frame BMW_19B = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x19B,
+                               .data = {0x20, 0x40, 0x40, 0x55, 0xFD, 0xFF, 0xFF, 0xFF}};
+  CAN_classic_frame BMW_1D0 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x1D0,
+                               .data = {0x4D, 0xF0, 0xAE, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF}};
+  static constexpr CAN_classic_frame BMW_2CA = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 2,
+                                                .ID = 0x2CA,
+                                                .data = {0x57, 0x57}};
+  static constexpr CAN_classic_frame BMW_2E2 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 8,
+                                                .ID = 0x2E2,
+                                                .data = {0x4F, 0xDB, 0x7F, 0xB9, 0x07, 0x51, 0xff, 0x00}};
+  CAN_classic_frame BMW_30B = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x30B,
+                               .data = {0xe1, 0xf0, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff}};
+  CAN_classic_frame BMW_328 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 6,
+                               .ID = 0x328,
+                               .data = {0xB0, 0xE4, 0x87, 0x0E, 0x30, 0x22}};
+  static constexpr CAN_classic_frame BMW_37B = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 6,
+                                                .ID = 0x37B,
+                                                .data = {0x40, 0x00, 0x00, 0xFF, 0xFF, 0x00}};
+  static constexpr CAN_classic_frame BMW_380 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 7,
+                                                .ID = 0x380,
+                                                .data = {0x56, 0x5A, 0x37, 0x39, 0x34, 0x34, 0x34}};
+  static constexpr CAN_classic_frame BMW_3A0 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 8,
+                                                .ID = 0x3A0,
+                                                .data = {0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC}};
+  CAN_classic_frame BMW_3A7 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 7,
+                               .ID = 0x3A7,
+                               .data = {0x05, 0xF5, 0x0A, 0x00, 0x4F, 0x11, 0xF0}};
+  CAN_classic_frame BMW_3C5 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x3C5,
+                               .data = {0x30, 0x05, 0x47, 0x70, 0x2c, 0xce, 0xc3, 0x34}};
+  static constexpr CAN_classic_frame BMW_3CA = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 8,
+                                                .ID = 0x3CA,
+                                                .data = {0x87, 0x80, 0x30, 0x0C, 0x0C, 0x81, 0xFF, 0xFF}};
+  static constexpr CAN_classic_frame BMW_3D0 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 2,
+                                                .ID = 0x3D0,
+                                                .data = {0xFD, 0xFF}};
+  static constexpr CAN_classic_frame BMW_3E4 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 6,
+                                                .ID = 0x3E4,
+                                                .data = {0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF}};
+  CAN_classic_frame BMW_3E5 = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x3E5, .data = {0xFC, 0xFF, 0xFF}};
+  CAN_classic_frame BMW_3E8 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 2,
+                               .ID = 0x3E8,
+                               .data = {0xF0, 0xFF}};  //1000ms OBD reset
+  CAN_classic_frame BMW_3EC = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x3EC,
+                               .data = {0xF5, 0x10, 0x00, 0x00, 0x80, 0x25, 0x0F, 0xFC}};
+  CAN_classic_frame BMW_3F9 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x3F9,
+                               .data = {0xA7, 0x2A, 0x00, 0xE2, 0xA6, 0x30, 0xC3, 0xFF}};
+  static constexpr CAN_classic_frame BMW_3FB = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 6,
+                                                .ID = 0x3FB,
+                                                .data = {0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00}};
+  CAN_classic_frame BMW_3FC = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x3FC, .data = {0xC0, 0xF9, 0x0F}};
+  static constexpr CAN_classic_frame BMW_418 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 8,
+                                                .ID = 0x418,
+                                                .data = {0xFF, 0x7C, 0xFF, 0x00, 0xC0, 0x3F, 0xFF, 0xFF}};
+  static constexpr CAN_classic_frame BMW_41D = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 4,
+                                                .ID = 0x41D,
+                                                .data = {0xFF, 0xF7, 0x7F, 0xFF}};
+  CAN_classic_frame BMW_433 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 4,
+                               .ID = 0x433,
+                               .data = {0xFF, 0x00, 0x0F, 0xFF}};  // HV specification
+  static constexpr CAN_classic_frame BMW_512 = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x512,
       .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12}};  // 0x512 Network management
-  static constexpr CAN_frame BMW_592_0 = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 8,
-                                          .ID = 0x592,
-                                          .data = {0x86, 0x10, 0x07, 0x21, 0x6e, 0x35, 0x5e, 0x86}};
-  static constexpr CAN_frame BMW_592_1 = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 8,
-                                          .ID = 0x592,
-                                          .data = {0x86, 0x21, 0xb4, 0xdd, 0x00, 0x00, 0x00, 0x00}};
-  static constexpr CAN_frame BMW_5F8 = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 8,
-                                        .ID = 0x5F8,
-                                        .data = {0x64, 0x01, 0x00, 0x0B, 0x92, 0x03, 0x00, 0x05}};
-  static constexpr CAN_frame BMW_6F1_CELL = {.FD = false,
-                                             .ext_ID = false,
-                                             .DLC = 5,
-                                             .ID = 0x6F1,
-                                             .data = {0x07, 0x03, 0x22, 0xDD, 0xBF}};
-  static constexpr CAN_frame BMW_6F1_SOH = {.FD = false,
-                                            .ext_ID = false,
-                                            .DLC = 5,
-                                            .ID = 0x6F1,
-                                            .data = {0x07, 0x03, 0x22, 0x63, 0x35}};
-  static constexpr CAN_frame BMW_6F1_SOC = {.FD = false,
-                                            .ext_ID = false,
-                                            .DLC = 5,
-                                            .ID = 0x6F1,
-                                            .data = {0x07, 0x03, 0x22, 0xDD, 0xBC}};
-  static constexpr CAN_frame BMW_6F1_CELL_VOLTAGE_AVG = {.FD = false,
+  static constexpr CAN_classic_frame BMW_592_0 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 8,
+                                                  .ID = 0x592,
+                                                  .data = {0x86, 0x10, 0x07, 0x21, 0x6e, 0x35, 0x5e, 0x86}};
+  static constexpr CAN_classic_frame BMW_592_1 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 8,
+                                                  .ID = 0x592,
+                                                  .data = {0x86, 0x21, 0xb4, 0xdd, 0x00, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame BMW_5F8 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 8,
+                                                .ID = 0x5F8,
+                                                .data = {0x64, 0x01, 0x00, 0x0B, 0x92, 0x03, 0x00, 0x05}};
+  static constexpr CAN_classic_frame BMW_6F1_CELL = {.FD = false,
+                                                     .ext_ID = false,
+                                                     .DLC = 5,
+                                                     .ID = 0x6F1,
+                                                     .data = {0x07, 0x03, 0x22, 0xDD, 0xBF}};
+  static constexpr CAN_classic_frame BMW_6F1_SOH = {.FD = false,
+                                                    .ext_ID = false,
+                                                    .DLC = 5,
+                                                    .ID = 0x6F1,
+                                                    .data = {0x07, 0x03, 0x22, 0x63, 0x35}};
+  static constexpr CAN_classic_frame BMW_6F1_SOC = {.FD = false,
+                                                    .ext_ID = false,
+                                                    .DLC = 5,
+                                                    .ID = 0x6F1,
+                                                    .data = {0x07, 0x03, 0x22, 0xDD, 0xBC}};
+  static constexpr CAN_classic_frame BMW_6F1_CELL_VOLTAGE_AVG = {.FD = false,
+                                                                 .ext_ID = false,
+                                                                 .DLC = 5,
+                                                                 .ID = 0x6F1,
+                                                                 .data = {0x07, 0x03, 0x22, 0xDF, 0xA0}};
+  static constexpr CAN_classic_frame BMW_6F1_CONTINUE = {.FD = false,
                                                          .ext_ID = false,
-                                                         .DLC = 5,
+                                                         .DLC = 4,
                                                          .ID = 0x6F1,
-                                                         .data = {0x07, 0x03, 0x22, 0xDF, 0xA0}};
-  static constexpr CAN_frame BMW_6F1_CONTINUE = {.FD = false,
-                                                 .ext_ID = false,
-                                                 .DLC = 4,
-                                                 .ID = 0x6F1,
-                                                 .data = {0x07, 0x30, 0x00, 0x02}};
-  static constexpr CAN_frame BMW_6F1_CLEAR_DTC = {.FD = false,
-                                                  .ext_ID = false,
-                                                  .DLC = 6,
-                                                  .ID = 0x6F1,
-                                                  .data = {0xDF, 0x04, 0x14, 0xFF, 0xFF, 0xFF}};
-  CAN_frame BMW_6F4_CELL_VOLTAGE_CELLNO = {.FD = false,
-                                           .ext_ID = false,
-                                           .DLC = 7,
-                                           .ID = 0x6F4,
-                                           .data = {0x07, 0x05, 0x31, 0x01, 0xAD, 0x6E, 0x01}};
-  static constexpr CAN_frame BMW_6F4_CELL_CONTINUE = {.FD = false,
-                                                      .ext_ID = false,
-                                                      .DLC = 6,
-                                                      .ID = 0x6F4,
-                                                      .data = {0x07, 0x04, 0x31, 0x03, 0xAD, 0x6E}};
+                                                         .data = {0x07, 0x30, 0x00, 0x02}};
+  static constexpr CAN_classic_frame BMW_6F1_CLEAR_DTC = {.FD = false,
+                                                          .ext_ID = false,
+                                                          .DLC = 6,
+                                                          .ID = 0x6F1,
+                                                          .data = {0xDF, 0x04, 0x14, 0xFF, 0xFF, 0xFF}};
+  CAN_classic_frame BMW_6F4_CELL_VOLTAGE_CELLNO = {.FD = false,
+                                                   .ext_ID = false,
+                                                   .DLC = 7,
+                                                   .ID = 0x6F4,
+                                                   .data = {0x07, 0x05, 0x31, 0x01, 0xAD, 0x6E, 0x01}};
+  static constexpr CAN_classic_frame BMW_6F4_CELL_CONTINUE = {.FD = false,
+                                                              .ext_ID = false,
+                                                              .DLC = 6,
+                                                              .ID = 0x6F4,
+                                                              .data = {0x07, 0x04, 0x31, 0x03, 0xAD, 0x6E}};
 
   //The above CAN messages need to be sent towards the battery to keep it alive
 
@@ -6,7 +6,7 @@
 class BmwPhevBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
 
@@ -45,7 +45,7 @@ class BmwPhevBattery : public CanBattery {
   void processCellVoltages();
   void wake_battery_via_canbus();
   uint8_t increment_alive_counter(uint8_t counter);
-  const char* getUDSRequestName(CAN_frame* frame);
+  const char* getUDSRequestName(CAN_classic_frame* frame);
 
   unsigned long previousMillis20 = 0;     // will store last time a 20ms CAN Message was send
   unsigned long previousMillis100 = 0;    // will store last time a 100ms CAN Message was send
@@ -78,7 +78,7 @@ class BmwPhevBattery : public CanBattery {
 
   //Vehicle CAN START
 
-  CAN_frame BMWiX_0C0 = {
+  CAN_classic_frame BMWiX_0C0 = {
       .FD = false,
       .ext_ID = false,
       .DLC = 2,
@@ -87,15 +87,15 @@ class BmwPhevBattery : public CanBattery {
           0xF0,
           0x08}};  // Keep Alive 2 BDC>SME  200ms First byte cycles F0 > FE  second byte 08 - MINIMUM ID TO KEEP SME AWAKE
 
-  CAN_frame BMW_13E = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x13E,
-                       .data = {0xFF, 0x31, 0xFA, 0xFA, 0xFA, 0xFA, 0x0C, 0x00}};
+  CAN_classic_frame BMW_13E = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x13E,
+                               .data = {0xFF, 0x31, 0xFA, 0xFA, 0xFA, 0xFA, 0x0C, 0x00}};
 
   uint8_t alive_counter_100ms = 0;
 
-  CAN_frame BMW_12F = {
+  CAN_classic_frame BMW_12F = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
@@ -106,7 +106,7 @@ class BmwPhevBattery : public CanBattery {
 
   //Request Data CAN START
 
-  CAN_frame BMW_PHEV_BUS_WAKEUP_REQUEST = {
+  CAN_classic_frame BMW_PHEV_BUS_WAKEUP_REQUEST = {
       .FD = false,
       .ext_ID = false,
       .DLC = 4,
@@ -115,25 +115,25 @@ class BmwPhevBattery : public CanBattery {
           0x5A, 0xA5, 0x5A,
           0xA5}};  // Won't work at 500kbps! Ideally sent at 50kbps - but can also achieve wakeup at 100kbps (helps with library support but might not be as reliable). Might need to be sent twice + clear buffer
 
-  CAN_frame BMWPHEV_6F1_REQUEST_SOC = {.FD = false,
-                                       .ext_ID = false,
-                                       .DLC = 5,
-                                       .ID = 0x6F1,
-                                       .data = {0x07, 0x03, 0x22, 0xDD, 0xC4}};  //  SOC%
-
-  CAN_frame BMWPHEV_6F1_REQUEST_SOH = {.FD = false,
-                                       .ext_ID = false,
-                                       .DLC = 5,
-                                       .ID = 0x6F1,
-                                       .data = {0x07, 0x03, 0x22, 0xDD, 0x7B}};  //  SOH%
-
-  CAN_frame BMWPHEV_6F1_REQUEST_CURRENT = {.FD = false,
-                                           .ext_ID = false,
-                                           .DLC = 5,
-                                           .ID = 0x6F1,
-                                           .data = {0x07, 0x03, 0x22, 0xDD, 0x69}};  //  SOH%
-
-  CAN_frame BMWPHEV_6F1_REQUEST_VOLTAGE_LIMITS = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_SOC = {.FD = false,
+                                               .ext_ID = false,
+                                               .DLC = 5,
+                                               .ID = 0x6F1,
+                                               .data = {0x07, 0x03, 0x22, 0xDD, 0xC4}};  //  SOC%
+
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_SOH = {.FD = false,
+                                               .ext_ID = false,
+                                               .DLC = 5,
+                                               .ID = 0x6F1,
+                                               .data = {0x07, 0x03, 0x22, 0xDD, 0x7B}};  //  SOH%
+
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_CURRENT = {.FD = false,
+                                                   .ext_ID = false,
+                                                   .DLC = 5,
+                                                   .ID = 0x6F1,
+                                                   .data = {0x07, 0x03, 0x22, 0xDD, 0x69}};  //  SOH%
+
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_VOLTAGE_LIMITS = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
@@ -141,26 +141,26 @@ class BmwPhevBattery : public CanBattery {
       .data = {0x07, 0x03, 0x22, 0xDD, 0x7E}};  //  Pack Voltage Limits  Multi Frame
 
   // UDS $19 ReadDTC Request (Report DTC by status mask - all DTCs)
-  CAN_frame BMWPHEV_6F1_REQUEST_READ_DTC = {.FD = false,
-                                            .ext_ID = false,
-                                            .DLC = 8,
-                                            .ID = 0x6F1,
-                                            .data = {0x07, 0x03, 0x19, 0x02, 0x0C, 0x00, 0x00, 0x00}};
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_READ_DTC = {.FD = false,
+                                                    .ext_ID = false,
+                                                    .DLC = 8,
+                                                    .ID = 0x6F1,
+                                                    .data = {0x07, 0x03, 0x19, 0x02, 0x0C, 0x00, 0x00, 0x00}};
 
   // UDS $14 ClearDTC Request (Clear all DTCs)
-  CAN_frame BMWPHEV_6F1_REQUEST_CLEAR_DTC = {.FD = false,
-                                             .ext_ID = false,
-                                             .DLC = 8,
-                                             .ID = 0x6F1,
-                                             .data = {0x07, 0x04, 0x14, 0xFF, 0xFF, 0xFF, 0x00, 0x00}};
-
-  CAN_frame BMWPHEV_6F1_REQUEST_PAIRED_VIN = {.FD = false,
-                                              .ext_ID = false,
-                                              .DLC = 5,
-                                              .ID = 0x6F1,
-                                              .data = {0x07, 0x03, 0x22, 0xF1, 0x90}};  //  SME Paired VIN
-
-  CAN_frame BMWPHEV_6F1_REQUEST_ISO_READING1 = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_CLEAR_DTC = {.FD = false,
+                                                     .ext_ID = false,
+                                                     .DLC = 8,
+                                                     .ID = 0x6F1,
+                                                     .data = {0x07, 0x04, 0x14, 0xFF, 0xFF, 0xFF, 0x00, 0x00}};
+
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_PAIRED_VIN = {.FD = false,
+                                                      .ext_ID = false,
+                                                      .DLC = 5,
+                                                      .ID = 0x6F1,
+                                                      .data = {0x07, 0x03, 0x22, 0xF1, 0x90}};  //  SME Paired VIN
+
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_ISO_READING1 = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
@@ -169,7 +169,7 @@ class BmwPhevBattery : public CanBattery {
           0x07, 0x03, 0x22, 0xDD,
           0x6A}};  // MULTI FRAME ISOLATIONSWIDERSTAND 62 DD 6A [07 D0] [07 D0] [07 D0] [01] [01] [01] 00 00 00 00 00   [EXT Reading] [INT reading] [ EXT - 0 not plausible, 1 plausible]
 
-  CAN_frame BMWPHEV_6F1_REQUEST_ISO_READING2 = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_ISO_READING2 = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
@@ -177,49 +177,49 @@ class BmwPhevBattery : public CanBattery {
       .data = {0x07, 0x03, 0x22, 0xD6,
                0xD9}};  //  R_ISO_ROH 62 D6 D9 [07 FF] [13] (2047kohm) quality of reading 0-21 (19)
 
-  CAN_frame BMWPHEV_6F1_REQUEST_PACK_INFO = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_PACK_INFO = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
       .ID = 0x6F1,
       .data = {0x07, 0x03, 0x22, 0xDF, 0x71}};  //   62 DF 71 00 60 1C 25 1C? Cell Count, Module Count
 
-  CAN_frame BMWPHEV_6F1_REQUEST_CURRENT_LIMITS = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_CURRENT_LIMITS = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
       .ID = 0x6F1,
       .data = {0x07, 0x03, 0x22, 0xDD, 0x7D}};  //  Pack Current Limits  Multi Frame
 
-  CAN_frame BMWPHEV_6F1_REQUEST_MAINVOLTAGE_PRECONTACTOR = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_MAINVOLTAGE_PRECONTACTOR = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
       .ID = 0x6F1,
       .data = {0x07, 0x03, 0x22, 0xDD, 0xB4}};  //Main Battery Voltage (Pre Contactor)
 
-  CAN_frame BMWPHEV_6F1_REQUEST_MAINVOLTAGE_POSTCONTACTOR = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_MAINVOLTAGE_POSTCONTACTOR = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
       .ID = 0x6F1,
       .data = {0x07, 0x03, 0x22, 0xDD, 0x66}};  //Main Battery Voltage (After Contactor)
 
-  CAN_frame BMWPHEV_6F1_REQUEST_CELLSUMMARY = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_CELLSUMMARY = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
       .ID = 0x6F1,
       .data = {0x07, 0x03, 0x22, 0xDF, 0xA0}};  //Min and max cell voltage + temps   6.55V = Qualifier Invalid?
 
-  CAN_frame BMWPHEV_6F1_REQUEST_CELLS_INDIVIDUAL_VOLTS = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_CELLS_INDIVIDUAL_VOLTS = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
       .ID = 0x6F1,
       .data = {0x07, 0x03, 0x22, 0xDF, 0xA5}};  //All individual cell voltages
 
-  CAN_frame BMWPHEV_6F1_REQUEST_CELL_TEMP = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_CELL_TEMP = {
       .FD = false,
       .ext_ID = false,
       .DLC = 5,
@@ -228,7 +228,7 @@ class BmwPhevBattery : public CanBattery {
           0x07, 0x03, 0x22, 0xDD,
           0xC0}};  // UDS Request Cell Temperatures min max avg. Has continue frame min in first, then max + avg in second frame
 
-  CAN_frame BMW_6F1_REQUEST_CONTINUE_MULTIFRAME = {
+  CAN_classic_frame BMW_6F1_REQUEST_CONTINUE_MULTIFRAME = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
@@ -237,26 +237,26 @@ class BmwPhevBattery : public CanBattery {
           0x07, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00,
           0x00}};  //Request continued frames from UDS Multiframe request  byte[2] is the request messages to return per continue. default 0x03, all is 0x00
 
-  CAN_frame BMW_6F1_REQUEST_HARD_RESET = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 4,
-                                          .ID = 0x6F1,
-                                          .data = {0x07, 0x03, 0x11, 0x01}};  // Reset BMS - TBC
+  CAN_classic_frame BMW_6F1_REQUEST_HARD_RESET = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 4,
+                                                  .ID = 0x6F1,
+                                                  .data = {0x07, 0x03, 0x11, 0x01}};  // Reset BMS - TBC
 
-  CAN_frame BMWPHEV_6F1_REQUEST_CONTACTORS_CLOSE = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_CONTACTORS_CLOSE = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x6F1,
       .data = {0x07, 0x04, 0x2E, 0xDD, 0x61, 0x01, 0x00, 0x00}};  // Request Contactors Close - Unconfirmed
-  CAN_frame BMWPHEV_6F1_REQUEST_CONTACTORS_OPEN = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_CONTACTORS_OPEN = {
       .FD = false,
       .ext_ID = false,
       .DLC = 6,
       .ID = 0x6F1,
       .data = {0x07, 0x04, 0x2E, 0xDD, 0x61, 0x00, 0x00, 0x00}};  // Request Contactors Open - Unconfirmed
 
-  CAN_frame BMWPHEV_6F1_REQUEST_BALANCING_STATUS = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_BALANCING_STATUS = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
@@ -264,21 +264,21 @@ class BmwPhevBattery : public CanBattery {
       .data = {0x07, 0x04, 0x31, 0x03, 0xAD, 0x6B, 0x00,
                0x00}};  // Balancing status.  Response 7DLC F1 05 71 03 AD 6B 01   (01 = active)  (03 not active)
 
-  CAN_frame BMWPHEV_6F1_REQUEST_ISOLATION_TEST = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_ISOLATION_TEST = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x6F1,
       .data = {0x07, 0x04, 0x31, 0x01, 0xAD, 0x61, 0x00, 0x00}};  // Start Isolation Test
 
-  CAN_frame BMWPHEV_6F1_REQUEST_BALANCING_START = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_BALANCING_START = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x6F1,
       .data = {0x07, 0x04, 0x31, 0x01, 0xAD, 0x6B, 0x00, 0x00}};  // Balancing start request
 
-  CAN_frame BMWPHEV_6F1_REQUEST_BALANCING_STOP = {
+  CAN_classic_frame BMWPHEV_6F1_REQUEST_BALANCING_STOP = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
@@ -286,43 +286,45 @@ class BmwPhevBattery : public CanBattery {
       .data = {0x07, 0x04, 0x31, 0x02, 0xAD, 0x6B, 0x00, 0x00}};  // Balancing stop request
 
   //Action Requests:
-  CAN_frame BMW_10B = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 3,
-                       .ID = 0x10B,
-                       .data = {0xCD, 0x00, 0xFC}};  // Contactor closing command?
-
-  CAN_frame BMWPHEV_6F1_CELL_SOC = {.FD = false,
-                                    .ext_ID = false,
-                                    .DLC = 5,
-                                    .ID = 0x6F1,
-                                    .data = {0x07, 0x03, 0x22, 0xE5, 0x9A}};
-  CAN_frame BMWPHEV_6F1_CELL_TEMP = {.FD = false,
-                                     .ext_ID = false,
-                                     .DLC = 5,
-                                     .ID = 0x6F1,
-                                     .data = {0x07, 0x03, 0x22, 0xE5, 0xCA}};
+  CAN_classic_frame BMW_10B = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 3,
+                               .ID = 0x10B,
+                               .data = {0xCD, 0x00, 0xFC}};  // Contactor closing command?
+
+  CAN_classic_frame BMWPHEV_6F1_CELL_SOC = {.FD = false,
+                                            .ext_ID = false,
+                                            .DLC = 5,
+                                            .ID = 0x6F1,
+                                            .data = {0x07, 0x03, 0x22, 0xE5, 0x9A}};
+  CAN_classic_frame BMWPHEV_6F1_CELL_TEMP = {.FD = false,
+                                             .ext_ID = false,
+                                             .DLC = 5,
+                                             .ID = 0x6F1,
+                                             .data = {0x07, 0x03, 0x22, 0xE5, 0xCA}};
   //Request Data CAN End
 
   bool battery_awake = false;
 
   //Setup Fast UDS values to poll for
-  CAN_frame* UDS_REQUESTS_FAST[5] = {&BMWPHEV_6F1_REQUEST_CELLSUMMARY, &BMWPHEV_6F1_REQUEST_SOC,
-                                     &BMWPHEV_6F1_REQUEST_VOLTAGE_LIMITS, &BMWPHEV_6F1_REQUEST_MAINVOLTAGE_PRECONTACTOR,
-                                     &BMWPHEV_6F1_REQUEST_MAINVOLTAGE_POSTCONTACTOR};
+  CAN_classic_frame* UDS_REQUESTS_FAST[5] = {&BMWPHEV_6F1_REQUEST_CELLSUMMARY,
+                                             &BMWPHEV_6F1_REQUEST_SOC,
+                                             &BMWPHEV_6F1_REQUEST_VOLTAGE_LIMITS,
+                                             &BMWPHEV_6F1_REQUEST_MAINVOLTAGE_PRECONTACTOR,
+                                             &BMWPHEV_6F1_REQUEST_MAINVOLTAGE_POSTCONTACTOR};
   int numFastUDSreqs =
       sizeof(UDS_REQUESTS_FAST) / sizeof(UDS_REQUESTS_FAST[0]);  //Store Number of elements in the array
 
   //Setup Slow UDS values to poll for
-  CAN_frame* UDS_REQUESTS_SLOW[9] = {&BMWPHEV_6F1_REQUEST_ISO_READING1,
-                                     &BMWPHEV_6F1_REQUEST_ISO_READING2,
-                                     &BMWPHEV_6F1_REQUEST_CURRENT_LIMITS,
-                                     &BMWPHEV_6F1_REQUEST_SOH,
-                                     &BMWPHEV_6F1_REQUEST_CELLS_INDIVIDUAL_VOLTS,
-                                     &BMWPHEV_6F1_REQUEST_CELL_TEMP,
-                                     &BMWPHEV_6F1_REQUEST_BALANCING_STATUS,
-                                     &BMWPHEV_6F1_REQUEST_PAIRED_VIN,
-                                     &BMWPHEV_6F1_REQUEST_READ_DTC};
+  CAN_classic_frame* UDS_REQUESTS_SLOW[9] = {&BMWPHEV_6F1_REQUEST_ISO_READING1,
+                                             &BMWPHEV_6F1_REQUEST_ISO_READING2,
+                                             &BMWPHEV_6F1_REQUEST_CURRENT_LIMITS,
+                                             &BMWPHEV_6F1_REQUEST_SOH,
+                                             &BMWPHEV_6F1_REQUEST_CELLS_INDIVIDUAL_VOLTS,
+                                             &BMWPHEV_6F1_REQUEST_CELL_TEMP,
+                                             &BMWPHEV_6F1_REQUEST_BALANCING_STATUS,
+                                             &BMWPHEV_6F1_REQUEST_PAIRED_VIN,
+                                             &BMWPHEV_6F1_REQUEST_READ_DTC};
   int numSlowUDSreqs =
       sizeof(UDS_REQUESTS_SLOW) / sizeof(UDS_REQUESTS_SLOW[0]);  // Store Number of elements in the array
 
@@ -11,7 +11,7 @@ class BmwSbox : public CanShunt {
  public:
   void setup();
   void transmit_can(unsigned long currentMillis);
-  void handle_incoming_can_frame(CAN_frame rx_frame);
+  void handle_incoming_can_frame(const CAN_frame& rx_frame);
   static constexpr const char* Name = "BMW SBOX";
 
  private:
@@ -51,18 +51,18 @@ class BmwSbox : public CanShunt {
 
   uint8_t CAN100_cnt = 0;
 
-  CAN_frame SBOX_100 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 4,
-                        .ID = 0x100,
-                        .data = {0x55, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-                                 0x00}};  // Byte 0: relay control, Byte 1: counter 0-E, Byte 4: CRC
-
-  CAN_frame SBOX_300 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 4,
-                        .ID = 0x300,
-                        .data = {0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00}};  // Static frame
+  CAN_classic_frame SBOX_100 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 4,
+                                .ID = 0x100,
+                                .data = {0x55, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+                                         0x00}};  // Byte 0: relay control, Byte 1: counter 0-E, Byte 4: CRC
+
+  CAN_classic_frame SBOX_300 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 4,
+                                .ID = 0x300,
+                                .data = {0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00}};  // Static frame
 };
 
 #endif
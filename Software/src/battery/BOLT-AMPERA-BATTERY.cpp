@@ -150,7 +150,7 @@ void BoltAmperaBattery::update_values() {  //This function maps all the values f
   datalayer_extended.boltampera.battery_current_7E4 = battery_current_7E4;
 }
 
-void BoltAmperaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void BoltAmperaBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   uint8_t cellbank_mux = 0;
   uint8_t cellblock_index = 0;
   switch (rx_frame.ID) {
@@ -6,7 +6,7 @@
 class BoltAmperaBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
 
@@ -169,31 +169,31 @@ class BoltAmperaBattery : public CanBattery {
   unsigned long previousMillis100ms = 0;  // will store last time a 100ms CAN Message was send
   unsigned long previousMillis120ms = 0;  // will store last time a 120ms CAN Message was send
 
-  CAN_frame BOLT_778 = {.FD = false,  // Unsure of what this message is, added only as example
-                        .ext_ID = false,
-                        .DLC = 7,
-                        .ID = 0x778,
-                        .data = {0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame BOLT_POLL_7E4 = {.FD = false,  // VICM_HV poll
-                             .ext_ID = false,
-                             .DLC = 8,
-                             .ID = 0x7E4,
-                             .data = {0x03, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame BOLT_ACK_7E4 = {.FD = false,  //VICM_HV ack
-                            .ext_ID = false,
-                            .DLC = 8,
-                            .ID = 0x7E4,
-                            .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame BOLT_POLL_7E7 = {.FD = false,  //VITM_HV poll
-                             .ext_ID = false,
-                             .DLC = 8,
-                             .ID = 0x7E7,
-                             .data = {0x03, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame BOLT_ACK_7E7 = {.FD = false,  //VITM_HV ack
-                            .ext_ID = false,
-                            .DLC = 8,
-                            .ID = 0x7E7,
-                            .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame BOLT_778 = {.FD = false,  // Unsure of what this message is, added only as example
+                                .ext_ID = false,
+                                .DLC = 7,
+                                .ID = 0x778,
+                                .data = {0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame BOLT_POLL_7E4 = {.FD = false,  // VICM_HV poll
+                                     .ext_ID = false,
+                                     .DLC = 8,
+                                     .ID = 0x7E4,
+                                     .data = {0x03, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame BOLT_ACK_7E4 = {.FD = false,  //VICM_HV ack
+                                    .ext_ID = false,
+                                    .DLC = 8,
+                                    .ID = 0x7E4,
+                                    .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame BOLT_POLL_7E7 = {.FD = false,  //VITM_HV poll
+                                     .ext_ID = false,
+                                     .DLC = 8,
+                                     .ID = 0x7E7,
+                                     .data = {0x03, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame BOLT_ACK_7E7 = {.FD = false,  //VITM_HV ack
+                                    .ext_ID = false,
+                                    .DLC = 8,
+                                    .ID = 0x7E7,
+                                    .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // Other PID requests in the vehicle
   // All HV ECUs - 0x101
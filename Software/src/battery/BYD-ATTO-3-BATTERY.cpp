@@ -316,7 +316,14 @@ void BydAttoBattery::
   }
 }
 
-void BydAttoBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void BydAttoBattery::declare_can_ids(CanIdSet& ids) {
+  for (uint32_t id : {0x244, 0x245, 0x286, 0x334, 0x338, 0x344, 0x345, 0x347, 0x34A, 0x35E, 0x360, 0x36C,
+                      0x438, 0x43A, 0x43B, 0x43C, 0x43D, 0x444, 0x445, 0x446, 0x447, 0x47B, 0x524, 0x7EF}) {
+    ids.add_id(id);
+  }
+}
+
+void BydAttoBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x244:
       datalayer_battery->status.CAN_battery_still_alive = CAN_STILL_ALIVE;
@@ -43,7 +43,8 @@ class BydAttoBattery : public CanBattery {
   }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
+  virtual void declare_can_ids(CanIdSet& ids);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
 
@@ -141,31 +142,31 @@ class BydAttoBattery : public CanBattery {
   int16_t battery_daughterboard_temperatures[10];
   uint16_t battery_cellvoltages[CELLCOUNT_EXTENDED] = {0};
 
-  CAN_frame ATTO_3_12D = {.FD = false,
-                          .ext_ID = false,
-                          .DLC = 8,
-                          .ID = 0x12D,
-                          .data = {0xA0, 0x28, 0x02, 0xA0, 0x0C, 0x71, 0xCF, 0x49}};
-  CAN_frame ATTO_3_441 = {.FD = false,
-                          .ext_ID = false,
-                          .DLC = 8,
-                          .ID = 0x441,
-                          .data = {0x98, 0x3A, 0x88, 0x13, 0x07, 0x00, 0xFF, 0x8C}};
-  CAN_frame ATTO_3_7E7_POLL = {.FD = false,
-                               .ext_ID = false,
-                               .DLC = 8,
-                               .ID = 0x7E7,  //Poll PID 03 22 00 05 (POLL_FOR_BATTERY_SOC)
-                               .data = {0x03, 0x22, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ATTO_3_7E7_ACK = {.FD = false,
-                              .ext_ID = false,
-                              .DLC = 8,
-                              .ID = 0x7E7,  //ACK frame for long PIDs
-                              .data = {0x30, 0x08, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ATTO_3_7E7_CLEAR_CRASH = {.FD = false,
+  CAN_classic_frame ATTO_3_12D = {.FD = false,
+                                  .ext_ID = false,
+                                  .DLC = 8,
+                                  .ID = 0x12D,
+                                  .data = {0xA0, 0x28, 0x02, 0xA0, 0x0C, 0x71, 0xCF, 0x49}};
+  CAN_classic_frame ATTO_3_441 = {.FD = false,
+                                  .ext_ID = false,
+                                  .DLC = 8,
+                                  .ID = 0x441,
+                                  .data = {0x98, 0x3A, 0x88, 0x13, 0x07, 0x00, 0xFF, 0x8C}};
+  CAN_classic_frame ATTO_3_7E7_POLL = {.FD = false,
+                                       .ext_ID = false,
+                                       .DLC = 8,
+                                       .ID = 0x7E7,  //Poll PID 03 22 00 05 (POLL_FOR_BATTERY_SOC)
+                                       .data = {0x03, 0x22, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ATTO_3_7E7_ACK = {.FD = false,
                                       .ext_ID = false,
                                       .DLC = 8,
-                                      .ID = 0x7E7,
-                                      .data = {0x02, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}};
+                                      .ID = 0x7E7,  //ACK frame for long PIDs
+                                      .data = {0x30, 0x08, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ATTO_3_7E7_CLEAR_CRASH = {.FD = false,
+                                              .ext_ID = false,
+                                              .DLC = 8,
+                                              .ID = 0x7E7,
+                                              .data = {0x02, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}};
 };
 
 #endif
@@ -112,7 +112,7 @@ void CellPowerBms::update_values() {
   }
 }
 
-void CellPowerBms::handle_incoming_can_frame(CAN_frame rx_frame) {
+void CellPowerBms::handle_incoming_can_frame(const CAN_frame& rx_frame) {
 
   switch (rx_frame.ID) {
     case 0x1A4:  //PDO1_TX - 200ms
@@ -8,7 +8,7 @@ class CellPowerBms : public CanBattery {
   CellPowerBms() : CanBattery(CAN_Speed::CAN_SPEED_250KBPS) {}
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
 
@@ -23,26 +23,26 @@ class CellPowerBms : public CanBattery {
 
   /*Actual content messages
   // Optional add-on charger module. Might not be needed to send these towards the BMS to keep it happy.
-  CAN_frame CELLPOWER_18FF50E9 = {.FD = false,
-                                  .ext_ID = true,
-                                  .DLC = 5,
-                                  .ID = 0x18FF50E9,
-                                  .data = {0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame CELLPOWER_18FF50E8 = {.FD = false,
-                                  .ext_ID = true,
-                                  .DLC = 5,
-                                  .ID = 0x18FF50E8,
-                                  .data = {0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame CELLPOWER_18FF50E7 = {.FD = false,
-                                  .ext_ID = true,
-                                  .DLC = 5,
-                                  .ID = 0x18FF50E7,
-                                  .data = {0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame CELLPOWER_18FF50E5 = {.FD = false,
-                                  .ext_ID = true,
-                                  .DLC = 5,
-                                  .ID = 0x18FF50E5,
-                                  .data = {0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CELLPOWER_18FF50E9 = {.FD = false,
+                                          .ext_ID = true,
+                                          .DLC = 5,
+                                          .ID = 0x18FF50E9,
+                                          .data = {0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CELLPOWER_18FF50E8 = {.FD = false,
+                                          .ext_ID = true,
+                                          .DLC = 5,
+                                          .ID = 0x18FF50E8,
+                                          .data = {0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CELLPOWER_18FF50E7 = {.FD = false,
+                                          .ext_ID = true,
+                                          .DLC = 5,
+                                          .ID = 0x18FF50E7,
+                                          .data = {0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CELLPOWER_18FF50E5 = {.FD = false,
+                                          .ext_ID = true,
+                                          .DLC = 5,
+                                          .ID = 0x18FF50E5,
+                                          .data = {0x00, 0x00, 0x00, 0x00, 0x00}};
   */
   bool system_state_discharge = false;
   bool system_state_charge = false;
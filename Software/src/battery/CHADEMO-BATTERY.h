@@ -22,7 +22,7 @@ class ChademoBattery : public CanBattery {
   }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
 
@@ -39,18 +39,18 @@ class ChademoBattery : public CanBattery {
   gpio_num_t pin2, pin10, pin4, pin7, pin_lock, precharge, positive_contactor;
   ChademoBatteryHtmlRenderer renderer;
 
-  void process_vehicle_charging_minimums(CAN_frame rx_frame);
-  void process_vehicle_charging_maximums(CAN_frame rx_frame);
-  void process_vehicle_charging_session(CAN_frame rx_frame);
-  void process_vehicle_charging_limits(CAN_frame rx_frame);
-  void process_vehicle_discharge_estimate(CAN_frame rx_frame);
-  void process_vehicle_dynamic_control(CAN_frame rx_frame);
-  void process_vehicle_vendor_ID(CAN_frame rx_frame);
+  void process_vehicle_charging_minimums(const CAN_frame& rx_frame);
+  void process_vehicle_charging_maximums(const CAN_frame& rx_frame);
+  void process_vehicle_charging_session(const CAN_frame& rx_frame);
+  void process_vehicle_charging_limits(const CAN_frame& rx_frame);
+  void process_vehicle_discharge_estimate(const CAN_frame& rx_frame);
+  void process_vehicle_dynamic_control(const CAN_frame& rx_frame);
+  void process_vehicle_vendor_ID(const CAN_frame& rx_frame);
   void evse_init();
-  void update_evse_capabilities(CAN_frame& f);
-  void update_evse_status(CAN_frame& f);
-  void update_evse_discharge_estimate(CAN_frame& f);
-  void update_evse_discharge_capabilities(CAN_frame& f);
+  void update_evse_capabilities(CAN_classic_frame& f);
+  void update_evse_status(CAN_classic_frame& f);
+  void update_evse_discharge_estimate(CAN_classic_frame& f);
+  void update_evse_discharge_capabilities(CAN_classic_frame& f);
   void handle_chademo_sequence();
 
   static const int MAX_EVSE_POWER_CHARGING = 3300;
@@ -336,22 +336,22 @@ uint8_t CHADEMO_seq = 0x0;
   struct x118_EVSE_Dynamic_Control x118_evse_dyn;
   struct x208_EVSE_Discharge_Capability x208_evse_dischg_cap;
 
-  CAN_frame CHADEMO_108 = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x108,
-                           .data = {0x01, 0xF4, 0x01, 0x0F, 0xB3, 0x01, 0x00, 0x00}};
-  CAN_frame CHADEMO_109 = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x109,
-                           .data = {0x02, 0x00, 0x00, 0x00, 0x01, 0x20, 0xFF, 0xFF}};
+  CAN_classic_frame CHADEMO_108 = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x108,
+                                   .data = {0x01, 0xF4, 0x01, 0x0F, 0xB3, 0x01, 0x00, 0x00}};
+  CAN_classic_frame CHADEMO_109 = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x109,
+                                   .data = {0x02, 0x00, 0x00, 0x00, 0x01, 0x20, 0xFF, 0xFF}};
   //For chademo v2.0 only
-  CAN_frame CHADEMO_118 = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x118,
-                           .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CHADEMO_118 = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x118,
+                                   .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // OLD value from skeleton implementation, indicates dynamic control is possible.
   // Hardcode above as being incompatible for simplicity in current incarnation.
@@ -359,16 +359,16 @@ uint8_t CHADEMO_seq = 0x0;
 
   //    0x200 : From vehicle-side. A V2X-ready vehicle will send this message to broadcast its “Maximum discharger current”. (It is a similar logic to the limits set in 0x100 or 0x102 during a DC charging session)
   //    0x208 : From EVSE-side. A V2X EVSE will use this to send the “present discharger current” during the session, and the “available input current”. (uses similar logic to 0x108 and 0x109 during a DC charging session)
-  CAN_frame CHADEMO_208 = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x208,
-                           .data = {0xFF, 0xF4, 0x01, 0xF0, 0x00, 0x00, 0xFA, 0x00}};
-  CAN_frame CHADEMO_209 = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x209,
-                           .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CHADEMO_208 = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x208,
+                                   .data = {0xFF, 0xF4, 0x01, 0xF0, 0x00, 0x00, 0xFA, 0x00}};
+  CAN_classic_frame CHADEMO_209 = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x209,
+                                   .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 };
 
 #endif
@@ -29,7 +29,7 @@ class CmfaEvBattery : public CanBattery {
   void reset_DTC() { UserRequestDTCclear = true; }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "CMFA platform, 27 kWh battery";
@@ -163,39 +163,43 @@ class CmfaEvBattery : public CanBattery {
   static const int PID_POLL_CUMULATIVE_ENERGY_WHEN_DISCHARGING = 0x9245;
   static const int PID_POLL_CUMULATIVE_ENERGY_IN_REGEN = 0x9247;
 
-  CAN_frame CMFA_1EA = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x1EA, .data = {0x00}};
-  CAN_frame CMFA_125 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 7,
-                        .ID = 0x125,
-                        .data = {0x7D, 0x7D, 0x7D, 0x07, 0x82, 0x6A, 0x8A}};
-  CAN_frame CMFA_134 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x134,
-                        .data = {0x90, 0x8A, 0x7E, 0x3E, 0xB2, 0x4C, 0x80, 0x00}};
-  CAN_frame CMFA_135 = {.FD = false, .ext_ID = false, .DLC = 5, .ID = 0x135, .data = {0xD5, 0x85, 0x38, 0x80, 0x01}};
-  CAN_frame CMFA_3D3 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x3D3,
-                        .data = {0x47, 0x30, 0x00, 0x02, 0x5D, 0x80, 0x5D, 0xE7}};
-  CAN_frame CMFA_59B = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x59B, .data = {0x00, 0x02, 0x00}};
-  CAN_frame CMFA_ACK = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x79B,
-                        .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame CMFA_POLLING_FRAME = {.FD = false,
-                                  .ext_ID = false,
-                                  .DLC = 8,
-                                  .ID = 0x79B,
-                                  .data = {0x03, 0x22, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame CMFA_CLEAR_DTC = {.FD = false,
-                              .ext_ID = false,
-                              .DLC = 8,
-                              .ID = 0x79B,
-                              .data = {0x04, 0x14, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CMFA_1EA = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x1EA, .data = {0x00}};
+  CAN_classic_frame CMFA_125 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 7,
+                                .ID = 0x125,
+                                .data = {0x7D, 0x7D, 0x7D, 0x07, 0x82, 0x6A, 0x8A}};
+  CAN_classic_frame CMFA_134 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x134,
+                                .data = {0x90, 0x8A, 0x7E, 0x3E, 0xB2, 0x4C, 0x80, 0x00}};
+  CAN_classic_frame CMFA_135 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 5,
+                                .ID = 0x135,
+                                .data = {0xD5, 0x85, 0x38, 0x80, 0x01}};
+  CAN_classic_frame CMFA_3D3 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x3D3,
+                                .data = {0x47, 0x30, 0x00, 0x02, 0x5D, 0x80, 0x5D, 0xE7}};
+  CAN_classic_frame CMFA_59B = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x59B, .data = {0x00, 0x02, 0x00}};
+  CAN_classic_frame CMFA_ACK = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x79B,
+                                .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CMFA_POLLING_FRAME = {.FD = false,
+                                          .ext_ID = false,
+                                          .DLC = 8,
+                                          .ID = 0x79B,
+                                          .data = {0x03, 0x22, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CMFA_CLEAR_DTC = {.FD = false,
+                                      .ext_ID = false,
+                                      .DLC = 8,
+                                      .ID = 0x79B,
+                                      .data = {0x04, 0x14, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00}};
   bool end_of_charge = false;
   bool interlock_flag = false;
   uint16_t soc_z = 0;
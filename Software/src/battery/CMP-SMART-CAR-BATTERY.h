@@ -7,7 +7,7 @@
 class CmpSmartCarBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Stellantis CMP Smart Car Battery";
@@ -36,82 +36,82 @@ class CmpSmartCarBattery : public CanBattery {
   uint8_t precalculated432[16] = {0x12, 0x11, 0x10, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B,
                                   0x1A, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13};
 
-  CAN_frame CMP_211 = {.FD = false,  //VCU contactor 100ms
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x211,
-                       .data = {0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame CMP_351 = {.FD = false,  //VCU 60ms Airbag
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x351,
-                       .data = {0x46, 0x14, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0F}};
-  CAN_frame CMP_432 = {.FD = false,  //VCU 50ms
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x432,
-                       .data = {0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x52}};
+  CAN_classic_frame CMP_211 = {.FD = false,  //VCU contactor 100ms
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x211,
+                               .data = {0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CMP_351 = {.FD = false,  //VCU 60ms Airbag
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x351,
+                               .data = {0x46, 0x14, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0F}};
+  CAN_classic_frame CMP_432 = {.FD = false,  //VCU 50ms
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x432,
+                               .data = {0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x52}};
 
   //Optional CAN messages to simulate more of the vehicle towards the battery (Not required?)
   /*
     uint8_t checksum217[16] = {0x50, 0x41, 0xB2, 0xA3, 0x14, 0x05, 0xF6, 0xE7,
                              0x58, 0xC9, 0xBA, 0xAB, 0x1C, 0x8D, 0x7E, 0x6F};
-  CAN_frame CMP_208 = {.FD = false,  //VCU 10ms
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x208,
-                       .data = {0x00, 0x20, 0x00, 0x84, 0x40, 0x21, 0x00, 0x00}};
-
-  CAN_frame CMP_217 = {.FD = false,  //VCU 10ms (Inverter motor speed)
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x217,
-                       .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00}};
-  CAN_frame CMP_231 = {
+  CAN_classic_frame CMP_208 = {.FD = false,  //VCU 10ms
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x208,
+                               .data = {0x00, 0x20, 0x00, 0x84, 0x40, 0x21, 0x00, 0x00}};
+
+  CAN_classic_frame CMP_217 = {.FD = false,  //VCU 10ms (Inverter motor speed)
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x217,
+                               .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00}};
+  CAN_classic_frame CMP_231 = {
       .FD = false,  //VCU preconditioning
       .ext_ID = false,
       .DLC = 8,     //
       .ID = 0x231,  //0b00 : Not active0b01 : Heating function active0b10 : Cooling function active0b11 : Reserve
       .data = {0x98, 0x59, 0x60, 0x00, 0xA3, 0x20, 0x00, 0x00}};  //Last byte, bit pos 1, has precond req
-  CAN_frame CMP_241 = {.FD = false,                               //VCU vehicle speed and emg stop 10ms
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x241,
-                       .data = {0x00, 0x00, 0x39, 0x00, 0xC8, 0x00, 0x00, 0x00}};
-  CAN_frame CMP_262 = {.FD = false,  //VCU 10ms
-                       .ext_ID = false,
-                       .DLC = 1,
-                       .ID = 0x262,
-                       .data = {0x00}};
-
-  CAN_frame CMP_421 = {.FD = false,  //VCU 50ms
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x421,
-                       .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame CMP_422 = {.FD = false,  //100ms VCU, Configuration
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x422,  //Fitting, Plant,check,storage,client,APV,showroom etc.
-                       .data = {0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00}};
-
-  CAN_frame CMP_4A2 = {.FD = false,  //OBC plug 100ms
-                       .ext_ID = false,
-                       .DLC = 2,
-                       .ID = 0x4A2,
-                       .data = {0x00, 0x41}};  //second byte, 00 plugged, 64 unplugged, 41vehiclerunning
-  CAN_frame CMP_552 = {.FD = false,            //VCU mileage and time 1000ms
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x552,
-                       .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE}};
+  CAN_classic_frame CMP_241 = {.FD = false,                               //VCU vehicle speed and emg stop 10ms
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x241,
+                               .data = {0x00, 0x00, 0x39, 0x00, 0xC8, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CMP_262 = {.FD = false,  //VCU 10ms
+                               .ext_ID = false,
+                               .DLC = 1,
+                               .ID = 0x262,
+                               .data = {0x00}};
+
+  CAN_classic_frame CMP_421 = {.FD = false,  //VCU 50ms
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x421,
+                               .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame CMP_422 = {.FD = false,  //100ms VCU, Configuration
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x422,  //Fitting, Plant,check,storage,client,APV,showroom etc.
+                               .data = {0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00}};
+
+  CAN_classic_frame CMP_4A2 = {.FD = false,  //OBC plug 100ms
+                               .ext_ID = false,
+                               .DLC = 2,
+                               .ID = 0x4A2,
+                               .data = {0x00, 0x41}};  //second byte, 00 plugged, 64 unplugged, 41vehiclerunning
+  CAN_classic_frame CMP_552 = {.FD = false,            //VCU mileage and time 1000ms
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x552,
+                               .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE}};
   */
-  CAN_frame CMP_POLL = {.FD = false, .ext_ID = false, .DLC = 4, .ID = 0x6B4, .data = {0x03, 0x22, 0xD8, 0x13}};
-  CAN_frame CMP_CLEAR_ALL_DTC = {.FD = false,
-                                 .ext_ID = false,
-                                 .DLC = 5,
-                                 .ID = 0x6B4,
-                                 .data = {0x04, 0x14, 0xFF, 0xFF, 0xFF}};
+  CAN_classic_frame CMP_POLL = {.FD = false, .ext_ID = false, .DLC = 4, .ID = 0x6B4, .data = {0x03, 0x22, 0xD8, 0x13}};
+  CAN_classic_frame CMP_CLEAR_ALL_DTC = {.FD = false,
+                                         .ext_ID = false,
+                                         .DLC = 5,
+                                         .ID = 0x6B4,
+                                         .data = {0x04, 0x14, 0xFF, 0xFF, 0xFF}};
   uint32_t vehicle_time_counter = 0x088B390B;  //Taken from log on 19thOctober2025
   uint32_t main_contactor_cycle_count = 0;
   uint32_t QC_contactor_cycle_count = 0;
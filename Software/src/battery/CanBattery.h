@@ -5,20 +5,21 @@
 
 #include "../../src/communication/Transmitter.h"
 #include "../../src/communication/can/CanReceiver.h"
+#include "../../src/communication/can/CanScheduler.h"
 #include "../../src/communication/can/comm_can.h"
 #include "../../src/devboard/utils/types.h"
 
 // Abstract base class for batteries using the CAN bus
 class CanBattery : public Battery, Transmitter, CanReceiver {
  public:
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame) = 0;
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame) = 0;
   virtual void transmit_can(unsigned long currentMillis) = 0;
 
   const char* interface_name() { return getCANInterfaceName(can_interface); }
 
   void transmit(unsigned long currentMillis) { transmit_can(currentMillis); }
 
-  void receive_can_frame(CAN_frame* frame) { handle_incoming_can_frame(*frame); }
+  void receive_can_frame(const CAN_frame& frame) { handle_incoming_can_frame(frame); }
 
  protected:
   CAN_Interface can_interface;
@@ -30,7 +31,23 @@ class CanBattery : public Battery, Transmitter, CanReceiver {
   bool change_can_speed(CAN_Speed speed);
   void reset_can_speed();
 
-  void transmit_can_frame(const CAN_frame* frame) { transmit_can_frame_to_interface(frame, can_interface); }
+  void transmit_can_frame(const CAN_frame* frame, CanTxPriority priority = CanTxPriority::Normal) {
+    transmit_can_frame_to_interface(frame, can_interface, priority);
+  }
+  void transmit_can_frame(const CAN_classic_frame* frame, CanTxPriority priority = CanTxPriority::Normal) {
+    transmit_can_frame_to_interface(frame, can_interface, priority);
+  }
+
+  // Has the CAN scheduler send the frame unchanged every period_ms
+  void schedule_can_frame(const CAN_classic_frame* frame, uint16_t period_ms,
+                          int16_t phase_ms = CanScheduler::AUTO_PHASE) {
+    schedule_can(period_ms, 1, [this, frame](unsigned long) { transmit_can_frame(frame); }, phase_ms);
+  }
+  // Has the CAN scheduler run a generator sending about 'frames' frames every period_ms, returns its phase
+  uint16_t schedule_can(uint16_t period_ms, uint8_t frames, CanScheduler::Generator generator,
+                        int16_t phase_ms = CanScheduler::AUTO_PHASE) {
+    return can_scheduler.add(this, period_ms, frames, generator, phase_ms);
+  }
 };
 
 #endif
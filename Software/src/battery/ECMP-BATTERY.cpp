@@ -230,7 +230,7 @@ void EcmpBattery::update_values() {
   }
 }
 
-void EcmpBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void EcmpBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x2D4:  //MysteryVan 50/75kWh platform (TBMU 100ms periodic)
       datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
@@ -1166,7 +1166,7 @@ void EcmpBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
   }
 }
 
-uint8_t checksum_calc(uint8_t counter, CAN_frame rx_frame) {
+uint8_t checksum_calc(uint8_t counter, const CAN_classic_frame& rx_frame) {
   // Confirmed working on IDs 0F0,0F2,17B,31B,31D,31E,3A2(special),3A3,112,351
   // Sum of frame ID nibbles + Sum all nibbles of data bytes (frames 0–6 and high nibble of frame7)
   int sum = ((rx_frame.ID >> 8) & 0xF) + ((rx_frame.ID >> 4) & 0xF) + (rx_frame.ID & 0xF);
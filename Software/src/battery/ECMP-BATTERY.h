@@ -9,7 +9,7 @@
 class EcmpBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Stellantis ECMP battery";
@@ -44,230 +44,243 @@ class EcmpBattery : public CanBattery {
   unsigned long previousMillis500 = 0;   // will store last time a 500ms CAN Message was sent
   unsigned long previousMillis1000 = 0;  // will store last time a 1000ms CAN Message was sent
   unsigned long previousMillis5000 = 0;  // will store last time a 1000ms CAN Message was sent
-  CAN_frame ECMP_010 = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x010, .data = {0xB4}};  //VCU_BCM_Crash 100ms
-  CAN_frame ECMP_0F0 = {.FD = false,  //VCU2_0F0 (Common) 20ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x0F0,
-                        .data = {0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF}};
-  CAN_frame ECMP_0F2 = {.FD = false,      //CtrlMCU1_0F2 10ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x0F2,
-                        .data = {0x7D, 0x00, 0x4E, 0x20, 0x00, 0x00, 0x60, 0x0D}};
+  CAN_classic_frame ECMP_010 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 1,
+                                .ID = 0x010,
+                                .data = {0xB4}};  //VCU_BCM_Crash 100ms
+  CAN_classic_frame ECMP_0F0 = {.FD = false,  //VCU2_0F0 (Common) 20ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x0F0,
+                                .data = {0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF}};
+  CAN_classic_frame ECMP_0F2 = {.FD = false,      //CtrlMCU1_0F2 10ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  // NOTE. Changes on BMS state
+                                .DLC = 8,
+                                .ID = 0x0F2,
+                                .data = {0x7D, 0x00, 0x4E, 0x20, 0x00, 0x00, 0x60, 0x0D}};
 
-  CAN_frame ECMP_110 = {.FD = false,      //??? 10ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x110,
-                        .data = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x87, 0x05}};
-  static constexpr CAN_frame ECMP_111 = {.FD = false,      //??? 10ms periodic (Perfectly emulated in Battery-Emulator)
-                                         .ext_ID = false,  //Same content always, fully static
-                                         .DLC = 8,
-                                         .ID = 0x111,
-                                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ECMP_112 = {.FD = false,      //MCU1_112 10ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  //Same content always, only CRC changes at end
-                        .DLC = 8,
-                        .ID = 0x112,
-                        .data = {0x4E, 0x20, 0x00, 0x0F, 0xA0, 0x7D, 0x00, 0x0A}};
-  static constexpr CAN_frame ECMP_114 = {.FD = false,      //??? 10ms periodic (Perfectly emulated in Battery-Emulator)
-                                         .ext_ID = false,  //Same content always, fully static
-                                         .DLC = 8,
-                                         .ID = 0x114,
-                                         .data = {0x00, 0x00, 0x00, 0x7D, 0x07, 0xD0, 0x7D, 0x00}};
-  static constexpr CAN_frame ECMP_0C5 = {.FD = false,  //DC2_0C5 10ms periodic (Perfectly emulated in Battery-Emulator)
-                                         .ext_ID = false,  //Same content always, fully static
-                                         .DLC = 8,
-                                         .ID = 0x0C5,
-                                         .data = {0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ECMP_17B = {.FD = false,      //VCU_PCANInfo_17B 10ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x17B,
-                        .data = {0x00, 0x00, 0x00, 0x7E, 0x78, 0x00, 0x00, 0x0F}};  // NOTE. Changes on BMS state
-  static constexpr CAN_frame ECMP_230 = {.FD = false,  //OBC3_230 50ms periodic (Perfectly emulated in Battery-Emulator)
-                                         .ext_ID = false,  //Same content always, fully static
-                                         .DLC = 8,
-                                         .ID = 0x230,
-                                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ECMP_27A = {
+  CAN_classic_frame ECMP_110 = {.FD = false,      //??? 10ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  // NOTE. Changes on BMS state
+                                .DLC = 8,
+                                .ID = 0x110,
+                                .data = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x87, 0x05}};
+  static constexpr CAN_classic_frame ECMP_111 = {
+      .FD = false,      //??? 10ms periodic (Perfectly emulated in Battery-Emulator)
+      .ext_ID = false,  //Same content always, fully static
+      .DLC = 8,
+      .ID = 0x111,
+      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ECMP_112 = {.FD = false,      //MCU1_112 10ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  //Same content always, only CRC changes at end
+                                .DLC = 8,
+                                .ID = 0x112,
+                                .data = {0x4E, 0x20, 0x00, 0x0F, 0xA0, 0x7D, 0x00, 0x0A}};
+  static constexpr CAN_classic_frame ECMP_114 = {
+      .FD = false,      //??? 10ms periodic (Perfectly emulated in Battery-Emulator)
+      .ext_ID = false,  //Same content always, fully static
+      .DLC = 8,
+      .ID = 0x114,
+      .data = {0x00, 0x00, 0x00, 0x7D, 0x07, 0xD0, 0x7D, 0x00}};
+  static constexpr CAN_classic_frame ECMP_0C5 = {
+      .FD = false,      //DC2_0C5 10ms periodic (Perfectly emulated in Battery-Emulator)
+      .ext_ID = false,  //Same content always, fully static
+      .DLC = 8,
+      .ID = 0x0C5,
+      .data = {0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ECMP_17B = {
+      .FD = false,      //VCU_PCANInfo_17B 10ms periodic (Perfectly emulated in Battery-Emulator)
+      .ext_ID = false,  // NOTE. Changes on BMS state
+      .DLC = 8,
+      .ID = 0x17B,
+      .data = {0x00, 0x00, 0x00, 0x7E, 0x78, 0x00, 0x00, 0x0F}};  // NOTE. Changes on BMS state
+  static constexpr CAN_classic_frame ECMP_230 = {
+      .FD = false,      //OBC3_230 50ms periodic (Perfectly emulated in Battery-Emulator)
+      .ext_ID = false,  //Same content always, fully static
+      .DLC = 8,
+      .ID = 0x230,
+      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ECMP_27A = {
       .FD = false,      //VCU_BSI_Wakeup_27A message 50ms periodic (Perfectly emulated in Battery-Emulator)
       .ext_ID = false,  // NOTE. Changes on BMS state
       .DLC = 8,         //Contains SEV main state, position of the BSI shunt park, ACC status
       .ID = 0x27A,      // electric network state, powetrain status, Wakeups, diagmux, APC activation
       .data = {0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ECMP_3D0 = {.FD = false,      //Not in logs, but makes speed go to 0km/h in diag tool when we send this
-                        .ext_ID = false,  //Only sent in idle state
-                        .DLC = 8,
-                        .ID = 0x3D0,
-                        .data = {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ECMP_345 = {.FD = false,      //DC1_345 100ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x345,
-                        .data = {0x45, 0x57, 0x00, 0x04, 0x00, 0x00, 0x06, 0x31}};
-  static constexpr CAN_frame ECMP_382 = {
+  CAN_classic_frame ECMP_3D0 = {
+      .FD = false,      //Not in logs, but makes speed go to 0km/h in diag tool when we send this
+      .ext_ID = false,  //Only sent in idle state
+      .DLC = 8,
+      .ID = 0x3D0,
+      .data = {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ECMP_345 = {.FD = false,      //DC1_345 100ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  // NOTE. Changes on BMS state
+                                .DLC = 8,
+                                .ID = 0x345,
+                                .data = {0x45, 0x57, 0x00, 0x04, 0x00, 0x00, 0x06, 0x31}};
+  static constexpr CAN_classic_frame ECMP_382 = {
       //BSIInfo_382 (VCU) PSA specific 100ms periodic (Perfectly emulated in Battery-Emulator)
       .FD = false,  //Same content always, fully static
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x382,  //Frame1 has rollerbenchmode request, frame2 has generic powertrain cycle sync status
       .data = {0x02, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ECMP_3A2 = {.FD = false,      //OBC2_3A2 100ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x3A2,
-                        .data = {0x03, 0xE8, 0x00, 0x00, 0x81, 0x00, 0x08, 0x02}};
-  CAN_frame ECMP_3A3 = {.FD = false,      //OBC1_3A3 100ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x3A3,
-                        .data = {0x4A, 0x4A, 0x40, 0x00, 0x00, 0x08, 0x00, 0x0F}};
-  static constexpr CAN_frame ECMP_439 = {.FD = false,      //OBC4 1s periodic (Perfectly emulated in Battery-Emulator)
-                                         .ext_ID = false,  //Same content always, fully static
-                                         .DLC = 8,
-                                         .ID = 0x439,
-                                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ECMP_3A2 = {.FD = false,      //OBC2_3A2 100ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  // NOTE. Changes on BMS state
+                                .DLC = 8,
+                                .ID = 0x3A2,
+                                .data = {0x03, 0xE8, 0x00, 0x00, 0x81, 0x00, 0x08, 0x02}};
+  CAN_classic_frame ECMP_3A3 = {.FD = false,      //OBC1_3A3 100ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  // NOTE. Changes on BMS state
+                                .DLC = 8,
+                                .ID = 0x3A3,
+                                .data = {0x4A, 0x4A, 0x40, 0x00, 0x00, 0x08, 0x00, 0x0F}};
+  static constexpr CAN_classic_frame ECMP_439 = {
+      .FD = false,      //OBC4 1s periodic (Perfectly emulated in Battery-Emulator)
+      .ext_ID = false,  //Same content always, fully static
+      .DLC = 8,
+      .ID = 0x439,
+      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
-  CAN_frame ECMP_552 = {.FD = false,  //VCU_552 1s periodic (Perfectly handled in Battery-Emulator)
-                        .ext_ID = false,
-                        .DLC = 8,     //552 seems to be tracking time in byte 0-3
-                        .ID = 0x552,  // distance in km in byte 4-6, temporal reset counter in byte 7
-                        .data = {0x00, 0x02, 0x95, 0x6D, 0x00, 0xD7, 0xB5, 0xFE}};
+  CAN_classic_frame ECMP_552 = {.FD = false,  //VCU_552 1s periodic (Perfectly handled in Battery-Emulator)
+                                .ext_ID = false,
+                                .DLC = 8,     //552 seems to be tracking time in byte 0-3
+                                .ID = 0x552,  // distance in km in byte 4-6, temporal reset counter in byte 7
+                                .data = {0x00, 0x02, 0x95, 0x6D, 0x00, 0xD7, 0xB5, 0xFE}};
 
-  CAN_frame ECMP_POLL = {.FD = false, .ext_ID = false, .DLC = 4, .ID = 0x6B4, .data = {0x03, 0x22, 0xD8, 0x66}};
-  static constexpr CAN_frame ECMP_ACK = {.FD = false,  //Ack frame
-                                         .ext_ID = false,
-                                         .DLC = 3,
-                                         .ID = 0x6B4,
-                                         .data = {0x30, 0x00, 0x00}};
-  static constexpr CAN_frame ECMP_DIAG_START = {.FD = false,
-                                                .ext_ID = false,
-                                                .DLC = 3,
-                                                .ID = 0x6B4,
-                                                .data = {0x02, 0x10, 0x03}};
-  //Start diagnostic session (extended diagnostic session, mode 0x10 with sub-mode 0x03)
-  static constexpr CAN_frame ECMP_CONTACTOR_RESET_START = {.FD = false,
-                                                           .ext_ID = false,
-                                                           .DLC = 5,
-                                                           .ID = 0x6B4,
-                                                           .data = {0x04, 0x31, 0x01, 0xDD, 0x35}};
-  static constexpr CAN_frame ECMP_CONTACTOR_RESET_PROGRESS = {.FD = false,
-                                                              .ext_ID = false,
-                                                              .DLC = 5,
-                                                              .ID = 0x6B4,
-                                                              .data = {0x04, 0x31, 0x03, 0xDD, 0x35}};
-  static constexpr CAN_frame ECMP_COLLISION_RESET_START = {.FD = false,
-                                                           .ext_ID = false,
-                                                           .DLC = 5,
-                                                           .ID = 0x6B4,
-                                                           .data = {0x04, 0x31, 0x01, 0xDF, 0x60}};
-  static constexpr CAN_frame ECMP_COLLISION_RESET_PROGRESS = {.FD = false,
-                                                              .ext_ID = false,
-                                                              .DLC = 5,
-                                                              .ID = 0x6B4,
-                                                              .data = {0x04, 0x31, 0x03, 0xDF, 0x60}};
-  static constexpr CAN_frame ECMP_ISOLATION_RESET_START = {.FD = false,
-                                                           .ext_ID = false,
-                                                           .DLC = 5,
-                                                           .ID = 0x6B4,
-                                                           .data = {0x04, 0x31, 0x01, 0xDF, 0x46}};
-  static constexpr CAN_frame ECMP_ISOLATION_RESET_PROGRESS = {.FD = false,
-                                                              .ext_ID = false,
-                                                              .DLC = 8,
-                                                              .ID = 0x6B4,
-                                                              .data = {0x04, 0x31, 0x03, 0xDF, 0x46}};
-  static constexpr CAN_frame ECMP_RESET_DONE = {.FD = false,
-                                                .ext_ID = false,
-                                                .DLC = 3,
-                                                .ID = 0x6B4,
-                                                .data = {0x02, 0x3E, 0x00}};
-  static constexpr CAN_frame ECMP_FACTORY_MODE_ACTIVATION = {.FD = false,
-                                                             .ext_ID = false,
-                                                             .DLC = 5,
-                                                             .ID = 0x6B4,
-                                                             .data = {0x04, 0x2E, 0xD9, 0x00, 0x01}};
-  static constexpr CAN_frame ECMP_DISABLE_ISOLATION_REQ = {.FD = false,
-                                                           .ext_ID = false,
-                                                           .DLC = 5,
-                                                           .ID = 0x6B4,
-                                                           .data = {0x04, 0x31, 0x02, 0xDF, 0xE1}};
-  static constexpr CAN_frame ECMP_ACK_MESSAGE = {.FD = false,
+  CAN_classic_frame ECMP_POLL = {.FD = false, .ext_ID = false, .DLC = 4, .ID = 0x6B4, .data = {0x03, 0x22, 0xD8, 0x66}};
+  static constexpr CAN_classic_frame ECMP_ACK = {.FD = false,  //Ack frame
                                                  .ext_ID = false,
                                                  .DLC = 3,
                                                  .ID = 0x6B4,
-                                                 .data = {0x02, 0x3E, 0x00}};
+                                                 .data = {0x30, 0x00, 0x00}};
+  static constexpr CAN_classic_frame ECMP_DIAG_START = {.FD = false,
+                                                        .ext_ID = false,
+                                                        .DLC = 3,
+                                                        .ID = 0x6B4,
+                                                        .data = {0x02, 0x10, 0x03}};
+  //Start diagnostic session (extended diagnostic session, mode 0x10 with sub-mode 0x03)
+  static constexpr CAN_classic_frame ECMP_CONTACTOR_RESET_START = {.FD = false,
+                                                                   .ext_ID = false,
+                                                                   .DLC = 5,
+                                                                   .ID = 0x6B4,
+                                                                   .data = {0x04, 0x31, 0x01, 0xDD, 0x35}};
+  static constexpr CAN_classic_frame ECMP_CONTACTOR_RESET_PROGRESS = {.FD = false,
+                                                                      .ext_ID = false,
+                                                                      .DLC = 5,
+                                                                      .ID = 0x6B4,
+                                                                      .data = {0x04, 0x31, 0x03, 0xDD, 0x35}};
+  static constexpr CAN_classic_frame ECMP_COLLISION_RESET_START = {.FD = false,
+                                                                   .ext_ID = false,
+                                                                   .DLC = 5,
+                                                                   .ID = 0x6B4,
+                                                                   .data = {0x04, 0x31, 0x01, 0xDF, 0x60}};
+  static constexpr CAN_classic_frame ECMP_COLLISION_RESET_PROGRESS = {.FD = false,
+                                                                      .ext_ID = false,
+                                                                      .DLC = 5,
+                                                                      .ID = 0x6B4,
+                                                                      .data = {0x04, 0x31, 0x03, 0xDF, 0x60}};
+  static constexpr CAN_classic_frame ECMP_ISOLATION_RESET_START = {.FD = false,
+                                                                   .ext_ID = false,
+                                                                   .DLC = 5,
+                                                                   .ID = 0x6B4,
+                                                                   .data = {0x04, 0x31, 0x01, 0xDF, 0x46}};
+  static constexpr CAN_classic_frame ECMP_ISOLATION_RESET_PROGRESS = {.FD = false,
+                                                                      .ext_ID = false,
+                                                                      .DLC = 8,
+                                                                      .ID = 0x6B4,
+                                                                      .data = {0x04, 0x31, 0x03, 0xDF, 0x46}};
+  static constexpr CAN_classic_frame ECMP_RESET_DONE = {.FD = false,
+                                                        .ext_ID = false,
+                                                        .DLC = 3,
+                                                        .ID = 0x6B4,
+                                                        .data = {0x02, 0x3E, 0x00}};
+  static constexpr CAN_classic_frame ECMP_FACTORY_MODE_ACTIVATION = {.FD = false,
+                                                                     .ext_ID = false,
+                                                                     .DLC = 5,
+                                                                     .ID = 0x6B4,
+                                                                     .data = {0x04, 0x2E, 0xD9, 0x00, 0x01}};
+  static constexpr CAN_classic_frame ECMP_DISABLE_ISOLATION_REQ = {.FD = false,
+                                                                   .ext_ID = false,
+                                                                   .DLC = 5,
+                                                                   .ID = 0x6B4,
+                                                                   .data = {0x04, 0x31, 0x02, 0xDF, 0xE1}};
+  static constexpr CAN_classic_frame ECMP_ACK_MESSAGE = {.FD = false,
+                                                         .ext_ID = false,
+                                                         .DLC = 3,
+                                                         .ID = 0x6B4,
+                                                         .data = {0x02, 0x3E, 0x00}};
 
 #ifdef SIMULATE_ENTIRE_VEHICLE_ECMP
-  static constexpr CAN_frame ECMP_0AE = {.FD = false,
-                                         .ext_ID = false,
-                                         .DLC = 5,
-                                         .ID = 0x0AE,
-                                         .data = {0x04, 0x77, 0x7A, 0x5E, 0xDF}};
-  static constexpr CAN_frame ECMP_041 = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x041, .data = {0x00}};
-  CAN_frame ECMP_486 = {.FD = false,      //??? 1s periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x486,
-                        .data = {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};
-  static constexpr CAN_frame ECMP_786 = {.FD = false,      //1s periodic
-                                         .ext_ID = false,  //Always static in HV mode
-                                         .DLC = 8,
-                                         .ID = 0x786,
-                                         .data = {0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};
-  static constexpr CAN_frame ECMP_591 = {.FD = false,      //1s periodic
-                                         .ext_ID = false,  //Always static in HV mode
-                                         .DLC = 8,
-                                         .ID = 0x591,
-                                         .data = {0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};
-  CAN_frame ECMP_794 = {.FD = false,  //Unsure who sends this. Could it be BMU?
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x794,
-                        .data = {0xB8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};  // NOTE. Changes on BMS state
-  static constexpr CAN_frame ECMP_55F = {.FD = false,      //5s periodic (Perfectly emulated in Battery-Emulator)
-                                         .ext_ID = false,  //Same content always, fully static
-                                         .DLC = 1,
-                                         .ID = 0x55F,
-                                         .data = {0x82}};
-  CAN_frame ECMP_31D = {.FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  //Same content always, fully static
-                        .DLC = 8,
-                        .ID = 0x31D,
-                        .data = {0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42}};
-  CAN_frame ECMP_351 = {.FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x351,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0E}};
-  CAN_frame ECMP_372 = {.FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x372,
-                        .data = {0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};  // NOTE. Changes on BMS state
-  static constexpr CAN_frame ECMP_37F = {
+  static constexpr CAN_classic_frame ECMP_0AE = {.FD = false,
+                                                 .ext_ID = false,
+                                                 .DLC = 5,
+                                                 .ID = 0x0AE,
+                                                 .data = {0x04, 0x77, 0x7A, 0x5E, 0xDF}};
+  static constexpr CAN_classic_frame ECMP_041 = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x041, .data = {0x00}};
+  CAN_classic_frame ECMP_486 = {.FD = false,      //??? 1s periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  // NOTE. Changes on BMS state
+                                .DLC = 8,
+                                .ID = 0x486,
+                                .data = {0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};
+  static constexpr CAN_classic_frame ECMP_786 = {.FD = false,      //1s periodic
+                                                 .ext_ID = false,  //Always static in HV mode
+                                                 .DLC = 8,
+                                                 .ID = 0x786,
+                                                 .data = {0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};
+  static constexpr CAN_classic_frame ECMP_591 = {.FD = false,      //1s periodic
+                                                 .ext_ID = false,  //Always static in HV mode
+                                                 .DLC = 8,
+                                                 .ID = 0x591,
+                                                 .data = {0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};
+  CAN_classic_frame ECMP_794 = {.FD = false,  //Unsure who sends this. Could it be BMU?
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x794,
+                                .data = {0xB8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};  // NOTE. Changes on BMS state
+  static constexpr CAN_classic_frame ECMP_55F = {
+      .FD = false,      //5s periodic (Perfectly emulated in Battery-Emulator)
+      .ext_ID = false,  //Same content always, fully static
+      .DLC = 1,
+      .ID = 0x55F,
+      .data = {0x82}};
+  CAN_classic_frame ECMP_31D = {.FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  //Same content always, fully static
+                                .DLC = 8,
+                                .ID = 0x31D,
+                                .data = {0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42}};
+  CAN_classic_frame ECMP_351 = {.FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  // NOTE. Changes on BMS state
+                                .DLC = 8,
+                                .ID = 0x351,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0E}};
+  CAN_classic_frame ECMP_372 = {
+      .FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
+      .ext_ID = false,  // NOTE. Changes on BMS state
+      .DLC = 8,
+      .ID = 0x372,
+      .data = {0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};  // NOTE. Changes on BMS state
+  static constexpr CAN_classic_frame ECMP_37F = {
       .FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
       .ext_ID = false,  // Seems to be a bunch of temperature measurements? Static for now
       .DLC = 8,
       .ID = 0x37F,
       .data = {0x45, 0x49, 0x51, 0x45, 0x45, 0x00, 0x45, 0x45}};
-  static constexpr CAN_frame ECMP_0A6 = {
+  static constexpr CAN_classic_frame ECMP_0A6 = {
       .FD = false,
       .ext_ID = false,
       .DLC = 2,
       .ID = 0x0A6,
       .data = {0x02, 0x00}};              //Content changes after 12minutes of runtime (not emulated)
-  CAN_frame ECMP_383 = {.FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x383,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ECMP_31E = {.FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
-                        .ext_ID = false,  // NOTE. Changes on BMS state
-                        .DLC = 8,
-                        .ID = 0x31E,
-                        .data = {0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08}};
+  CAN_classic_frame ECMP_383 = {.FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  // NOTE. Changes on BMS state
+                                .DLC = 8,
+                                .ID = 0x383,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ECMP_31E = {.FD = false,      //??? 100ms periodic (Perfectly emulated in Battery-Emulator)
+                                .ext_ID = false,  // NOTE. Changes on BMS state
+                                .DLC = 8,
+                                .ID = 0x31E,
+                                .data = {0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08}};
 #endif
 
   uint32_t ticks_552 = 0x0BC8CFC6;
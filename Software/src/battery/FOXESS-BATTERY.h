@@ -5,7 +5,7 @@
 class FoxessBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "FoxESS HV2600/ECS4100 OEM battery";
@@ -19,11 +19,11 @@ class FoxessBattery : public CanBattery {
 
   unsigned long previousMillis500 = 0;  // will store last time a 500ms CAN Message was send
 
-  CAN_frame FOX_1871 = {.FD = false,  //Inverter request data from battery. Content varies depending on state
-                        .ext_ID = true,
-                        .DLC = 8,
-                        .ID = 0x1871,
-                        .data = {0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame FOX_1871 = {.FD = false,  //Inverter request data from battery. Content varies depending on state
+                                .ext_ID = true,
+                                .DLC = 8,
+                                .ID = 0x1871,
+                                .data = {0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}};
   uint32_t total_watt_hours = 0;
   uint16_t max_charge_power_dA = 0;
   uint16_t max_discharge_power_dA = 0;
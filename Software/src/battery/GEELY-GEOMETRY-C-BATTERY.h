@@ -21,7 +21,7 @@ class GeelyGeometryCBattery : public CanBattery {
   }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Geely Geometry C";
@@ -63,136 +63,136 @@ class GeelyGeometryCBattery : public CanBattery {
   static const int MAX_CELL_VOLTAGE_MV = 4250;  //Battery is put into emergency stop if one cell goes over this value
   static const int MIN_CELL_VOLTAGE_MV = 2700;  //Battery is put into emergency stop if one cell goes below this value
 
-  CAN_frame GEELY_191 = {.FD = false,  //PAS_APA_Status , 10ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x191,
-                         .data = {0x00, 0x00, 0x81, 0x20, 0x00, 0x00, 0x00, 0x01}};
-  CAN_frame GEELY_2D2 = {.FD = false,  //DSCU 100ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x2D2,
-                         .data = {0x60, 0x8E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GEELY_0A6 = {.FD = false,  //VCU 10ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x0A6,
-                         .data = {0xFA, 0x0F, 0xA0, 0x00, 0x00, 0xFA, 0x00, 0xE4}};
-  CAN_frame GEELY_160 = {.FD = false,  //VCU 10ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x160,
-                         .data = {0x00, 0x01, 0x67, 0xF7, 0xC0, 0x19, 0x00, 0x20}};
-  CAN_frame GEELY_165 = {.FD = false,  //VCU_ModeControl 10ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x165,
-                         .data = {0x00, 0x81, 0xA1, 0x00, 0x00, 0x1E, 0x00, 0xD6}};
-  CAN_frame GEELY_1A4 = {.FD = false,  //VCU 10ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x1A4,
-                         .data = {0x17, 0x73, 0x17, 0x70, 0x02, 0x1C, 0x00, 0x56}};
-  CAN_frame GEELY_162 = {.FD = false,  //VCU 10ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x162,
-                         .data = {0x00, 0x05, 0x06, 0x81, 0x00, 0x09, 0x00, 0xC6}};
-  CAN_frame GEELY_1A5 = {.FD = false,  //VCU 10ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x1A5,
-                         .data = {0x17, 0x70, 0x24, 0x0B, 0x00, 0x00, 0x00, 0xF9}};
-  CAN_frame GEELY_1B2 = {.FD = false,  //??? 50ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x1B2,
-                         .data = {0x17, 0x70, 0x24, 0x0B, 0x00, 0x00, 0x00, 0xF9}};
-  CAN_frame GEELY_221 = {.FD = false,  //OBC 50ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x221,
-                         .data = {0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00}};
-  CAN_frame GEELY_220 = {.FD = false,  //OBC 100ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x220,
-                         .data = {0x0B, 0x43, 0x69, 0xF3, 0x3A, 0x10, 0x00, 0x31}};
-  CAN_frame GEELY_1A3 = {.FD = false,  //FRS 50ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x1A3,
-                         .data = {0xFF, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x4F}};
-  CAN_frame GEELY_1A7 = {.FD = false,  //??? 50ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x1A7,
-                         .data = {0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00}};
-  CAN_frame GEELY_0A8 = {.FD = false,  //IPU 100ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x0A8,
-                         .data = {0x00, 0x2E, 0xDC, 0x4E, 0x20, 0x00, 0x20, 0xA2}};
-  CAN_frame GEELY_1F2 = {.FD = false,  //??? 50ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x1F2,
-                         .data = {0x9B, 0xA3, 0x99, 0xA2, 0x41, 0x42, 0x41, 0x42}};
-  CAN_frame GEELY_222 = {.FD = false,  //OBC 100ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x222,
-                         .data = {0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00}};
-  CAN_frame GEELY_1A6 = {.FD = false,  //OBC 100ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x1A6,
-                         .data = {0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00}};
-  CAN_frame GEELY_145 = {.FD = false,  //EGSM 20ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x145,
-                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A}};
-  CAN_frame GEELY_0E0 = {.FD = false,  //IPU 10ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x0E0,
-                         .data = {0xFF, 0x09, 0x00, 0xE0, 0x00, 0x8F, 0x00, 0x00}};
-  CAN_frame GEELY_0F9 = {.FD = false,  //??? 20ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x0F9,
-                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GEELY_292 = {.FD = false,  //T-BOX 100ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x292,
-                         .data = {0x00, 0x00, 0x00, 0x1F, 0xE7, 0xE7, 0x00, 0xBC}};
-  CAN_frame GEELY_0FA = {.FD = false,  //??? 20ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x0FA,
-                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GEELY_197 = {.FD = false,  //??? 20ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x197,
-                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A}};
-  CAN_frame GEELY_150 = {.FD = false,  //EPS 20ms
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x150,
-                         .data = {0x7E, 0x00, 0x24, 0x00, 0x01, 0x01, 0x00, 0xA9}};
-  CAN_frame GEELY_POLL = {.FD = false,  //Polling frame
-                          .ext_ID = false,
-                          .DLC = 8,
-                          .ID = 0x7E2,
-                          .data = {0x03, 0x22, 0x4B, 0xDA, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GEELY_ACK = {.FD = false,  //Ack frame
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x7E2,
-                         .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GEELY_191 = {.FD = false,  //PAS_APA_Status , 10ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x191,
+                                 .data = {0x00, 0x00, 0x81, 0x20, 0x00, 0x00, 0x00, 0x01}};
+  CAN_classic_frame GEELY_2D2 = {.FD = false,  //DSCU 100ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x2D2,
+                                 .data = {0x60, 0x8E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GEELY_0A6 = {.FD = false,  //VCU 10ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x0A6,
+                                 .data = {0xFA, 0x0F, 0xA0, 0x00, 0x00, 0xFA, 0x00, 0xE4}};
+  CAN_classic_frame GEELY_160 = {.FD = false,  //VCU 10ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x160,
+                                 .data = {0x00, 0x01, 0x67, 0xF7, 0xC0, 0x19, 0x00, 0x20}};
+  CAN_classic_frame GEELY_165 = {.FD = false,  //VCU_ModeControl 10ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x165,
+                                 .data = {0x00, 0x81, 0xA1, 0x00, 0x00, 0x1E, 0x00, 0xD6}};
+  CAN_classic_frame GEELY_1A4 = {.FD = false,  //VCU 10ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x1A4,
+                                 .data = {0x17, 0x73, 0x17, 0x70, 0x02, 0x1C, 0x00, 0x56}};
+  CAN_classic_frame GEELY_162 = {.FD = false,  //VCU 10ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x162,
+                                 .data = {0x00, 0x05, 0x06, 0x81, 0x00, 0x09, 0x00, 0xC6}};
+  CAN_classic_frame GEELY_1A5 = {.FD = false,  //VCU 10ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x1A5,
+                                 .data = {0x17, 0x70, 0x24, 0x0B, 0x00, 0x00, 0x00, 0xF9}};
+  CAN_classic_frame GEELY_1B2 = {.FD = false,  //??? 50ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x1B2,
+                                 .data = {0x17, 0x70, 0x24, 0x0B, 0x00, 0x00, 0x00, 0xF9}};
+  CAN_classic_frame GEELY_221 = {.FD = false,  //OBC 50ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x221,
+                                 .data = {0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00}};
+  CAN_classic_frame GEELY_220 = {.FD = false,  //OBC 100ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x220,
+                                 .data = {0x0B, 0x43, 0x69, 0xF3, 0x3A, 0x10, 0x00, 0x31}};
+  CAN_classic_frame GEELY_1A3 = {.FD = false,  //FRS 50ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x1A3,
+                                 .data = {0xFF, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x4F}};
+  CAN_classic_frame GEELY_1A7 = {.FD = false,  //??? 50ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x1A7,
+                                 .data = {0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GEELY_0A8 = {.FD = false,  //IPU 100ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x0A8,
+                                 .data = {0x00, 0x2E, 0xDC, 0x4E, 0x20, 0x00, 0x20, 0xA2}};
+  CAN_classic_frame GEELY_1F2 = {.FD = false,  //??? 50ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x1F2,
+                                 .data = {0x9B, 0xA3, 0x99, 0xA2, 0x41, 0x42, 0x41, 0x42}};
+  CAN_classic_frame GEELY_222 = {.FD = false,  //OBC 100ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x222,
+                                 .data = {0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GEELY_1A6 = {.FD = false,  //OBC 100ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x1A6,
+                                 .data = {0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GEELY_145 = {.FD = false,  //EGSM 20ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x145,
+                                 .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A}};
+  CAN_classic_frame GEELY_0E0 = {.FD = false,  //IPU 10ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x0E0,
+                                 .data = {0xFF, 0x09, 0x00, 0xE0, 0x00, 0x8F, 0x00, 0x00}};
+  CAN_classic_frame GEELY_0F9 = {.FD = false,  //??? 20ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x0F9,
+                                 .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GEELY_292 = {.FD = false,  //T-BOX 100ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x292,
+                                 .data = {0x00, 0x00, 0x00, 0x1F, 0xE7, 0xE7, 0x00, 0xBC}};
+  CAN_classic_frame GEELY_0FA = {.FD = false,  //??? 20ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x0FA,
+                                 .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GEELY_197 = {.FD = false,  //??? 20ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x197,
+                                 .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A}};
+  CAN_classic_frame GEELY_150 = {.FD = false,  //EPS 20ms
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x150,
+                                 .data = {0x7E, 0x00, 0x24, 0x00, 0x01, 0x01, 0x00, 0xA9}};
+  CAN_classic_frame GEELY_POLL = {.FD = false,  //Polling frame
+                                  .ext_ID = false,
+                                  .DLC = 8,
+                                  .ID = 0x7E2,
+                                  .data = {0x03, 0x22, 0x4B, 0xDA, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GEELY_ACK = {.FD = false,  //Ack frame
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x7E2,
+                                 .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
   uint16_t poll_pid = POLL_SOC;
   uint16_t incoming_poll = 0;
   uint8_t counter_10ms = 0;
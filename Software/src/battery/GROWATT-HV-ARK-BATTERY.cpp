@@ -13,12 +13,12 @@ static inline int16_t read_s16_be(const CAN_frame& f, int idx) {
   return (int16_t)read_u16_be(f, idx);
 }
 
-static inline void write_u16_be(CAN_frame& f, int idx, uint16_t v) {
+static inline void write_u16_be(CAN_classic_frame& f, int idx, uint16_t v) {
   f.data.u8[idx] = (uint8_t)(v >> 8);
   f.data.u8[idx + 1] = (uint8_t)(v & 0xFF);
 }
 
-static inline void write_u32_be(CAN_frame& f, int idx, uint32_t v) {
+static inline void write_u32_be(CAN_classic_frame& f, int idx, uint32_t v) {
   f.data.u8[idx] = (uint8_t)(v >> 24);
   f.data.u8[idx + 1] = (uint8_t)((v >> 16) & 0xFF);
   f.data.u8[idx + 2] = (uint8_t)((v >> 8) & 0xFF);
@@ -40,7 +40,7 @@ void GrowattHvArkBattery::setup(void) {
   datalayer.system.status.battery_allows_contactor_closing = false;
 }
 
-void GrowattHvArkBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void GrowattHvArkBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x3110: {
       datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
@@ -22,7 +22,7 @@ class GrowattHvArkBattery : public CanBattery {
   ~GrowattHvArkBattery() {}
 
   void setup(void) override;
-  void handle_incoming_can_frame(CAN_frame rx_frame) override;
+  void handle_incoming_can_frame(const CAN_frame& rx_frame) override;
   void update_values() override;
   void transmit_can(unsigned long currentMillis) override;
 
@@ -30,21 +30,21 @@ class GrowattHvArkBattery : public CanBattery {
 
  private:
   // --- Outgoing (PCS -> Battery) ---
-  CAN_frame PCS_3010 = {.FD = false,
-                        .ext_ID = true,
-                        .DLC = 8,
-                        .ID = 0x3010,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame PCS_3020 = {.FD = false,
-                        .ext_ID = true,
-                        .DLC = 8,
-                        .ID = 0x3020,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame PCS_3030 = {.FD = false,
-                        .ext_ID = true,
-                        .DLC = 8,
-                        .ID = 0x3030,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PCS_3010 = {.FD = false,
+                                .ext_ID = true,
+                                .DLC = 8,
+                                .ID = 0x3010,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PCS_3020 = {.FD = false,
+                                .ext_ID = true,
+                                .DLC = 8,
+                                .ID = 0x3020,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PCS_3030 = {.FD = false,
+                                .ext_ID = true,
+                                .DLC = 8,
+                                .ID = 0x3030,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   unsigned long previousMillis1000 = 0;
   uint16_t send_times = 0;
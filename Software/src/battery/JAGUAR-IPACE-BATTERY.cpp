@@ -42,11 +42,11 @@ static bool HVIsolationTestStatus = false;
 
 /* KeepAlive: PMZ_CAN_GWM_OSEK_NM_Pdu every 200ms.
  */
-CAN_frame ipace_keep_alive = {.FD = false,
-                              .ext_ID = false,
-                              .DLC = 8,
-                              .ID = 0x51e,
-                              .data = {0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+CAN_classic_frame ipace_keep_alive = {.FD = false,
+                                      .ext_ID = false,
+                                      .DLC = 8,
+                                      .ID = 0x51e,
+                                      .data = {0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
 /* KeepAlive: PMZ_CAN_NodeGWM_NM every 1s.
  * TODO: This may be needed for >2021 models.
@@ -99,7 +99,7 @@ void JaguarIpaceBattery::update_values() {
   }
 }
 
-void JaguarIpaceBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void JaguarIpaceBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
 
   switch (rx_frame.ID) {  // These messages are periodically transmitted by the battery
     case 0x080:
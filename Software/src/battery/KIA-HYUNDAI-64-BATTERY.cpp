@@ -80,7 +80,7 @@ void KiaHyundai64Battery::update_number_of_cells() {
   }
 }
 
-void KiaHyundai64Battery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void KiaHyundai64Battery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x4DE:
       datalayer_battery->status.CAN_battery_still_alive = CAN_STILL_ALIVE;
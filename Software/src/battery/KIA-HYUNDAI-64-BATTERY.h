@@ -26,7 +26,7 @@ class KiaHyundai64Battery : public CanBattery {
   }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Kia/Hyundai 64/40kWh battery";
@@ -103,50 +103,50 @@ class KiaHyundai64Battery : public CanBattery {
   uint16_t accumulated_normal_charging_energy_kWh = 0;
   uint16_t accumulated_fastcharging_energy_kWh = 0;
 
-  CAN_frame KIA_HYUNDAI_200 = {.FD = false,
-                               .ext_ID = false,
-                               .DLC = 8,
-                               .ID = 0x200,
-                               .data = {0x00, 0x80, 0xD8, 0x04, 0x00, 0x17, 0xD0, 0x00}};
-  CAN_frame KIA_HYUNDAI_523 = {.FD = false,
-                               .ext_ID = false,
-                               .DLC = 8,
-                               .ID = 0x523,
-                               .data = {0x08, 0x38, 0x36, 0x36, 0x33, 0x34, 0x00, 0x01}};
-  CAN_frame KIA_HYUNDAI_524 = {.FD = false,
-                               .ext_ID = false,
-                               .DLC = 8,
-                               .ID = 0x524,
-                               .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame KIA_HYUNDAI_200 = {.FD = false,
+                                       .ext_ID = false,
+                                       .DLC = 8,
+                                       .ID = 0x200,
+                                       .data = {0x00, 0x80, 0xD8, 0x04, 0x00, 0x17, 0xD0, 0x00}};
+  CAN_classic_frame KIA_HYUNDAI_523 = {.FD = false,
+                                       .ext_ID = false,
+                                       .DLC = 8,
+                                       .ID = 0x523,
+                                       .data = {0x08, 0x38, 0x36, 0x36, 0x33, 0x34, 0x00, 0x01}};
+  CAN_classic_frame KIA_HYUNDAI_524 = {.FD = false,
+                                       .ext_ID = false,
+                                       .DLC = 8,
+                                       .ID = 0x524,
+                                       .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
   //553 Needed frame 200ms
-  CAN_frame KIA64_553 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x553,
-                         .data = {0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00}};
+  CAN_classic_frame KIA64_553 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x553,
+                                 .data = {0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00}};
   //57F Needed frame 100ms
-  CAN_frame KIA64_57F = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x57F,
-                         .data = {0x80, 0x0A, 0x72, 0x00, 0x00, 0x00, 0x00, 0x72}};
+  CAN_classic_frame KIA64_57F = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x57F,
+                                 .data = {0x80, 0x0A, 0x72, 0x00, 0x00, 0x00, 0x00, 0x72}};
   //Needed frame 100ms
-  CAN_frame KIA64_2A1 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x2A1,
-                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame KIA64_7E4_OPEN_CONTACTOR_SEQUENCE = {.FD = false,
-                                                 .ext_ID = false,
-                                                 .DLC = 8,
-                                                 .ID = 0x7E4,
-                                                 .data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame KIA64_7E4_poll = {.FD = false,
-                              .ext_ID = false,
-                              .DLC = 8,
-                              .ID = 0x7E4,
-                              .data = {0x03, 0x22, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame KIA64_7E4_ack = {
+  CAN_classic_frame KIA64_2A1 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x2A1,
+                                 .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame KIA64_7E4_OPEN_CONTACTOR_SEQUENCE = {.FD = false,
+                                                         .ext_ID = false,
+                                                         .DLC = 8,
+                                                         .ID = 0x7E4,
+                                                         .data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame KIA64_7E4_poll = {.FD = false,
+                                      .ext_ID = false,
+                                      .DLC = 8,
+                                      .ID = 0x7E4,
+                                      .data = {0x03, 0x22, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame KIA64_7E4_ack = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
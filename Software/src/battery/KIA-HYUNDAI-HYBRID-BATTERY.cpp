@@ -9,7 +9,7 @@
 - We need to figure out how to keep the BMS alive. Most likely we need to send a specific CAN message
 */
 
-static uint8_t CalculateCRC8(const CAN_frame& frame) {
+static uint8_t CalculateCRC8(const CAN_classic_frame& frame) {
   uint8_t crc = 0x00;
 
   for (uint8_t i = 0; i < 8; i++) {
@@ -75,7 +75,7 @@ void KiaHyundaiHybridBattery::
   }
 }
 
-void KiaHyundaiHybridBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void KiaHyundaiHybridBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x5F1:
       break;
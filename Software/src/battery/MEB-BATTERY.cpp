@@ -45,7 +45,7 @@ const int RX_DEFAULT = 0xE000;
  * @see https://www.autosar.org/fileadmin/user_upload/standards/classic/4-3/AUTOSAR_SWS_CRCLibrary.pdf
  * @see https://web.archive.org/web/20221105210302/https://www.autosar.org/fileadmin/user_upload/standards/classic/4-3/AUTOSAR_SWS_CRCLibrary.pdf
  */
-uint8_t vw_crc_calc(uint8_t* inputBytes, uint8_t length, uint32_t address) {
+uint8_t vw_crc_calc(const uint8_t* inputBytes, uint8_t length, uint32_t address) {
 
   const uint8_t poly = 0x2F;
   const uint8_t xor_output = 0xFF;
@@ -306,7 +306,7 @@ void MebBattery::
   datalayer_extended.meb.charging_active = charging_active;
 }
 
-void MebBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void MebBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   last_can_msg_timestamp = millis();
   if (first_can_msg == 0) {
     logging.printf("MEB: First CAN msg received\n");
@@ -8,7 +8,7 @@
 class Mg5Battery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void update_soc(uint16_t soc_times_ten);
   virtual void transmit_can(unsigned long currentMillis);
@@ -104,168 +104,174 @@ class Mg5Battery : public CanBattery {
   UDS_RxContext gUDSContext;
 
   //0x781 UDS diagnostic requests - Extended Session Control
-  CAN_frame MG5_781_ses_ctrl = {.FD = false,
-                                .ext_ID = false,
-                                .DLC = 8,
-                                .ID = 0x781,
-                                .data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame MG5_781_ses_ctrl = {.FD = false,
+                                        .ext_ID = false,
+                                        .DLC = 8,
+                                        .ID = 0x781,
+                                        .data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   //0x781 UDS diagnostic requests - Session Response
-  CAN_frame MG5_781_ses_resp = {.FD = false,
-                                .ext_ID = false,
-                                .DLC = 8,
-                                .ID = 0x789,
-                                .data = {0x02, 0x50, 0x03, 0x00, 0x32, 0x01, 0xF4, 0x00}};
+  CAN_classic_frame MG5_781_ses_resp = {.FD = false,
+                                        .ext_ID = false,
+                                        .DLC = 8,
+                                        .ID = 0x789,
+                                        .data = {0x02, 0x50, 0x03, 0x00, 0x32, 0x01, 0xF4, 0x00}};
 
   //0x781 UDS diagnostic requests - keep alive
-  CAN_frame MG5_781_keep_alive = {.FD = false,
-                                  .ext_ID = false,
-                                  .DLC = 8,
-                                  .ID = 0x781,
-                                  .data = {0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame MG5_781_keep_alive = {.FD = false,
+                                          .ext_ID = false,
+                                          .DLC = 8,
+                                          .ID = 0x781,
+                                          .data = {0x02, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
   //0x781 UDS diagnostic requests - keep alive
-  CAN_frame MG5_781_RQ_CONTINUE_MULTIFRAME = {.FD = false,
+  CAN_classic_frame MG5_781_RQ_CONTINUE_MULTIFRAME = {.FD = false,
+                                                      .ext_ID = false,
+                                                      .DLC = 8,
+                                                      .ID = 0x781,
+                                                      .data = {0x30, 0x03, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+  //0x781 UDS diagnostic requests - request all DTC's
+  CAN_classic_frame MG5_781_RQ_DTCs = {.FD = false,
+                                       .ext_ID = false,
+                                       .DLC = 8,
+                                       .ID = 0x781,
+                                       .data = {0x03, 0x19, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00}};
+
+  //0x781 UDS diagnostic requests - clear all DTC's
+  CAN_classic_frame MG5_781_CLEAR_DTCs = {.FD = false,
+                                          .ext_ID = false,
+                                          .DLC = 8,
+                                          .ID = 0x781,
+                                          .data = {0x04, 0x14, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00}};
+
+  CAN_classic_frame MG5_781_RQ_BUS_VOLTAGE = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x781,
+      .data = {0x03, 0x22, 0xB0, 0x41, 0x00, 0x00, 0x00, 0x00}};  //battery bus voltage
+
+  CAN_classic_frame MG5_781_RQ_BAT_VOLTAGE = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x781,
+      .data = {0x03, 0x22, 0xB0, 0x42, 0x00, 0x00, 0x00, 0x00}};  //  Battery Voltage
+
+  CAN_classic_frame MG5_781_RQ_BAT_CURRENT = {.FD = false,
                                               .ext_ID = false,
                                               .DLC = 8,
                                               .ID = 0x781,
-                                              .data = {0x30, 0x03, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00}};
+                                              .data = {0x03, 0x22, 0xB0, 0x43, 0x00, 0x00, 0x00, 0x00}};  //  Current
 
-  //0x781 UDS diagnostic requests - request all DTC's
-  CAN_frame MG5_781_RQ_DTCs = {.FD = false,
-                               .ext_ID = false,
-                               .DLC = 8,
-                               .ID = 0x781,
-                               .data = {0x03, 0x19, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame MG5_781_RQ_BAT_RESISTANCE = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x781,
+      .data = {0x03, 0x22, 0xB0, 0x45, 0x00, 0x00, 0x00, 0x00}};  //  Resistance
 
-  //0x781 UDS diagnostic requests - clear all DTC's
-  CAN_frame MG5_781_CLEAR_DTCs = {.FD = false,
-                                  .ext_ID = false,
-                                  .DLC = 8,
-                                  .ID = 0x781,
-                                  .data = {0x04, 0x14, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00}};
-
-  CAN_frame MG5_781_RQ_BUS_VOLTAGE = {.FD = false,
-                                      .ext_ID = false,
-                                      .DLC = 8,
-                                      .ID = 0x781,
-                                      .data = {0x03, 0x22, 0xB0, 0x41, 0x00, 0x00, 0x00, 0x00}};  //battery bus voltage
-
-  CAN_frame MG5_781_RQ_BAT_VOLTAGE = {.FD = false,
-                                      .ext_ID = false,
-                                      .DLC = 8,
-                                      .ID = 0x781,
-                                      .data = {0x03, 0x22, 0xB0, 0x42, 0x00, 0x00, 0x00, 0x00}};  //  Battery Voltage
-
-  CAN_frame MG5_781_RQ_BAT_CURRENT = {.FD = false,
-                                      .ext_ID = false,
-                                      .DLC = 8,
-                                      .ID = 0x781,
-                                      .data = {0x03, 0x22, 0xB0, 0x43, 0x00, 0x00, 0x00, 0x00}};  //  Current
-
-  CAN_frame MG5_781_RQ_BAT_RESISTANCE = {.FD = false,
-                                         .ext_ID = false,
-                                         .DLC = 8,
-                                         .ID = 0x781,
-                                         .data = {0x03, 0x22, 0xB0, 0x45, 0x00, 0x00, 0x00, 0x00}};  //  Resistance
-
-  CAN_frame MG5_781_RQ_BAT_SOC = {.FD = false,
-                                  .ext_ID = false,
-                                  .DLC = 8,
-                                  .ID = 0x781,
-                                  .data = {0x03, 0x22, 0xB0, 0x46, 0x00, 0x00, 0x00, 0x00}};  //  State of Charge
-
-  CAN_frame MG5_781_RQ_BMS_ERR = {.FD = false,
-                                  .ext_ID = false,
-                                  .DLC = 8,
-                                  .ID = 0x781,
-                                  .data = {0x03, 0x22, 0xB0, 0x47, 0x00, 0x00, 0x00, 0x00}};  //  BMS Error
-
-  CAN_frame MG5_781_RQ_BMS_STATE = {.FD = false,
-                                    .ext_ID = false,
-                                    .DLC = 8,
-                                    .ID = 0x781,
-                                    .data = {0x03, 0x22, 0xB0, 0x48, 0x00, 0x00, 0x00, 0x00}};  //  BMS Status
-
-  CAN_frame MG5_781_RQ_BAT_RELAY_B = {
+  CAN_classic_frame MG5_781_RQ_BAT_SOC = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x781,
+      .data = {0x03, 0x22, 0xB0, 0x46, 0x00, 0x00, 0x00, 0x00}};  //  State of Charge
+
+  CAN_classic_frame MG5_781_RQ_BMS_ERR = {.FD = false,
+                                          .ext_ID = false,
+                                          .DLC = 8,
+                                          .ID = 0x781,
+                                          .data = {0x03, 0x22, 0xB0, 0x47, 0x00, 0x00, 0x00, 0x00}};  //  BMS Error
+
+  CAN_classic_frame MG5_781_RQ_BMS_STATE = {.FD = false,
+                                            .ext_ID = false,
+                                            .DLC = 8,
+                                            .ID = 0x781,
+                                            .data = {0x03, 0x22, 0xB0, 0x48, 0x00, 0x00, 0x00, 0x00}};  //  BMS Status
+
+  CAN_classic_frame MG5_781_RQ_BAT_RELAY_B = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x781,
       .data = {0x03, 0x22, 0xB0, 0x49, 0x00, 0x00, 0x00, 0x00}};  //  Battery Relay Status
 
-  CAN_frame MG5_781_RQ_BAT_RELAY_G = {
+  CAN_classic_frame MG5_781_RQ_BAT_RELAY_G = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x781,
       .data = {0x03, 0x22, 0xB0, 0x4A, 0x00, 0x00, 0x00, 0x00}};  //  Battery Relay Status
 
-  CAN_frame MG5_781_RQ_BAT_RELAY_P = {
+  CAN_classic_frame MG5_781_RQ_BAT_RELAY_P = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x781,
       .data = {0x03, 0x22, 0xB0, 0x52, 0x00, 0x00, 0x00, 0x00}};  //  Battery Relay Status
 
-  CAN_frame MG5_781_RQ_BAT_TEMP = {
+  CAN_classic_frame MG5_781_RQ_BAT_TEMP = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x781,
       .data = {0x03, 0x22, 0xB0, 0x56, 0x00, 0x00, 0x00, 0x00}};  //  Battery Temperature Status
 
-  CAN_frame MG5_781_RQ_MAX_CELL = {.FD = false,
-                                   .ext_ID = false,
-                                   .DLC = 8,
-                                   .ID = 0x781,
-                                   .data = {0x03, 0x22, 0xB0, 0x58, 0x00, 0x00, 0x00, 0x00}};  //  MAX Cell Voltage
+  CAN_classic_frame MG5_781_RQ_MAX_CELL = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x781,
+      .data = {0x03, 0x22, 0xB0, 0x58, 0x00, 0x00, 0x00, 0x00}};  //  MAX Cell Voltage
 
-  CAN_frame MG5_781_RQ_MIN_CELL = {.FD = false,
-                                   .ext_ID = false,
-                                   .DLC = 8,
-                                   .ID = 0x781,
-                                   .data = {0x03, 0x22, 0xB0, 0x59, 0x00, 0x00, 0x00, 0x00}};  //  MIN Cell Voltage
+  CAN_classic_frame MG5_781_RQ_MIN_CELL = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x781,
+      .data = {0x03, 0x22, 0xB0, 0x59, 0x00, 0x00, 0x00, 0x00}};  //  MIN Cell Voltage
 
-  CAN_frame MG5_781_RQ_COOLANT_TEMP = {
+  CAN_classic_frame MG5_781_RQ_COOLANT_TEMP = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x781,
       .data = {0x03, 0x22, 0xB0, 0x5C, 0x00, 0x00, 0x00, 0x00}};  //  Coolant Temperature Status
 
-  CAN_frame MG5_781_RQ_BAT_SOH = {
+  CAN_classic_frame MG5_781_RQ_BAT_SOH = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x781,
       .data = {0x03, 0x22, 0xB0, 0x61, 0x00, 0x00, 0x00, 0x00}};  //  Battery State of Health
 
-  CAN_frame MG5_781_RQ_BMS_TIME = {
+  CAN_classic_frame MG5_781_RQ_BMS_TIME = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x781,
       .data = {0x03, 0x22, 0xB0, 0x6D, 0x00, 0x00, 0x00, 0x00}};  //  Battery Management System Time
 
-  CAN_frame MG5_8A = {.FD = false,
-                      .ext_ID = false,
-                      .DLC = 8,
-                      .ID = 0x08A,
-                      .data = {0x80, 0x00, 0x00, 0x04, 0x00, 0x02, 0xBB, 0x3F}};
+  CAN_classic_frame MG5_8A = {.FD = false,
+                              .ext_ID = false,
+                              .DLC = 8,
+                              .ID = 0x08A,
+                              .data = {0x80, 0x00, 0x00, 0x04, 0x00, 0x02, 0xBB, 0x3F}};
 
-  CAN_frame MG5_1F1 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x1F1,
-                       .data = {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame MG5_1F1 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x1F1,
+                               .data = {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   //Setup Fast UDS values to poll for
-  //CAN_frame* UDS_REQUESTS_FAST[0] = {};
+  //CAN_classic_frame* UDS_REQUESTS_FAST[0] = {};
   //int numFastUDSreqs =
   //    sizeof(UDS_REQUESTS_FAST) / sizeof(UDS_REQUESTS_FAST[0]);  //Store Number of elements in the array
 
   //Setup Slow UDS values to poll for
-  CAN_frame* UDS_REQUESTS_SLOW[15] = {
+  CAN_classic_frame* UDS_REQUESTS_SLOW[15] = {
       &MG5_781_RQ_BUS_VOLTAGE, &MG5_781_RQ_BAT_VOLTAGE,  &MG5_781_RQ_BAT_CURRENT, &MG5_781_RQ_BAT_RESISTANCE,
       &MG5_781_RQ_BAT_SOC,     &MG5_781_RQ_BMS_ERR,      &MG5_781_RQ_BMS_STATE,   &MG5_781_RQ_BAT_RELAY_B,
       &MG5_781_RQ_BAT_RELAY_G, &MG5_781_RQ_BAT_RELAY_P,  &MG5_781_RQ_BAT_TEMP,    &MG5_781_RQ_MAX_CELL,
@@ -6,7 +6,7 @@
 class MgHsPHEVBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
 
@@ -71,35 +71,35 @@ class MgHsPHEVBattery : public CanBattery {
   const float DischargeTaperExponent =
       1;  // Shape of discharge power taper to zero. 1 is linear. >1 reduces quickly and is small at nearly full.
 
-  CAN_frame MG_HS_8A = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x08A,
-                        .data = {0x80, 0x00, 0x00, 0x04, 0x00, 0x02, 0x36, 0xB0}};
-  CAN_frame MG_HS_1F1 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x1F1,
-                         .data = {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame MG_HS_7E5_POLL = {.FD = false,
-                              .ext_ID = false,
-                              .DLC = 8,
-                              .ID = 0x7E5,
-                              .data = {0x03, 0x22, 0xB0, 0x42, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame MG_HS_8A = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x08A,
+                                .data = {0x80, 0x00, 0x00, 0x04, 0x00, 0x02, 0x36, 0xB0}};
+  CAN_classic_frame MG_HS_1F1 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x1F1,
+                                 .data = {0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame MG_HS_7E5_POLL = {.FD = false,
+                                      .ext_ID = false,
+                                      .DLC = 8,
+                                      .ID = 0x7E5,
+                                      .data = {0x03, 0x22, 0xB0, 0x42, 0x00, 0x00, 0x00, 0x00}};
 
   // Enter UDS extended-diagnostics mode
-  static constexpr CAN_frame MG_HS_7E5_DIAG = {.FD = false,
-                                               .ext_ID = false,
-                                               .DLC = 8,
-                                               .ID = 0x7E5,
-                                               .data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame MG_HS_7E5_DIAG = {.FD = false,
+                                                       .ext_ID = false,
+                                                       .DLC = 8,
+                                                       .ID = 0x7E5,
+                                                       .data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // BMS hard reset
-  static constexpr CAN_frame MG_HS_7E5_RESET = {.FD = false,
-                                                .ext_ID = false,
-                                                .DLC = 8,
-                                                .ID = 0x7E5,
-                                                .data = {0x02, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame MG_HS_7E5_RESET = {.FD = false,
+                                                        .ext_ID = false,
+                                                        .DLC = 8,
+                                                        .ID = 0x7E5,
+                                                        .data = {0x02, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00}};
 };
 
 #endif
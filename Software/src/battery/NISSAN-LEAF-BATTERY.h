@@ -28,7 +28,7 @@ class NissanLeafBattery : public CanBattery {
   }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
 
@@ -44,7 +44,7 @@ class NissanLeafBattery : public CanBattery {
   BatteryHtmlRenderer& get_status_renderer() { return renderer; }
   static constexpr const char* Name = "Nissan LEAF battery";
 
-  uint8_t calculate_crc(CAN_frame& frame);
+  uint8_t calculate_crc(const CAN_frame& frame);
 
  private:
   static const int MAX_PACK_VOLTAGE_DV = 4040;  //5000 = 500.0V
@@ -55,7 +55,7 @@ class NissanLeafBattery : public CanBattery {
 
   NissanLeafHtmlRenderer renderer;
 
-  bool is_message_corrupt(CAN_frame rx_frame);
+  bool is_message_corrupt(const CAN_frame& rx_frame);
   void clearSOH(void);
 
   DATALAYER_BATTERY_TYPE* datalayer_battery;
@@ -80,57 +80,61 @@ class NissanLeafBattery : public CanBattery {
   static const uint8_t ZE1_BATTERY = 2;
 
   // These CAN messages need to be sent towards the battery to keep it alive
-  CAN_frame LEAF_1F2 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x1F2,
-                        .data = {0x10, 0x64, 0x00, 0xB0, 0x00, 0x1E, 0x00, 0x8F}};
-  CAN_frame LEAF_50B = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 7,
-                        .ID = 0x50B,
-                        .data = {0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00}};
-  CAN_frame LEAF_50C = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 6,
-                        .ID = 0x50C,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame LEAF_1D4 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x1D4,
-                        .data = {0x6E, 0x6E, 0x00, 0x04, 0x07, 0x46, 0xE0, 0x44}};
+  CAN_classic_frame LEAF_1F2 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x1F2,
+                                .data = {0x10, 0x64, 0x00, 0xB0, 0x00, 0x1E, 0x00, 0x8F}};
+  CAN_classic_frame LEAF_50B = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 7,
+                                .ID = 0x50B,
+                                .data = {0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00}};
+  CAN_classic_frame LEAF_50C = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 6,
+                                .ID = 0x50C,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame LEAF_1D4 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x1D4,
+                                .data = {0x6E, 0x6E, 0x00, 0x04, 0x07, 0x46, 0xE0, 0x44}};
   // Extra CAN messages for ZE1 batteries
-  CAN_frame LEAF_355 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x355,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00}};
-  CAN_frame LEAF_3B8 = {.FD = false, .ext_ID = false, .DLC = 5, .ID = 0x3B8, .data = {0x7F, 0xE8, 0x01, 0x07, 0xFF}};
-  CAN_frame LEAF_5C5 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x5C5,
-                        .data = {0x40, 0x01, 0x2F, 0x5E, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame LEAF_5EC = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x5EC, .data = {0x00}};
-  CAN_frame LEAF_626 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 6,
-                        .ID = 0x626,
-                        .data = {0x02, 0x00, 0xff, 0x1d, 0x20, 0x00}};
+  CAN_classic_frame LEAF_355 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x355,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00}};
+  CAN_classic_frame LEAF_3B8 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 5,
+                                .ID = 0x3B8,
+                                .data = {0x7F, 0xE8, 0x01, 0x07, 0xFF}};
+  CAN_classic_frame LEAF_5C5 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x5C5,
+                                .data = {0x40, 0x01, 0x2F, 0x5E, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame LEAF_5EC = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x5EC, .data = {0x00}};
+  CAN_classic_frame LEAF_626 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 6,
+                                .ID = 0x626,
+                                .data = {0x02, 0x00, 0xff, 0x1d, 0x20, 0x00}};
   // Active polling messages
   uint8_t PIDgroups[7] = {0x01, 0x02, 0x04, 0x06, 0x83, 0x84, 0x90};
   uint8_t PIDindex = 0;
-  CAN_frame LEAF_GROUP_REQUEST = {.FD = false,
-                                  .ext_ID = false,
-                                  .DLC = 8,
-                                  .ID = 0x79B,
-                                  .data = {2, 0x21, 1, 0, 0, 0, 0, 0}};
-  CAN_frame LEAF_NEXT_LINE_REQUEST = {.FD = false,
-                                      .ext_ID = false,
-                                      .DLC = 8,
-                                      .ID = 0x79B,
-                                      .data = {0x30, 1, 0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+  CAN_classic_frame LEAF_GROUP_REQUEST = {.FD = false,
+                                          .ext_ID = false,
+                                          .DLC = 8,
+                                          .ID = 0x79B,
+                                          .data = {2, 0x21, 1, 0, 0, 0, 0, 0}};
+  CAN_classic_frame LEAF_NEXT_LINE_REQUEST = {.FD = false,
+                                              .ext_ID = false,
+                                              .DLC = 8,
+                                              .ID = 0x79B,
+                                              .data = {0x30, 1, 0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
 
   // The Li-ion battery controller only accepts a multi-message query. In fact, the LBC transmits many
   // groups: the first one contains lots of High Voltage battery data as SOC, currents, and voltage; the second
@@ -203,11 +207,11 @@ class NissanLeafBattery : public CanBattery {
   uint8_t solvedChallenge[8];
   bool challengeFailed = false;
 
-  CAN_frame LEAF_CLEAR_SOH = {.FD = false,
-                              .ext_ID = false,
-                              .DLC = 8,
-                              .ID = 0x79B,
-                              .data = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+  CAN_classic_frame LEAF_CLEAR_SOH = {.FD = false,
+                                      .ext_ID = false,
+                                      .DLC = 8,
+                                      .ID = 0x79B,
+                                      .data = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
 
 #endif
 };
@@ -26,7 +26,7 @@ class PylonBattery : public CanBattery {
   }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Pylon compatible battery";
@@ -50,38 +50,38 @@ class PylonBattery : public CanBattery {
   unsigned long previousMillis5000 = 0;  // will store last time a 5s CAN Message was sent
 
   //Actual content messages
-  CAN_frame PYLON_3010 = {.FD = false,
-                          .ext_ID = true,
-                          .DLC = 8,
-                          .ID = 0x3010,
-                          .data = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame PYLON_8200 = {.FD = false,
-                          .ext_ID = true,
-                          .DLC = 8,
-                          .ID = 0x8200,
-                          .data = {0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame PYLON_8210 = {.FD = false,
-                          .ext_ID = true,
-                          .DLC = 8,
-                          .ID = 0x8210,
-                          .data = {0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame PYLON_4200 = {.FD = false,
-                          .ext_ID = true,
-                          .DLC = 8,
-                          .ID = 0x4200,
-                          .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PYLON_3010 = {.FD = false,
+                                  .ext_ID = true,
+                                  .DLC = 8,
+                                  .ID = 0x3010,
+                                  .data = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PYLON_8200 = {.FD = false,
+                                  .ext_ID = true,
+                                  .DLC = 8,
+                                  .ID = 0x8200,
+                                  .data = {0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PYLON_8210 = {.FD = false,
+                                  .ext_ID = true,
+                                  .DLC = 8,
+                                  .ID = 0x8210,
+                                  .data = {0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PYLON_4200 = {.FD = false,
+                                  .ext_ID = true,
+                                  .DLC = 8,
+                                  .ID = 0x4200,
+                                  .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
   // EMUS request for individual cell voltages
-  CAN_frame EMUS_CELL_VOLTAGE_REQUEST = {.FD = false,
-                                         .ext_ID = true,
-                                         .DLC = 1,
-                                         .ID = 0x19B50100,
-                                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame EMUS_CELL_VOLTAGE_REQUEST = {.FD = false,
+                                                 .ext_ID = true,
+                                                 .DLC = 1,
+                                                 .ID = 0x19B50100,
+                                                 .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
   // EMUS request for individual cell balancing status
-  CAN_frame EMUS_CELL_BALANCING_REQUEST = {.FD = false,
-                                           .ext_ID = true,
-                                           .DLC = 1,
-                                           .ID = 0x19B50300,
-                                           .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame EMUS_CELL_BALANCING_REQUEST = {.FD = false,
+                                                   .ext_ID = true,
+                                                   .DLC = 1,
+                                                   .ID = 0x19B50300,
+                                                   .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   int16_t celltemperature_max_dC = 0;
   int16_t celltemperature_min_dC = 0;
@@ -6,7 +6,7 @@
 class RangeRoverPhevBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Range Rover 13kWh PHEV battery (L494/L405)";
@@ -116,11 +116,11 @@ class RangeRoverPhevBattery : public CanBattery {
       0;  //fac0.1 , Total Battery capacity in Kwh. This will reduce over the lifetime of the HV Battery.
 
   //CAN messages needed by battery (LOG needed!)
-  CAN_frame RANGE_ROVER_18B = {.FD = false,
-                               .ext_ID = false,
-                               .DLC = 8,
-                               .ID = 0x18B,  //CONTENT??? TODO
-                               .data = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame RANGE_ROVER_18B = {.FD = false,
+                                       .ext_ID = false,
+                                       .DLC = 8,
+                                       .ID = 0x18B,  //CONTENT??? TODO
+                                       .data = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 };
 
 #endif
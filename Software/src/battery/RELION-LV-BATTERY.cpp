@@ -113,7 +113,7 @@ void RelionBattery::update_values() {
   datalayer_battery->status.cell_min_voltage_mV = min_cell_voltage;
 }
 
-void RelionBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void RelionBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x02018100:  //ID1 (Example frame 10 08 01 F0 00 00 00 00)
       datalayer_battery->status.CAN_battery_still_alive = CAN_STILL_ALIVE;
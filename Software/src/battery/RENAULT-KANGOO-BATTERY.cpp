@@ -53,7 +53,7 @@ void RenaultKangooBattery::
   datalayer.battery.status.cell_max_voltage_mV = LB_Cell_Max_Voltage;
 }
 
-void RenaultKangooBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void RenaultKangooBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
 
   switch (rx_frame.ID) {
     case 0x155:  //BMS1
@@ -26,7 +26,7 @@ class RenaultZoeGen1Battery : public CanBattery {
   }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Renault Zoe Gen1 22/40kWh";
@@ -52,21 +52,21 @@ class RenaultZoeGen1Battery : public CanBattery {
   unsigned long previousMillis250 = 0;  // will store last time a 250ms CAN Message was sent
   uint8_t counter_423 = 0;
 
-  CAN_frame ZOE_423 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x423,
-                       .data = {0x07, 0x1d, 0x00, 0x02, 0x5d, 0x80, 0x5d, 0xc8}};
-  CAN_frame ZOE_POLL_79B = {.FD = false,
-                            .ext_ID = false,
-                            .DLC = 8,
-                            .ID = 0x79B,
-                            .data = {0x02, 0x21, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ZOE_ACK_79B = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x79B,
-                           .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ZOE_423 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x423,
+                               .data = {0x07, 0x1d, 0x00, 0x02, 0x5d, 0x80, 0x5d, 0xc8}};
+  CAN_classic_frame ZOE_POLL_79B = {.FD = false,
+                                    .ext_ID = false,
+                                    .DLC = 8,
+                                    .ID = 0x79B,
+                                    .data = {0x02, 0x21, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ZOE_ACK_79B = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x79B,
+                                   .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
 #define GROUP1_CELLVOLTAGES_1_POLL 0x41
 #define GROUP2_CELLVOLTAGES_2_POLL 0x42
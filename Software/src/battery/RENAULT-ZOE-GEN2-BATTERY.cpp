@@ -23,16 +23,16 @@ https://github.com/ljames28/Renault-Zoe-PH2-ZE50-Canbus-LBC-Information?tab=read
 https://github.com/fesch/CanZE/tree/master/app/src/main/assets/ZOE_Ph2
 */
 
-uint8_t RenaultZoeGen2Battery::calculate_crc_zoe(CAN_frame& rx_frame, uint8_t crc_xor) {
+uint8_t RenaultZoeGen2Battery::calculate_crc_zoe(const uint8_t* data, uint8_t crc_xor) {
   uint8_t crc = 0;  //init value 0x00
   for (uint8_t j = 0; j < 7; j++) {
-    crc = crc8_table_SAE_J1850_ZER0[(crc ^ static_cast<uint8_t>(rx_frame.data.u8[j])) & 0xFF];
+    crc = crc8_table_SAE_J1850_ZER0[(crc ^ static_cast<uint8_t>(data[j])) & 0xFF];
   }
   return crc ^ crc_xor;
 }
 
-bool RenaultZoeGen2Battery::is_message_corrupt(CAN_frame rx_frame, uint8_t crc_xor) {
-  uint8_t crc = calculate_crc_zoe(rx_frame, crc_xor);
+bool RenaultZoeGen2Battery::is_message_corrupt(const CAN_frame& rx_frame, uint8_t crc_xor) {
+  uint8_t crc = calculate_crc_zoe(rx_frame.data.u8, crc_xor);
   return crc != rx_frame.data.u8[7];
 }
 
@@ -129,7 +129,7 @@ void RenaultZoeGen2Battery::update_values() {
   datalayer_extended.zoePH2.battery_soc_max = battery_soc_max;
 }
 
-void RenaultZoeGen2Battery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void RenaultZoeGen2Battery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x0F8:
       datalayer_battery->status.CAN_battery_still_alive = CAN_STILL_ALIVE;
@@ -399,7 +399,7 @@ void RenaultZoeGen2Battery::transmit_can(unsigned long currentMillis) {
     counter_10ms = (counter_10ms + 1) % 16;
 
     ZOE_0EE.data.u8[6] = counter_10ms;
-    ZOE_0EE.data.u8[7] = calculate_crc_zoe(ZOE_0EE, 0xAC);
+    ZOE_0EE.data.u8[7] = calculate_crc_zoe(ZOE_0EE.data.u8, 0xAC);
 
     transmit_can_frame(&ZOE_0EE);  //Pedal position
     //transmit_can_frame(&ZOE_133);  //Vehicle speed (CRC is frame3 B1A670 55 0006FFFF)
@@ -24,7 +24,7 @@ class RenaultZoeGen2Battery : public CanBattery {
     datalayer_zoePH2 = &datalayer_extended.zoePH2;
   }
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Renault Zoe Gen2 50kWh";
@@ -35,7 +35,7 @@ class RenaultZoeGen2Battery : public CanBattery {
 
   BatteryHtmlRenderer& get_status_renderer() { return renderer; }
 
-  uint8_t calculate_crc_zoe(CAN_frame& frame, uint8_t crc_xor);
+  uint8_t calculate_crc_zoe(const uint8_t* data, uint8_t crc_xor);
 
  private:
   RenaultZoeGen2HtmlRenderer renderer;
@@ -46,7 +46,7 @@ class RenaultZoeGen2Battery : public CanBattery {
   // If not null, this battery decides when the contactor can be closed and writes the value here.
   bool* allows_contactor_closing;
 
-  bool is_message_corrupt(CAN_frame rx_frame, uint8_t crc_xor);
+  bool is_message_corrupt(const CAN_frame& rx_frame, uint8_t crc_xor);
 
   static const int MAX_PACK_VOLTAGE_DV = 4100;  //5000 = 500.0V
   static const int MIN_PACK_VOLTAGE_DV = 3000;
@@ -244,25 +244,25 @@ class RenaultZoeGen2Battery : public CanBattery {
   unsigned long kProductionTimestamp_s =
       1614454107;  // Production timestamp in seconds since January 1, 1970. Production timestamp used: February 25, 2021 at 8:08:27 AM GMT
 
-  CAN_frame ZOE_0EE = {//Pedal position
+  CAN_classic_frame ZOE_0EE = {//Pedal position
                        .FD = false,
                        .ext_ID = false,
                        .DLC = 8,
                        .ID = 0x0EE,
                        .data = {0x32, 0x3, 0x20, 0xAA, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ZOE_373 = {//HEVC sender, wakeup message
+  CAN_classic_frame ZOE_373 = {//HEVC sender, wakeup message
                        .FD = false,
                        .ext_ID = false,
                        .DLC = 8,
                        .ID = 0x373,
                        .data = {0xC1, 0x40, 0x5D, 0xB2, 0x00, 0x01, 0xff, 0xe3}};
-  CAN_frame ZOE_375 = {//HEVC status message
+  CAN_classic_frame ZOE_375 = {//HEVC status message
                        .FD = false,
                        .ext_ID = false,
                        .DLC = 8,
                        .ID = 0x375,
                        .data = {0x02, 0x29, 0x00, 0xBF, 0xFE, 0x64, 0x0, 0xff}};
-  CAN_frame ZOE_376 = {
+  CAN_classic_frame ZOE_376 = {
       //HEVC sender
       .FD = false,
       .ext_ID = false,
@@ -270,50 +270,50 @@ class RenaultZoeGen2Battery : public CanBattery {
       .ID = 0x376,
       .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
                0x00}};  // fill first 6 bytes with 0's. The first 6 bytes are calculated based on the current time.
-  CAN_frame ZOE_5F8 = { //Vehicle ID
+  CAN_classic_frame ZOE_5F8 = { //Vehicle ID
                        .FD = false,
                        .ext_ID = false,
                        .DLC = 4,
                        .ID = 0x5F8,
                        .data = {0x16, 0x44, 0x90, 0x8F}};
-  CAN_frame ZOE_6BF = {//Total Boost Time
+  CAN_classic_frame ZOE_6BF = {//Total Boost Time
                        .FD = false,
                        .ext_ID = false,
                        .DLC = 3,
                        .ID = 0x6BF,
                        .data = {0x00, 0x00, 0x00}};
-  CAN_frame ZOE_POLL_18DADBF1 = {.FD = false,
-                                 .ext_ID = true,
-                                 .DLC = 8,
-                                 .ID = 0x18DADBF1,
-                                 .data = {0x03, 0x22, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame ZOE_POLL_FLOW_CONTROL = {.FD = false,
-                                     .ext_ID = true,
-                                     .DLC = 8,
-                                     .ID = 0x18DADBF1,
-                                     .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ZOE_POLL_18DADBF1 = {.FD = false,
+                                         .ext_ID = true,
+                                         .DLC = 8,
+                                         .ID = 0x18DADBF1,
+                                         .data = {0x03, 0x22, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame ZOE_POLL_FLOW_CONTROL = {.FD = false,
+                                             .ext_ID = true,
+                                             .DLC = 8,
+                                             .ID = 0x18DADBF1,
+                                             .data = {0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
   //NVROL Reset
-  CAN_frame ZOE_NVROL_1_18DADBF1 = {.FD = false,
-                                    .ext_ID = true,
-                                    .DLC = 8,
-                                    .ID = 0x18DADBF1,
-                                    .data = {0x02, 0x10, 0x03, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA}};
-  CAN_frame ZOE_NVROL_2_18DADBF1 = {.FD = false,
-                                    .ext_ID = true,
-                                    .DLC = 8,
-                                    .ID = 0x18DADBF1,
-                                    .data = {0x04, 0x31, 0x01, 0xB0, 0x09, 0x00, 0xAA, 0xAA}};
+  CAN_classic_frame ZOE_NVROL_1_18DADBF1 = {.FD = false,
+                                            .ext_ID = true,
+                                            .DLC = 8,
+                                            .ID = 0x18DADBF1,
+                                            .data = {0x02, 0x10, 0x03, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA}};
+  CAN_classic_frame ZOE_NVROL_2_18DADBF1 = {.FD = false,
+                                            .ext_ID = true,
+                                            .DLC = 8,
+                                            .ID = 0x18DADBF1,
+                                            .data = {0x04, 0x31, 0x01, 0xB0, 0x09, 0x00, 0xAA, 0xAA}};
   //Enable temporisation before sleep
-  CAN_frame ZOE_SLEEP_1_18DADBF1 = {.FD = false,
-                                    .ext_ID = true,
-                                    .DLC = 8,
-                                    .ID = 0x18DADBF1,
-                                    .data = {0x02, 0x10, 0x03, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA}};
-  CAN_frame ZOE_SLEEP_2_18DADBF1 = {.FD = false,
-                                    .ext_ID = true,
-                                    .DLC = 8,
-                                    .ID = 0x18DADBF1,
-                                    .data = {0x04, 0x2E, 0x92, 0x81, 0x01, 0xAA, 0xAA, 0xAA}};
+  CAN_classic_frame ZOE_SLEEP_1_18DADBF1 = {.FD = false,
+                                            .ext_ID = true,
+                                            .DLC = 8,
+                                            .ID = 0x18DADBF1,
+                                            .data = {0x02, 0x10, 0x03, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA}};
+  CAN_classic_frame ZOE_SLEEP_2_18DADBF1 = {.FD = false,
+                                            .ext_ID = true,
+                                            .DLC = 8,
+                                            .ID = 0x18DADBF1,
+                                            .data = {0x04, 0x2E, 0x92, 0x81, 0x01, 0xAA, 0xAA, 0xAA}};
 
   const uint16_t poll_commands[163] = {POLL_SOC,
                                        POLL_USABLE_SOC,
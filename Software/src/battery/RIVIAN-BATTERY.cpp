@@ -35,7 +35,7 @@ void RivianBattery::update_values() {
   datalayer.battery.status.temperature_max_dC = battery_max_temperature * 10;
 }
 
-void RivianBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void RivianBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x160:  //Current [Platform CAN]+
       datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
@@ -5,7 +5,7 @@
 class RivianBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Rivian R1T large 135kWh battery";
@@ -33,28 +33,28 @@ class RivianBattery : public CanBattery {
   static const uint8_t GO = 3;
   unsigned long previousMillis10 = 0;  // will store last time a 10ms CAN Message was sent
 
-  CAN_frame RIVIAN_150 = {.FD = false,
-                          .ext_ID = false,
-                          .DLC = 6,
-                          .ID = 0x150,
-                          .data = {0x03, 0x00, 0x01, 0x00, 0x01, 0x00}};
-  CAN_frame RIVIAN_420 = {.FD = false,
-                          .ext_ID = false,
-                          .DLC = 8,
-                          .ID = 0x420,
-                          .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame RIVIAN_41F = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x41F, .data = {0x62, 0x10, 0x00}};
-  CAN_frame RIVIAN_245 = {.FD = false,
-                          .ext_ID = false,
-                          .DLC = 6,
-                          .ID = 0x245,
-                          .data = {0x10, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame RIVIAN_200 = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x200, .data = {0x08}};
-  CAN_frame RIVIAN_207 = {.FD = false,
-                          .ext_ID = false,
-                          .DLC = 1,
-                          .ID = 0x207,
-                          .data = {0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00}};
+  CAN_classic_frame RIVIAN_150 = {.FD = false,
+                                  .ext_ID = false,
+                                  .DLC = 6,
+                                  .ID = 0x150,
+                                  .data = {0x03, 0x00, 0x01, 0x00, 0x01, 0x00}};
+  CAN_classic_frame RIVIAN_420 = {.FD = false,
+                                  .ext_ID = false,
+                                  .DLC = 8,
+                                  .ID = 0x420,
+                                  .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame RIVIAN_41F = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x41F, .data = {0x62, 0x10, 0x00}};
+  CAN_classic_frame RIVIAN_245 = {.FD = false,
+                                  .ext_ID = false,
+                                  .DLC = 6,
+                                  .ID = 0x245,
+                                  .data = {0x10, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame RIVIAN_200 = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x200, .data = {0x08}};
+  CAN_classic_frame RIVIAN_207 = {.FD = false,
+                                  .ext_ID = false,
+                                  .DLC = 1,
+                                  .ID = 0x207,
+                                  .data = {0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00}};
 };
 
 #endif
@@ -87,7 +87,7 @@ void RjxzsBms::update_values() {
   datalayer.battery.status.cell_min_voltage_mV = minimum_cell_voltage;
 }
 
-void RjxzsBms::handle_incoming_can_frame(CAN_frame rx_frame) {
+void RjxzsBms::handle_incoming_can_frame(const CAN_frame& rx_frame) {
 
   switch (rx_frame.ID) {
     case 0xF5:                 // This is the only message is sent from BMS
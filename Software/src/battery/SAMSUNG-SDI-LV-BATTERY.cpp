@@ -48,7 +48,7 @@ void SamsungSdiLVBattery::update_values() {
   datalayer.battery.info.min_design_voltage_dV = battery_discharge_voltage;
 }
 
-void SamsungSdiLVBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void SamsungSdiLVBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x500:  //Voltage, current, SOC, SOH
       datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
@@ -13,7 +13,7 @@ TODO: Tweak temperature values once more data is known about them
 TODO: Check if CRC function works like it should. This enables checking for corrupt messages
 */
 
-static uint8_t CalculateCRC8(CAN_frame rx_frame) {
+static uint8_t CalculateCRC8(const CAN_classic_frame& rx_frame) {
   int crc = 0;
 
   for (uint8_t framepos = 0; framepos < 8; framepos++) {
@@ -61,7 +61,7 @@ void SantaFePhevBattery::
   }
 }
 
-void SantaFePhevBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void SantaFePhevBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x1FF:
       datalayer_battery->status.CAN_battery_still_alive = CAN_STILL_ALIVE;
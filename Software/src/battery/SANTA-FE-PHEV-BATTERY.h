@@ -18,7 +18,7 @@ class SantaFePhevBattery : public CanBattery {
   }
 
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Santa Fe PHEV";
@@ -58,36 +58,36 @@ class SantaFePhevBattery : public CanBattery {
   uint8_t StatusBattery = 0;
   uint16_t cellvoltages_mv[96];
 
-  CAN_frame SANTAFE_200 = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x200,
-                           .data = {0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00}};
-  CAN_frame SANTAFE_2A1 = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x2A1,
-                           .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x02}};
-  CAN_frame SANTAFE_2F0 = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x2F0,
-                           .data = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00}};
-  CAN_frame SANTAFE_523 = {.FD = false,
-                           .ext_ID = false,
-                           .DLC = 8,
-                           .ID = 0x523,
-                           .data = {0x60, 0x00, 0x60, 0, 0, 0, 0, 0}};
-  CAN_frame SANTAFE_7E4_poll = {.FD = false,
-                                .ext_ID = false,
-                                .DLC = 8,
-                                .ID = 0x7E4,  //Polling frame, 0x22 01 0X
-                                .data = {0x03, 0x22, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SANTAFE_7E4_ack = {.FD = false,
-                               .ext_ID = false,
-                               .DLC = 8,
-                               .ID = 0x7E4,  //Ack frame, correct PID is returned. Flow control message
-                               .data = {0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SANTAFE_200 = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x200,
+                                   .data = {0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00}};
+  CAN_classic_frame SANTAFE_2A1 = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x2A1,
+                                   .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x02}};
+  CAN_classic_frame SANTAFE_2F0 = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x2F0,
+                                   .data = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00}};
+  CAN_classic_frame SANTAFE_523 = {.FD = false,
+                                   .ext_ID = false,
+                                   .DLC = 8,
+                                   .ID = 0x523,
+                                   .data = {0x60, 0x00, 0x60, 0, 0, 0, 0, 0}};
+  CAN_classic_frame SANTAFE_7E4_poll = {.FD = false,
+                                        .ext_ID = false,
+                                        .DLC = 8,
+                                        .ID = 0x7E4,  //Polling frame, 0x22 01 0X
+                                        .data = {0x03, 0x22, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SANTAFE_7E4_ack = {.FD = false,
+                                       .ext_ID = false,
+                                       .DLC = 8,
+                                       .ID = 0x7E4,  //Ack frame, correct PID is returned. Flow control message
+                                       .data = {0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};
 };
 
 #endif
@@ -6,7 +6,7 @@
 class SonoBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Sono Motors Sion 64kWh LFP ";
@@ -34,16 +34,16 @@ class SonoBattery : public CanBattery {
   uint8_t batterySOH = 99;
   uint8_t realSOC = 99;
 
-  CAN_frame SONO_400 = {.FD = false,  //Message of Vehicle Command, 100ms
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x400,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SONO_401 = {.FD = false,  //Message of Vehicle Date, 1000ms
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x400,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SONO_400 = {.FD = false,  //Message of Vehicle Command, 100ms
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x400,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SONO_401 = {.FD = false,  //Message of Vehicle Date, 1000ms
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x400,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 };
 
 #endif
@@ -154,12 +154,12 @@ inline void setBitField(uint8_t* data, int bytes, int startBit, int bitLen, uint
 }
 
 /// Increment a counter field and recompute an 8‑bit checksum as part of a mux
-void generateMuxFrameCounterChecksum(CAN_frame& f,
-                                     uint8_t frameCounter,  // counter value
-                                     int ctrStartBit,       // bit index of counter LSB
-                                     int ctrBitLength,      // width of counter in bits
-                                     int csumStartBit,      // bit index of checksum LSB
-                                     int csumBitLength      // width of checksum in bits
+void generateMuxFrameCounterChecksum(CAN_classic_frame& f,
+                                             uint8_t frameCounter,  // counter value
+                                             int ctrStartBit,       // bit index of counter LSB
+                                             int ctrBitLength,      // width of counter in bits
+                                             int csumStartBit,      // bit index of checksum LSB
+                                             int csumBitLength      // width of checksum in bits
 ) {
   int bytes = getDataLen(f.DLC);
   auto data = f.data.u8;
@@ -209,11 +209,11 @@ void generateMuxFrameCounterChecksum(CAN_frame& f,
 }
 
 // Increment a counter field and recompute an 8‑bit checksum
-void generateFrameCounterChecksum(CAN_frame& f,
-                                  int ctrStartBit,   // bit index of counter LSB
-                                  int ctrBitLength,  // width of counter in bits
-                                  int csumStartBit,  // bit index of checksum LSB
-                                  int csumBitLength  // width of checksum in bits
+void generateFrameCounterChecksum(CAN_classic_frame& f,
+                                          int ctrStartBit,   // bit index of counter LSB
+                                          int ctrBitLength,  // width of counter in bits
+                                          int csumStartBit,  // bit index of checksum LSB
+                                          int csumBitLength  // width of checksum in bits
 ) {
   int bytes = getDataLen(f.DLC);
   auto data = f.data.u8;
@@ -286,7 +286,8 @@ inline uint64_t extract_signal_value(const uint8_t* data, uint32_t start_bit, ui
 }
 
 // Function to write a value to a given CAN frame signal
-void write_signal_value(CAN_frame* frame, uint16_t start_bit, uint8_t bit_length, int64_t value, bool is_signed) {
+void write_signal_value(CAN_classic_frame* frame, uint16_t start_bit, uint8_t bit_length, int64_t value,
+                        bool is_signed) {
   if (bit_length == 0 || bit_length > 64 || frame == nullptr)
     return;
 
@@ -326,7 +327,7 @@ void write_signal_value(CAN_frame* frame, uint16_t start_bit, uint8_t bit_length
   }
 }
 
-void generateTESLA_229(CAN_frame& f) {
+void generateTESLA_229(CAN_classic_frame& f) {
   static const uint8_t checksumLookup[16] = {0x46, 0x44, 0x52, 0x6D, 0x43, 0x41, 0xDD, 0xF9,
                                              0x4C, 0xA5, 0xF6, 0x8C, 0x49, 0x2F, 0x31, 0x3B};
 
@@ -366,7 +367,7 @@ void generateTESLA_229(CAN_frame& f) {
   setBitField(data, bytes, csumStartBit, csumBitLength, checksum);
 }
 
-void generateTESLA_213(CAN_frame& f) {
+void generateTESLA_213(CAN_classic_frame& f) {
   static uint8_t counter = 0;
 
   // Increment counter (wrap at 16)
@@ -885,7 +886,17 @@ void TeslaBattery::
                  (battery_dcdcLvBusVolt * 0.0390625), (battery_dcdcLvOutputCurrent * 0.1));
 }
 
-void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
+void TeslaBattery::declare_supervised_can_ids(CanSupervisionSet& ids) {
+  ids.renew(&datalayer.battery.status.CAN_battery_still_alive);
+  ids.expect(0x132, 10, true);  // HVBattAmpVolt, pack voltage and current
+  ids.expect(0x20A, 100);       // HVP_contactorState
+  ids.expect(0x212, 100);       // BMS_status
+  ids.expect(0x252, 100);       // BMS_powerAvailable
+  ids.expect(0x292, 1000);      // BMS_socStatus
+  ids.expect(0x352, 1000);      // BMS_energyStatus
+}
+
+void TeslaBattery::handle_incoming_can_frame(const CAN_frame& rx_frame) {
   static uint8_t mux = 0;
   static uint16_t temp = 0;
   static bool mux0_read = false;
@@ -893,7 +904,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
 
   switch (rx_frame.ID) {
     case 0x352:  // 850 BMS_energyStatus newer BMS
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       mux = ((rx_frame.data.u8[0]) & 0x03);  //BMS_energyStatusIndex M : 0|2@1+ (1,0) [0|0] ""  X
       if (mux == 0) {
         battery_nominal_full_pack_energy_m0 =
@@ -947,7 +957,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
           ((rx_frame.data.u8[7] >> 7) & 0x01);  //noYes
       break;
     case 0x20A:  //522 HVP_contactorState:
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       battery_packContNegativeState =
           (rx_frame.data.u8[0] & 0x07);  //(_d[0] & (0x07U)); 0|3@1+ (1,0) [0|7] //contactorState
       battery_packContPositiveState =
@@ -979,7 +988,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       battery_fcLinkAllowedToEnergize = ((rx_frame.data.u8[5] >> 4) & (0x03U));     //44|2@1+ (1,0) [0|2] ""  Receiver
       break;
     case 0x212:  //530 BMS_status: 8
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       BMS_hvacPowerRequest = (rx_frame.data.u8[0] & (0x01U));
       BMS_notEnoughPowerForDrive = ((rx_frame.data.u8[0] >> 1) & (0x01U));
       BMS_notEnoughPowerForSupport = ((rx_frame.data.u8[0] >> 2) & (0x01U));
@@ -1019,7 +1027,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       BMS_minPackTemperature = (rx_frame.data.u8[7] & (0xFFU));  //56|8@1+ (0.5,-40) [0|0] "DegC
       break;
     case 0x224:  //548 PCS_dcdcStatus:
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       PCS_dcdcPrechargeStatus = (rx_frame.data.u8[0] & (0x03U));              //0 "IDLE" 1 "ACTIVE" 2 "FAULTED" ;
       PCS_dcdc12VSupportStatus = ((rx_frame.data.u8[0] >> 2) & (0x03U));      //0 "IDLE" 1 "ACTIVE" 2 "FAULTED"
       PCS_dcdcHvBusDischargeStatus = ((rx_frame.data.u8[0] >> 4) & (0x03U));  //0 "IDLE" 1 "ACTIVE" 2 "FAULTED"
@@ -1047,7 +1054,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
            (0x1FU));  //0 "PWR_UP_INIT" 1 "STANDBY" 2 "12V_SUPPORT_ACTIVE" 3 "DIS_HVBUS" 4 "PCHG_FAST_DIS_HVBUS" 5 "PCHG_SLOW_DIS_HVBUS" 6 "PCHG_DWELL_CHARGE" 7 "PCHG_DWELL_WAIT" 8 "PCHG_DI_RECOVERY_WAIT" 9 "PCHG_ACTIVE" 10 "PCHG_FLT_FAST_DIS_HVBUS" 11 "SHUTDOWN" 12 "12V_SUPPORT_FAULTED" 13 "DIS_HVBUS_FAULTED" 14 "PCHG_FAULTED" 15 "CLEAR_FAULTS" 16 "FAULTED" 17 "NUM" ;
       break;
     case 0x252:  //Limit //594 BMS_powerAvailable:
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       BMS_maxRegenPower = ((rx_frame.data.u8[1] << 8) |
                            rx_frame.data.u8[0]);  //0|16@1+ (0.01,0) [0|655.35] "kW"  //Example 4715 * 0.01 = 47.15kW
       BMS_maxDischargePower =
@@ -1067,7 +1073,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       BMS_inverterTQF = ((rx_frame.data.u8[7] >> 4) & (0x03U));
       break;
     case 0x132:  //battery amps/volts //HVBattAmpVolt
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       battery_volts = ((rx_frame.data.u8[1] << 8) | rx_frame.data.u8[0]) *
                       0.1;  //0|16@1+ (0.01,0) [0|655.35] "V"  //Example 37030mv * 0.01 = 3703dV
       battery_amps =
@@ -1085,7 +1090,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       }
       break;
     case 0x3D2:  //TotalChargeDischarge:
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       battery_total_discharge = ((rx_frame.data.u8[3] << 24) | (rx_frame.data.u8[2] << 16) |
                                  (rx_frame.data.u8[1] << 8) | rx_frame.data.u8[0]);
       //0|32@1+ (0.001,0) [0|4294970] "kWh"
@@ -1094,7 +1098,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       //32|32@1+ (0.001,0) [0|4294970] "kWh"
       break;
     case 0x332:  //min/max hist values //BattBrickMinMax:
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       mux = (rx_frame.data.u8[0] & 0x03);  //BattBrickMultiplexer M : 0|2@1+ (1,0) [0|0] ""
 
       if (mux == 1)  //Cell voltages
@@ -1136,7 +1139,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       }
       break;
     case 0x312:  // 786 BMS_thermalStatus
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       BMS_powerDissipation =
           ((rx_frame.data.u8[1] & (0x03U)) << 8) | (rx_frame.data.u8[0] & (0xFFU));  //0|10@1+ (0.02,0) [0|0] "kW"
       BMS_flowRequest = ((rx_frame.data.u8[2] & (0x01U)) << 6) |
@@ -1155,7 +1157,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       BMS_noFlowRequest = ((rx_frame.data.u8[7] >> 7) & (0x01U));     //63|1@1+ (1,0) [0|0] ""
       break;
     case 0x2A4:  //676 PCS_thermalStatus
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       PCS_chgPhATemp = (rx_frame.data.u8[0] & 0xFF) | ((rx_frame.data.u8[1] & 0x07) << 8);  //0|11@1- (0.1,40) [0|0] "C"
       PCS_chgPhBTemp =
           ((rx_frame.data.u8[1] & 0xF8) >> 3) | ((rx_frame.data.u8[2] & 0x3F) << 5);  //11|11@1- (0.1,40) [0|0] "C"
@@ -1166,7 +1167,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       PCS_ambientTemp = ((rx_frame.data.u8[5] & 0xF0) >> 4) | (rx_frame.data.u8[6] << 4);  //44|11@1- (0.1,40) [0|0] "C"
       break;
     case 0x2C4:  // 708 PCS_logging: not all frames are listed, just ones relating to dcdc
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       mux = (rx_frame.data.u8[0] & (0x1FU));
       //PCS_logMessageSelect = (rx_frame.data.u8[0] & (0x1FU));  //0|5@1+ (1,0) [0|0] ""
       if (mux == 6) {
@@ -1224,7 +1224,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       }
       break;
     case 0x401:  // Cell stats  //BrickVoltages
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       mux = (rx_frame.data.u8[0]);  //MultiplexSelector M : 0|8@1+ (1,0) [0|0] ""
                                     //StatusFlags : 8|8@1+ (1,0) [0|0] ""
                                     //Brick0 m0 : 16|16@1+ (0.0001,0) [0|0] "V"
@@ -1259,7 +1258,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       }
       break;
     case 0x2d2:  //BMSVAlimits:
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       BMS_min_voltage = ((rx_frame.data.u8[1] << 8) |
                          rx_frame.data.u8[0]);  //0|16@1+ (0.01,0) [0|430] "V"  //Example 24148mv * 0.01 = 241.48 V
       BMS_max_voltage = ((rx_frame.data.u8[3] << 8) |
@@ -1270,7 +1268,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
                                       0.128;  //48|14@1+ (0.128,0) [0|2096.9] "A"  //Example 430? * 0.128 = 55.4?
       break;
     case 0x2b4:  //PCS_dcdcRailStatus:
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       battery_dcdcLvBusVolt =
           (((rx_frame.data.u8[1] & 0x03) << 8) | rx_frame.data.u8[0]);  //0|10@1+ (0.0390625,0) [0|39.9609] "V"
       battery_dcdcHvBusVolt = (((rx_frame.data.u8[2] & 0x3F) << 6) |
@@ -1279,7 +1276,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
           (((rx_frame.data.u8[4] & 0x0F) << 8) | rx_frame.data.u8[3]);  //24|12@1+ (0.1,0) [0|400] "A"
       break;
     case 0x292:  //BMS_socStatus
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       battery_beginning_of_life =
           (((rx_frame.data.u8[6] & 0x03) << 8) | rx_frame.data.u8[5]) * 0.1;          //40|10@1+ (0.1,0) [0|102.3] "kWh"
       battery_soc_min = (((rx_frame.data.u8[1] & 0x03) << 8) | rx_frame.data.u8[0]);  //0|10@1+ (0.1,0) [0|102.3] "%"
@@ -1293,7 +1289,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
           (((rx_frame.data.u8[7] & 0x03) << 6) | (rx_frame.data.u8[6] & 0x3F) >> 2);  //50|8@1+ (0.4,0) [0|100] "%"
       break;
     case 0x392:  //BMS_packConfig
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       mux = (rx_frame.data.u8[0] & (0xFF));
       if (mux == 1) {
         battery_packConfigMultiplexer = (rx_frame.data.u8[0] & (0xff));  //0|8@1+ (1,0) [0|1] ""
@@ -1311,7 +1306,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       }
       break;
     case 0x7AA:  //1962 HVP_debugMessage:
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       mux = (rx_frame.data.u8[0] & (0x0FU));
       //HVP_debugMessageMultiplexer = (rx_frame.data.u8[0] & (0x0FU));  //0|4@1+ (1,0) [0|6] ""
       if (mux == 0) {
@@ -1463,7 +1457,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       battery_shuntThermistorMia = ((rx_frame.data.u8[6] & 0x04) >> 2);
       break;*/
     case 0x320:  //800 BMS_alertMatrix                                                //BMS_alertMatrix 800 BMS_alertMatrix: 8 VEH
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       mux = (rx_frame.data.u8[0] & (0x0F));
       if (mux == 0) {                                                               //mux0
         BMS_matrixIndex = (rx_frame.data.u8[0] & (0x0F));                           // 0|4@1+ (1,0) [0|0] ""  X
@@ -1566,7 +1559,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       }
       break;
     case 0x72A:  //BMS_serialNumber
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       //Pack serial number in ASCII: 00 54 47 33 32 31 32 30 (mux 0) .TG32120 + 01 32 30 30 33 41 48 58 (mux 1) .2003AHX = TG321202003AHX
       if (rx_frame.data.u8[0] == 0x00 && !parsed_battery_serialNumber) {  // Serial number 1-7
         battery_serialNumber[0] = rx_frame.data.u8[1];
@@ -1602,7 +1594,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       }
       break;
     case 0x300:  //BMS_info
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       //Display internal BMS info and other build/version data
       if (rx_frame.data.u8[0] == 0x0A) {  // Mux 10: BUILD_HWID_COMPONENTID
         if (BMS_info_buildConfigId == 0) {
@@ -1636,7 +1627,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       */
       break;
     case 0x3C4:  //PCS_info
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       //Display internal PCS info and other build/version data
       if (rx_frame.data.u8[0] == 0x0A) {  // Mux 10: BUILD_HWID_COMPONENTID
         if (PCS_info_buildConfigId == 0) {
@@ -1694,7 +1684,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       }
       break;
     case 0x310:  //HVP_info
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       //Display internal HVP info and other build/version data
       if (rx_frame.data.u8[0] == 0x0A) {  // Mux 10: BUILD_HWID_COMPONENTID
         if (HVP_info_buildConfigId == 0) {
@@ -1728,7 +1717,6 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
       */
       break;
     case 0x612:  // CAN UDS responses for BMS
-      datalayer.battery.status.CAN_battery_still_alive = CAN_STILL_ALIVE;
       //BMS Query
       if (stateMachineBMSQuery != 0xFF && stateMachineBMSReset == 0xFF && stateMachineSOCReset == 0xFF) {
         if (memcmp(rx_frame.data.u8, "\x02\x50\x03\xAA\xAA\xAA\xAA\xAA", 8) == 0) {
@@ -1802,7 +1790,7 @@ void TeslaBattery::handle_incoming_can_frame(CAN_frame rx_frame) {
   }
 }
 
-CAN_frame can_msg_1CF[] = {
+CAN_classic_frame can_msg_1CF[] = {
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x1CF, .data = {0x01, 0x00, 0x00, 0x1A, 0x1C, 0x02, 0x60, 0x69}},
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x1CF, .data = {0x01, 0x00, 0x00, 0x1A, 0x1C, 0x02, 0x80, 0x89}},
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x1CF, .data = {0x01, 0x00, 0x00, 0x1A, 0x1C, 0x02, 0xA0, 0xA9}},
@@ -1812,7 +1800,7 @@ CAN_frame can_msg_1CF[] = {
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x1CF, .data = {0x01, 0x00, 0x00, 0x1A, 0x1C, 0x02, 0x20, 0x29}},
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x1CF, .data = {0x01, 0x00, 0x00, 0x1A, 0x1C, 0x02, 0x40, 0x49}}};
 
-CAN_frame can_msg_118[] = {
+CAN_classic_frame can_msg_118[] = {
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x118, .data = {0x61, 0x80, 0x30, 0x10, 0x00, 0x08, 0x00, 0x80}},
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x118, .data = {0x62, 0x81, 0x30, 0x10, 0x00, 0x08, 0x00, 0x80}},
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x118, .data = {0x63, 0x82, 0x30, 0x10, 0x00, 0x08, 0x00, 0x80}},
@@ -1830,12 +1818,13 @@ CAN_frame can_msg_118[] = {
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x118, .data = {0x6F, 0x8E, 0x30, 0x10, 0x00, 0x08, 0x00, 0x80}},
     {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x118, .data = {0x70, 0x8F, 0x30, 0x10, 0x00, 0x08, 0x00, 0x80}}};
 
-void TeslaBattery::transmit_can(unsigned long currentMillis) {
+void TeslaBattery::transmit_can(unsigned long /*currentMillis*/) {
+  // All periodic frames are sent by the CAN scheduler, see schedule_can_frames()
+}
 
+void TeslaBattery::schedule_can_frames() {
   //Send 10ms messages
-  if (currentMillis - previousMillis10 >= INTERVAL_10_MS) {
-    previousMillis10 = currentMillis;
-
+  schedule_can(INTERVAL_10_MS, 2, [this](unsigned long) {
     if (user_selected_tesla_digital_HVIL) {  //Special Digital HVIL mode for S/X 2024+ batteries
       if ((datalayer.system.status.inverter_allows_contactor_closing) &&
           (datalayer.battery.status.bms_status != FAULT)) {
@@ -1850,7 +1839,10 @@ void TeslaBattery::transmit_can(unsigned long currentMillis) {
       index_1CF = 0;  //Stop broadcasting Digital HVIL 1CF and 118 to keep contactors open
       index_118 = 0;
     }
-
+    //Generate next frame
+    generateFrameCounterChecksum(TESLA_118, 8, 4, 0, 8);
+  });
+  schedule_can(INTERVAL_10_MS, 1, [this](unsigned long) {
     //0x2E1 VCFRONT_status
     switch (muxNumber_TESLA_2E1) {
       case 0:
@@ -1875,14 +1867,10 @@ void TeslaBattery::transmit_can(unsigned long currentMillis) {
         break;
     }
     muxNumber_TESLA_2E1 = (muxNumber_TESLA_2E1 + 1) % 6;  //Cycle betweeen 0-1-2-3-4-5-0...
-    //Generate next frames
-    generateFrameCounterChecksum(TESLA_118, 8, 4, 0, 8);
-  }
+  });
 
   //Send 50ms messages
-  if (currentMillis - previousMillis50 >= INTERVAL_50_MS) {
-    previousMillis50 = currentMillis;
-
+  schedule_can(INTERVAL_50_MS, 2, [this](unsigned long) {
     //0x221 VCFRONT_LVPowerState
     if (vehicleState == CAR_DRIVE) {
       if (alternateMux) {
@@ -1924,59 +1912,61 @@ void TeslaBattery::transmit_can(unsigned long currentMillis) {
 
     //0x3C2 VCLEFT_switchStatus
     transmit_can_frame(alternateMux == 0 ? &TESLA_3C2_Mux0 : &TESLA_3C2_Mux1);
-
+  });
+  schedule_can(INTERVAL_50_MS, 1, [this](unsigned long) {
     //0x39D IBST_status
     transmit_can_frame(&TESLA_39D);
-
-    if (battery_contactor == 4) {  // Contactors closed
-
-      // Frames to be sent only when contactors closed
-      if (timeToMux3A1) {
-        timeToMux3A1 = false;
-        TESLA_3A1.data.u8[0] = 0xC3;
-        TESLA_3A1.data.u8[1] = 0xFF;
-        TESLA_3A1.data.u8[2] = 0xFF;
-        TESLA_3A1.data.u8[3] = 0xFF;
-        TESLA_3A1.data.u8[4] = 0x3D;
-        TESLA_3A1.data.u8[5] = 0x00;
-      } else {  //!timeToMux3A1
-        TESLA_3A1.data.u8[0] = 0x08;
-        TESLA_3A1.data.u8[1] = 0x62;
-        TESLA_3A1.data.u8[2] = 0x0B;
-        TESLA_3A1.data.u8[3] = 0x18;
-        TESLA_3A1.data.u8[4] = 0x00;
-        TESLA_3A1.data.u8[5] = 0x28;
-        timeToMux3A1 = true;
-      }
-      TESLA_3A1.data.u8[6] = frame6_3A1[frameCounter_TESLA_3A1];
-      TESLA_3A1.data.u8[7] = frame7_3A1[frameCounter_TESLA_3A1];
-      //0x3A1 VCFRONT_vehicleStatus, critical otherwise VCFRONT_MIA triggered
-      transmit_can_frame(&TESLA_3A1);
-      frameCounter_TESLA_3A1 = (frameCounter_TESLA_3A1 + 1) % 16;
-    }
-
-    //Generate next frame
     generateFrameCounterChecksum(TESLA_39D, 8, 4, 0, 8);
-  }
+  });
+  schedule_can(INTERVAL_50_MS, 1, [this](unsigned long) {
+    if (battery_contactor != 4) {  // Frames to be sent only when contactors closed
+      return;
+    }
+    if (timeToMux3A1) {
+      timeToMux3A1 = false;
+      TESLA_3A1.data.u8[0] = 0xC3;
+      TESLA_3A1.data.u8[1] = 0xFF;
+      TESLA_3A1.data.u8[2] = 0xFF;
+      TESLA_3A1.data.u8[3] = 0xFF;
+      TESLA_3A1.data.u8[4] = 0x3D;
+      TESLA_3A1.data.u8[5] = 0x00;
+    } else {  //!timeToMux3A1
+      TESLA_3A1.data.u8[0] = 0x08;
+      TESLA_3A1.data.u8[1] = 0x62;
+      TESLA_3A1.data.u8[2] = 0x0B;
+      TESLA_3A1.data.u8[3] = 0x18;
+      TESLA_3A1.data.u8[4] = 0x00;
+      TESLA_3A1.data.u8[5] = 0x28;
+      timeToMux3A1 = true;
+    }
+    TESLA_3A1.data.u8[6] = frame6_3A1[frameCounter_TESLA_3A1];
+    TESLA_3A1.data.u8[7] = frame7_3A1[frameCounter_TESLA_3A1];
+    //0x3A1 VCFRONT_vehicleStatus, critical otherwise VCFRONT_MIA triggered
+    transmit_can_frame(&TESLA_3A1);
+    frameCounter_TESLA_3A1 = (frameCounter_TESLA_3A1 + 1) % 16;
+  });
 
   //Send 100ms messages
-  if (currentMillis - previousMillis100 >= INTERVAL_100_MS) {
-    previousMillis100 = currentMillis;
-
-    //0x102 VCLEFT_doorStatus, static
-    transmit_can_frame(&TESLA_102);
-    //0x103 VCRIGHT_doorStatus, static
-    transmit_can_frame(&TESLA_103);
+  schedule_can_frame(&TESLA_102, INTERVAL_100_MS);  //0x102 VCLEFT_doorStatus, static
+  schedule_can_frame(&TESLA_103, INTERVAL_100_MS);  //0x103 VCRIGHT_doorStatus, static
+  schedule_can_frame(&TESLA_241, INTERVAL_100_MS);  //0x241 VCFRONT_coolant, static
+  schedule_can_frame(&TESLA_2D1, INTERVAL_100_MS);  //0x2D1 VCFRONT_okToUseHighPower, static
+  schedule_can(INTERVAL_100_MS, 1, [this](unsigned long) {
     //0x229 SCCM_rightStalk
     transmit_can_frame(&TESLA_229);
-    //0x241 VCFRONT_coolant, static
-    transmit_can_frame(&TESLA_241);
-    //0x2D1 VCFRONT_okToUseHighPower, static
-    transmit_can_frame(&TESLA_2D1);
+    generateTESLA_229(TESLA_229);
+  });
+  schedule_can(INTERVAL_100_MS, 1, [this](unsigned long) {
     //0x2A8 CMPD_state
     transmit_can_frame(&TESLA_2A8);
+    generateFrameCounterChecksum(TESLA_2A8, 52, 4, 56, 8);
+  });
+  schedule_can(INTERVAL_100_MS, 1, [this](unsigned long) {
     //0x2E8 EPBR_status
     transmit_can_frame(&TESLA_2E8);
+    generateFrameCounterChecksum(TESLA_2E8, 52, 4, 56, 8);
+  });
+  schedule_can(INTERVAL_100_MS, 1, [this](unsigned long) {
     //0x7FF GTW_carConfig
     switch (muxNumber_TESLA_7FF) {
       case 0:
@@ -1998,215 +1988,213 @@ void TeslaBattery::transmit_can(unsigned long currentMillis) {
         break;
     }
     muxNumber_TESLA_7FF = (muxNumber_TESLA_7FF + 1) % 5;  //Cycle betweeen 0-1-2-3-4-0...
-    //Generate next frames
-    generateTESLA_229(TESLA_229);
-    generateFrameCounterChecksum(TESLA_2A8, 52, 4, 56, 8);
-    generateFrameCounterChecksum(TESLA_2E8, 52, 4, 56, 8);
-
-    if (stateMachineClearIsolationFault != 0xFF) {
-      //This implementation should be rewritten to actually reply to the UDS responses sent by the BMS
-      //While this may work, it is not the correct way to implement this clearing logic
-      switch (stateMachineClearIsolationFault) {
-        case 0:
-          TESLA_602.data = {0x02, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          stateMachineClearIsolationFault = 1;
-          break;
-        case 1:
-          TESLA_602.data = {0x30, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          // BMS should reply 02 50 C0 FF FF FF FF FF
-          stateMachineClearIsolationFault = 2;
-          break;
-        case 2:
-          TESLA_602.data = {0x10, 0x12, 0x27, 0x06, 0x35, 0x34, 0x37, 0x36};
-          transmit_can_frame(&TESLA_602);
-          // BMS should reply 7E FF FF FF FF FF FF
-          stateMachineClearIsolationFault = 3;
-          break;
-        case 3:
-          TESLA_602.data = {0x21, 0x31, 0x30, 0x33, 0x32, 0x3D, 0x3C, 0x3F};
-          transmit_can_frame(&TESLA_602);
-          stateMachineClearIsolationFault = 4;
-          break;
-        case 4:
-          TESLA_602.data = {0x22, 0x3E, 0x39, 0x38, 0x3B, 0x3A, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          //Should generate a CAN UDS log message indicating ECU unlocked
-          stateMachineClearIsolationFault = 5;
-          break;
-        case 5:
-          TESLA_602.data = {0x04, 0x31, 0x01, 0x04, 0x0A, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          stateMachineClearIsolationFault = 0xFF;
-          break;
-        default:
-          //Something went wrong. Reset all and cancel
-          stateMachineClearIsolationFault = 0xFF;
-          break;
-      }
-    }
-    if (stateMachineBMSReset != 0xFF) {
-      //This implementation should be rewritten to actually reply to the UDS responses sent by the BMS
-      //While this may work, it is not the correct way to implement this reset logic
-      switch (stateMachineBMSReset) {
-        case 0:
-          TESLA_602.data = {0x02, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          stateMachineBMSReset = 1;
-          break;
-        case 1:
-          TESLA_602.data = {0x30, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          stateMachineBMSReset = 2;
-          break;
-        case 2:
-          TESLA_602.data = {0x10, 0x12, 0x27, 0x06, 0x35, 0x34, 0x37, 0x36};
-          transmit_can_frame(&TESLA_602);
-          stateMachineBMSReset = 3;
-          break;
-        case 3:
-          TESLA_602.data = {0x21, 0x31, 0x30, 0x33, 0x32, 0x3D, 0x3C, 0x3F};
-          transmit_can_frame(&TESLA_602);
-          stateMachineBMSReset = 4;
-          break;
-        case 4:
-          TESLA_602.data = {0x22, 0x3E, 0x39, 0x38, 0x3B, 0x3A, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          //Should generate a CAN UDS log message indicating ECU unlocked
-          stateMachineBMSReset = 5;
-          break;
-        case 5:
-          TESLA_602.data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          stateMachineBMSReset = 6;
-          break;
-        case 6:
-          TESLA_602.data = {0x02, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          stateMachineBMSReset = 7;
-          break;
-        case 7:
-          TESLA_602.data = {0x02, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          //Should generate a CAN UDS log message(s) indicating ECU has reset
-          stateMachineBMSReset = 0xFF;
-          break;
-        default:
-          //Something went wrong. Reset all and cancel
-          stateMachineBMSReset = 0xFF;
-          break;
-      }
-    }
-    if (stateMachineSOCReset != 0xFF) {
-      //This implementation should be rewritten to actually reply to the UDS responses sent by the BMS
-      //While this may work, it is not the correct way to implement this
-      switch (stateMachineSOCReset) {
-        case 0:
-          TESLA_602.data = {0x02, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          stateMachineSOCReset = 1;
-          break;
-        case 1:
-          TESLA_602.data = {0x30, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          stateMachineSOCReset = 2;
-          break;
-        case 2:
-          TESLA_602.data = {0x10, 0x12, 0x27, 0x06, 0x35, 0x34, 0x37, 0x36};
-          transmit_can_frame(&TESLA_602);
-          stateMachineSOCReset = 3;
-          break;
-        case 3:
-          TESLA_602.data = {0x21, 0x31, 0x30, 0x33, 0x32, 0x3D, 0x3C, 0x3F};
-          transmit_can_frame(&TESLA_602);
-          stateMachineSOCReset = 4;
-          break;
-        case 4:
-          TESLA_602.data = {0x22, 0x3E, 0x39, 0x38, 0x3B, 0x3A, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          //Should generate a CAN UDS log message indicating ECU unlocked
-          stateMachineSOCReset = 5;
-          break;
-        case 5:
-          TESLA_602.data = {0x04, 0x31, 0x01, 0x04, 0x07, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          stateMachineSOCReset = 0xFF;
-          break;
-        default:
-          //Something went wrong. Reset all and cancel
-          stateMachineSOCReset = 0xFF;
-          break;
-      }
-    }
-    if (stateMachineBMSQuery != 0xFF) {
-      //This implementation should be rewritten to actually reply to the UDS responses sent by the BMS
-      //While this may work, it is not the correct way to implement this query logic
-      switch (stateMachineBMSQuery) {
-        case 0:
-          //Initial request
-          logging.println("CAN UDS: Sending BMS query initial handshake");
-          TESLA_602.data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          break;
-        case 1:
-          //Send query
-          logging.println("CAN UDS: Sending BMS query for pack part number");
-          TESLA_602.data = {0x03, 0x22, 0xF0, 0x14, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          break;
-        case 2:
-          //Flow control
-          logging.println("CAN UDS: Sending BMS query flow control");
-          TESLA_602.data = {0x30, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00};
-          transmit_can_frame(&TESLA_602);
-          break;
-        case 3:
-          break;
-        case 4:
-          break;
-        default:
-          //Something went wrong. Reset all and cancel
-          stateMachineBMSQuery = 0xFF;
-          break;
-      }
-    }
-  }
+  });
+  schedule_can(INTERVAL_100_MS, 1, [this](unsigned long) { transmit_uds_requests(); });
 
   //Send 500ms messages
-  if (currentMillis - previousMillis500 >= INTERVAL_500_MS) {
-    previousMillis500 = currentMillis;
-
+  schedule_can(INTERVAL_500_MS, 1, [this](unsigned long) {
     transmit_can_frame(&TESLA_213);
-    transmit_can_frame(&TESLA_284);
+    generateTESLA_213(TESLA_213);
+  });
+  schedule_can_frame(&TESLA_284, INTERVAL_500_MS);
+  schedule_can(INTERVAL_500_MS, 1, [this](unsigned long) {
     transmit_can_frame(&TESLA_293);
+    generateFrameCounterChecksum(TESLA_293, 52, 4, 56, 8);
+  });
+  schedule_can(INTERVAL_500_MS, 1, [this](unsigned long) {
     transmit_can_frame(&TESLA_313);
-    transmit_can_frame(&TESLA_333);
+    generateFrameCounterChecksum(TESLA_313, 52, 4, 56, 8);
+  });
+  schedule_can_frame(&TESLA_333, INTERVAL_500_MS);
+  schedule_can(INTERVAL_500_MS, 1, [this](unsigned long) {
     if (TESLA_334_INITIAL_SENT == false) {
       transmit_can_frame(&TESLA_334_INITIAL);
       TESLA_334_INITIAL_SENT = true;
     } else {
       transmit_can_frame(&TESLA_334);
     }
-    transmit_can_frame(&TESLA_3B3);
-    transmit_can_frame(&TESLA_55A);
-
-    //Generate next frames
-    generateTESLA_213(TESLA_213);
-    generateFrameCounterChecksum(TESLA_293, 52, 4, 56, 8);
-    generateFrameCounterChecksum(TESLA_313, 52, 4, 56, 8);
     generateFrameCounterChecksum(TESLA_334, 52, 4, 56, 8);
-  }
+  });
+  schedule_can_frame(&TESLA_3B3, INTERVAL_500_MS);
+  schedule_can_frame(&TESLA_55A, INTERVAL_500_MS);
 
   //Send 1000ms messages
-  if (currentMillis - previousMillis1000 >= INTERVAL_1_S) {
-    previousMillis1000 = currentMillis;
-
-    transmit_can_frame(&TESLA_082);
+  schedule_can_frame(&TESLA_082, INTERVAL_1_S);
+  schedule_can(INTERVAL_1_S, 1, [this](unsigned long) {
     transmit_can_frame(&TESLA_321);
-
-    //Generate next frames
     generateFrameCounterChecksum(TESLA_321, 52, 4, 56, 8);
+  });
+}
+
+// UDS requests of the isolation clear, BMS reset, SOC reset and BMS query sequences, one step every 100ms
+void TeslaBattery::transmit_uds_requests() {
+  if (stateMachineClearIsolationFault != 0xFF) {
+    //This implementation should be rewritten to actually reply to the UDS responses sent by the BMS
+    //While this may work, it is not the correct way to implement this clearing logic
+    switch (stateMachineClearIsolationFault) {
+      case 0:
+        TESLA_602.data = {0x02, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        stateMachineClearIsolationFault = 1;
+        break;
+      case 1:
+        TESLA_602.data = {0x30, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        // BMS should reply 02 50 C0 FF FF FF FF FF
+        stateMachineClearIsolationFault = 2;
+        break;
+      case 2:
+        TESLA_602.data = {0x10, 0x12, 0x27, 0x06, 0x35, 0x34, 0x37, 0x36};
+        transmit_can_frame(&TESLA_602);
+        // BMS should reply 7E FF FF FF FF FF FF
+        stateMachineClearIsolationFault = 3;
+        break;
+      case 3:
+        TESLA_602.data = {0x21, 0x31, 0x30, 0x33, 0x32, 0x3D, 0x3C, 0x3F};
+        transmit_can_frame(&TESLA_602);
+        stateMachineClearIsolationFault = 4;
+        break;
+      case 4:
+        TESLA_602.data = {0x22, 0x3E, 0x39, 0x38, 0x3B, 0x3A, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        //Should generate a CAN UDS log message indicating ECU unlocked
+        stateMachineClearIsolationFault = 5;
+        break;
+      case 5:
+        TESLA_602.data = {0x04, 0x31, 0x01, 0x04, 0x0A, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        stateMachineClearIsolationFault = 0xFF;
+        break;
+      default:
+        //Something went wrong. Reset all and cancel
+        stateMachineClearIsolationFault = 0xFF;
+        break;
+    }
+  }
+  if (stateMachineBMSReset != 0xFF) {
+    //This implementation should be rewritten to actually reply to the UDS responses sent by the BMS
+    //While this may work, it is not the correct way to implement this reset logic
+    switch (stateMachineBMSReset) {
+      case 0:
+        TESLA_602.data = {0x02, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        stateMachineBMSReset = 1;
+        break;
+      case 1:
+        TESLA_602.data = {0x30, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        stateMachineBMSReset = 2;
+        break;
+      case 2:
+        TESLA_602.data = {0x10, 0x12, 0x27, 0x06, 0x35, 0x34, 0x37, 0x36};
+        transmit_can_frame(&TESLA_602);
+        stateMachineBMSReset = 3;
+        break;
+      case 3:
+        TESLA_602.data = {0x21, 0x31, 0x30, 0x33, 0x32, 0x3D, 0x3C, 0x3F};
+        transmit_can_frame(&TESLA_602);
+        stateMachineBMSReset = 4;
+        break;
+      case 4:
+        TESLA_602.data = {0x22, 0x3E, 0x39, 0x38, 0x3B, 0x3A, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        //Should generate a CAN UDS log message indicating ECU unlocked
+        stateMachineBMSReset = 5;
+        break;
+      case 5:
+        TESLA_602.data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        stateMachineBMSReset = 6;
+        break;
+      case 6:
+        TESLA_602.data = {0x02, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        stateMachineBMSReset = 7;
+        break;
+      case 7:
+        TESLA_602.data = {0x02, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        //Should generate a CAN UDS log message(s) indicating ECU has reset
+        stateMachineBMSReset = 0xFF;
+        break;
+      default:
+        //Something went wrong. Reset all and cancel
+        stateMachineBMSReset = 0xFF;
+        break;
+    }
+  }
+  if (stateMachineSOCReset != 0xFF) {
+    //This implementation should be rewritten to actually reply to the UDS responses sent by the BMS
+    //While this may work, it is not the correct way to implement this
+    switch (stateMachineSOCReset) {
+      case 0:
+        TESLA_602.data = {0x02, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        stateMachineSOCReset = 1;
+        break;
+      case 1:
+        TESLA_602.data = {0x30, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        stateMachineSOCReset = 2;
+        break;
+      case 2:
+        TESLA_602.data = {0x10, 0x12, 0x27, 0x06, 0x35, 0x34, 0x37, 0x36};
+        transmit_can_frame(&TESLA_602);
+        stateMachineSOCReset = 3;
+        break;
+      case 3:
+        TESLA_602.data = {0x21, 0x31, 0x30, 0x33, 0x32, 0x3D, 0x3C, 0x3F};
+        transmit_can_frame(&TESLA_602);
+        stateMachineSOCReset = 4;
+        break;
+      case 4:
+        TESLA_602.data = {0x22, 0x3E, 0x39, 0x38, 0x3B, 0x3A, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        //Should generate a CAN UDS log message indicating ECU unlocked
+        stateMachineSOCReset = 5;
+        break;
+      case 5:
+        TESLA_602.data = {0x04, 0x31, 0x01, 0x04, 0x07, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        stateMachineSOCReset = 0xFF;
+        break;
+      default:
+        //Something went wrong. Reset all and cancel
+        stateMachineSOCReset = 0xFF;
+        break;
+    }
+  }
+  if (stateMachineBMSQuery != 0xFF) {
+    //This implementation should be rewritten to actually reply to the UDS responses sent by the BMS
+    //While this may work, it is not the correct way to implement this query logic
+    switch (stateMachineBMSQuery) {
+      case 0:
+        //Initial request
+        logging.println("CAN UDS: Sending BMS query initial handshake");
+        TESLA_602.data = {0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        break;
+      case 1:
+        //Send query
+        logging.println("CAN UDS: Sending BMS query for pack part number");
+        TESLA_602.data = {0x03, 0x22, 0xF0, 0x14, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        break;
+      case 2:
+        //Flow control
+        logging.println("CAN UDS: Sending BMS query flow control");
+        TESLA_602.data = {0x30, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00};
+        transmit_can_frame(&TESLA_602);
+        break;
+      case 3:
+        break;
+      case 4:
+        break;
+      default:
+        //Something went wrong. Reset all and cancel
+        stateMachineBMSQuery = 0xFF;
+        break;
+    }
   }
 }
 
@@ -2415,6 +2403,8 @@ void TeslaModel3YBattery::setup(void) {  // Performs one time setup at startup
     datalayer.battery.info.min_cell_voltage_mV = MIN_CELL_VOLTAGE_NCA_NCM;
     datalayer.battery.info.max_cell_voltage_deviation_mV = MAX_CELL_DEVIATION_NCA_NCM;
   }
+
+  schedule_can_frames();
 }
 
 void TeslaModelSXBattery::setup(void) {
@@ -2429,4 +2419,6 @@ void TeslaModelSXBattery::setup(void) {
   datalayer.battery.info.max_cell_voltage_mV = MAX_CELL_VOLTAGE_NCA_NCM;
   datalayer.battery.info.min_cell_voltage_mV = MIN_CELL_VOLTAGE_NCA_NCM;
   datalayer.battery.info.max_cell_voltage_deviation_mV = MAX_CELL_DEVIATION_NCA_NCM;
+
+  schedule_can_frames();
 }
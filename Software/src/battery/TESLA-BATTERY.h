@@ -18,7 +18,8 @@ class TeslaBattery : public CanBattery {
   // Use the default constructor to create the first or single battery.
   TeslaBattery() { allows_contactor_closing = &datalayer.system.status.battery_allows_contactor_closing; }
 
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
+  virtual void declare_supervised_can_ids(CanSupervisionSet& ids);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
 
@@ -67,12 +68,9 @@ class TeslaBattery : public CanBattery {
   bool* allows_contactor_closing;
 
   void printFaultCodesIfActive();
-
-  unsigned long previousMillis10 = 0;    // will store last time a 50ms CAN Message was sent
-  unsigned long previousMillis50 = 0;    // will store last time a 50ms CAN Message was sent
-  unsigned long previousMillis100 = 0;   // will store last time a 100ms CAN Message was sent
-  unsigned long previousMillis500 = 0;   // will store last time a 500ms CAN Message was sent
-  unsigned long previousMillis1000 = 0;  // will store last time a 1000ms CAN Message was sent
+  // Registers the periodic frames with the CAN scheduler, called once from setup()
+  void schedule_can_frames();
+  void transmit_uds_requests();
 
   //UDS session tracker
   //static bool uds_SessionInProgress = false; // Future use
@@ -100,130 +98,135 @@ class TeslaBattery : public CanBattery {
   uint16_t previous_max_percentage = datalayer.battery.settings.max_percentage;
 
   //0x082 UI_tripPlanning: "cycle_time" 1000ms
-  static constexpr CAN_frame TESLA_082 = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 8,
-                                          .ID = 0x082,
-                                          .data = {0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80}};
+  static constexpr CAN_classic_frame TESLA_082 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 8,
+                                                  .ID = 0x082,
+                                                  .data = {0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80}};
 
   //0x102 VCLEFT_doorStatus: "cycle_time" 100ms
-  static constexpr CAN_frame TESLA_102 = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 8,
-                                          .ID = 0x102,
-                                          .data = {0x22, 0x33, 0x00, 0x00, 0xC0, 0x38, 0x21, 0x08}};
+  static constexpr CAN_classic_frame TESLA_102 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 8,
+                                                  .ID = 0x102,
+                                                  .data = {0x22, 0x33, 0x00, 0x00, 0xC0, 0x38, 0x21, 0x08}};
 
   //0x103 VCRIGHT_doorStatus: "cycle_time" 100ms
-  static constexpr CAN_frame TESLA_103 = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 8,
-                                          .ID = 0x103,
-                                          .data = {0x22, 0x33, 0x00, 0x00, 0x30, 0xF2, 0x20, 0x02}};
+  static constexpr CAN_classic_frame TESLA_103 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 8,
+                                                  .ID = 0x103,
+                                                  .data = {0x22, 0x33, 0x00, 0x00, 0x30, 0xF2, 0x20, 0x02}};
 
   //0x118 DI_systemStatus: "cycle_time" 50ms, DI_systemStatusChecksum/DI_systemStatusCounter generated via generateFrameCounterChecksum
-  CAN_frame TESLA_118 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x118,
-                         .data = {0xAB, 0x60, 0x2A, 0x00, 0x00, 0x08, 0x00, 0x00}};
+  CAN_classic_frame TESLA_118 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x118,
+                                 .data = {0xAB, 0x60, 0x2A, 0x00, 0x00, 0x08, 0x00, 0x00}};
 
   //0x2A8 CMPD_state: "cycle_time" 100ms, different depending on firmware, semi-manual increment for now
-  CAN_frame TESLA_2A8 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x2A8,
-                         .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x2C}};
+  CAN_classic_frame TESLA_2A8 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x2A8,
+                                 .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x2C}};
 
   //0x213 UI_cruiseControl: "cycle_time" 500ms, UI_speedLimitTick/UI_cruiseControlCounter - different depending on firmware, semi-manual increment for now
-  CAN_frame TESLA_213 = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x213, .data = {0x00, 0x15}};
+  CAN_classic_frame TESLA_213 = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x213, .data = {0x00, 0x15}};
 
   //0x221 These frames will/should eventually be migrated to 2 base frames (1 per mux), and then just the relevant bits changed
 
   //0x221 VCFRONT_LVPowerState "Drive"
   //VCFRONT_vehiclePowerState VEHICLE_POWER_STATE_DRIVE (Mux0, Counter 15): "cycle_time" 50ms each mux/LVPowerStateIndex, VCFRONT_LVPowerStateChecksum/VCFRONT_LVPowerStateCounter generated via generateMuxFrameCounterChecksum
-  CAN_frame TESLA_221_DRIVE_Mux0 = {.FD = false,
-                                    .ext_ID = false,
-                                    .DLC = 8,
-                                    .ID = 0x221,
-                                    .data = {0x60, 0x55, 0x55, 0x15, 0x54, 0x51, 0xF1, 0xD8}};
+  CAN_classic_frame TESLA_221_DRIVE_Mux0 = {.FD = false,
+                                            .ext_ID = false,
+                                            .DLC = 8,
+                                            .ID = 0x221,
+                                            .data = {0x60, 0x55, 0x55, 0x15, 0x54, 0x51, 0xF1, 0xD8}};
 
   //0x221 VCFRONT_LVPowerState "Drive"
   //VCFRONT_vehiclePowerState VEHICLE_POWER_STATE_DRIVE (Mux1, Counter 0): "cycle_time" 50ms each mux/LVPowerStateIndex, VCFRONT_LVPowerStateChecksum/VCFRONT_LVPowerStateCounter generated via generateMuxFrameCounterChecksum
-  CAN_frame TESLA_221_DRIVE_Mux1 = {.FD = false,
-                                    .ext_ID = false,
-                                    .DLC = 8,
-                                    .ID = 0x221,
-                                    .data = {0x61, 0x05, 0x55, 0x05, 0x00, 0x00, 0x00, 0xE3}};
+  CAN_classic_frame TESLA_221_DRIVE_Mux1 = {.FD = false,
+                                            .ext_ID = false,
+                                            .DLC = 8,
+                                            .ID = 0x221,
+                                            .data = {0x61, 0x05, 0x55, 0x05, 0x00, 0x00, 0x00, 0xE3}};
 
   //0x221 VCFRONT_LVPowerState "Accessory"
   //VCFRONT_vehiclePowerState VEHICLE_POWER_STATE_ACCESSORY (Mux0, Counter 15): "cycle_time" 50ms each mux/LVPowerStateIndex, VCFRONT_LVPowerStateChecksum/VCFRONT_LVPowerStateCounter generated via generateMuxFrameCounterChecksum
-  CAN_frame TESLA_221_ACCESSORY_Mux0 = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 8,
-                                        .ID = 0x221,
-                                        .data = {0x40, 0x55, 0x55, 0x05, 0x54, 0x51, 0xF5, 0xAC}};
+  CAN_classic_frame TESLA_221_ACCESSORY_Mux0 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 8,
+                                                .ID = 0x221,
+                                                .data = {0x40, 0x55, 0x55, 0x05, 0x54, 0x51, 0xF5, 0xAC}};
 
   //0x221 VCFRONT_LVPowerState "Accessory"
   //VCFRONT_vehiclePowerState VEHICLE_POWER_STATE_ACCESSORY (Mux1, Counter 0): "cycle_time" 50ms each mux/LVPowerStateIndex, VCFRONT_LVPowerStateChecksum/VCFRONT_LVPowerStateCounter generated via generateMuxFrameCounterChecksum
-  CAN_frame TESLA_221_ACCESSORY_Mux1 = {.FD = false,
-                                        .ext_ID = false,
-                                        .DLC = 8,
-                                        .ID = 0x221,
-                                        .data = {0x41, 0x05, 0x55, 0x55, 0x01, 0x00, 0x04, 0x18}};
+  CAN_classic_frame TESLA_221_ACCESSORY_Mux1 = {.FD = false,
+                                                .ext_ID = false,
+                                                .DLC = 8,
+                                                .ID = 0x221,
+                                                .data = {0x41, 0x05, 0x55, 0x55, 0x01, 0x00, 0x04, 0x18}};
 
   //0x221 VCFRONT_LVPowerState "Going Down"
   //VCFRONT_vehiclePowerState VEHICLE_POWER_STATE_OFF, key parts GOING_DOWN (Mux0, Counter 15): "cycle_time" 50ms each mux/LVPowerStateIndex, VCFRONT_LVPowerStateChecksum/VCFRONT_LVPowerStateCounter generated via generateMuxFrameCounterChecksum
-  CAN_frame TESLA_221_GOING_DOWN_Mux0 = {.FD = false,
-                                         .ext_ID = false,
-                                         .DLC = 8,
-                                         .ID = 0x221,
-                                         .data = {0x00, 0x89, 0x55, 0x06, 0xA4, 0x51, 0xF1, 0xED}};
+  CAN_classic_frame TESLA_221_GOING_DOWN_Mux0 = {.FD = false,
+                                                 .ext_ID = false,
+                                                 .DLC = 8,
+                                                 .ID = 0x221,
+                                                 .data = {0x00, 0x89, 0x55, 0x06, 0xA4, 0x51, 0xF1, 0xED}};
 
   //0x221 VCFRONT_LVPowerState "Going Down"
   //VCFRONT_vehiclePowerState VEHICLE_POWER_STATE_OFF, key parts GOING_DOWN (Mux1, Counter 0): "cycle_time" 50ms each mux/LVPowerStateIndex, VCFRONT_LVPowerStateChecksum/VCFRONT_LVPowerStateCounter generated via generateMuxFrameCounterChecksum
-  CAN_frame TESLA_221_GOING_DOWN_Mux1 = {.FD = false,
-                                         .ext_ID = false,
-                                         .DLC = 8,
-                                         .ID = 0x221,
-                                         .data = {0x01, 0x09, 0x55, 0x59, 0x00, 0x00, 0x00, 0xDB}};
+  CAN_classic_frame TESLA_221_GOING_DOWN_Mux1 = {.FD = false,
+                                                 .ext_ID = false,
+                                                 .DLC = 8,
+                                                 .ID = 0x221,
+                                                 .data = {0x01, 0x09, 0x55, 0x59, 0x00, 0x00, 0x00, 0xDB}};
 
   //0x221 VCFRONT_LVPowerState "Off"
   //VCFRONT_vehiclePowerState VEHICLE_POWER_STATE_OFF, key parts OFF (Mux0, Counter 15): "cycle_time" 50ms each mux/LVPowerStateIndex, VCFRONT_LVPowerStateChecksum/VCFRONT_LVPowerStateCounter generated via generateMuxFrameCounterChecksum
-  CAN_frame TESLA_221_OFF_Mux0 = {.FD = false,
-                                  .ext_ID = false,
-                                  .DLC = 8,
-                                  .ID = 0x221,
-                                  .data = {0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0xF1, 0x65}};
+  CAN_classic_frame TESLA_221_OFF_Mux0 = {.FD = false,
+                                          .ext_ID = false,
+                                          .DLC = 8,
+                                          .ID = 0x221,
+                                          .data = {0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0xF1, 0x65}};
 
   //0x221 VCFRONT_LVPowerState "Off"
   //VCFRONT_vehiclePowerState VEHICLE_POWER_STATE_OFF, key parts OFF (Mux1, Counter 0): "cycle_time" 50ms each mux/LVPowerStateIndex, VCFRONT_LVPowerStateChecksum/VCFRONT_LVPowerStateCounter generated via generateMuxFrameCounterChecksum
-  CAN_frame TESLA_221_OFF_Mux1 = {.FD = false,
-                                  .ext_ID = false,
-                                  .DLC = 8,
-                                  .ID = 0x221,
-                                  .data = {0x01, 0x01, 0x01, 0x50, 0x00, 0x00, 0x00, 0x76}};
+  CAN_classic_frame TESLA_221_OFF_Mux1 = {.FD = false,
+                                          .ext_ID = false,
+                                          .DLC = 8,
+                                          .ID = 0x221,
+                                          .data = {0x01, 0x01, 0x01, 0x50, 0x00, 0x00, 0x00, 0x76}};
 
   //0x229 SCCM_rightStalk: "cycle_time" 100ms, SCCM_rightStalkChecksum/SCCM_rightStalkCounter generated via dedicated generateTESLA_229 function for now
   //CRC seemingly related to AUTOSAR ID array... "autosarDataIds": [124,182,240,47,105,163,221,28,86,144,202,9,67,125,183,241] found in Model 3 firmware
-  CAN_frame TESLA_229 = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x229, .data = {0x46, 0x00, 0x00}};
+  CAN_classic_frame TESLA_229 = {.FD = false, .ext_ID = false, .DLC = 3, .ID = 0x229, .data = {0x46, 0x00, 0x00}};
 
   //0x241 VCFRONT_coolant: "cycle_time" 100ms
-  static constexpr CAN_frame TESLA_241 = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 7,
-                                          .ID = 0x241,
-                                          .data = {0x35, 0x34, 0x0C, 0x0F, 0x8F, 0x55, 0x00}};
+  static constexpr CAN_classic_frame TESLA_241 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 7,
+                                                  .ID = 0x241,
+                                                  .data = {0x35, 0x34, 0x0C, 0x0F, 0x8F, 0x55, 0x00}};
 
   //0x2D1 VCFRONT_okToUseHighPower: "cycle_time" 100ms
-  static constexpr CAN_frame TESLA_2D1 = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x2D1, .data = {0xFF, 0x01}};
+  static constexpr CAN_classic_frame TESLA_2D1 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 2,
+                                                  .ID = 0x2D1,
+                                                  .data = {0xFF, 0x01}};
 
   //0x2E1, 6 muxes
   //0x2E1 VCFRONT_status: "cycle_time" 10ms each mux/statusIndex
-  static constexpr CAN_frame TESLA_2E1_VEHICLE_AND_RAILS = {.FD = false,
-                                                            .ext_ID = false,
-                                                            .DLC = 8,
-                                                            .ID = 0x2E1,
-                                                            .data = {0x29, 0x0A, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame TESLA_2E1_VEHICLE_AND_RAILS = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x2E1,
+      .data = {0x29, 0x0A, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00}};
 
   //{0x29, 0x0A, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00} INIT
   //{0x29, 0x0A, 0x0D, 0xFF, 0x0F, 0x00, 0x00, 0x00} DRIVE
@@ -232,81 +235,84 @@ class TeslaBattery : public CanBattery {
   //{0x29, 0x0A, 0x06, 0xFF, 0x0F, 0x00, 0x00, 0x00} SLEEP_STANDBY
 
   //0x2E1 VCFRONT_status: "cycle_time" 10ms each mux/statusIndex
-  static constexpr CAN_frame TESLA_2E1_HOMELINK = {.FD = false,
-                                                   .ext_ID = false,
-                                                   .DLC = 8,
-                                                   .ID = 0x2E1,
-                                                   .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00}};
-
-  //0x2E1 VCFRONT_status: "cycle_time" 10ms each mux/statusIndex
-  static constexpr CAN_frame TESLA_2E1_REFRIGERANT_SYSTEM = {.FD = false,
-                                                             .ext_ID = false,
-                                                             .DLC = 8,
-                                                             .ID = 0x2E1,
-                                                             .data = {0x03, 0x6D, 0x99, 0x02, 0x1B, 0x57, 0x00, 0x00}};
-
-  //0x2E1 VCFRONT_status: "cycle_time" 10ms each mux/statusIndex
-  static constexpr CAN_frame TESLA_2E1_LV_BATTERY_DEBUG = {.FD = false,
+  static constexpr CAN_classic_frame TESLA_2E1_HOMELINK = {.FD = false,
                                                            .ext_ID = false,
                                                            .DLC = 8,
                                                            .ID = 0x2E1,
-                                                           .data = {0xFC, 0x1B, 0xD1, 0x99, 0x9A, 0xD8, 0x09, 0x00}};
+                                                           .data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00}};
 
   //0x2E1 VCFRONT_status: "cycle_time" 10ms each mux/statusIndex
-  static constexpr CAN_frame TESLA_2E1_MUX_5 = {.FD = false,
-                                                .ext_ID = false,
-                                                .DLC = 8,
-                                                .ID = 0x2E1,
-                                                .data = {0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame TESLA_2E1_REFRIGERANT_SYSTEM = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x2E1,
+      .data = {0x03, 0x6D, 0x99, 0x02, 0x1B, 0x57, 0x00, 0x00}};
 
   //0x2E1 VCFRONT_status: "cycle_time" 10ms each mux/statusIndex
-  static constexpr CAN_frame TESLA_2E1_BODY_CONTROLS = {.FD = false,
+  static constexpr CAN_classic_frame TESLA_2E1_LV_BATTERY_DEBUG = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x2E1,
+      .data = {0xFC, 0x1B, 0xD1, 0x99, 0x9A, 0xD8, 0x09, 0x00}};
+
+  //0x2E1 VCFRONT_status: "cycle_time" 10ms each mux/statusIndex
+  static constexpr CAN_classic_frame TESLA_2E1_MUX_5 = {.FD = false,
                                                         .ext_ID = false,
                                                         .DLC = 8,
                                                         .ID = 0x2E1,
-                                                        .data = {0x08, 0x21, 0x04, 0x6E, 0xA0, 0x88, 0x06, 0x04}};
+                                                        .data = {0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+  //0x2E1 VCFRONT_status: "cycle_time" 10ms each mux/statusIndex
+  static constexpr CAN_classic_frame TESLA_2E1_BODY_CONTROLS = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x2E1,
+      .data = {0x08, 0x21, 0x04, 0x6E, 0xA0, 0x88, 0x06, 0x04}};
 
   //0x2E8 EPBR_status: "cycle_time" 100ms
-  CAN_frame TESLA_2E8 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x2E8,
-                         .data = {0x02, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x6C}};
+  CAN_classic_frame TESLA_2E8 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x2E8,
+                                 .data = {0x02, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x6C}};
 
   //0x284 UI_vehicleModes: "cycle_time" 500ms
-  static constexpr CAN_frame TESLA_284 = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 5,
-                                          .ID = 0x284,
-                                          .data = {0x10, 0x00, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame TESLA_284 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 5,
+                                                  .ID = 0x284,
+                                                  .data = {0x10, 0x00, 0x00, 0x00, 0x00}};
 
   //0x293 UI_chassisControl: "cycle_time" 500ms, UI_chassisControlChecksum/UI_chassisControlCounter generated via generateFrameCounterChecksum
-  CAN_frame TESLA_293 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x293,
-                         .data = {0x01, 0x0C, 0x55, 0x91, 0x55, 0x15, 0x01, 0xF3}};
+  CAN_classic_frame TESLA_293 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x293,
+                                 .data = {0x01, 0x0C, 0x55, 0x91, 0x55, 0x15, 0x01, 0xF3}};
 
   //0x3A1 VCFRONT_vehicleStatus: "cycle_time" 50ms, VCFRONT_vehicleStatusChecksum/VCFRONT_vehicleStatusCounter eventually need to be generated via generateMuxFrameCounterChecksum
   //Looks like 2 muxes, counter at bit 52 width 4 and checksum at bit 56 width 8? Need later software Model3_ETH.compact.json signal file or DBC.
-  CAN_frame TESLA_3A1 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x3A1,
-                         .data = {0xC3, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0xD0, 0x01}};
+  CAN_classic_frame TESLA_3A1 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x3A1,
+                                 .data = {0xC3, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0xD0, 0x01}};
   uint8_t frame6_3A1[16] = {0xD0, 0xE2, 0xF0, 0x02, 0x10, 0x22, 0x30, 0x42,
                             0x50, 0x62, 0x70, 0x82, 0x90, 0xA2, 0xB0, 0xC2};
   uint8_t frame7_3A1[16] = {0x01, 0xCB, 0x21, 0xEB, 0x41, 0x0B, 0x61, 0x2B,
                             0x81, 0x4B, 0xA1, 0x6B, 0xC1, 0x8B, 0xE1, 0xAB};
   //0x313 UI_powertrainControl: "cycle_time" 500ms, UI_powertrainControlChecksum/UI_powertrainControlCounter generated via generateFrameCounterChecksum
-  CAN_frame TESLA_313 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x313,
-                         .data = {0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1B}};
+  CAN_classic_frame TESLA_313 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x313,
+                                 .data = {0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1B}};
 
   //0x321 VCFRONT_sensors: "cycle_time" 1000ms
-  CAN_frame TESLA_321 = {
+  CAN_classic_frame TESLA_321 = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
@@ -314,139 +320,148 @@ class TeslaBattery : public CanBattery {
       .data = {0xEC, 0x71, 0xA7, 0x6E, 0x02, 0x6C, 0x00, 0x04}};  // Last 2 bytes are counter and checksum
 
   //0x333 UI_chargeRequest: "cycle_time" 500ms, UI_chargeTerminationPct value = 900 [bit 16, width 10, scale 0.1, min 25, max 100]
-  CAN_frame TESLA_333 = {.FD = false, .ext_ID = false, .DLC = 5, .ID = 0x333, .data = {0x84, 0x30, 0x84, 0x07, 0x02}};
+  CAN_classic_frame TESLA_333 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 5,
+                                 .ID = 0x333,
+                                 .data = {0x84, 0x30, 0x84, 0x07, 0x02}};
 
   //0x334 UI request: "cycle_time" 500ms, initial frame car sends
-  static constexpr CAN_frame TESLA_334_INITIAL = {.FD = false,
-                                                  .ext_ID = false,
-                                                  .DLC = 8,
-                                                  .ID = 0x334,
-                                                  .data = {0x3F, 0x3F, 0xC8, 0x00, 0xE2, 0x3F, 0x80, 0x1E}};
+  static constexpr CAN_classic_frame TESLA_334_INITIAL = {.FD = false,
+                                                          .ext_ID = false,
+                                                          .DLC = 8,
+                                                          .ID = 0x334,
+                                                          .data = {0x3F, 0x3F, 0xC8, 0x00, 0xE2, 0x3F, 0x80, 0x1E}};
 
   //0x334 UI request: "cycle_time" 500ms, generated via generateFrameCounterChecksum
-  CAN_frame TESLA_334 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x334,
-                         .data = {0x3F, 0x3F, 0x00, 0x0F, 0xE2, 0x3F, 0x90, 0x75}};
+  CAN_classic_frame TESLA_334 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x334,
+                                 .data = {0x3F, 0x3F, 0x00, 0x0F, 0xE2, 0x3F, 0x90, 0x75}};
 
   //0x3B3 UI_vehicleControl2: "cycle_time" 500ms
-  static constexpr CAN_frame TESLA_3B3 = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 8,
-                                          .ID = 0x3B3,
-                                          .data = {0x90, 0x80, 0x05, 0x08, 0x00, 0x00, 0x00, 0x01}};
+  static constexpr CAN_classic_frame TESLA_3B3 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 8,
+                                                  .ID = 0x3B3,
+                                                  .data = {0x90, 0x80, 0x05, 0x08, 0x00, 0x00, 0x00, 0x01}};
 
   //0x39D IBST_status: "cycle_time" 50ms, IBST_statusChecksum/IBST_statusCounter generated via generateFrameCounterChecksum
-  CAN_frame TESLA_39D = {.FD = false, .ext_ID = false, .DLC = 5, .ID = 0x39D, .data = {0xE1, 0x59, 0xC1, 0x27, 0x00}};
+  CAN_classic_frame TESLA_39D = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 5,
+                                 .ID = 0x39D,
+                                 .data = {0xE1, 0x59, 0xC1, 0x27, 0x00}};
 
   //0x3C2 VCLEFT_switchStatus (Mux0, initial frame car sends): "cycle_time" 50ms, sent once
-  static constexpr CAN_frame TESLA_3C2_INITIAL = {.FD = false,
-                                                  .ext_ID = false,
-                                                  .DLC = 8,
-                                                  .ID = 0x3C2,
-                                                  .data = {0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x5A, 0x05}};
+  static constexpr CAN_classic_frame TESLA_3C2_INITIAL = {.FD = false,
+                                                          .ext_ID = false,
+                                                          .DLC = 8,
+                                                          .ID = 0x3C2,
+                                                          .data = {0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x5A, 0x05}};
 
   //0x3C2 VCLEFT_switchStatus (Mux0): "cycle_time" 50ms each mux/SwitchStatusIndex
-  static constexpr CAN_frame TESLA_3C2_Mux0 = {.FD = false,
-                                               .ext_ID = false,
-                                               .DLC = 8,
-                                               .ID = 0x3C2,
-                                               .data = {0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x5A, 0x45}};
+  static constexpr CAN_classic_frame TESLA_3C2_Mux0 = {.FD = false,
+                                                       .ext_ID = false,
+                                                       .DLC = 8,
+                                                       .ID = 0x3C2,
+                                                       .data = {0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x5A, 0x45}};
 
   //0x3C2 VCLEFT_switchStatus (Mux1): "cycle_time" 50ms each mux/SwitchStatusIndex
-  static constexpr CAN_frame TESLA_3C2_Mux1 = {.FD = false,
-                                               .ext_ID = false,
-                                               .DLC = 8,
-                                               .ID = 0x3C2,
-                                               .data = {0x29, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame TESLA_3C2_Mux1 = {.FD = false,
+                                                       .ext_ID = false,
+                                                       .DLC = 8,
+                                                       .ID = 0x3C2,
+                                                       .data = {0x29, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   //0x504 Initially sent
-  static constexpr CAN_frame TESLA_504_INITIAL = {.FD = false,
-                                                  .ext_ID = false,
-                                                  .DLC = 8,
-                                                  .ID = 0x504,
-                                                  .data = {0x00, 0x1B, 0x06, 0x03, 0x00, 0x01, 0x00, 0x01}};
+  static constexpr CAN_classic_frame TESLA_504_INITIAL = {.FD = false,
+                                                          .ext_ID = false,
+                                                          .DLC = 8,
+                                                          .ID = 0x504,
+                                                          .data = {0x00, 0x1B, 0x06, 0x03, 0x00, 0x01, 0x00, 0x01}};
 
   //0x55A Unknown but always sent: "cycle_time" 500ms
-  static constexpr CAN_frame TESLA_55A = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 8,
-                                          .ID = 0x55A,
-                                          .data = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame TESLA_55A = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 8,
+                                                  .ID = 0x55A,
+                                                  .data = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   //0x7FF GTW_carConfig: "cycle_time" 100ms each mux/carConfigMultiplexer (UK/RHD)
-  CAN_frame TESLA_7FF_Mux1 = {.FD = false,
-                              .ext_ID = false,
-                              .DLC = 8,
-                              .ID = 0x7FF,
-                              .data = {0x01, 0x49, 0x42, 0x47, 0x00, 0x03, 0x15, 0x01}};
+  CAN_classic_frame TESLA_7FF_Mux1 = {.FD = false,
+                                      .ext_ID = false,
+                                      .DLC = 8,
+                                      .ID = 0x7FF,
+                                      .data = {0x01, 0x49, 0x42, 0x47, 0x00, 0x03, 0x15, 0x01}};
 
   //0x7FF GTW_carConfig: "cycle_time" 100ms each mux/carConfigMultiplexer
-  static constexpr CAN_frame TESLA_7FF_Mux2 = {.FD = false,
-                                               .ext_ID = false,
-                                               .DLC = 8,
-                                               .ID = 0x7FF,
-                                               .data = {0x02, 0x66, 0x32, 0x24, 0x04, 0x49, 0x95, 0x82}};
+  static constexpr CAN_classic_frame TESLA_7FF_Mux2 = {.FD = false,
+                                                       .ext_ID = false,
+                                                       .DLC = 8,
+                                                       .ID = 0x7FF,
+                                                       .data = {0x02, 0x66, 0x32, 0x24, 0x04, 0x49, 0x95, 0x82}};
 
   //0x7FF GTW_carConfig: "cycle_time" 100ms each mux/carConfigMultiplexer (EU/Long Range)
-  CAN_frame TESLA_7FF_Mux3 = {.FD = false,
-                              .ext_ID = false,
-                              .DLC = 8,
-                              .ID = 0x7FF,
-                              .data = {0x03, 0x01, 0x08, 0x48, 0x01, 0x00, 0x00, 0x12}};
+  CAN_classic_frame TESLA_7FF_Mux3 = {.FD = false,
+                                      .ext_ID = false,
+                                      .DLC = 8,
+                                      .ID = 0x7FF,
+                                      .data = {0x03, 0x01, 0x08, 0x48, 0x01, 0x00, 0x00, 0x12}};
 
   //0x7FF GTW_carConfig: "cycle_time" 100ms each mux/carConfigMultiplexer
-  static constexpr CAN_frame TESLA_7FF_Mux4 = {.FD = false,
-                                               .ext_ID = false,
-                                               .DLC = 8,
-                                               .ID = 0x7FF,
-                                               .data = {0x04, 0x73, 0x03, 0x67, 0x5C, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame TESLA_7FF_Mux4 = {.FD = false,
+                                                       .ext_ID = false,
+                                                       .DLC = 8,
+                                                       .ID = 0x7FF,
+                                                       .data = {0x04, 0x73, 0x03, 0x67, 0x5C, 0x00, 0x00, 0x00}};
 
   //0x7FF GTW_carConfig: "cycle_time" 100ms each mux/carConfigMultiplexer
-  static constexpr CAN_frame TESLA_7FF_Mux5 = {.FD = false,
-                                               .ext_ID = false,
-                                               .DLC = 8,
-                                               .ID = 0x7FF,
-                                               .data = {0x05, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame TESLA_7FF_Mux5 = {.FD = false,
+                                                       .ext_ID = false,
+                                                       .DLC = 8,
+                                                       .ID = 0x7FF,
+                                                       .data = {0x05, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00}};
 
   //0x7FF GTW_carConfig: "cycle_time" 100ms each mux/carConfigMultiplexer - later firmware has muxes 6 & 7, needed?
-  static constexpr CAN_frame TESLA_7FF_Mux6 = {.FD = false,
-                                               .ext_ID = false,
-                                               .DLC = 8,
-                                               .ID = 0x7FF,
-                                               .data = {0x06, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0xD0}};
+  static constexpr CAN_classic_frame TESLA_7FF_Mux6 = {.FD = false,
+                                                       .ext_ID = false,
+                                                       .DLC = 8,
+                                                       .ID = 0x7FF,
+                                                       .data = {0x06, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0xD0}};
 
   //0x7FF GTW_carConfig: "cycle_time" 100ms each mux/carConfigMultiplexer - later firmware has muxes 6 & 7, needed?
-  static constexpr CAN_frame TESLA_7FF_Mux7 = {.FD = false,
-                                               .ext_ID = false,
-                                               .DLC = 8,
-                                               .ID = 0x7FF,
-                                               .data = {0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame TESLA_7FF_Mux7 = {.FD = false,
+                                                       .ext_ID = false,
+                                                       .DLC = 8,
+                                                       .ID = 0x7FF,
+                                                       .data = {0x07, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00}};
 
   //0x722 BMS_bmbKeepAlive: "cycle_time" 100ms, should only be sent when testing packs or diagnosing problems
-  static constexpr CAN_frame TESLA_722 = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 8,
-                                          .ID = 0x722,
-                                          .data = {0x02, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80}};
+  static constexpr CAN_classic_frame TESLA_722 = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 8,
+                                                  .ID = 0x722,
+                                                  .data = {0x02, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80}};
 
   //0x25D CP_status: "cycle_time" 100ms, stops some cpMia errors, but not necessary for standalone pack operation so not used/necessary. Note CP_type for different regions, the below has "IEC_CCS"
-  static constexpr CAN_frame TESLA_25D = {.FD = false,
-                                          .ext_ID = false,
-                                          .DLC = 8,
-                                          .ID = 0x25D,
-                                          .data = {0x37, 0x41, 0x01, 0x16, 0x08, 0x00, 0x00, 0x00}};
+  static constexpr CAN_classic_frame TESLA_25D = {.FD = false,
+                                                  .ext_ID = false,
+                                                  .DLC = 8,
+                                                  .ID = 0x25D,
+                                                  .data = {0x37, 0x41, 0x01, 0x16, 0x08, 0x00, 0x00, 0x00}};
 
   //0x602 BMS UDS diagnostic request: on demand
-  CAN_frame TESLA_602 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x602,
-                         .data = {0x02, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00}};  // Define initial UDS request
+  CAN_classic_frame TESLA_602 = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x602,
+      .data = {0x02, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00}};  // Define initial UDS request
 
   //0x610 BMS Query UDS request: on demand
-  static constexpr CAN_frame TESLA_610 = {
+  static constexpr CAN_classic_frame TESLA_610 = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
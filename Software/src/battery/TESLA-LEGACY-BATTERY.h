@@ -5,7 +5,7 @@
 class TeslaLegacyBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Tesla Model S/X 2012-2020";
@@ -30,28 +30,28 @@ class TeslaLegacyBattery : public CanBattery {
   static const int MAX_CELL_DEVIATION_MV = 150;
   static const int MAX_CELL_VOLTAGE_MV = 4200;  //Battery is put into emergency stop if one cell goes over this value
   static const int MIN_CELL_VOLTAGE_MV = 3400;  //Battery is put into emergency stop if one cell goes below this value
-  CAN_frame TESLA_25C = {.FD = false,           // fast charge status
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x25C,
-                         .data = {0x00, 0x02, 0x2A, 0x09, 0x40, 0xC7, 0x72, 0x81}};
-  CAN_frame TESLA_2C8 = {.FD = false,  // GTW status
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x2C8,
-                         .data = {0x6F, 0xE8, 0x13, 0x71, 0x1D, 0x24, 0x80, 0x7B}};
-  CAN_frame TESLA_21C = {.FD = false,  // charger status
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x21C,
-                         .data = {0x31, 0x58, 0x20, 0x89, 0x8C, 0x08, 0x03, 0x08}};
-  CAN_frame TESLA_20E = {.FD = false,  // charge port status
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x20E,
-                         .data = {0x05, 0x56, 0x22, 0x00, 0xC3, 0x00, 0x02, 0x08}};
+  CAN_classic_frame TESLA_25C = {.FD = false,           // fast charge status
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x25C,
+                                 .data = {0x00, 0x02, 0x2A, 0x09, 0x40, 0xC7, 0x72, 0x81}};
+  CAN_classic_frame TESLA_2C8 = {.FD = false,  // GTW status
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x2C8,
+                                 .data = {0x6F, 0xE8, 0x13, 0x71, 0x1D, 0x24, 0x80, 0x7B}};
+  CAN_classic_frame TESLA_21C = {.FD = false,  // charger status
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x21C,
+                                 .data = {0x31, 0x58, 0x20, 0x89, 0x8C, 0x08, 0x03, 0x08}};
+  CAN_classic_frame TESLA_20E = {.FD = false,  // charge port status
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x20E,
+                                 .data = {0x05, 0x56, 0x22, 0x00, 0xC3, 0x00, 0x02, 0x08}};
   // Keep alive
-  CAN_frame TESLA_408 = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x408, .data = {0x00}};
+  CAN_classic_frame TESLA_408 = {.FD = false, .ext_ID = false, .DLC = 1, .ID = 0x408, .data = {0x00}};
   unsigned long previousMillis100 = 0;   // will store last time a 100ms CAN Message was send
   unsigned long previousMillis1000 = 0;  // will store last time a 1s CAN Message was send
   uint32_t BMS_CAC_min = 23160000;
@@ -7,7 +7,7 @@
 class ThinkBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Think City";
@@ -21,12 +21,12 @@ class ThinkBattery : public CanBattery {
 
   unsigned long previousMillis200 = 0;  // will store last time a 100ms CAN Message was sent
 
-  CAN_frame PCU_310 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 3,
-                       .ID = 0x310,
-                       .data = {0x00, 0x00, 0x06}};  //Charger Status & TIM Status = TRUE
-  CAN_frame PCU_311 = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x311, .data = {0x00, 0x00}};
+  CAN_classic_frame PCU_310 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 3,
+                               .ID = 0x310,
+                               .data = {0x00, 0x00, 0x06}};  //Charger Status & TIM Status = TRUE
+  CAN_classic_frame PCU_311 = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x311, .data = {0x00, 0x00}};
 
   uint16_t min_cellvoltage = 3700;
   uint16_t max_cellvoltage = 3700;
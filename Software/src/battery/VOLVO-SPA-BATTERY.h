@@ -7,7 +7,7 @@
 class VolvoSpaBattery : public CanBattery {
  public:
   virtual void setup(void);
-  virtual void handle_incoming_can_frame(CAN_frame rx_frame);
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame);
   virtual void update_values();
   virtual void transmit_can(unsigned long currentMillis);
   static constexpr const char* Name = "Volvo / Polestar 69/78kWh SPA battery";
@@ -67,70 +67,74 @@ class VolvoSpaBattery : public CanBattery {
   bool startedUp = false;
   uint8_t DTC_reset_counter = 0;
 
-  CAN_frame VOLVO_536 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x536,
-                         .data = {0x00, 0x40, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00}};  //Network manage frame
-  CAN_frame VOLVO_140_CLOSE = {.FD = false,
-                               .ext_ID = false,
-                               .DLC = 8,
-                               .ID = 0x140,
-                               .data = {0x00, 0x02, 0x00, 0xB7, 0xFF, 0x03, 0xFF, 0x82}};  //Close contactors message
-  CAN_frame VOLVO_140_OPEN = {.FD = false,
-                              .ext_ID = false,
-                              .DLC = 8,
-                              .ID = 0x140,
-                              .data = {0x00, 0x02, 0x00, 0x9E, 0xFF, 0x03, 0xFF, 0x82}};  //Open contactor message
-  CAN_frame VOLVO_372 = {
+  CAN_classic_frame VOLVO_536 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x536,
+                                 .data = {0x00, 0x40, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00}};  //Network manage frame
+  CAN_classic_frame VOLVO_140_CLOSE = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x140,
+      .data = {0x00, 0x02, 0x00, 0xB7, 0xFF, 0x03, 0xFF, 0x82}};  //Close contactors message
+  CAN_classic_frame VOLVO_140_OPEN = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x140,
+      .data = {0x00, 0x02, 0x00, 0x9E, 0xFF, 0x03, 0xFF, 0x82}};  //Open contactor message
+  CAN_classic_frame VOLVO_372 = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x372,
       .data = {0x00, 0xA6, 0x07, 0x14, 0x04, 0x00, 0x80, 0x00}};  //Ambient Temp -->>VERIFY this data content!!!<<--
-  CAN_frame VOLVO_CELL_U_Req = {.FD = false,
-                                .ext_ID = false,
-                                .DLC = 8,
-                                .ID = 0x735,
-                                .data = {0x03, 0x22, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00}};  //Cell voltage request frame
-  CAN_frame VOLVO_FlowControl = {.FD = false,
-                                 .ext_ID = false,
-                                 .DLC = 8,
-                                 .ID = 0x735,
-                                 .data = {0x30, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00}};  //Flowcontrol
-  CAN_frame VOLVO_SOH_Req = {.FD = false,
-                             .ext_ID = false,
-                             .DLC = 8,
-                             .ID = 0x735,
-                             .data = {0x03, 0x22, 0x49, 0x6D, 0x00, 0x00, 0x00, 0x00}};  //Battery SOH request frame
-  CAN_frame VOLVO_BECMsupplyVoltage_Req = {
+  CAN_classic_frame VOLVO_CELL_U_Req = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x735,
+      .data = {0x03, 0x22, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00}};  //Cell voltage request frame
+  CAN_classic_frame VOLVO_FlowControl = {.FD = false,
+                                         .ext_ID = false,
+                                         .DLC = 8,
+                                         .ID = 0x735,
+                                         .data = {0x30, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00}};  //Flowcontrol
+  CAN_classic_frame VOLVO_SOH_Req = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x735,
+      .data = {0x03, 0x22, 0x49, 0x6D, 0x00, 0x00, 0x00, 0x00}};  //Battery SOH request frame
+  CAN_classic_frame VOLVO_BECMsupplyVoltage_Req = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x735,
       .data = {0x03, 0x22, 0xF4, 0x42, 0x00, 0x00, 0x00, 0x00}};  //BECM supply voltage request frame
-  CAN_frame VOLVO_BECM_HVIL_Status_Req = {
+  CAN_classic_frame VOLVO_BECM_HVIL_Status_Req = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x735,
       .data = {0x03, 0x22, 0x49, 0x1A, 0x00, 0x00, 0x00, 0x00}};  //BECM HVIL status request frame
-  CAN_frame VOLVO_DTC_Erase = {.FD = false,
-                               .ext_ID = false,
-                               .DLC = 8,
-                               .ID = 0x7FF,
-                               .data = {0x04, 0x14, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00}};  //Global DTC erase
-  CAN_frame VOLVO_BECM_ECUreset = {
+  CAN_classic_frame VOLVO_DTC_Erase = {.FD = false,
+                                       .ext_ID = false,
+                                       .DLC = 8,
+                                       .ID = 0x7FF,
+                                       .data = {0x04, 0x14, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00}};  //Global DTC erase
+  CAN_classic_frame VOLVO_BECM_ECUreset = {
       .FD = false,
       .ext_ID = false,
       .DLC = 8,
       .ID = 0x735,
       .data = {0x02, 0x11, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00}};  //BECM ECU reset command (reboot/powercycle BECM)
-  CAN_frame VOLVO_DTCreadout = {.FD = false,
-                                .ext_ID = false,
-                                .DLC = 8,
-                                .ID = 0x7FF,
-                                .data = {0x02, 0x19, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};  //Global DTC readout
+  CAN_classic_frame VOLVO_DTCreadout = {.FD = false,
+                                        .ext_ID = false,
+                                        .DLC = 8,
+                                        .ID = 0x7FF,
+                                        .data = {0x02, 0x19, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00}};  //Global DTC readout
 };
 
 #endif
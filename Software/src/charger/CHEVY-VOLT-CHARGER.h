@@ -14,7 +14,7 @@ class ChevyVoltCharger : public CanCharger {
   const char* name() { return Name; }
   static constexpr const char* Name = "Chevy Volt Gen1 Charger";
 
-  void map_can_frame_to_variable(CAN_frame rx_frame);
+  void map_can_frame_to_variable(const CAN_frame& rx_frame);
   void transmit_can(unsigned long currentMillis);
 
   float outputPowerDC() {
@@ -45,17 +45,17 @@ class ChevyVoltCharger : public CanCharger {
   enum CHARGER_MODES : uint8_t { MODE_DISABLED = 0, MODE_LV, MODE_HV, MODE_HVLV };
 
   //Actual content messages
-  CAN_frame charger_keepalive_frame = {.FD = false,
-                                       .ext_ID = false,
-                                       .DLC = 1,
-                                       .ID = 0x30E,  //one byte only, indicating enabled or disabled
-                                       .data = {MODE_DISABLED}};
-
-  CAN_frame charger_set_targets = {.FD = false,
-                                   .ext_ID = false,
-                                   .DLC = 4,
-                                   .ID = 0x304,
-                                   .data = {0x40, 0x00, 0x00, 0x00}};  // data[0] is a value, meaning unknown
+  CAN_classic_frame charger_keepalive_frame = {.FD = false,
+                                               .ext_ID = false,
+                                               .DLC = 1,
+                                               .ID = 0x30E,  //one byte only, indicating enabled or disabled
+                                               .data = {MODE_DISABLED}};
+
+  CAN_classic_frame charger_set_targets = {.FD = false,
+                                           .ext_ID = false,
+                                           .DLC = 4,
+                                           .ID = 0x304,
+                                           .data = {0x40, 0x00, 0x00, 0x00}};  // data[0] is a value, meaning unknown
 };
 
 #endif
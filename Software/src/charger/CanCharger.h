@@ -46,7 +46,7 @@ class Charger {
 // Base class for chargers on a CAN bus
 class CanCharger : public Charger, Transmitter, CanReceiver {
  public:
-  virtual void map_can_frame_to_variable(CAN_frame rx_frame) = 0;
+  virtual void map_can_frame_to_variable(const CAN_frame& rx_frame) = 0;
   virtual void transmit_can(unsigned long currentMillis) = 0;
 
   void transmit(unsigned long currentMillis) {
@@ -55,7 +55,7 @@ class CanCharger : public Charger, Transmitter, CanReceiver {
     }
   }
 
-  void receive_can_frame(CAN_frame* frame) { map_can_frame_to_variable(*frame); }
+  void receive_can_frame(const CAN_frame& frame) { map_can_frame_to_variable(frame); }
 
   CAN_Interface interface() { return can_interface; }
 
@@ -68,7 +68,12 @@ class CanCharger : public Charger, Transmitter, CanReceiver {
     register_can_receiver(this, can_interface);
   }
 
-  void transmit_can_frame(CAN_frame* frame) { transmit_can_frame_to_interface(frame, can_interface); }
+  void transmit_can_frame(const CAN_frame* frame, CanTxPriority priority = CanTxPriority::Normal) {
+    transmit_can_frame_to_interface(frame, can_interface, priority);
+  }
+  void transmit_can_frame(const CAN_classic_frame* frame, CanTxPriority priority = CanTxPriority::Normal) {
+    transmit_can_frame_to_interface(frame, can_interface, priority);
+  }
 };
 
 extern CanCharger* charger;
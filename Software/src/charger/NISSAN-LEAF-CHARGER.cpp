@@ -21,7 +21,7 @@
  * battery onto the CAN bus. 
 */
 
-static uint8_t calculate_CRC_Nissan(CAN_frame* frame) {
+static uint8_t calculate_CRC_Nissan(CAN_classic_frame* frame) {
   uint8_t crc = 0;
   for (uint8_t j = 0; j < 7; j++) {
     crc = crctable_nissan_leaf[(crc ^ static_cast<uint8_t>(frame->data.u8[j])) % 256];
@@ -29,7 +29,7 @@ static uint8_t calculate_CRC_Nissan(CAN_frame* frame) {
   return crc;
 }
 
-static uint8_t calculate_checksum_nibble(CAN_frame* frame) {
+static uint8_t calculate_checksum_nibble(CAN_classic_frame* frame) {
   uint8_t sum = 0;
   for (uint8_t i = 0; i < 7; i++) {
     sum += frame->data.u8[i] >> 4;
@@ -39,7 +39,7 @@ static uint8_t calculate_checksum_nibble(CAN_frame* frame) {
   return sum;
 }
 
-void NissanLeafCharger::map_can_frame_to_variable(CAN_frame rx_frame) {
+void NissanLeafCharger::map_can_frame_to_variable(const CAN_frame& rx_frame) {
 
   switch (rx_frame.ID) {
     case 0x679:  // This message fires once when charging cable is plugged in
@@ -13,7 +13,7 @@ class NissanLeafCharger : public CanCharger {
   const char* name() { return Name; }
   static constexpr const char* Name = "Nissan LEAF 2013-2024 PDM charger";
 
-  void map_can_frame_to_variable(CAN_frame rx_frame);
+  void map_can_frame_to_variable(const CAN_frame& rx_frame);
   void transmit_can(unsigned long currentMillis);
 
   float outputPowerDC() { return static_cast<float>(datalayer.charger.charger_stat_HVcur * 100); }
@@ -54,42 +54,42 @@ class NissanLeafCharger : public CanCharger {
   bool OBCwakeup = false;
 
   //Actual content messages
-  CAN_frame LEAF_1DB = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x1DB,
-                        .data = {0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00}};
-  CAN_frame LEAF_1DC = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x1DC,
-                        .data = {0x6E, 0x0A, 0x05, 0xD5, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame LEAF_1F2 = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x1F2,
-                        .data = {0x30, 0x00, 0x20, 0xAC, 0x00, 0x3C, 0x00, 0x8F}};
-  CAN_frame LEAF_50B = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 7,
-                        .ID = 0x50B,
-                        .data = {0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00}};
-  CAN_frame LEAF_55B = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x55B,
-                        .data = {0xA4, 0x40, 0xAA, 0x00, 0xDF, 0xC0, 0x10, 0x00}};
-  CAN_frame LEAF_5BC = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x5BC,
-                        .data = {0x3D, 0x80, 0xF0, 0x64, 0xB0, 0x01, 0x00, 0x32}};
+  CAN_classic_frame LEAF_1DB = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x1DB,
+                                .data = {0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00}};
+  CAN_classic_frame LEAF_1DC = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x1DC,
+                                .data = {0x6E, 0x0A, 0x05, 0xD5, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame LEAF_1F2 = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x1F2,
+                                .data = {0x30, 0x00, 0x20, 0xAC, 0x00, 0x3C, 0x00, 0x8F}};
+  CAN_classic_frame LEAF_50B = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 7,
+                                .ID = 0x50B,
+                                .data = {0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00}};
+  CAN_classic_frame LEAF_55B = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x55B,
+                                .data = {0xA4, 0x40, 0xAA, 0x00, 0xDF, 0xC0, 0x10, 0x00}};
+  CAN_classic_frame LEAF_5BC = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x5BC,
+                                .data = {0x3D, 0x80, 0xF0, 0x64, 0xB0, 0x01, 0x00, 0x32}};
 
-  CAN_frame LEAF_59E = {.FD = false,
-                        .ext_ID = false,
-                        .DLC = 8,
-                        .ID = 0x59E,
-                        .data = {0x00, 0x00, 0x0C, 0x76, 0x18, 0x00, 0x00, 0x00}};
+  CAN_classic_frame LEAF_59E = {.FD = false,
+                                .ext_ID = false,
+                                .DLC = 8,
+                                .ID = 0x59E,
+                                .data = {0x00, 0x00, 0x0C, 0x76, 0x18, 0x00, 0x00, 0x00}};
 };
 
 #endif
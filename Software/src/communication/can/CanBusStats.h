@@ -0,0 +1,150 @@
+#ifndef _CAN_BUS_STATS_H
+#define _CAN_BUS_STATS_H
+
+#include <string.h>
+#include <algorithm>
+#include "../../datalayer/datalayer.h"
+#include "../../devboard/utils/types.h"
+#include "CanIdSet.h"
+
+// Traffic counters of one CAN interface, fed with every frame received or sent. Counting a frame costs a few
+// additions and one probe into a small hash of IDs, so it can be done on the receive and transmit paths.
+// sample() turns the counts into per second rates and starts counting anew.
+class CanBusStats {
+ public:
+  // data_rate_factor: data phase bit rate of CAN-FD frames relative to the nominal bit rate
+  explicit CanBusStats(uint8_t data_rate_factor = 1) : data_rate_factor(data_rate_factor) { reset(); }
+
+  // Time a frame occupies the bus, in nominal bit times, counting the worst case amount of stuff bits
+  static uint16_t frame_bit_times(bool fd, bool ext_ID, uint8_t length, uint8_t data_rate_factor) {
+    if (!fd) {
+      // SOF up to the CRC can be stuffed. The CRC delimiter, ACK, EOF and interframe space can not.
+      const uint16_t stuffable = (ext_ID ? 54 : 34) + 8 * std::min<uint8_t>(length, 8);
+      return stuffable + (stuffable - 1) / 4 + 13;
+    }
+    // CAN-FD: SOF up to BRS and the trailer at the nominal rate, ESI up to the CRC at the data rate.
+    // The stuff count and CRC get a fixed stuff bit every 4 bits.
+    const uint16_t arbitration = ext_ID ? 36 : 17;
+    const uint16_t crc = length > 16 ? 21 : 17;
+    const uint16_t dynamic = 5 + 8 * length;
+    const uint16_t data_phase = dynamic + (dynamic - 1) / 4 + (4 + crc) + (4 + crc + 3) / 4;
+    const uint8_t factor = data_rate_factor == 0 ? 1 : data_rate_factor;
+    return arbitration + (arbitration - 1) / 4 + (data_phase + factor - 1) / factor + 13;
+  }
+
+  template <typename Frame>
+  void count(const Frame& frame, bool tx) {
+    frames++;
+    bit_times += frame_bit_times(frame.FD, frame.ext_ID, frame.DLC, data_rate_factor);
+    IdSlot* slot = find_slot(frame.ID, frame.ext_ID);
+    if (slot != nullptr) {
+      if (tx) {
+        slot->tx++;
+      } else {
+        slot->rx++;
+      }
+    }
+  }
+
+  // Adds the counts of other, kept by another task, and clears them there
+  void absorb(CanBusStats& other) {
+    frames += other.frames;
+    bit_times += other.bit_times;
+    untracked_ids |= other.untracked_ids;
+    for (const auto& theirs : other.ids) {
+      if (theirs.key == 0) {
+        continue;
+      }
+      IdSlot* slot = find_slot(theirs.key & CAN_EXT_ID_MASK, (theirs.key & KEY_EXTENDED) != 0);
+      if (slot != nullptr) {
+        slot->rx += theirs.rx;
+        slot->tx += theirs.tx;
+      }
+    }
+    other.reset();
+  }
+
+  // Writes the rates since the previous sample into stats, stats.bitrate must be set
+  void sample(DATALAYER_CAN_BUS_STATS_TYPE& stats, uint32_t elapsed_ms) {
+    if (elapsed_ms == 0) {
+      return;
+    }
+    stats.frames_per_second = (uint64_t)frames * 1000 / elapsed_ms;
+    stats.bits_per_second = (uint64_t)bit_times * 1000 / elapsed_ms;
+    stats.utilization_dpct =
+        stats.bitrate == 0 ? 0 : std::min<uint64_t>(1000, (uint64_t)stats.bits_per_second * 1000 / stats.bitrate);
+
+    IdSlot used[ID_SLOTS];
+    uint8_t used_count = 0;
+    for (auto& slot : ids) {
+      if (slot.key != 0) {
+        used[used_count++] = slot;
+      }
+    }
+    const uint8_t listed = std::min<uint8_t>(used_count, CAN_ID_RATE_TABLE_SIZE);
+    std::partial_sort(used, used + listed, used + used_count, [](const IdSlot& a, const IdSlot& b) {
+      return a.rx + a.tx > b.rx + b.tx;
+    });
+
+    stats.id_count = used_count + untracked_ids;
+    for (uint8_t i = 0; i < CAN_ID_RATE_TABLE_SIZE; i++) {
+      auto& rate = stats.id_rates[i];
+      if (i < listed) {
+        rate.id = used[i].key & CAN_EXT_ID_MASK;
+        rate.ext_ID = (used[i].key & KEY_EXTENDED) != 0;
+        rate.rx_per_second = (uint32_t)used[i].rx * 1000 / elapsed_ms;
+        rate.tx_per_second = (uint32_t)used[i].tx * 1000 / elapsed_ms;
+      } else {
+        rate = DATALAYER_CAN_ID_RATE_TYPE();
+      }
+    }
+    reset();
+  }
+
+ private:
+  // Power of two. IDs that find no free slot within MAX_PROBES are only counted in the totals.
+  static const uint8_t ID_SLOTS = 64;
+  static const uint8_t MAX_PROBES = 8;
+  static const uint32_t KEY_USED = 0x80000000;
+  static const uint32_t KEY_EXTENDED = 0x40000000;
+
+  struct IdSlot {
+    uint32_t key;
+    uint16_t rx;
+    uint16_t tx;
+  };
+
+  IdSlot* find_slot(uint32_t id, bool ext_ID) {
+    const uint32_t key = id | KEY_USED | (ext_ID ? KEY_EXTENDED : 0);
+    uint8_t index = (key * 2654435761u) >> 26;
+    for (uint8_t probe = 0; probe < MAX_PROBES; probe++) {
+      IdSlot& slot = ids[index];
+      if (slot.key == key) {
+        return &slot;
+      }
+      if (slot.key == 0) {
+        slot.key = key;
+        return &slot;
+      }
+      index = (index + 1) & (ID_SLOTS - 1);
+    }
+    untracked_ids = 1;
+    return nullptr;
+  }
+
+  void reset() {
+    memset(ids, 0, sizeof(ids));
+    frames = 0;
+    bit_times = 0;
+    untracked_ids = 0;
+  }
+
+  IdSlot ids[ID_SLOTS];
+  uint32_t frames;
+  uint32_t bit_times;
+  // Set if some ID did not fit in the hash, so id_count is a lower bound
+  uint8_t untracked_ids;
+  const uint8_t data_rate_factor;
+};
+
+#endif
@@ -0,0 +1,83 @@
+#include "CanDispatchTable.h"
+#include <string.h>
+#include "CanReceiver.h"
+
+CanDispatchTable::CanDispatchTable() : count(0), extended_all(0) {
+  memset(receivers, 0, sizeof(receivers));
+  memset(extended_cache, 0, sizeof(extended_cache));
+  memset(standard_lookup, 0, sizeof(standard_lookup));
+}
+
+bool CanDispatchTable::add_receiver(CanReceiver* receiver) {
+  CanIdSet ids;
+  receiver->declare_can_ids(ids);
+  return add_receiver(receiver, ids);
+}
+
+bool CanDispatchTable::add_receiver(CanReceiver* receiver, const CanIdSet& ids) {
+  if (count >= MAX_RECEIVERS) {
+    return false;
+  }
+
+  const uint8_t bit = 1 << count;
+  receivers[count++] = receiver;
+  all_ids.add_set(ids);
+
+  if (ids.accepts_all()) {
+    for (auto& entry : standard_lookup) {
+      entry |= bit;
+    }
+    extended_all |= bit;
+  } else {
+    for (auto& block : ids.get_blocks()) {
+      if (block.ext_ID) {
+        extended_blocks.push_back({block, bit});
+        continue;
+      }
+      // Mark every standard ID covered by the block
+      for (uint32_t id = 0; id <= CAN_STD_ID_MASK; id++) {
+        if (block.matches(id)) {
+          standard_lookup[id] |= bit;
+        }
+      }
+    }
+  }
+
+  // Previously resolved extended IDs may now have more receivers
+  memset(extended_cache, 0, sizeof(extended_cache));
+  return true;
+}
+
+uint8_t CanDispatchTable::lookup_extended(uint32_t id) {
+  // Fibonacci hashing of the ID into the cache
+  ExtCacheEntry& entry = extended_cache[(uint32_t)(id * 2654435769U) >> 26];
+  if (entry.valid && entry.id == id) {
+    return entry.receivers;
+  }
+
+  uint8_t result = extended_all;
+  for (auto& block : extended_blocks) {
+    if (block.first.matches(id)) {
+      result |= block.second;
+    }
+  }
+
+  entry = {id, result, true};
+  return result;
+}
+
+uint8_t CanDispatchTable::receivers_for(const CAN_frame& frame) {
+  if (!frame.ext_ID && frame.ID <= CAN_STD_ID_MASK) {
+    return standard_lookup[frame.ID];
+  }
+  return lookup_extended(frame.ID & CAN_EXT_ID_MASK);
+}
+
+void CanDispatchTable::dispatch(const CAN_frame& frame) {
+  uint8_t targets = receivers_for(frame);
+  for (uint8_t i = 0; targets != 0; i++, targets >>= 1) {
+    if (targets & 1) {
+      receivers[i]->receive_can_frame(frame);
+    }
+  }
+}
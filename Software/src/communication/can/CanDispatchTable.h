@@ -0,0 +1,53 @@
+#ifndef _CAN_DISPATCH_TABLE_H
+#define _CAN_DISPATCH_TABLE_H
+
+#include "../../devboard/utils/types.h"
+#include "CanIdSet.h"
+
+class CanReceiver;
+
+// Routes received frames of one CAN interface to the receivers that declared interest in their ID.
+// Standard IDs are looked up in a table covering the whole 11-bit space, extended IDs are resolved
+// against the declared blocks once and then remembered in a small hash.
+class CanDispatchTable {
+ public:
+  static const uint8_t MAX_RECEIVERS = 8;
+
+  CanDispatchTable();
+
+  // Adds a receiver, asking it which IDs it wants. Returns false if the table is full.
+  bool add_receiver(CanReceiver* receiver);
+  // Adds a receiver with explicitly given IDs. Returns false if the table is full.
+  bool add_receiver(CanReceiver* receiver, const CanIdSet& ids);
+
+  // Bitmask of receiver indexes that want this frame
+  uint8_t receivers_for(const CAN_frame& frame);
+  // Hands the frame to every interested receiver
+  void dispatch(const CAN_frame& frame);
+
+  uint8_t receiver_count() const { return count; }
+  CanReceiver* receiver(uint8_t index) const { return receivers[index]; }
+  // Union of the IDs declared by all receivers, used to program hardware acceptance filters
+  const CanIdSet& accepted_ids() const { return all_ids; }
+
+ private:
+  static const uint8_t EXT_CACHE_SIZE = 64;
+
+  struct ExtCacheEntry {
+    uint32_t id;
+    uint8_t receivers;
+    bool valid;
+  };
+
+  uint8_t lookup_extended(uint32_t id);
+
+  CanReceiver* receivers[MAX_RECEIVERS];
+  uint8_t count;
+  uint8_t extended_all;
+  CanIdSet all_ids;
+  std::vector<std::pair<CanIdMask, uint8_t>> extended_blocks;
+  ExtCacheEntry extended_cache[EXT_CACHE_SIZE];
+  uint8_t standard_lookup[CAN_STD_ID_MASK + 1];
+};
+
+#endif
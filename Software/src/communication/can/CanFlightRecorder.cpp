@@ -0,0 +1,214 @@
+#include "CanFlightRecorder.h"
+#include <string.h>
+#include <algorithm>
+
+CanFlightRecorder can_flight_recorder;
+
+// Records a single record() or poll() drops from the window for being older than pre-trigger time. Many more than the
+// one record a frame adds, so the window catches up a few frames after a quiet bus without a long walk
+static const uint32_t WINDOW_STEPS = 32;
+
+void CanFlightRecorder::begin(uint8_t* new_memory, size_t size, const CanFlightRecorderConfig& new_config) {
+  memory = new_memory;
+  block_count = memory != nullptr ? size / CAN_LOG_BLOCK_SIZE : 0;
+  config = new_config;
+  head = 0;
+  window_start = 0;
+  window_bytes = 0;
+  recorded_frames = 0;
+  if (block_count < CAN_LOG_MAX_RECORD_SIZE / CAN_LOG_BLOCK_SIZE) {
+    current_state.store(CanFlightState::Off, std::memory_order_release);
+    return;
+  }
+  rearm();
+}
+
+void CanFlightRecorder::record(const CAN_frame& frame, CAN_Interface interface, frameDirection direction,
+                               uint64_t timestamp_us) {
+  const CanFlightState state = current_state.load(std::memory_order_acquire);
+  if (state != CanFlightState::Recording && state != CanFlightState::Triggered) {
+    return;
+  }
+
+  const uint8_t length = std::min<uint8_t>(frame.DLC, 64);
+  const uint32_t blocks = length <= 8 ? 1 : 1 + (length - 8 + CAN_LOG_BLOCK_SIZE - 1) / CAN_LOG_BLOCK_SIZE;
+  // A record never wraps around the end of the memory, the blocks it does not fit in are left empty
+  const uint32_t position = head % block_count;
+  const uint32_t padding = position + blocks > block_count ? block_count - position : 0;
+
+  const uint64_t end = head + padding + blocks;
+  if (state == CanFlightState::Triggered) {
+    if (!window_found) {
+      find_window_start();
+    }
+    if ((int64_t)(timestamp_us - triggered_us) >= (int64_t)config.post_trigger_ms * 1000 ||
+        (window_found && end - window_start > block_count && !drop_history(end - block_count))) {
+      freeze();
+      return;
+    }
+  } else {
+    const uint64_t pre_trigger_us = (uint64_t)config.pre_trigger_ms * 1000;
+    advance_window(timestamp_us > pre_trigger_us ? timestamp_us - pre_trigger_us : 0);
+  }
+  // The records about to be overwritten leave the window
+  while (end - window_start > block_count) {
+    drop_record();
+  }
+
+  if (padding > 0) {
+    memset(block(head), 0, (size_t)padding * CAN_LOG_BLOCK_SIZE);
+    head += padding;
+  }
+  can_log_encode(frame, interface, direction, timestamp_us, block(head));
+  head += blocks;
+  window_bytes += (size_t)blocks * CAN_LOG_BLOCK_SIZE;
+  recorded_frames++;
+}
+
+void CanFlightRecorder::poll(uint64_t now_us) {
+  if (current_state.load(std::memory_order_acquire) != CanFlightState::Triggered) {
+    return;
+  }
+  if (!window_found) {
+    find_window_start();
+  }
+  if ((int64_t)(now_us - triggered_us) >= (int64_t)config.post_trigger_ms * 1000) {
+    freeze();
+  }
+}
+
+bool CanFlightRecorder::trigger(uint16_t new_reason, uint64_t now_us) {
+  if (current_state.load(std::memory_order_acquire) != CanFlightState::Recording ||
+      trigger_claimed.exchange(true, std::memory_order_acq_rel)) {
+    return false;
+  }
+  reason = new_reason;
+  triggered_us = now_us;
+  current_state.store(CanFlightState::Triggered, std::memory_order_release);
+  return true;
+}
+
+void CanFlightRecorder::set_trigger_event(uint16_t event, bool enabled) {
+  if (event >= CAN_FLIGHT_MAX_EVENTS) {
+    return;
+  }
+  if (enabled) {
+    trigger_events[event / 32] |= 1UL << (event % 32);
+  } else {
+    trigger_events[event / 32] &= ~(1UL << (event % 32));
+  }
+}
+
+size_t CanFlightRecorder::snapshot_size() const {
+  return current_state.load(std::memory_order_acquire) == CanFlightState::Frozen ? snapshot_bytes : 0;
+}
+
+size_t CanFlightRecorder::read(uint32_t& cursor, uint8_t* out, size_t size) const {
+  if (current_state.load(std::memory_order_acquire) != CanFlightState::Frozen) {
+    return 0;
+  }
+  size_t copied = 0;
+  while (window_start + cursor < window_end) {
+    const uint8_t* start = block(window_start + cursor);
+    const size_t record_size = can_log_record_size(start);
+    if (record_size == 0) {
+      cursor++;  // Left empty at the end of the memory
+      continue;
+    }
+    if (copied + record_size > size) {
+      break;
+    }
+    memcpy(out + copied, start, record_size);
+    copied += record_size;
+    cursor += record_size / CAN_LOG_BLOCK_SIZE;
+  }
+  return copied;
+}
+
+void CanFlightRecorder::rearm() {
+  if (block_count == 0) {
+    return;
+  }
+  window_found = false;
+  snapshot_bytes = 0;
+  trigger_claimed.store(false, std::memory_order_release);
+  current_state.store(CanFlightState::Recording, std::memory_order_release);
+}
+
+void CanFlightRecorder::drop_record() {
+  const size_t record_size = can_log_record_size(block(window_start));
+  window_bytes -= record_size;
+  window_start += record_size == 0 ? 1 : record_size / CAN_LOG_BLOCK_SIZE;
+}
+
+bool CanFlightRecorder::advance_window(uint64_t from_us) {
+  for (uint32_t step = 0; window_start < head; step++) {
+    const size_t record_size = can_log_record_size(block(window_start));
+    if (record_size != 0) {
+      CanLogRecord record;
+      memcpy(&record, block(window_start), sizeof(record));
+      if (record.timestamp_us >= from_us) {
+        return true;
+      }
+    }
+    if (step == WINDOW_STEPS) {
+      return false;
+    }
+    drop_record();
+  }
+  return true;
+}
+
+void CanFlightRecorder::find_window_start() {
+  // The window already starts at most pre-trigger time before the last frame recorded, only the records from then
+  // until the trigger are left to drop
+  const uint64_t pre_trigger_us = (uint64_t)config.pre_trigger_ms * 1000;
+  if (!advance_window(triggered_us > pre_trigger_us ? triggered_us - pre_trigger_us : 0)) {
+    return;  // Goes on with the next frame or poll()
+  }
+  // Post-trigger frames may take the place of the oldest history, up to half of the memory
+  window_limit = std::max(window_start, head > block_count / 2 ? head - block_count / 2 : 0);
+  window_found = true;
+}
+
+bool CanFlightRecorder::drop_history(uint64_t until) {
+  uint64_t index = window_start;
+  size_t bytes = 0;
+  while (index < until) {
+    const size_t record_size = can_log_record_size(block(index));
+    bytes += record_size;
+    index += record_size == 0 ? 1 : record_size / CAN_LOG_BLOCK_SIZE;
+  }
+  if (index > window_limit) {
+    return false;
+  }
+  window_start = index;
+  window_bytes -= bytes;
+  return true;
+}
+
+void CanFlightRecorder::freeze() {
+  // Without walking the memory: window_bytes already counts the records of the window. Should the window start not
+  // be found yet, the snapshot keeps some more history
+  window_end = head;
+  snapshot_bytes = window_bytes;
+  current_state.store(CanFlightState::Frozen, std::memory_order_release);
+}
+
+size_t CanFlightSnapshotStream::read(uint8_t* out, size_t size) {
+  size_t copied = 0;
+  while (copied < size) {
+    if (position == fill) {
+      fill = recorder.read(cursor, buffer, sizeof(buffer));
+      position = 0;
+      if (fill == 0) {
+        break;
+      }
+    }
+    const size_t length = std::min(size - copied, fill - position);
+    memcpy(out + copied, buffer + position, length);
+    copied += length;
+    position += length;
+  }
+  return copied;
+}
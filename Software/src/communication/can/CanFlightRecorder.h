@@ -0,0 +1,132 @@
+#ifndef CAN_FLIGHT_RECORDER_H
+#define CAN_FLIGHT_RECORDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "../../devboard/sdcard/can_log_record.h"
+
+enum class CanFlightState : uint8_t {
+  Off,         // No memory
+  Recording,   // Keeps the latest frames, overwriting the oldest
+  Triggered,   // An event happened, recording goes on for the post-trigger time
+  Frozen,      // Holds the frames around the event until rearm()
+};
+
+// Events that can be selected as triggers, numbered like EVENTS_ENUM_TYPE
+#define CAN_FLIGHT_MAX_EVENTS 256
+
+// Events that trigger the recorder besides the fixed list of comm_can.cpp, as stored in the settings
+enum class CanFlightTrigger : uint8_t {
+  Listed = 0,    // Only the fixed list
+  Errors = 1,    // Also every error
+  Warnings = 2,  // Also every warning and error
+};
+
+struct CanFlightRecorderConfig {
+  // History kept from before the trigger, as far as the memory holds it
+  uint32_t pre_trigger_ms = 10000;
+  // Recording time after the trigger. When the memory is full it takes the place of the oldest pre-trigger history,
+  // but ends early rather than leaving less than half of the memory to the history
+  uint32_t post_trigger_ms = 5000;
+};
+
+// Always-on capture of the recent CAN traffic of all interfaces, in the binary format of the SD card CAN log
+// (can_log_record.h). The memory is a circle of 24 byte blocks; a frame is encoded straight into it, so recording
+// costs about one record copy per frame. An event triggers it: recording goes on for the post-trigger time, then the
+// frames from pre-trigger time before the event until then are frozen for saving or download.
+//
+// record() and poll() must not run at the same time, frames are sent from several tasks so the caller serializes
+// them. Neither walks the memory: the window start follows the frames a few records per call, so the caller may hold
+// a spinlock around them whatever the memory size. trigger() may be called from any task. The snapshot is read once
+// frozen, by any task, and stays untouched until rearm().
+class CanFlightRecorder {
+ public:
+  // Uses size bytes of memory, which must stay valid. Starts recording
+  void begin(uint8_t* memory, size_t size, const CanFlightRecorderConfig& config);
+
+  void record(const CAN_frame& frame, CAN_Interface interface, frameDirection direction, uint64_t timestamp_us);
+
+  // Ends the post-trigger time also when no frames arrive
+  void poll(uint64_t now_us);
+
+  // Starts the post-trigger time, unless already triggered or frozen. reason is kept for the snapshot, e.g. an event
+  bool trigger(uint16_t reason, uint64_t now_us);
+
+  // Selects the events that trigger the recorder when they are raised
+  void set_trigger_event(uint16_t event, bool enabled);
+  bool triggered_by(uint16_t event) const {
+    return event < CAN_FLIGHT_MAX_EVENTS && (trigger_events[event / 32] & (1UL << (event % 32))) != 0;
+  }
+
+  CanFlightState state() const { return current_state.load(std::memory_order_acquire); }
+  uint16_t trigger_reason() const { return reason; }
+  uint64_t trigger_time_us() const { return triggered_us; }
+
+  // Bytes of the frozen snapshot, 0 otherwise
+  size_t snapshot_size() const;
+
+  // Copies whole records of the frozen snapshot from cursor on into out, oldest first, and advances cursor. Start
+  // with cursor 0. Returns the bytes copied, 0 at the end; size must be at least CAN_LOG_MAX_RECORD_SIZE.
+  size_t read(uint32_t& cursor, uint8_t* out, size_t size) const;
+
+  // Drops the snapshot and records again
+  void rearm();
+
+  size_t capacity_blocks() const { return block_count; }
+  // Frames recorded since begin()
+  uint32_t frames() const { return recorded_frames; }
+
+ private:
+  uint8_t* block(uint64_t index) const { return memory + (size_t)(index % block_count) * CAN_LOG_BLOCK_SIZE; }
+  void drop_record();
+  bool advance_window(uint64_t from_us);
+  void find_window_start();
+  bool drop_history(uint64_t until);
+  void freeze();
+
+  uint8_t* memory = nullptr;
+  uint32_t block_count = 0;
+  CanFlightRecorderConfig config;
+
+  std::atomic<CanFlightState> current_state{CanFlightState::Off};
+  // Taken by the first trigger() until rearm()
+  std::atomic<bool> trigger_claimed{false};
+  // Blocks ever written, the next record goes to block(head)
+  uint64_t head = 0;
+  // Oldest whole record kept. While recording it follows the frames to at most pre-trigger time before the last one,
+  // after a trigger it is moved to pre-trigger time before the trigger, then only by post-trigger frames up to
+  // window_limit
+  uint64_t window_start = 0;
+  uint64_t window_limit = 0;
+  bool window_found = false;
+  // Bytes of the records from window_start to head
+  size_t window_bytes = 0;
+  // End of the snapshot and its size without the empty blocks, set when frozen
+  uint64_t window_end = 0;
+  size_t snapshot_bytes = 0;
+  uint16_t reason = 0;
+  uint64_t triggered_us = 0;
+  uint32_t trigger_events[CAN_FLIGHT_MAX_EVENTS / 32] = {};
+  uint32_t recorded_frames = 0;
+};
+
+// Reads a frozen snapshot as a byte stream in pieces of any size, e.g. for CanLogTextStream or a download. Ends early
+// when the recorder is rearmed meanwhile
+class CanFlightSnapshotStream {
+ public:
+  explicit CanFlightSnapshotStream(const CanFlightRecorder& recorder) : recorder(recorder) {}
+
+  size_t read(uint8_t* out, size_t size);
+
+ private:
+  const CanFlightRecorder& recorder;
+  uint32_t cursor = 0;
+  uint8_t buffer[4 * CAN_LOG_MAX_RECORD_SIZE];
+  size_t fill = 0;
+  size_t position = 0;
+};
+
+extern CanFlightRecorder can_flight_recorder;
+
+#endif
@@ -0,0 +1,81 @@
+#include "CanFrameText.h"
+#include "CanIdSet.h"
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+// "00" "01" ... "99", two decimal digits per lookup
+static const char decimal_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657"
+    "585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+// Writes the last two decimal digits of value at out
+static inline void put_pair(char* out, uint32_t value) {
+  out[0] = decimal_pairs[value * 2];
+  out[1] = decimal_pairs[value * 2 + 1];
+}
+
+// Writes value without leading zeros, returns the digit count
+static inline size_t put_decimal(char* out, uint32_t value) {
+  char digits[10];
+  size_t position = sizeof(digits);
+  while (value >= 100) {
+    position -= 2;
+    put_pair(digits + position, value % 100);
+    value /= 100;
+  }
+  if (value >= 10) {
+    position -= 2;
+    put_pair(digits + position, value);
+  } else {
+    digits[--position] = '0' + value;
+  }
+  const size_t count = sizeof(digits) - position;
+  for (size_t i = 0; i < count; i++) {
+    out[i] = digits[position + i];
+  }
+  return count;
+}
+
+size_t format_can_frame_text(char* out, uint64_t timestamp_us, bool tx, uint8_t interface, uint32_t id,
+                             const uint8_t* data, uint8_t length) {
+  char* p = out;
+  const uint32_t seconds = timestamp_us / 1000000;
+  const uint32_t microseconds = timestamp_us - (uint64_t)seconds * 1000000;
+
+  *p++ = '(';
+  p += put_decimal(p, seconds);
+  *p++ = '.';
+  put_pair(p, microseconds / 10000);
+  put_pair(p + 2, microseconds / 100 % 100);
+  put_pair(p + 4, microseconds % 100);
+  p += 6;
+
+  *p++ = ')';
+  *p++ = ' ';
+  *p++ = tx ? 'T' : 'R';
+  *p++ = 'X';
+  p += put_decimal(p, interface * 2 + (tx ? 1 : 0));
+  *p++ = ' ';
+
+  id &= CAN_EXT_ID_MASK;
+  int shift = 28;
+  while (shift > 0 && (id >> shift) == 0) {
+    shift -= 4;
+  }
+  for (; shift >= 0; shift -= 4) {
+    *p++ = hex_digits[(id >> shift) & 0x0F];
+  }
+
+  *p++ = ' ';
+  *p++ = '[';
+  p += put_decimal(p, length);
+  *p++ = ']';
+  for (uint8_t i = 0; i < length; i++) {
+    p[0] = ' ';
+    p[1] = hex_digits[data[i] >> 4];
+    p[2] = hex_digits[data[i] & 0x0F];
+    p += 3;
+  }
+  *p++ = '\n';
+  return p - out;
+}
@@ -0,0 +1,24 @@
+#ifndef _CAN_FRAME_TEXT_H
+#define _CAN_FRAME_TEXT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../../devboard/utils/types.h"
+
+// Longest line: "(4294967295.999999) TX7 1FFFFFFF [64] " and 64 data bytes
+#define CAN_FRAME_TEXT_MAX_LENGTH 240
+
+// Formats a frame as the candump style line used by all CAN logs (USB, webserver and SD export):
+// "(1700000000.123456) RX0 7FF [8] 00 11 22 33 44 55 66 77\n". The interface is printed times two, plus one for TX,
+// so SavvyCAN puts RX and TX in a different bus. Writes the whole line in one pass with lookup tables, out must hold
+// CAN_FRAME_TEXT_MAX_LENGTH characters. Returns the line length, the line is not null terminated.
+size_t format_can_frame_text(char* out, uint64_t timestamp_us, bool tx, uint8_t interface, uint32_t id,
+                             const uint8_t* data, uint8_t length);
+
+inline size_t format_can_frame_text(char* out, const CAN_frame& frame, CAN_Interface interface,
+                                    frameDirection direction, uint64_t timestamp_us) {
+  return format_can_frame_text(out, timestamp_us, direction == MSG_TX, interface, frame.ID, frame.data.u8,
+                               frame.DLC > 64 ? 64 : frame.DLC);
+}
+
+#endif
@@ -0,0 +1,146 @@
+#include "CanIdSet.h"
+
+static inline uint32_t full_mask(bool ext_ID) {
+  return ext_ID ? CAN_EXT_ID_MASK : CAN_STD_ID_MASK;
+}
+
+// True if every identifier of b is also covered by a
+static inline bool covers(const CanIdMask& a, const CanIdMask& b) {
+  return a.ext_ID == b.ext_ID && (a.mask & ~b.mask) == 0 && a.matches(b.id);
+}
+
+// Smallest block covering both a and b
+static inline CanIdMask merge(const CanIdMask& a, const CanIdMask& b) {
+  uint32_t mask = a.mask & b.mask & ~(a.id ^ b.id);
+  return {a.id & mask, mask, a.ext_ID};
+}
+
+uint64_t CanIdMask::size() const {
+  const uint32_t full = full_mask(ext_ID);
+  return 1ULL << (__builtin_popcount(full) - __builtin_popcount(mask & full));
+}
+
+void CanIdSet::add_id(uint32_t id, bool ext_ID) {
+  add_mask(id, full_mask(ext_ID), ext_ID);
+}
+
+void CanIdSet::add_range(uint32_t first, uint32_t last, bool ext_ID) {
+  const uint32_t full = full_mask(ext_ID);
+  uint64_t start = first & full;
+  const uint64_t end = last & full;
+
+  // Split the range into the largest possible power-of-two sized, aligned blocks
+  while (start <= end) {
+    uint8_t bits = 0;
+    while (bits < 29 && (start & (1ULL << bits)) == 0 && start + (2ULL << bits) - 1 <= end) {
+      bits++;
+    }
+    add_mask((uint32_t)start, full & ~((1UL << bits) - 1), ext_ID);
+    start += 1ULL << bits;
+  }
+}
+
+void CanIdSet::add_mask(uint32_t id, uint32_t mask, bool ext_ID) {
+  mask &= full_mask(ext_ID);
+  CanIdMask block = {id & mask, mask, ext_ID};
+  for (auto& existing : blocks) {
+    if (covers(existing, block)) {
+      return;
+    }
+  }
+  blocks.push_back(block);
+}
+
+void CanIdSet::add_set(const CanIdSet& other) {
+  if (other.all) {
+    all = true;
+  }
+  for (auto& block : other.blocks) {
+    add_mask(block.id, block.mask, block.ext_ID);
+  }
+}
+
+bool CanIdSet::has_format(bool ext_ID) const {
+  if (all) {
+    return true;
+  }
+  for (auto& block : blocks) {
+    if (block.ext_ID == ext_ID) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool CanIdSet::contains(uint32_t id, bool ext_ID) const {
+  if (all) {
+    return true;
+  }
+  for (auto& block : blocks) {
+    if (block.ext_ID == ext_ID && block.matches(id)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<CanIdMask> CanIdSet::reduce(bool ext_ID, size_t max_count) const {
+  std::vector<CanIdMask> result;
+  if (max_count == 0) {
+    return result;
+  }
+  if (all) {
+    result.push_back({0, 0, ext_ID});
+    return result;
+  }
+
+  for (auto& block : blocks) {
+    if (block.ext_ID == ext_ID) {
+      result.push_back(block);
+    }
+  }
+
+  // Greedily merge the pair of blocks that adds the fewest unwanted identifiers, until few enough remain
+  while (result.size() > max_count) {
+    size_t best_a = 0;
+    size_t best_b = 1;
+    int64_t best_cost = INT64_MAX;
+    for (size_t a = 0; a < result.size(); a++) {
+      for (size_t b = a + 1; b < result.size(); b++) {
+        const int64_t cost =
+            (int64_t)merge(result[a], result[b]).size() - (int64_t)result[a].size() - (int64_t)result[b].size();
+        if (cost < best_cost) {
+          best_cost = cost;
+          best_a = a;
+          best_b = b;
+        }
+      }
+    }
+
+    const CanIdMask merged = merge(result[best_a], result[best_b]);
+    result[best_a] = merged;
+    result.erase(result.begin() + best_b);
+
+    // The merged block may now cover some of the others
+    for (size_t i = 0; i < result.size();) {
+      if (i != best_a && covers(merged, result[i])) {
+        result.erase(result.begin() + i);
+        if (i < best_a) {
+          best_a--;
+        }
+      } else {
+        i++;
+      }
+    }
+  }
+
+  return result;
+}
+
+uint32_t CanIdSet::shared_mask(const std::vector<CanIdMask>& group) {
+  uint32_t mask = CAN_EXT_ID_MASK;
+  for (auto& block : group) {
+    mask &= block.mask;
+  }
+  return mask;
+}
@@ -0,0 +1,57 @@
+#ifndef _CAN_ID_SET_H
+#define _CAN_ID_SET_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#define CAN_STD_ID_MASK 0x7FFUL
+#define CAN_EXT_ID_MASK 0x1FFFFFFFUL
+
+// A block of CAN identifiers. An identifier belongs to the block if all bits set in mask match id.
+struct CanIdMask {
+  uint32_t id;
+  uint32_t mask;
+  bool ext_ID;
+
+  bool matches(uint32_t frame_id) const { return ((frame_id ^ id) & mask) == 0; }
+  // Amount of identifiers covered by this block
+  uint64_t size() const;
+};
+
+// The CAN identifiers a CanReceiver wants delivered, see CanReceiver::declare_can_ids().
+// Identifiers above 0x7FF are treated as extended, unless explicitly stated otherwise.
+class CanIdSet {
+ public:
+  // Accept every frame, standard and extended
+  void add_all() { all = true; }
+  void add_id(uint32_t id) { add_id(id, id > CAN_STD_ID_MASK); }
+  void add_id(uint32_t id, bool ext_ID);
+  // Inclusive range of identifiers, stored as a few aligned blocks
+  void add_range(uint32_t first, uint32_t last) { add_range(first, last, last > CAN_STD_ID_MASK); }
+  void add_range(uint32_t first, uint32_t last, bool ext_ID);
+  // Identifiers where all bits set in mask match id
+  void add_mask(uint32_t id, uint32_t mask, bool ext_ID);
+  // Union with another set
+  void add_set(const CanIdSet& other);
+
+  bool accepts_all() const { return all; }
+  bool empty() const { return !all && blocks.empty(); }
+  bool has_format(bool ext_ID) const;
+  bool contains(uint32_t id, bool ext_ID) const;
+  const std::vector<CanIdMask>& get_blocks() const { return blocks; }
+
+  // Returns at most max_count blocks of the given frame format that together cover every identifier of that
+  // format in this set (and possibly some more). Used to program hardware acceptance filters.
+  std::vector<CanIdMask> reduce(bool ext_ID, size_t max_count) const;
+
+  // Returns a single mask shared by all blocks in group, such that (block.id & mask) for each block covers
+  // every identifier in that block. Used by controllers where several filters share one mask register.
+  static uint32_t shared_mask(const std::vector<CanIdMask>& group);
+
+ private:
+  bool all = false;
+  std::vector<CanIdMask> blocks;
+};
+
+#endif
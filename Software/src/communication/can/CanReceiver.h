@@ -2,10 +2,22 @@
 #define _CANRECEIVER_H
 
 #include "../../devboard/utils/types.h"
+#include "CanIdSet.h"
+#include "CanSupervisor.h"
 
 class CanReceiver {
  public:
-  virtual void receive_can_frame(CAN_frame* rx_frame) = 0;
+  virtual void receive_can_frame(const CAN_frame& rx_frame) = 0;
+
+  // Declares which CAN IDs should be delivered to this receiver. With hardware filtering enabled, the declarations of
+  // all receivers on an interface also program the acceptance filters, so frames nobody wants are dropped before
+  // reaching the CPU. Receivers that don't override this get every frame on their interface.
+  virtual void declare_can_ids(CanIdSet& ids) { ids.add_all(); }
+
+  // Declares the CAN IDs this receiver expects periodically, see CanSupervisor. Receiving one of them renews the
+  // given still-alive counter, so the receiver needn't do that itself, and a critical one going missing for a few
+  // periods has the receiver reported missing. Receivers that don't override this renew their counter themselves.
+  virtual void declare_supervised_can_ids(CanSupervisionSet& /*ids*/) {}
 };
 
 #endif
@@ -0,0 +1,149 @@
+#include "CanReplay.h"
+#include <algorithm>
+
+void CanReplayLoader::begin(bool binary_log) {
+  records.clear();
+  binary = binary_log;
+  line_length = 0;
+  line_too_long = false;
+  loaded_frames = 0;
+  skipped = 0;
+}
+
+void CanReplayLoader::append(const uint8_t* data, size_t size) {
+  if (binary) {
+    // Kept as it is, the engine skips what does not start a record
+    records.insert(records.end(), data, data + size);
+    return;
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    const char c = data[i];
+    if (c == '\n') {
+      parse_line();
+    } else if (line_length < sizeof(line)) {
+      line[line_length++] = c;
+    } else {
+      line_too_long = true;
+    }
+  }
+}
+
+void CanReplayLoader::end() {
+  if (binary) {
+    for (size_t position = 0; position + CAN_LOG_BLOCK_SIZE <= records.size();) {
+      const size_t size = can_log_record_size(records.data() + position);
+      loaded_frames += size > 0 ? 1 : 0;
+      position += size > 0 ? size : CAN_LOG_BLOCK_SIZE;
+    }
+  } else if (line_length > 0) {
+    parse_line();
+  }
+  records.shrink_to_fit();
+}
+
+void CanReplayLoader::parse_line() {
+  uint8_t encoded[CAN_LOG_MAX_RECORD_SIZE];
+  const size_t size = line_too_long ? 0 : can_log_parse_text(line, line_length, encoded);
+  if (size > 0) {
+    records.insert(records.end(), encoded, encoded + size);
+    loaded_frames++;
+  } else if (line_length > 0 && !(line_length == 1 && line[0] == '\r')) {
+    skipped++;
+  }
+  line_length = 0;
+  line_too_long = false;
+}
+
+void CanReplayEngine::start(uint16_t speed, bool loop_log) {
+  speed_percent = speed == CAN_REPLAY_AS_FAST_AS_POSSIBLE
+                      ? speed
+                      : std::clamp<uint16_t>(speed, CAN_REPLAY_MIN_SPEED, CAN_REPLAY_MAX_SPEED);
+  loop = loop_log;
+  statistics = CanReplayStats();
+  active = next_frame();
+  if (active) {
+    anchor(clock_us());
+  }
+}
+
+uint64_t CanReplayEngine::poll() {
+  uint32_t sent = 0;
+  while (active) {
+    if (speed_percent == CAN_REPLAY_AS_FAST_AS_POSSIBLE) {
+      if (sent == CAN_REPLAY_BATCH) {
+        return clock_us();
+      }
+      if (!sender(frame, interface, direction)) {
+        statistics.retries++;
+        return clock_us() + CAN_REPLAY_RETRY_US;
+      }
+    } else {
+      const uint64_t now_us = clock_us();
+      if (due_us > now_us) {
+        return due_us;
+      }
+      if (!sender(frame, interface, direction)) {
+        statistics.retries++;
+        return now_us + CAN_REPLAY_RETRY_US;
+      }
+      const uint32_t error_us = (uint32_t)std::min<uint64_t>(now_us - due_us, UINT32_MAX);
+      statistics.timed_frames++;
+      statistics.error_total_us += error_us;
+      statistics.error_max_us = std::max(statistics.error_max_us, error_us);
+      statistics.late_frames += error_us > CAN_REPLAY_LATE_US ? 1 : 0;
+    }
+    sent++;
+    statistics.frames_sent++;
+
+    const uint64_t previous_due_us = due_us;
+    if (!next_frame()) {
+      if (!loop || !rewinder() || !next_frame()) {
+        active = false;
+        break;
+      }
+      // The log starts over right after its last frame
+      statistics.loops++;
+      anchor(previous_due_us);
+      continue;
+    }
+    if (timestamp_us < previous_timestamp_us) {
+      // Time went back, e.g. two logs put together. Go on from the previous frame
+      anchor(previous_due_us);
+    } else {
+      due_us = start_us + (timestamp_us - first_timestamp_us) * 100 / std::max<uint16_t>(speed_percent, 1);
+    }
+    previous_timestamp_us = timestamp_us;
+  }
+  return CAN_REPLAY_DONE;
+}
+
+void CanReplayEngine::anchor(uint64_t at_us) {
+  first_timestamp_us = timestamp_us;
+  previous_timestamp_us = timestamp_us;
+  start_us = at_us;
+  due_us = at_us;
+}
+
+bool CanReplayEngine::read_record() {
+  while (true) {
+    if (reader(record, CAN_LOG_BLOCK_SIZE) != CAN_LOG_BLOCK_SIZE) {
+      return false;
+    }
+    const size_t size = can_log_record_size(record);
+    if (size == 0) {
+      statistics.skipped_blocks++;
+      continue;
+    }
+    return size == CAN_LOG_BLOCK_SIZE ||
+           reader(record + CAN_LOG_BLOCK_SIZE, size - CAN_LOG_BLOCK_SIZE) == size - CAN_LOG_BLOCK_SIZE;
+  }
+}
+
+bool CanReplayEngine::next_frame() {
+  if (!read_record()) {
+    return false;
+  }
+  timestamp_us = can_log_decode(record, frame, interface, direction);
+  return true;
+}
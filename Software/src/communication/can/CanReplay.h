@@ -0,0 +1,127 @@
+#ifndef _CAN_REPLAY_H
+#define _CAN_REPLAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include <vector>
+#include "../../devboard/sdcard/can_log_record.h"
+
+// Replay speed in percent of the recorded pace, 10 ... 1000 (0.1x ... 10x)
+#define CAN_REPLAY_MIN_SPEED 10
+#define CAN_REPLAY_MAX_SPEED 1000
+// Speed that sends the frames as fast as the transmit queue takes them, ignoring the timestamps
+#define CAN_REPLAY_AS_FAST_AS_POSSIBLE 0
+// Frames sent at once when replaying as fast as possible, half the transmit queue so nothing is dropped
+#define CAN_REPLAY_BATCH 16
+// A frame sent more than this after its due time counts as late
+#define CAN_REPLAY_LATE_US 1000
+// A frame the sender did not take is offered again this much later
+#define CAN_REPLAY_RETRY_US 1000
+// Returned by CanReplayEngine::poll() once the replay is over
+#define CAN_REPLAY_DONE UINT64_MAX
+
+// Turns an uploaded log, piece by piece as it arrives, into binary CAN log records (can_log_record.h) for
+// CanReplayEngine. Takes the text lines of the CAN logs or the binary log of the SD card and the flight recorder.
+class CanReplayLoader {
+ public:
+  explicit CanReplayLoader(std::vector<uint8_t>& records) : records(records) {}
+
+  // Drops the frames loaded before
+  void begin(bool binary);
+  void append(const uint8_t* data, size_t size);
+  // Takes the last line also without a line end
+  void end();
+
+  uint32_t frames() const { return loaded_frames; }
+  // Text lines that were not a frame, e.g. comments
+  uint32_t skipped_lines() const { return skipped; }
+
+ private:
+  void parse_line();
+
+  std::vector<uint8_t>& records;
+  bool binary = false;
+  char line[CAN_LOG_MAX_LINE_LENGTH];
+  size_t line_length = 0;
+  bool line_too_long = false;
+  uint32_t loaded_frames = 0;
+  uint32_t skipped = 0;
+};
+
+struct CanReplayStats {
+  uint32_t frames_sent = 0;
+  uint32_t loops = 0;
+  // Blocks that did not start a record, e.g. after a torn write
+  uint32_t skipped_blocks = 0;
+  // How long after their due time the frames were sent. Not counted when replaying as fast as possible
+  uint32_t timed_frames = 0;
+  uint64_t error_total_us = 0;
+  uint32_t error_max_us = 0;
+  uint32_t late_frames = 0;
+  // Times the sender did not take a frame
+  uint32_t retries = 0;
+
+  uint32_t error_mean_us() const { return timed_frames > 0 ? error_total_us / timed_frames : 0; }
+};
+
+// Sends the frames of a binary CAN log with the timing they were recorded with, scaled by a speed factor. Each frame
+// gets a due time against clock_us, the caller waits for the time poll() returns (on the ESP32 with an esp_timer)
+// and polls again. The log is read once, piece by piece, so it can be streamed from the SD card as well as from
+// memory.
+class CanReplayEngine {
+ public:
+  // Reads up to size bytes of the log, returns the amount read, 0 at the end
+  typedef std::function<size_t(uint8_t* buffer, size_t size)> Reader;
+  // Starts the log over for looping, returns false if it cannot
+  typedef std::function<bool()> Rewinder;
+  // Sends a frame, with the interface and direction it was recorded with. Returns false if the frame could not be
+  // taken now, e.g. a full queue, it is then offered again after CAN_REPLAY_RETRY_US
+  typedef std::function<bool(const CAN_frame& frame, CAN_Interface interface, frameDirection direction)> Sender;
+
+  CanReplayEngine(Reader reader, Rewinder rewinder, Sender sender, uint64_t (*clock_us)())
+      : reader(reader), rewinder(rewinder), sender(sender), clock_us(clock_us) {}
+
+  // speed_percent is clamped to CAN_REPLAY_MIN_SPEED ... CAN_REPLAY_MAX_SPEED unless CAN_REPLAY_AS_FAST_AS_POSSIBLE
+  void start(uint16_t speed_percent, bool loop);
+  void stop() { active = false; }
+
+  // Sends the frames that are due, returns the due time of the next one or CAN_REPLAY_DONE. When replaying as fast
+  // as possible it sends CAN_REPLAY_BATCH frames and returns the current time, wait a little before polling again.
+  uint64_t poll();
+
+  bool running() const { return active; }
+  uint16_t speed() const { return speed_percent; }
+  const CanReplayStats& stats() const { return statistics; }
+
+ private:
+  bool read_record();
+  bool next_frame();
+  void anchor(uint64_t at_us);
+
+  Reader reader;
+  Rewinder rewinder;
+  Sender sender;
+  uint64_t (*clock_us)();
+
+  uint16_t speed_percent = 100;
+  bool loop = false;
+  bool active = false;
+
+  // The next frame to send
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  CAN_frame frame;
+  CAN_Interface interface = CAN_NATIVE;
+  frameDirection direction = MSG_RX;
+  uint64_t timestamp_us = 0;
+  uint64_t due_us = 0;
+
+  // The recorded time first_timestamp_us is sent at start_us, the following frames relative to it
+  uint64_t first_timestamp_us = 0;
+  uint64_t start_us = 0;
+  uint64_t previous_timestamp_us = 0;
+
+  CanReplayStats statistics;
+};
+
+#endif
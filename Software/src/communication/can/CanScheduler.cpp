@@ -0,0 +1,78 @@
+#include "CanScheduler.h"
+#include <algorithm>
+
+CanScheduler can_scheduler;
+
+uint16_t CanScheduler::add(const void* owner, uint16_t period_ms, uint8_t frames, Generator generator,
+                           int16_t phase_ms) {
+  if (period_ms == 0) {
+    period_ms = 1;
+  }
+
+  uint16_t phase;
+  if (phase_ms != AUTO_PHASE) {
+    phase = phase_ms % period_ms;
+  } else if (staggering) {
+    phase = least_loaded_phase(period_ms, frames);
+  } else {
+    phase = 0;
+  }
+
+  Job job = {owner, generator, phase, period_ms, phase, frames};
+  plan(job, 1);
+  jobs.push_back(job);
+  return phase;
+}
+
+void CanScheduler::remove(const void* owner) {
+  for (auto& job : jobs) {
+    if (job.owner == owner) {
+      plan(job, -1);
+    }
+  }
+  jobs.erase(std::remove_if(jobs.begin(), jobs.end(), [owner](const Job& job) { return job.owner == owner; }),
+             jobs.end());
+}
+
+void CanScheduler::run(unsigned long currentMillis) {
+  // By index, a generator may register further jobs
+  for (size_t i = 0; i < jobs.size(); i++) {
+    Job& job = jobs[i];
+    const int32_t late = (int32_t)(currentMillis - job.next_ms);
+    if (late < 0) {
+      continue;
+    }
+    // Periods missed while the core task was held up are skipped, the phase is kept
+    job.next_ms += ((uint32_t)late / job.period_ms + 1) * job.period_ms;
+    job.generator(currentMillis);
+  }
+}
+
+// Picks the phase whose busiest millisecond is the least loaded, preferring the least total load on a tie
+uint16_t CanScheduler::least_loaded_phase(uint16_t period_ms, uint8_t frames) const {
+  const uint16_t candidates = std::min(period_ms, CYCLE_MS);
+  uint16_t best_phase = 0;
+  uint32_t best_worst = UINT32_MAX;
+  uint32_t best_sum = UINT32_MAX;
+
+  for (uint16_t phase = 0; phase < candidates; phase++) {
+    uint32_t worst = 0;
+    uint32_t sum = 0;
+    for (uint16_t ms = phase; ms < CYCLE_MS; ms += period_ms) {
+      worst = std::max<uint32_t>(worst, load[ms] + frames);
+      sum += load[ms];
+    }
+    if (worst < best_worst || (worst == best_worst && sum < best_sum)) {
+      best_phase = phase;
+      best_worst = worst;
+      best_sum = sum;
+    }
+  }
+  return best_phase;
+}
+
+void CanScheduler::plan(const Job& job, int sign) {
+  for (uint32_t ms = job.phase_ms % CYCLE_MS; ms < CYCLE_MS; ms += job.period_ms) {
+    load[ms] += sign * job.frames;
+  }
+}
@@ -0,0 +1,84 @@
+#ifndef _CAN_SCHEDULER_H
+#define _CAN_SCHEDULER_H
+
+#include <stdint.h>
+#include <functional>
+#include <vector>
+
+// Sends the periodic CAN frames of all protocols. A protocol registers what it sends and how often, and the
+// scheduler gives every job its own phase within the period so that frames are spread over the milliseconds of a
+// cycle, instead of all 100 ms and 1 s groups of all protocols firing on the same core tick.
+class CanScheduler {
+ public:
+  // Window over which the load is balanced. Jobs with a longer period are counted once per cycle.
+  static constexpr uint16_t CYCLE_MS = 1000;
+  // Let the scheduler pick the least loaded phase
+  static constexpr int16_t AUTO_PHASE = -1;
+
+  // Prepares counters/checksums and sends the frames of one job
+  typedef std::function<void(unsigned long currentMillis)> Generator;
+
+  // Registers a job expected to send 'frames' frames every period_ms. Returns the phase it was given, so that
+  // jobs which must follow each other can be registered with a fixed offset to it.
+  uint16_t add(const void* owner, uint16_t period_ms, uint8_t frames, Generator generator,
+               int16_t phase_ms = AUTO_PHASE);
+  // Forgets all jobs of an owner
+  void remove(const void* owner);
+
+  // Runs the jobs that are due, called every core tick
+  void run(unsigned long currentMillis);
+
+  // Without staggering every automatic phase is 0, like the hand-rolled previousMillis timers
+  void set_staggering(bool enabled) { staggering = enabled; }
+  // Frames planned for each millisecond of the cycle
+  const uint16_t* planned_load() const { return load; }
+  size_t job_count() const { return jobs.size(); }
+
+ private:
+  struct Job {
+    const void* owner;
+    Generator generator;
+    unsigned long next_ms;
+    uint16_t period_ms;
+    uint16_t phase_ms;
+    uint8_t frames;
+  };
+
+  uint16_t least_loaded_phase(uint16_t period_ms, uint8_t frames) const;
+  void plan(const Job& job, int sign);
+
+  std::vector<Job> jobs;
+  uint16_t load[CYCLE_MS] = {0};
+  bool staggering = true;
+};
+
+// Distribution of the amount of frames sent per millisecond
+class CanLoadHistogram {
+ public:
+  // The last bucket also counts every millisecond with more frames
+  static const uint8_t BUCKETS = 16;
+
+  void record(uint16_t frames) {
+    ticks[frames < BUCKETS ? frames : BUCKETS - 1]++;
+    total_ticks++;
+    total_frames += frames;
+    if (frames > peak) {
+      peak = frames;
+    }
+  }
+
+  uint32_t ticks_with(uint8_t frames) const { return ticks[frames]; }
+  uint16_t peak_frames() const { return peak; }
+  uint32_t tick_count() const { return total_ticks; }
+  uint32_t frame_count() const { return total_frames; }
+
+ private:
+  uint32_t ticks[BUCKETS] = {0};
+  uint32_t total_ticks = 0;
+  uint32_t total_frames = 0;
+  uint16_t peak = 0;
+};
+
+extern CanScheduler can_scheduler;
+
+#endif
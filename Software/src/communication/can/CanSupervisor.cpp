@@ -0,0 +1,164 @@
+#include "CanSupervisor.h"
+#include <string.h>
+#include <algorithm>
+#include "CanReceiver.h"
+
+CanSupervisor can_supervisor;
+
+CanSupervisor::CanSupervisor() {
+  clear();
+}
+
+void CanSupervisor::clear() {
+  entries.clear();
+  groups.clear();
+  memset(slots, 0, sizeof(slots));
+}
+
+bool CanSupervisor::add_receiver(CanReceiver* receiver, CAN_Interface interface) {
+  CanSupervisionSet set;
+  receiver->declare_supervised_can_ids(set);
+  if (set.ids.empty()) {
+    return true;
+  }
+  return add(set, interface);
+}
+
+bool CanSupervisor::add(const CanSupervisionSet& set, CAN_Interface interface) {
+  if (groups.size() >= MAX_GROUPS) {
+    return false;
+  }
+  const uint8_t group = groups.size();
+  const uint32_t owner = 1UL << group;
+  groups.push_back({set.still_alive, 0});
+
+  bool all_added = true;
+  for (const auto& expected : set.ids) {
+    const bool critical = expected.critical && expected.period_ms > 0;
+    const int index = find_index(expected.id, expected.ext_ID, interface);
+    if (index >= 0) {
+      // Supervised for another receiver on this interface already, renew both
+      Entry& entry = entries[index];
+      entry.owners |= owner;
+      if (critical) {
+        entry.critical_owners |= owner;
+        entry.critical = true;
+      }
+      if (expected.period_ms > 0 && (entry.period_ms == 0 || expected.period_ms < entry.period_ms)) {
+        entry.period_ms = expected.period_ms;
+        entry.timeout_ms = timeout_for(expected.period_ms);
+      }
+      continue;
+    }
+    if (entries.size() >= MAX_ENTRIES) {
+      all_added = false;
+      continue;
+    }
+
+    Entry entry = {};
+    entry.id = expected.id;
+    entry.ext_ID = expected.ext_ID;
+    entry.interface = interface;
+    entry.period_ms = expected.period_ms;
+    entry.timeout_ms = timeout_for(expected.period_ms);
+    entry.critical = critical;
+    entry.owners = owner;
+    entry.critical_owners = critical ? owner : 0;
+    entries.push_back(entry);
+
+    uint8_t slot = hash(expected.id, expected.ext_ID, interface);
+    while (slots[slot] != 0) {
+      slot = (slot + 1) & (HASH_SLOTS - 1);
+    }
+    slots[slot] = entries.size();
+  }
+  return all_added;
+}
+
+void CanSupervisor::frame_received(const CAN_frame& frame, CAN_Interface interface, unsigned long now_ms) {
+  const int index = find_index(frame.ID, frame.ext_ID, interface);
+  if (index < 0) {
+    return;
+  }
+
+  Entry& entry = entries[index];
+  entry.last_seen_ms = now_ms;
+  entry.seen = true;
+  if (entry.missing) {
+    entry.missing = false;
+    count_critical_missing(entry, -1);
+  }
+  for (uint8_t i = 0; i < groups.size(); i++) {
+    if ((entry.owners & (1UL << i)) && groups[i].critical_missing == 0 && groups[i].still_alive != nullptr) {
+      *groups[i].still_alive = CAN_STILL_ALIVE;
+    }
+  }
+}
+
+void CanSupervisor::check(unsigned long now_ms) {
+  for (auto& entry : entries) {
+    if (entry.period_ms == 0 || !entry.seen || entry.missing) {
+      continue;
+    }
+    // Signed, a frame timestamped by the receive interrupt can be a little newer than now_ms
+    if ((int32_t)(now_ms - entry.last_seen_ms) > (int32_t)entry.timeout_ms) {
+      entry.missing = true;
+      entry.timeouts++;
+      count_critical_missing(entry, 1);
+    }
+  }
+
+  for (auto& group : groups) {
+    if (group.critical_missing > 0 && group.still_alive != nullptr) {
+      *group.still_alive = 0;
+    }
+  }
+}
+
+const CanSupervisor::Entry* CanSupervisor::find(uint32_t id, bool ext_ID, CAN_Interface interface) const {
+  const int index = find_index(id, ext_ID, interface);
+  return index < 0 ? nullptr : &entries[index];
+}
+
+bool CanSupervisor::fresh(uint32_t id, CAN_Interface interface, bool ext_ID) const {
+  const Entry* entry = find(id, ext_ID, interface);
+  return entry != nullptr && entry->seen && !entry->missing;
+}
+
+bool CanSupervisor::any_critical_missing() const {
+  for (const auto& group : groups) {
+    if (group.critical_missing > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t CanSupervisor::timeout_for(uint16_t period_ms) {
+  return std::max<uint32_t>((uint32_t)period_ms * MISSED_PERIODS, MIN_TIMEOUT_MS);
+}
+
+void CanSupervisor::count_critical_missing(const Entry& entry, int change) {
+  for (uint8_t i = 0; i < groups.size(); i++) {
+    if (entry.critical_owners & (1UL << i)) {
+      groups[i].critical_missing += change;
+    }
+  }
+}
+
+uint8_t CanSupervisor::hash(uint32_t id, bool ext_ID, CAN_Interface interface) {
+  const uint32_t key = id ^ (ext_ID ? 0x20000000UL : 0) ^ ((uint32_t)interface << 26);
+  return (key * 2654435761u) >> 25;
+}
+
+int CanSupervisor::find_index(uint32_t id, bool ext_ID, CAN_Interface interface) const {
+  uint8_t slot = hash(id, ext_ID, interface);
+  while (slots[slot] != 0) {
+    const Entry& entry = entries[slots[slot] - 1];
+    if (entry.id == id && entry.ext_ID == ext_ID && entry.interface == interface) {
+      return slots[slot] - 1;
+    }
+    slot = (slot + 1) & (HASH_SLOTS - 1);
+  }
+  return -1;
+}
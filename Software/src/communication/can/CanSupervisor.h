@@ -0,0 +1,107 @@
+#ifndef _CAN_SUPERVISOR_H
+#define _CAN_SUPERVISOR_H
+
+#include <stdint.h>
+#include <vector>
+#include "../../devboard/utils/types.h"
+
+class CanReceiver;
+
+// The periodic CAN IDs a receiver expects, see CanReceiver::declare_supervised_can_ids()
+class CanSupervisionSet {
+ public:
+  struct Expected {
+    uint32_t id;
+    bool ext_ID;
+    uint16_t period_ms;
+    bool critical;
+  };
+
+  // Still-alive counter renewed whenever one of the IDs arrives, and held at 0 while a critical one is missing
+  void renew(uint8_t* counter) { still_alive = counter; }
+  // Expects the ID every period_ms. A period of 0 only renews the still-alive counter, for IDs sent on request.
+  void expect(uint32_t id, uint16_t period_ms, bool critical = false, bool ext_ID = false) {
+    ids.push_back({id, ext_ID, period_ms, critical});
+  }
+
+  uint8_t* still_alive = nullptr;
+  std::vector<Expected> ids;
+};
+
+// Keeps track of when each supervised CAN ID was last received. The receive path looks the ID up in a small hash,
+// and a periodic check flags the IDs whose deadline passed. While a critical ID is missing the still-alive counter
+// of its receiver stays at 0, so the missing battery/inverter event is raised within a second, instead of after
+// the full CAN_STILL_ALIVE countdown.
+class CanSupervisor {
+ public:
+  // An ID is missing after this many periods without it
+  static constexpr uint8_t MISSED_PERIODS = 5;
+  // Lower bound of the timeout, covering the jitter of the core task
+  static constexpr uint16_t MIN_TIMEOUT_MS = 100;
+  static const uint8_t MAX_ENTRIES = 64;
+  // Receivers with supervised IDs, one bit each in Entry::owners
+  static const uint8_t MAX_GROUPS = 32;
+
+  struct Entry {
+    uint32_t id;
+    bool ext_ID;
+    CAN_Interface interface;
+    uint16_t period_ms;
+    uint32_t timeout_ms;
+    // Critical for at least one of its receivers
+    bool critical;
+    // Received at least once, IDs never seen are not reported missing
+    bool seen;
+    bool missing;
+    // Receivers that declared the ID, a bit per group, all renewed when it arrives. Those it is critical for are
+    // held at 0 while it is missing.
+    uint32_t owners;
+    uint32_t critical_owners;
+    unsigned long last_seen_ms;
+    // Times the ID went missing
+    uint16_t timeouts;
+  };
+
+  CanSupervisor();
+
+  // Adds the IDs the receiver declares. An ID several receivers on the interface declare renews all of them, with the
+  // shortest period declared. Returns false if they did not all fit.
+  bool add_receiver(CanReceiver* receiver, CAN_Interface interface);
+  bool add(const CanSupervisionSet& set, CAN_Interface interface);
+  void clear();
+
+  // Called for every received frame
+  void frame_received(const CAN_frame& frame, CAN_Interface interface, unsigned long now_ms);
+  // Flags the IDs whose deadline passed, called periodically
+  void check(unsigned long now_ms);
+
+  // Supervision state of an ID, nullptr if it isn't supervised
+  const Entry* find(uint32_t id, bool ext_ID, CAN_Interface interface) const;
+  // Received within its deadline
+  bool fresh(uint32_t id, CAN_Interface interface, bool ext_ID = false) const;
+  bool any_critical_missing() const;
+  const std::vector<Entry>& get_entries() const { return entries; }
+
+ private:
+  static const uint8_t HASH_SLOTS = 128;  // Power of two, twice MAX_ENTRIES
+
+  struct Group {
+    uint8_t* still_alive;
+    uint8_t critical_missing;
+  };
+
+  static uint8_t hash(uint32_t id, bool ext_ID, CAN_Interface interface);
+  static uint32_t timeout_for(uint16_t period_ms);
+  // Counts the ID going missing (1) or coming back (-1) for the receivers it is critical for
+  void count_critical_missing(const Entry& entry, int change);
+  int find_index(uint32_t id, bool ext_ID, CAN_Interface interface) const;
+
+  std::vector<Entry> entries;
+  std::vector<Group> groups;
+  // Entry index + 1, 0 for a free slot
+  uint8_t slots[HASH_SLOTS];
+};
+
+extern CanSupervisor can_supervisor;
+
+#endif
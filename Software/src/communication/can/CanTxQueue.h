@@ -0,0 +1,158 @@
+#ifndef _CAN_TX_QUEUE_H
+#define _CAN_TX_QUEUE_H
+
+#include <stdint.h>
+
+// Order in which queued frames are handed to the CAN controller
+enum class CanTxPriority : uint8_t {
+  // Frames carrying limits or contactor requests, sent before anything else
+  Safety = 0,
+  Normal = 1,
+  // Informational frames, evicted first when the queue is full
+  Low = 2,
+};
+
+struct CanTxQueueStats {
+  // Frames accepted by the controller
+  uint32_t sent = 0;
+  // Frames lost because the queue was full
+  uint32_t dropped = 0;
+  // Frames lost because the controller did not accept them within the maximum wait
+  uint32_t expired = 0;
+  // Times a frame was offered to the controller and refused
+  uint32_t retries = 0;
+  uint16_t peak_depth = 0;
+  // Time from enqueue until the controller accepted the frame, since the last reset_latency()
+  uint32_t latency_max_us = 0;
+  uint64_t latency_sum_us = 0;
+  uint32_t latency_count = 0;
+};
+
+// Software transmit queue of one CAN interface. Frames wait here until the controller accepts them, highest
+// priority first and in order of arrival within a priority. A frame the controller refuses stays at the head
+// and is offered again on the next drain, until it has waited longer than max_wait_us.
+template <typename Frame, uint8_t SIZE>
+class CanTxQueue {
+ public:
+  explicit CanTxQueue(uint32_t max_wait_us) : max_wait_us(max_wait_us) {
+    for (uint8_t i = 0; i < SIZE; i++) {
+      free_slots[i] = i;
+    }
+  }
+
+  // Returns false if a frame was lost to make room: either this one, or an older one of lower priority.
+  bool enqueue(const Frame& frame, CanTxPriority priority, uint64_t now_us) {
+    bool lost = false;
+    if (free_count == 0) {
+      if (!evict_lower_than(priority)) {
+        stats.dropped++;
+        return false;
+      }
+      lost = true;
+    }
+
+    const uint8_t slot = free_slots[--free_count];
+    entries[slot].frame = frame;
+    entries[slot].enqueued_us = now_us;
+    push_back((uint8_t)priority, slot);
+
+    const uint16_t current = depth();
+    if (current > stats.peak_depth) {
+      stats.peak_depth = current;
+    }
+    return !lost;
+  }
+
+  // Hands queued frames to send(frame) until it returns false, meaning the controller is full.
+  // Returns the amount of frames that expired while waiting.
+  template <typename Send>
+  uint8_t drain(uint64_t now_us, Send&& send) {
+    uint8_t expired = 0;
+    for (uint8_t priority = 0; priority < PRIORITIES; priority++) {
+      while (count[priority] > 0) {
+        const uint8_t slot = order[priority][head[priority]];
+        Entry& entry = entries[slot];
+        const uint64_t waited_us = now_us - entry.enqueued_us;
+
+        if (send(entry.frame)) {
+          stats.sent++;
+          stats.latency_sum_us += waited_us;
+          stats.latency_count++;
+          if (waited_us > stats.latency_max_us) {
+            stats.latency_max_us = (uint32_t)waited_us;
+          }
+          release(pop_front(priority));
+          continue;
+        }
+
+        stats.retries++;
+        if (waited_us > max_wait_us) {
+          stats.expired++;
+          expired++;
+          release(pop_front(priority));
+        }
+        return expired;
+      }
+    }
+    return expired;
+  }
+
+  uint16_t depth() const { return SIZE - free_count; }
+  static constexpr uint8_t capacity() { return SIZE; }
+
+  const CanTxQueueStats& get_stats() const { return stats; }
+  uint32_t latency_avg_us() const {
+    return stats.latency_count == 0 ? 0 : (uint32_t)(stats.latency_sum_us / stats.latency_count);
+  }
+  void reset_latency() {
+    stats.latency_max_us = 0;
+    stats.latency_sum_us = 0;
+    stats.latency_count = 0;
+  }
+
+ private:
+  static const uint8_t PRIORITIES = 3;
+
+  struct Entry {
+    Frame frame;
+    uint64_t enqueued_us;
+  };
+
+  void push_back(uint8_t priority, uint8_t slot) {
+    order[priority][(head[priority] + count[priority]) % SIZE] = slot;
+    count[priority]++;
+  }
+
+  uint8_t pop_front(uint8_t priority) {
+    const uint8_t slot = order[priority][head[priority]];
+    head[priority] = (head[priority] + 1) % SIZE;
+    count[priority]--;
+    return slot;
+  }
+
+  void release(uint8_t slot) { free_slots[free_count++] = slot; }
+
+  // Drops the oldest frame of the lowest priority below the given one
+  bool evict_lower_than(CanTxPriority priority) {
+    for (uint8_t lower = PRIORITIES - 1; lower > (uint8_t)priority; lower--) {
+      if (count[lower] > 0) {
+        release(pop_front(lower));
+        stats.dropped++;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const uint32_t max_wait_us;
+  Entry entries[SIZE];
+  // Per priority ring of slot indexes into entries
+  uint8_t order[PRIORITIES][SIZE];
+  uint8_t head[PRIORITIES] = {0};
+  uint8_t count[PRIORITIES] = {0};
+  uint8_t free_slots[SIZE];
+  uint8_t free_count = SIZE;
+  CanTxQueueStats stats;
+};
+
+#endif
@@ -0,0 +1,250 @@
+#include "CanUsbProtocol.h"
+#include <string.h>
+#include "CanIdSet.h"
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+// GVRET message types, as numbered by GVRET and ESP32RET
+enum GvretCommand : uint8_t {
+  GVRET_BUILD_CAN_FRAME = 0,
+  GVRET_TIME_SYNC = 1,
+  GVRET_DIG_INPUTS = 2,
+  GVRET_ANA_INPUTS = 3,
+  GVRET_SET_DIG_OUT = 4,
+  GVRET_SETUP_CANBUS = 5,
+  GVRET_GET_CANBUS_PARAMS = 6,
+  GVRET_GET_DEV_INFO = 7,
+  GVRET_SET_SW_MODE = 8,
+  GVRET_KEEPALIVE = 9,
+  GVRET_SET_SYSTYPE = 10,
+  GVRET_ECHO_CAN_FRAME = 11,
+  GVRET_GET_NUMBUSES = 12,
+  GVRET_GET_EXT_BUSES = 13,
+  GVRET_SET_EXT_BUSES = 14,
+  GVRET_BUILD_FD_FRAME = 20,
+};
+
+#define GVRET_START 0xF1
+#define GVRET_BINARY_MODE 0xE7
+// Reported to the host, GVRET has no way to ask the device for the real bus speed
+#define GVRET_BUS_SPEED 500000
+
+static inline uint8_t* put_u32(uint8_t* out, uint32_t value) {
+  out[0] = value;
+  out[1] = value >> 8;
+  out[2] = value >> 16;
+  out[3] = value >> 24;
+  return out + 4;
+}
+
+size_t gvret_encode_frame(const CAN_frame& frame, uint8_t bus, uint32_t timestamp_us, uint8_t* out) {
+  const uint8_t length = frame.DLC > 64 ? 64 : frame.DLC;
+  uint8_t* p = out;
+  *p++ = GVRET_START;
+  *p++ = frame.FD ? GVRET_BUILD_FD_FRAME : GVRET_BUILD_CAN_FRAME;
+  p = put_u32(p, timestamp_us);
+  p = put_u32(p, (frame.ID & CAN_EXT_ID_MASK) | (frame.ext_ID ? 0x80000000UL : 0));
+  if (frame.FD) {
+    *p++ = length;
+    *p++ = bus;
+  } else {
+    *p++ = (length > 8 ? 8 : length) | (bus << 4);
+  }
+  const uint8_t count = frame.FD ? length : (length > 8 ? 8 : length);
+  memcpy(p, frame.data.u8, count);
+  p += count;
+  *p++ = 0;  // Checksum, not checked by the hosts
+  return p - out;
+}
+
+// Data length of the SLCAN DLC codes 0 ... F
+static const uint8_t slcan_lengths[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+size_t slcan_encode_frame(const CAN_frame& frame, int32_t timestamp_ms, uint8_t* out) {
+  uint8_t* p = out;
+  if (frame.FD) {
+    *p++ = frame.ext_ID ? 'D' : 'd';
+  } else {
+    *p++ = frame.ext_ID ? 'T' : 't';
+  }
+
+  const uint32_t id = frame.ID & (frame.ext_ID ? CAN_EXT_ID_MASK : CAN_STD_ID_MASK);
+  for (int shift = frame.ext_ID ? 28 : 8; shift >= 0; shift -= 4) {
+    *p++ = hex_digits[(id >> shift) & 0x0F];
+  }
+
+  // CAN-FD lengths between the DLC steps are padded with zeros up to the next step
+  uint8_t code = 0;
+  const uint8_t max_code = frame.FD ? 15 : 8;
+  while (code < max_code && slcan_lengths[code] < frame.DLC) {
+    code++;
+  }
+  *p++ = hex_digits[code];
+  for (uint8_t i = 0; i < slcan_lengths[code]; i++) {
+    const uint8_t byte = i < frame.DLC ? frame.data.u8[i] : 0;
+    *p++ = hex_digits[byte >> 4];
+    *p++ = hex_digits[byte & 0x0F];
+  }
+
+  if (timestamp_ms >= 0 && timestamp_ms < 60000) {
+    for (int shift = 12; shift >= 0; shift -= 4) {
+      *p++ = hex_digits[(timestamp_ms >> shift) & 0x0F];
+    }
+  }
+  *p++ = '\r';
+  return p - out;
+}
+
+void GvretSession::receive(uint8_t byte, const CanUsbReply& reply) {
+  switch (state) {
+    case IDLE:
+      if (byte == GVRET_START) {
+        state = COMMAND;
+      } else if (byte == GVRET_BINARY_MODE) {
+        binary = true;
+      }
+      break;
+
+    case COMMAND: {
+      state = IDLE;
+      uint8_t answer[17] = {GVRET_START, byte};
+      switch (byte) {
+        case GVRET_BUILD_CAN_FRAME:
+        case GVRET_ECHO_CAN_FRAME:
+          state = SKIP_FRAME;
+          frame_position = 0;
+          break;
+        case GVRET_TIME_SYNC:
+          put_u32(answer + 2, clock_us());
+          reply(answer, 6);
+          break;
+        case GVRET_DIG_INPUTS:
+          reply(answer, 4);
+          break;
+        case GVRET_ANA_INPUTS:
+          reply(answer, 17);
+          break;
+        case GVRET_SET_DIG_OUT:
+        case GVRET_SET_SW_MODE:
+        case GVRET_SET_SYSTYPE:
+          state = SKIP;
+          skip = 1;
+          break;
+        case GVRET_SETUP_CANBUS:
+          state = SKIP;
+          skip = 8;
+          break;
+        case GVRET_SET_EXT_BUSES:
+          state = SKIP;
+          skip = 12;
+          break;
+        case GVRET_GET_CANBUS_PARAMS:
+          // Two buses, enabled and listen only
+          answer[2] = 0x11;
+          put_u32(answer + 3, GVRET_BUS_SPEED);
+          answer[7] = buses > 1 ? 0x11 : 0;
+          put_u32(answer + 8, GVRET_BUS_SPEED);
+          reply(answer, 12);
+          break;
+        case GVRET_GET_DEV_INFO:
+          answer[2] = 1;  // Build number
+          answer[4] = 0x20;  // EEPROM version
+          reply(answer, 8);
+          break;
+        case GVRET_KEEPALIVE:
+          answer[2] = 0xDE;
+          answer[3] = 0xAD;
+          reply(answer, 4);
+          break;
+        case GVRET_GET_NUMBUSES:
+          answer[2] = buses;
+          reply(answer, 3);
+          break;
+        case GVRET_GET_EXT_BUSES:
+          reply(answer, 17);
+          break;
+        default:
+          break;
+      }
+      break;
+    }
+
+    case SKIP:
+      if (--skip == 0) {
+        state = IDLE;
+      }
+      break;
+
+    case SKIP_FRAME:
+      // ID, bus, length, then the data and a checksum
+      if (frame_position++ == 5) {
+        const uint8_t length = byte & 0x0F;
+        state = SKIP;
+        skip = (length > 8 ? 8 : length) + 1;
+      }
+      break;
+  }
+}
+
+void SlcanSession::receive(uint8_t byte, const CanUsbReply& reply) {
+  if (byte == '\r') {
+    execute(reply);
+    length = 0;
+  } else if (byte != '\n' && length < sizeof(command)) {
+    command[length++] = byte;
+  }
+}
+
+void SlcanSession::execute(const CanUsbReply& reply) {
+  static const uint8_t ok[] = {'\r'};
+  static const uint8_t error[] = {7};
+
+  if (length == 0) {
+    reply(ok, sizeof(ok));
+    return;
+  }
+  if (length == sizeof(command)) {
+    reply(error, sizeof(error));
+    return;
+  }
+
+  switch (command[0]) {
+    case 'O':
+    case 'L':
+      open = true;
+      reply(ok, sizeof(ok));
+      break;
+    case 'C':
+      open = false;
+      reply(ok, sizeof(ok));
+      break;
+    case 'Z':
+      with_timestamps = length > 1 && command[1] == '1';
+      reply(ok, sizeof(ok));
+      break;
+    case 'S':
+    case 's':
+    case 'Y':
+    case 'M':
+    case 'm':
+      // Bit rates and filters belong to the emulator's own CAN setup
+      reply(ok, sizeof(ok));
+      break;
+    case 'V':
+      reply((const uint8_t*)"V1013\r", 6);
+      break;
+    case 'v':
+      reply((const uint8_t*)"v1013\r", 6);
+      break;
+    case 'N':
+      reply((const uint8_t*)"NBE01\r", 6);
+      break;
+    case 'F':
+      reply((const uint8_t*)"F00\r", 4);
+      break;
+    default:
+      // Including t/T/r/R/d/D/b/B, the emulator does not send frames for the host
+      reply(error, sizeof(error));
+      break;
+  }
+}
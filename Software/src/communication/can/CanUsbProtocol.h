@@ -0,0 +1,76 @@
+#ifndef _CAN_USB_PROTOCOL_H
+#define _CAN_USB_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include "../../devboard/utils/types.h"
+
+// How CAN frames are sent over the USB serial port
+enum class CanUsbMode : uint8_t {
+  // candump style text lines, see CanFrameText.h
+  Text = 0,
+  // GVRET binary protocol, as spoken by SavvyCAN's "GVRET" serial connection
+  Gvret = 1,
+  // Lawicel SLCAN text protocol, as used by slcand and SavvyCAN's "LAWICEL" serial connection
+  Slcan = 2,
+};
+
+// Longest encoded frame of any mode
+#define CAN_USB_MAX_FRAME_LENGTH 240
+
+// Encodes a frame as a GVRET frame message: 0xF1 0x00, timestamp, ID (bit 31 for extended IDs), length | bus << 4,
+// data and a checksum byte. CAN-FD frames use the FD frame message. Returns the message length.
+size_t gvret_encode_frame(const CAN_frame& frame, uint8_t bus, uint32_t timestamp_us, uint8_t* out);
+
+// Encodes a frame as an SLCAN line: t/T (classic) or d/D (CAN-FD), ID, DLC code, data and, if timestamp_ms is
+// 0 ... 59999, a timestamp. Returns the line length.
+size_t slcan_encode_frame(const CAN_frame& frame, int32_t timestamp_ms, uint8_t* out);
+
+// Answers for the commands a host sends to the device
+typedef std::function<void(const uint8_t* data, size_t size)> CanUsbReply;
+
+// Commands of a GVRET host. The device is a listen-only logger: frames the host wants to send are ignored.
+class GvretSession {
+ public:
+  // buses is the amount reported to the host, clock_us gives the time for time sync requests
+  GvretSession(uint8_t buses, uint32_t (*clock_us)()) : buses(buses), clock_us(clock_us) {}
+
+  // Handles one byte received from the host
+  void receive(uint8_t byte, const CanUsbReply& reply);
+
+  // True once the host switched to binary mode, frames are only sent from then on
+  bool streaming() const { return binary; }
+
+ private:
+  enum State : uint8_t { IDLE, COMMAND, SKIP, SKIP_FRAME };
+
+  uint8_t buses;
+  uint32_t (*clock_us)();
+  bool binary = false;
+  State state = IDLE;
+  // Bytes of the current command still to be skipped
+  uint16_t skip = 0;
+  uint8_t frame_position = 0;
+};
+
+// Commands of an SLCAN host, one per line ending in a carriage return. Sending frames is refused.
+class SlcanSession {
+ public:
+  void receive(uint8_t byte, const CanUsbReply& reply);
+
+  // True while the channel is open, frames are only sent then
+  bool streaming() const { return open; }
+  // True if the host asked for timestamps
+  bool timestamps() const { return with_timestamps; }
+
+ private:
+  void execute(const CanUsbReply& reply);
+
+  bool open = false;
+  bool with_timestamps = false;
+  char command[32];
+  uint8_t length = 0;
+};
+
+#endif
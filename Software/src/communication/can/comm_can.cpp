@@ -2,16 +2,27 @@
 #include "../../lib/pierremolinaro-ACAN2517FD/ACAN2517FD.h"
 #include "../../lib/pierremolinaro-acan-esp32/ACAN_ESP32.h"
 #include "../../lib/pierremolinaro-acan2515/ACAN2515.h"
+#include "CanBusStats.h"
+#include "CanDispatchTable.h"
+#include "CanFlightRecorder.h"
 #include "CanReceiver.h"
+#include "CanSupervisor.h"
 #include "comm_can.h"
 #include "src/datalayer/datalayer.h"
 #include "src/devboard/safety/safety.h"
 #include "src/devboard/sdcard/sdcard.h"
+#include "src/devboard/utils/events.h"
 #include "src/devboard/utils/logging.h"
+#include "src/devboard/utils/log_ring.h"
+#include "src/devboard/utils/spsc_ring.h"
+#include "src/communication/usb/comm_usb.h"
 
 #include <esp_private/periph_ctrl.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 
 // The spare ESP32 SPI buses are called HSPI and VSPI, whereas on a ESP32S3
@@ -38,18 +49,37 @@ struct CanReceiverRegistration {
 
 static std::multimap<CAN_Interface, CanReceiverRegistration> can_receivers;
 
-volatile bool send_ok_native = 0;
-volatile bool send_ok_2515 = 0;
-volatile bool send_ok_2518 = 0;
-
-void map_can_frame_to_variable(CAN_frame* rx_frame, CAN_Interface interface);
+// Per-interface routing of received frames, built from the receiver declarations once all are registered
+static CanDispatchTable* can_dispatch_tables[NO_CAN_INTERFACE] = {nullptr};
+
+// Transmit queues. The native and MCP2515 controllers only send classic frames, so their queues store them compactly.
+// The MCP2518FD serves both CAN-FD interfaces with one queue.
+typedef CanTxQueue<CAN_classic_frame, CAN_TX_QUEUE_SIZE> CanClassicTxQueue;
+typedef CanTxQueue<CAN_frame, CAN_TX_QUEUE_SIZE> CanFdTxQueue;
+static CanClassicTxQueue* can_native_tx_queue = nullptr;
+static CanClassicTxQueue* can_addon_tx_queue = nullptr;
+static CanFdTxQueue* canfd_tx_queue = nullptr;
+// Frames are queued from several tasks (core, webserver replay)
+static SemaphoreHandle_t can_tx_mutex = nullptr;
+
+void map_can_frame_to_variable(const CAN_frame& rx_frame, CAN_Interface interface);
+
+// The boards have no CAN-FD controller of their own, the MCP2518FD add-on serves CANFD_NATIVE as well. Receivers
+// on either interface are registered on CANFD_ADDON_MCP2518, so each frame from the chip is dispatched once.
+static CAN_Interface receiving_can_interface(CAN_Interface interface) {
+  return interface == CANFD_NATIVE ? CANFD_ADDON_MCP2518 : interface;
+}
 
 void register_can_receiver(CanReceiver* receiver, CAN_Interface interface, CAN_Speed speed) {
-  can_receivers.insert({interface, {receiver, speed}});
+  can_receivers.insert({receiving_can_interface(interface), {receiver, speed}});
   DEBUG_PRINTF("CAN receiver registered, total: %d\n", can_receivers.size());
 }
 
 uint32_t init_native_can(CAN_Speed speed, gpio_num_t tx_pin, gpio_num_t rx_pin);
+static void start_can_rx_task();
+static void start_can_tx_queues();
+static void set_can_rx_paused(bool paused);
+static void start_can_bus_statistics();
 
 ACAN_ESP32_Settings* settingsespcan = nullptr;
 
@@ -60,20 +90,233 @@ uint8_t user_selected_can_addon_crystal_frequency_mhz = 0;
 ACAN2515* can2515;
 ACAN2515Settings* settings2515;
 
-static ACAN2515_Buffer16 gBuffer;
-
 static ACAN2517FDSettings::Oscillator quartz_fd_frequency;
 SPIClass SPI2517(SPI2517_BUS);
 uint8_t user_selected_canfd_addon_crystal_frequency_mhz = 0;
 ACAN2517FD* canfd;
 ACAN2517FDSettings* settings2517;
 bool use_canfd_as_can = false;
+// Program the acceptance filters from the receiver declarations, off by default so all traffic reaches the logs
+bool use_can_hw_filters = false;
 bool native_can_initialized = false;
 //CAN logging filter settings
 uint16_t user_selected_CAN_ID_cutoff_filter = 0;  //Messages below this ID will not be logged in webserver
+//CAN receive budget settings, frames drained per interface each core task tick
+uint16_t user_selected_can_native_rx_budget = CAN_RX_BUDGET_PER_TICK;
+uint16_t user_selected_can_addon_rx_budget = CAN_RX_BUDGET_PER_TICK;
+uint16_t user_selected_canfd_addon_rx_budget = CAN_RX_BUDGET_PER_TICK;
+uint16_t user_selected_can_addon_rx_buffer_size = CAN_ADDON_RX_BUFFER_SIZE;
+//CAN flight recorder settings
+uint16_t user_selected_can_flight_kb = CAN_FLIGHT_DEFAULT_KB;
+uint16_t user_selected_can_flight_pre_s = CAN_FLIGHT_DEFAULT_PRE_S;
+uint16_t user_selected_can_flight_post_s = CAN_FLIGHT_DEFAULT_POST_S;
+CanFlightTrigger user_selected_can_flight_trigger = CanFlightTrigger::Listed;
+
+// Frames are sent from several tasks, the flight recorder takes them one at a time
+static portMUX_TYPE can_flight_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Frames received per interface, cleared each time the statistics are sampled
+static uint32_t can_rx_frames_since_sample[NO_CAN_INTERFACE] = {0};
+static unsigned long can_rx_last_sample_millis = 0;
+
+// Bus traffic per interface. Received frames are counted by the core task, sent frames under can_tx_mutex.
+static CanBusStats* can_bus_rx_counters[NO_CAN_INTERFACE] = {nullptr};
+static CanBusStats* can_bus_tx_counters[NO_CAN_INTERFACE] = {nullptr};
+static unsigned long can_bus_last_sample_millis = 0;
+
+// A received frame waiting for the core task
+struct CanRxEntry {
+  CAN_frame frame;
+  CAN_Interface interface;
+};
+
+// Filled by the CAN ingestion task, drained by the core task
+static SpscRing<CanRxEntry, CAN_RX_RING_SIZE>* can_rx_ring = nullptr;
+static TaskHandle_t can_rx_task_handle = nullptr;
+// Held by the ingestion task while it talks to the drivers, and while the drivers are (re)started
+static SemaphoreHandle_t can_rx_mutex = nullptr;
+static bool can_rx_paused = false;
+// Wake up the ingestion task at least this often, in case a driver notification was missed
+static const TickType_t CAN_RX_IDLE_WAKEUP = pdMS_TO_TICKS(10);
+
+// Filled by inject_can_frame(), drained by the core task along with the received frames. Made on first use.
+static std::atomic<SpscRing<CanRxEntry, CAN_LOOPBACK_RING_SIZE>*> can_loopback_ring{nullptr};
+
+// Ensure a budget of 0 (e.g. unset or bad setting) still lets at least one frame through per tick
+static inline uint16_t effective_rx_budget(uint16_t budget) {
+  return budget == 0 ? 1 : budget;
+}
+
+static inline uint16_t rx_budget(CAN_Interface interface) {
+  switch (interface) {
+    case CAN_NATIVE:
+      return effective_rx_budget(user_selected_can_native_rx_budget);
+    case CAN_ADDON_MCP2515:
+      return effective_rx_budget(user_selected_can_addon_rx_budget);
+    default:
+      return effective_rx_budget(user_selected_canfd_addon_rx_budget);
+  }
+}
+
+static inline void account_rx_tick(CAN_Interface interface, uint16_t frames) {
+  can_rx_frames_since_sample[interface] += frames;
+  auto& stats = datalayer.system.status.can_rx_stats[interface];
+  if (frames > stats.max_frames_per_tick) {
+    stats.max_frames_per_tick = frames;
+  }
+}
+
+static void build_can_dispatch_tables() {
+  for (auto& registration : can_receivers) {
+    auto& table = can_dispatch_tables[registration.first];
+    if (table == nullptr) {
+      table = new CanDispatchTable();
+    }
+    if (!table->add_receiver(registration.second.receiver)) {
+      logging.println("Too many CAN receivers on one interface, frames will not reach all of them!");
+    }
+    if (!can_supervisor.add_receiver(registration.second.receiver, registration.first)) {
+      logging.println("Too many supervised CAN IDs, some will not be supervised!");
+    }
+  }
+}
+
+// Union of the IDs wanted by the receivers on the given interfaces. Everything unless hardware filtering is enabled,
+// and also then while the SD or USB CAN log or the flight recorder want to see the whole bus.
+static CanIdSet accepted_can_ids(std::initializer_list<CAN_Interface> interfaces) {
+  CanIdSet ids;
+  const bool whole_bus = !use_can_hw_filters || datalayer.system.info.CAN_SD_logging_active ||
+                         datalayer.system.info.CAN_usb_logging_active || user_selected_can_flight_kb > 0;
+  for (auto interface : interfaces) {
+    if (!whole_bus && can_dispatch_tables[interface] != nullptr) {
+      ids.add_set(can_dispatch_tables[interface]->accepted_ids());
+    }
+  }
+  if (ids.empty()) {
+    ids.add_all();
+  }
+  return ids;
+}
+
+// The TWAI controller has one acceptance filter: a single mask for one frame format,
+// or two masks for standard frames.
+static ACAN_ESP32_Filter native_can_filter() {
+  const CanIdSet ids = accepted_can_ids({CAN_NATIVE});
+  const bool standard = ids.has_format(false);
+  const bool extended = ids.has_format(true);
+
+  if (ids.accepts_all() || (standard && extended)) {
+    return ACAN_ESP32_Filter::acceptAll();
+  }
+
+  if (extended) {
+    auto blocks = ids.reduce(true, 1);
+    return ACAN_ESP32_Filter::singleExtendedFilter(ACAN_ESP32_Filter::dataAndRemote, blocks[0].id,
+                                                   ~blocks[0].mask & CAN_EXT_ID_MASK);
+  }
+
+  auto blocks = ids.reduce(false, 2);
+  if (blocks.size() == 1) {
+    return ACAN_ESP32_Filter::singleStandardFilter(ACAN_ESP32_Filter::dataAndRemote, blocks[0].id,
+                                                   ~blocks[0].mask & CAN_STD_ID_MASK);
+  }
+  return ACAN_ESP32_Filter::dualStandardFilter(ACAN_ESP32_Filter::dataAndRemote, blocks[0].id,
+                                               ~blocks[0].mask & CAN_STD_ID_MASK, ACAN_ESP32_Filter::dataAndRemote,
+                                               blocks[1].id, ~blocks[1].mask & CAN_STD_ID_MASK);
+}
+
+// Amount of IDs let through by a group of filters sharing one mask register
+static uint64_t shared_mask_coverage(const std::vector<CanIdMask>& group) {
+  const uint32_t mask = CanIdSet::shared_mask(group);
+  std::vector<uint32_t> values;
+  for (auto& block : group) {
+    if (std::find(values.begin(), values.end(), block.id & mask) == values.end()) {
+      values.push_back(block.id & mask);
+    }
+  }
+  return values.size() * CanIdMask{0, mask, group[0].ext_ID}.size();
+}
+
+// Split up to 6 filters of one frame format over RXB0 (mask 0, 2 filters) and RXB1 (mask 1, 4 filters),
+// picking the split that lets the fewest unwanted IDs through the shared masks.
+static void split_mcp2515_filters(const std::vector<CanIdMask>& blocks, std::vector<CanIdMask>& rxb0,
+                                  std::vector<CanIdMask>& rxb1) {
+  if (blocks.size() == 1) {
+    rxb0 = blocks;
+    rxb1 = blocks;
+    return;
+  }
+
+  uint64_t best_coverage = UINT64_MAX;
+  for (uint8_t selection = 1; selection < (1 << blocks.size()) - 1; selection++) {
+    std::vector<CanIdMask> group0, group1;
+    for (uint8_t i = 0; i < blocks.size(); i++) {
+      (selection & (1 << i) ? group0 : group1).push_back(blocks[i]);
+    }
+    if (group0.size() > 2 || group1.size() > 4) {
+      continue;
+    }
+    const uint64_t coverage = shared_mask_coverage(group0) + shared_mask_coverage(group1);
+    if (coverage < best_coverage) {
+      best_coverage = coverage;
+      rxb0 = group0;
+      rxb1 = group1;
+    }
+  }
+}
+
+static ACAN2515Mask mcp2515_mask(const std::vector<CanIdMask>& group) {
+  const uint32_t mask = CanIdSet::shared_mask(group);
+  return group[0].ext_ID ? extended2515Mask(mask) : standard2515Mask(mask, 0, 0);
+}
+
+static ACAN2515Mask mcp2515_filter(const std::vector<CanIdMask>& group, uint8_t index) {
+  const uint32_t mask = CanIdSet::shared_mask(group);
+  const CanIdMask& block = group[std::min<size_t>(index, group.size() - 1)];
+  return block.ext_ID ? extended2515Filter(block.id & mask) : standard2515Filter(block.id & mask, 0, 0);
+}
+
+// (Re)start the MCP2515 with its masks and filters programmed from the receiver declarations
+static uint16_t begin_can_addon() {
+  const CanIdSet ids = accepted_can_ids({CAN_ADDON_MCP2515});
+  if (ids.accepts_all()) {
+    return can2515->begin(*settings2515, [] { can2515->isr(); });
+  }
+
+  std::vector<CanIdMask> rxb0, rxb1;
+  if (ids.has_format(false) && ids.has_format(true)) {
+    rxb0 = ids.reduce(true, 2);
+    rxb1 = ids.reduce(false, 4);
+  } else {
+    split_mcp2515_filters(ids.reduce(ids.has_format(true), 6), rxb0, rxb1);
+  }
+
+  const ACAN2515AcceptanceFilter filters[] = {
+      {mcp2515_filter(rxb0, 0), nullptr}, {mcp2515_filter(rxb0, 1), nullptr}, {mcp2515_filter(rxb1, 0), nullptr},
+      {mcp2515_filter(rxb1, 1), nullptr}, {mcp2515_filter(rxb1, 2), nullptr}, {mcp2515_filter(rxb1, 3), nullptr}};
+  return can2515->begin(*settings2515, [] { can2515->isr(); }, mcp2515_mask(rxb0), mcp2515_mask(rxb1), filters, 6);
+}
+
+// (Re)start the MCP2518FD with up to 16 filter objects per frame format programmed from the receiver declarations
+static uint32_t begin_canfd_addon() {
+  const CanIdSet ids = accepted_can_ids({CANFD_ADDON_MCP2518});
+  if (ids.accepts_all()) {
+    return canfd->begin(*settings2517, [] { canfd->isr(); });
+  }
+
+  ACAN2517FDFilters filters;
+  for (bool extended : {false, true}) {
+    for (auto& block : ids.reduce(extended, 16)) {
+      filters.appendFilter(extended ? kExtended : kStandard, block.mask, block.id, nullptr);
+    }
+  }
+  return canfd->begin(*settings2517, [] { canfd->isr(); }, filters);
+}
 
 bool init_CAN() {
 
+  build_can_dispatch_tables();
+
   if (user_selected_can_addon_crystal_frequency_mhz > 0) {
     QUARTZ_FREQUENCY = user_selected_can_addon_crystal_frequency_mhz * 1000000UL;
   } else {
@@ -109,6 +352,7 @@ bool init_CAN() {
     const uint32_t errorCode = init_native_can(nativeIt->second.speed, tx_pin, rx_pin);
     if (errorCode == 0) {
       native_can_initialized = true;
+      datalayer.system.status.can_rx_stats[CAN_NATIVE].active = true;
       logging.println("Native Can ok");
       logging.print("Bit Rate prescaler: ");
       logging.println(settingsespcan->mBitRatePrescaler);
@@ -149,7 +393,6 @@ bool init_CAN() {
     }
 
     logging.println("Dual CAN Bus (ESP32+MCP2515) selected");
-    gBuffer.initWithSize(25);
 
     if (rst_pin != GPIO_NUM_NC) {
       pinMode(rst_pin, OUTPUT);
@@ -170,8 +413,10 @@ bool init_CAN() {
 
     settings2515 = new ACAN2515Settings(QUARTZ_FREQUENCY, bitRate);
     settings2515->mRequestedMode = ACAN2515Settings::NormalMode;
-    const uint16_t errorCode2515 = can2515->begin(*settings2515, [] { can2515->isr(); });
+    settings2515->mReceiveBufferSize = user_selected_can_addon_rx_buffer_size;
+    const uint16_t errorCode2515 = begin_can_addon();
     if (errorCode2515 == 0) {
+      datalayer.system.status.can_rx_stats[CAN_ADDON_MCP2515].active = true;
       logging.println("Can ok");
     } else {
       logging.print("Error Can: 0x");
@@ -181,12 +426,11 @@ bool init_CAN() {
     }
   }
 
-  auto fdNativeIt = can_receivers.find(CANFD_NATIVE);
   auto fdAddonIt = can_receivers.find(CANFD_ADDON_MCP2518);
 
-  if (fdNativeIt != can_receivers.end() || fdAddonIt != can_receivers.end()) {
+  if (fdAddonIt != can_receivers.end()) {
 
-    auto speed = (fdNativeIt != can_receivers.end()) ? fdNativeIt->second.speed : fdAddonIt->second.speed;
+    auto speed = fdAddonIt->second.speed;
 
     auto cs_pin = esp32hal->MCP2517_CS();
     auto int_pin = esp32hal->MCP2517_INT();
@@ -208,10 +452,14 @@ bool init_CAN() {
 
     // ListenOnly / Normal20B / NormalFDs
     settings2517->mRequestedMode = use_canfd_as_can ? ACAN2517FDSettings::Normal20B : ACAN2517FDSettings::NormalFD;
+    // Frames carry the receive time from the chip's time base, the timestamps take 4 bytes of RAM per FIFO object
+    settings2517->mControllerReceiveFIFOTimestamps = true;
+    settings2517->mControllerReceiveFIFOSize = 26;
 
-    const uint32_t errorCode2517 = canfd->begin(*settings2517, [] { canfd->isr(); });
+    const uint32_t errorCode2517 = begin_canfd_addon();
     canfd->poll();
     if (errorCode2517 == 0) {
+      datalayer.system.status.can_rx_stats[CANFD_ADDON_MCP2518].active = true;
       logging.print("Bit Rate prescaler: ");
       logging.println(settings2517->mBitRatePrescaler);
       logging.print("Arbitration Phase segment 1: ");
@@ -236,242 +484,574 @@ bool init_CAN() {
     }
   }
 
+  start_can_bus_statistics();
+  start_can_rx_task();
+  start_can_tx_queues();
+
   return true;
 }
 
-void transmit_can_frame_to_interface(const CAN_frame* tx_frame, CAN_Interface interface) {
-  if (!allowed_to_send_CAN) {
-    return;
+static void start_can_tx_queues() {
+  const uint32_t max_wait_us = CAN_TX_MAX_WAIT_MS * 1000UL;
+  if (native_can_initialized) {
+    can_native_tx_queue = new CanClassicTxQueue(max_wait_us);
+    datalayer.system.status.can_tx_stats[CAN_NATIVE].active = true;
   }
-  print_can_frame(*tx_frame, interface, frameDirection(MSG_TX));
+  if (can2515) {
+    can_addon_tx_queue = new CanClassicTxQueue(max_wait_us);
+    datalayer.system.status.can_tx_stats[CAN_ADDON_MCP2515].active = true;
+  }
+  if (canfd) {
+    canfd_tx_queue = new CanFdTxQueue(max_wait_us);
+    datalayer.system.status.can_tx_stats[CANFD_ADDON_MCP2518].active = true;
+  }
+  can_tx_mutex = xSemaphoreCreateMutex();
+}
 
-  if (datalayer.system.info.CAN_SD_logging_active) {
-    add_can_frame_to_buffer(*tx_frame, frameDirection(MSG_TX));
+static bool send_can_native(const CAN_classic_frame& tx_frame) {
+  CANMessage frame;
+  frame.id = tx_frame.ID;
+  frame.ext = tx_frame.ext_ID;
+  frame.len = tx_frame.DLC;
+  frame.data64 = tx_frame.data.u64;
+  if (!ACAN_ESP32::can.tryToSend(frame)) {
+    return false;
   }
+  can_bus_tx_counters[CAN_NATIVE]->count(tx_frame, true);
+  return true;
+}
 
-  switch (interface) {
-    case CAN_NATIVE: {
-
-      CANMessage frame;
-      frame.id = tx_frame->ID;
-      frame.ext = tx_frame->ext_ID;
-      frame.len = tx_frame->DLC;
-      for (uint8_t i = 0; i < frame.len; i++) {
-        frame.data[i] = tx_frame->data.u8[i];
-      }
-      send_ok_native = ACAN_ESP32::can.tryToSend(frame);
+static bool send_can_addon(const CAN_classic_frame& tx_frame) {
+  //Struct with ACAN2515 library format, needed to use the MCP2515 library for CAN2
+  CANMessage MCP2515Frame;
+  MCP2515Frame.id = tx_frame.ID;
+  MCP2515Frame.ext = tx_frame.ext_ID;
+  MCP2515Frame.len = tx_frame.DLC;
+  MCP2515Frame.rtr = false;
+  MCP2515Frame.data64 = tx_frame.data.u64;
+  if (!can2515->tryToSend(MCP2515Frame)) {
+    return false;
+  }
+  can_bus_tx_counters[CAN_ADDON_MCP2515]->count(tx_frame, true);
+  return true;
+}
+
+static bool send_canfd_addon(const CAN_frame& tx_frame) {
+  CANFDMessage MCP2518Frame;
+  if (tx_frame.FD) {
+    MCP2518Frame.type = CANFDMessage::CANFD_WITH_BIT_RATE_SWITCH;
+  } else {  //Classic CAN message
+    MCP2518Frame.type = CANFDMessage::CAN_DATA;
+  }
+  MCP2518Frame.id = tx_frame.ID;
+  MCP2518Frame.ext = tx_frame.ext_ID;
+  MCP2518Frame.len = tx_frame.DLC;
+  memcpy(MCP2518Frame.data, tx_frame.data.u8, std::min(tx_frame.DLC, (uint8_t)64));
+  if (!canfd->tryToSend(MCP2518Frame)) {
+    return false;
+  }
+  can_bus_tx_counters[CANFD_ADDON_MCP2518]->count(tx_frame, true);
+  return true;
+}
+
+// Hands queued frames to the controller until it is full. Must be called with can_tx_mutex held.
+static void drain_can_tx_queues(uint64_t now_us) {
+  if (can_native_tx_queue && can_native_tx_queue->drain(now_us, send_can_native) > 0) {
+    datalayer.system.info.can_native_send_fail = true;
+  }
+  if (can_addon_tx_queue && can_addon_tx_queue->drain(now_us, send_can_addon) > 0) {
+    datalayer.system.info.can_2515_send_fail = true;
+  }
+  if (canfd_tx_queue && canfd_tx_queue->drain(now_us, send_canfd_addon) > 0) {
+    datalayer.system.info.can_2518_send_fail = true;
+  }
+}
 
-      if (!send_ok_native) {
+static inline CAN_classic_frame classic_frame_of(const CAN_frame& frame) {
+  return to_classic_frame(frame);
+}
+static inline const CAN_classic_frame& classic_frame_of(const CAN_classic_frame& frame) {
+  return frame;
+}
+static inline const CAN_frame& fd_frame_of(const CAN_frame& frame) {
+  return frame;
+}
+static inline CAN_frame fd_frame_of(const CAN_classic_frame& frame) {
+  return to_can_frame(frame);
+}
+
+template <typename Frame>
+static void queue_can_frame(const Frame& tx_frame, CAN_Interface interface, CanTxPriority priority) {
+  if (can_tx_mutex == nullptr) {
+    return;  // CAN not initialized yet
+  }
+
+  xSemaphoreTake(can_tx_mutex, portMAX_DELAY);
+  const uint64_t now_us = esp_timer_get_time();
+
+  switch (interface) {
+    case CAN_NATIVE:
+      if (can_native_tx_queue && !can_native_tx_queue->enqueue(classic_frame_of(tx_frame), priority, now_us)) {
         datalayer.system.info.can_native_send_fail = true;
       }
-    } break;
-    case CAN_ADDON_MCP2515: {
-      //Struct with ACAN2515 library format, needed to use the MCP2515 library for CAN2
-      CANMessage MCP2515Frame;
-      MCP2515Frame.id = tx_frame->ID;
-      MCP2515Frame.ext = tx_frame->ext_ID;
-      MCP2515Frame.len = tx_frame->DLC;
-      MCP2515Frame.rtr = false;
-      for (uint8_t i = 0; i < MCP2515Frame.len; i++) {
-        MCP2515Frame.data[i] = tx_frame->data.u8[i];
-      }
-
-      send_ok_2515 = can2515->tryToSend(MCP2515Frame);
-      if (!send_ok_2515) {
+      break;
+    case CAN_ADDON_MCP2515:
+      if (can_addon_tx_queue && !can_addon_tx_queue->enqueue(classic_frame_of(tx_frame), priority, now_us)) {
         datalayer.system.info.can_2515_send_fail = true;
       }
-    } break;
+      break;
     case CANFD_NATIVE:
-    case CANFD_ADDON_MCP2518: {
-      CANFDMessage MCP2518Frame;
-      if (tx_frame->FD) {
-        MCP2518Frame.type = CANFDMessage::CANFD_WITH_BIT_RATE_SWITCH;
-      } else {  //Classic CAN message
-        MCP2518Frame.type = CANFDMessage::CAN_DATA;
-      }
-      MCP2518Frame.id = tx_frame->ID;
-      MCP2518Frame.ext = tx_frame->ext_ID;
-      MCP2518Frame.len = tx_frame->DLC;
-      for (uint8_t i = 0; i < MCP2518Frame.len; i++) {
-        MCP2518Frame.data[i] = tx_frame->data.u8[i];
-      }
-      send_ok_2518 = canfd->tryToSend(MCP2518Frame);
-      if (!send_ok_2518) {
+    case CANFD_ADDON_MCP2518:
+      if (canfd_tx_queue && !canfd_tx_queue->enqueue(fd_frame_of(tx_frame), priority, now_us)) {
         datalayer.system.info.can_2518_send_fail = true;
       }
-    } break;
+      break;
     default:
       // Invalid interface sent with function call. TODO: Raise event that coders messed up
       break;
   }
+
+  // Send right away if the controller has room, so an idle bus adds no latency
+  drain_can_tx_queues(now_us);
+  xSemaphoreGive(can_tx_mutex);
 }
 
-// Receive functions
-void receive_can() {
-  if (native_can_initialized) {
-    receive_frame_can_native();  // Receive CAN messages from native CAN port
+void transmit_can_frame_to_interface(const CAN_frame* tx_frame, CAN_Interface interface, CanTxPriority priority) {
+  if (!allowed_to_send_CAN) {
+    return;
   }
+  print_can_frame(*tx_frame, interface, frameDirection(MSG_TX));
 
-  if (can2515) {
-    receive_frame_can_addon();  // Receive CAN messages on add-on MCP2515 chip
+  if (datalayer.system.info.CAN_SD_logging_active) {
+    add_can_frame_to_buffer(*tx_frame, interface, frameDirection(MSG_TX));
   }
+  record_can_flight_frame(*tx_frame, interface, frameDirection(MSG_TX));
 
-  if (canfd) {
-    receive_frame_canfd_addon();  // Receive CAN-FD messages.
+  queue_can_frame(*tx_frame, interface, priority);
+}
+
+void transmit_can_frame_to_interface(const CAN_classic_frame* tx_frame, CAN_Interface interface,
+                                     CanTxPriority priority) {
+  if (!allowed_to_send_CAN) {
+    return;
   }
+  if (datalayer.system.info.CAN_usb_logging_active || datalayer.system.info.can_logging_active ||
+      datalayer.system.info.CAN_SD_logging_active || can_flight_recorder.state() != CanFlightState::Off) {
+    // The loggers work on full frames, only widen the frame when one of them is active
+    const CAN_frame frame = to_can_frame(*tx_frame);
+    print_can_frame(frame, interface, frameDirection(MSG_TX));
+
+    if (datalayer.system.info.CAN_SD_logging_active) {
+      add_can_frame_to_buffer(frame, interface, frameDirection(MSG_TX));
+    }
+    record_can_flight_frame(frame, interface, frameDirection(MSG_TX));
+  }
+
+  queue_can_frame(*tx_frame, interface, priority);
 }
 
-void receive_frame_can_native() {  // This section checks if we have a complete CAN message incoming on native CAN port
+void transmit_queued_can_frames() {
+  if (can_tx_mutex == nullptr) {
+    return;
+  }
+  xSemaphoreTake(can_tx_mutex, portMAX_DELAY);
+  drain_can_tx_queues(esp_timer_get_time());
+  xSemaphoreGive(can_tx_mutex);
+}
+
+void update_can_tx_statistics() {
+  if (can_tx_mutex == nullptr) {
+    return;
+  }
+
+  auto sample = [](CAN_Interface interface, auto* queue) {
+    if (queue == nullptr) {
+      return;
+    }
+    auto& stats = datalayer.system.status.can_tx_stats[interface];
+    const CanTxQueueStats& queue_stats = queue->get_stats();
+    stats.queue_size = queue->capacity();
+    stats.queue_high_water = queue_stats.peak_depth;
+    stats.frames_per_second = queue_stats.sent - stats.sent;
+    stats.sent = queue_stats.sent;
+    stats.dropped = queue_stats.dropped;
+    stats.expired = queue_stats.expired;
+    stats.retries = queue_stats.retries;
+    stats.latency_avg_us = queue->latency_avg_us();
+    stats.latency_max_us = queue_stats.latency_max_us;
+    queue->reset_latency();
+  };
+
+  xSemaphoreTake(can_tx_mutex, portMAX_DELAY);
+  sample(CAN_NATIVE, can_native_tx_queue);
+  sample(CAN_ADDON_MCP2515, can_addon_tx_queue);
+  sample(CANFD_ADDON_MCP2518, canfd_tx_queue);
+  xSemaphoreGive(can_tx_mutex);
+}
+
+// Receive functions
+// The ingestion functions below run in the CAN ingestion task. They move frames from the driver buffers into the
+// ring until the driver is empty or the ring is full, in which case the frames wait in the driver buffer.
+static void ingest_frames_can_native() {
   CANMessage frame;
+  CanRxEntry* entry;
+
+  while ((entry = can_rx_ring->reserve()) != nullptr && ACAN_ESP32::can.receive(frame)) {
+    entry->interface = CAN_NATIVE;
+    entry->frame.FD = false;
+    entry->frame.ID = frame.id;
+    entry->frame.ext_ID = frame.ext;
+    entry->frame.DLC = frame.len;
+    entry->frame.data.u64 = frame.data64;
+    entry->frame.timestamp_us = frame.timestamp_us;
+    can_rx_ring->commit();
+  }
+}
 
-  if (ACAN_ESP32::can.available()) {
-    if (ACAN_ESP32::can.receive(frame)) {
+static void ingest_frames_can_addon() {
+  CANMessage MCP2515frame;  // Struct with ACAN2515 library format, needed to use the MCP2515 library
+  CanRxEntry* entry;
+
+  while ((entry = can_rx_ring->reserve()) != nullptr && can2515->receive(MCP2515frame)) {
+    entry->interface = CAN_ADDON_MCP2515;
+    entry->frame.FD = false;
+    entry->frame.ID = MCP2515frame.id;
+    entry->frame.ext_ID = MCP2515frame.ext;
+    entry->frame.DLC = MCP2515frame.len;
+    entry->frame.data.u64 = MCP2515frame.data64;
+    entry->frame.timestamp_us = MCP2515frame.timestamp_us;
+    can_rx_ring->commit();
+  }
+}
 
-      CAN_frame rx_frame;
-      rx_frame.ID = frame.id;
-      rx_frame.ext_ID = frame.ext;
-      rx_frame.DLC = frame.len;
-      for (uint8_t i = 0; i < frame.len && i < 8; i++) {
-        rx_frame.data.u8[i] = frame.data[i];
-      }
+static void ingest_frames_canfd_addon() {
+  CANFDMessage MCP2518frame;
+  CanRxEntry* entry;
+
+  while ((entry = can_rx_ring->reserve()) != nullptr && canfd->available()) {
+    canfd->receive(MCP2518frame);
+    entry->interface = CANFD_ADDON_MCP2518;
+    entry->frame.FD = MCP2518frame.type == CANFDMessage::CANFD_NO_BIT_RATE_SWITCH ||
+                      MCP2518frame.type == CANFDMessage::CANFD_WITH_BIT_RATE_SWITCH;
+    entry->frame.ID = MCP2518frame.id;
+    entry->frame.ext_ID = MCP2518frame.ext;
+    entry->frame.DLC = MCP2518frame.len;
+    memcpy(entry->frame.data.u8, MCP2518frame.data, std::min(entry->frame.DLC, (uint8_t)64));
+    entry->frame.timestamp_us = MCP2518frame.timestamp_us;
+    can_rx_ring->commit();
+  }
+}
+
+// High priority task moving received frames out of the drivers as soon as they notify it, so the frames keep
+// their receive timestamps and the small driver buffers don't overflow while the core task is busy.
+static void can_rx_task(void*) {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, CAN_RX_IDLE_WAKEUP);
 
-      //message incoming, pass it on to the handler
-      map_can_frame_to_variable(&rx_frame, CAN_NATIVE);
+    xSemaphoreTake(can_rx_mutex, portMAX_DELAY);
+    if (!can_rx_paused) {
+      if (native_can_initialized) {
+        ingest_frames_can_native();
+      }
+      if (can2515) {
+        ingest_frames_can_addon();
+      }
+      if (canfd) {
+        ingest_frames_canfd_addon();
+      }
     }
+    xSemaphoreGive(can_rx_mutex);
   }
 }
 
-void receive_frame_can_addon() {  // This section checks if we have a complete CAN message incoming on add-on CAN port
-  CAN_frame rx_frame;             // Struct with our CAN format
-  CANMessage MCP2515frame;        // Struct with ACAN2515 library format, needed to use the MCP2515 library
+static void start_can_rx_task() {
+  if (!native_can_initialized && !can2515 && !canfd) {
+    return;
+  }
 
-  if (can2515->available()) {
-    can2515->receive(MCP2515frame);
+  can_rx_ring = new SpscRing<CanRxEntry, CAN_RX_RING_SIZE>();
+  can_rx_mutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore((TaskFunction_t)&can_rx_task, "can_rx", 3072, NULL, TASK_CAN_RX_PRIO, &can_rx_task_handle,
+                          esp32hal->CORE_FUNCTION_CORE());
 
-    rx_frame.ID = MCP2515frame.id;
-    rx_frame.ext_ID = MCP2515frame.ext;
-    rx_frame.DLC = MCP2515frame.len;
-    for (uint8_t i = 0; i < MCP2515frame.len && i < 8; i++) {
-      rx_frame.data.u8[i] = MCP2515frame.data[i];
+  if (native_can_initialized) {
+    ACAN_ESP32::can.setReceiveNotificationTask(can_rx_task_handle);
+  }
+  if (can2515) {
+    can2515->setReceiveNotificationTask(can_rx_task_handle);
+  }
+  if (canfd) {
+    canfd->setReceiveNotificationTask(can_rx_task_handle);
+  }
+}
+
+// Keeps the ingestion task away from the drivers while they are stopped or reconfigured
+static void set_can_rx_paused(bool paused) {
+  if (can_rx_mutex == nullptr) {
+    return;  // Ingestion task not started yet
+  }
+  xSemaphoreTake(can_rx_mutex, portMAX_DELAY);
+  can_rx_paused = paused;
+  xSemaphoreGive(can_rx_mutex);
+  if (!paused) {
+    xTaskNotifyGive(can_rx_task_handle);
+  }
+}
+
+bool inject_can_frame(const CAN_frame& frame, CAN_Interface interface) {
+  auto* ring = can_loopback_ring.load(std::memory_order_acquire);
+  if (ring == nullptr) {
+    ring = new SpscRing<CanRxEntry, CAN_LOOPBACK_RING_SIZE>();
+    can_loopback_ring.store(ring, std::memory_order_release);
+  }
+  return ring->push({frame, receiving_can_interface(interface)});
+}
+
+void receive_can() {
+  uint16_t count[NO_CAN_INTERFACE] = {0};
+  const CanRxEntry* entry;
+
+  // Injected frames share the budget of their interface, they are not counted as bus traffic
+  auto* loopback_ring = can_loopback_ring.load(std::memory_order_acquire);
+  if (loopback_ring != nullptr) {
+    while ((entry = loopback_ring->peek()) != nullptr && count[entry->interface] < rx_budget(entry->interface)) {
+      count[entry->interface]++;
+      map_can_frame_to_variable(entry->frame, entry->interface);
+      loopback_ring->pop();
     }
+  }
+
+  if (can_rx_ring == nullptr) {
+    return;
+  }
+
+  // Frames are handed on in arrival order, stop once an interface used up its budget for this tick
+  while ((entry = can_rx_ring->peek()) != nullptr) {
+    const CAN_Interface interface = entry->interface;
+    if (count[interface] >= rx_budget(interface)) {
+      break;
+    }
+    count[interface]++;
+    can_bus_rx_counters[interface]->count(entry->frame, false);
 
     //message incoming, pass it on to the handler
-    map_can_frame_to_variable(&rx_frame, CAN_ADDON_MCP2515);
+    map_can_frame_to_variable(entry->frame, interface);
+    can_rx_ring->pop();
+  }
+
+  if (native_can_initialized) {
+    account_rx_tick(CAN_NATIVE, count[CAN_NATIVE]);
+  }
+  if (can2515) {
+    account_rx_tick(CAN_ADDON_MCP2515, count[CAN_ADDON_MCP2515]);
+  }
+  if (canfd) {
+    account_rx_tick(CANFD_ADDON_MCP2518, count[CANFD_ADDON_MCP2518]);
+  }
+
+  // Ends the post-trigger time of the flight recorder on a quiet bus
+  if (can_flight_recorder.state() == CanFlightState::Triggered) {
+    portENTER_CRITICAL(&can_flight_lock);
+    can_flight_recorder.poll(esp_timer_get_time());
+    portEXIT_CRITICAL(&can_flight_lock);
   }
 }
 
-void receive_frame_canfd_addon() {  // This section checks if we have a complete CAN-FD message incoming
-  CANFDMessage MCP2518frame;
-  int count = 0;
-  while (canfd->available() && count++ < 16) {
-    canfd->receive(MCP2518frame);
+void update_can_rx_statistics() {
+  const unsigned long now = millis();
+  const unsigned long elapsed = now - can_rx_last_sample_millis;
+  can_rx_last_sample_millis = now;
+  if (elapsed == 0) {
+    return;
+  }
 
-    CAN_frame rx_frame;
-    rx_frame.ID = MCP2518frame.id;
-    rx_frame.ext_ID = MCP2518frame.ext;
-    rx_frame.DLC = MCP2518frame.len;
-    memcpy(rx_frame.data.u8, MCP2518frame.data, std::min(rx_frame.DLC, (uint8_t)64));
-    //message incoming, pass it on to the handler
-    map_can_frame_to_variable(&rx_frame, CANFD_ADDON_MCP2518);
-    map_can_frame_to_variable(&rx_frame, CANFD_NATIVE);
+  auto sample = [elapsed](CAN_Interface interface, uint16_t size, uint16_t peak, uint32_t overruns) {
+    auto& stats = datalayer.system.status.can_rx_stats[interface];
+    stats.buffer_size = size;
+    stats.buffer_high_water = std::max(stats.buffer_high_water, peak);
+    stats.overruns = overruns;
+    stats.frames_per_second = (can_rx_frames_since_sample[interface] * 1000UL) / elapsed;
+    can_rx_frames_since_sample[interface] = 0;
+  };
+
+  if (native_can_initialized) {
+    sample(CAN_NATIVE, ACAN_ESP32::can.driverReceiveBufferSize(), ACAN_ESP32::can.driverReceiveBufferPeakCount(),
+           ACAN_ESP32::can.driverReceiveBufferOverflowCount());
+  }
+
+  if (can2515 && datalayer.system.status.can_rx_stats[CAN_ADDON_MCP2515].active) {
+    sample(CAN_ADDON_MCP2515, can2515->receiveBufferSize(), can2515->receiveBufferPeakCount(),
+           can2515->receiveBufferOverflowCount());
+  }
+
+  if (canfd && datalayer.system.status.can_rx_stats[CANFD_ADDON_MCP2518].active) {
+    sample(CANFD_ADDON_MCP2518, canfd->driverReceiveBufferSize(), canfd->driverReceiveBufferPeakCount(),
+           canfd->driverReceiveBufferOverflowCount() + canfd->hardwareReceiveBufferOverflowCount());
   }
 }
 
-// Support functions
-void print_can_frame(CAN_frame frame, CAN_Interface interface, frameDirection msgDir) {
+static void start_can_bus_statistics() {
+  auto start = [](CAN_Interface interface, uint32_t bitrate, uint8_t data_rate_factor) {
+    can_bus_rx_counters[interface] = new CanBusStats(data_rate_factor);
+    can_bus_tx_counters[interface] = new CanBusStats(data_rate_factor);
+    datalayer.system.status.can_bus_stats[interface].bitrate = bitrate;
+    datalayer.system.status.can_bus_stats[interface].active = true;
+  };
 
-  if (datalayer.system.info.CAN_usb_logging_active) {
-    uint8_t i = 0;
-    Serial.print("(");
-    Serial.print(millis() / 1000.0);
-    if (msgDir == MSG_RX) {
-      Serial.print(") RX");
-      Serial.print((int)(interface * 2));
-    } else {
-      Serial.print(") TX");
-      Serial.print((int)(interface * 2) + 1);
-    }
-    Serial.print(" ");
-    Serial.print(frame.ID, HEX);
-    Serial.print(" [");
-    Serial.print(frame.DLC);
-    Serial.print("] ");
-    for (i = 0; i < frame.DLC; i++) {
-      Serial.print(frame.data.u8[i] < 16 ? "0" : "");
-      Serial.print(frame.data.u8[i], HEX);
-      if (i < frame.DLC - 1)
-        Serial.print(" ");
+  if (native_can_initialized) {
+    start(CAN_NATIVE, settingsespcan->actualBitRate(), 1);
+  }
+  if (can2515) {
+    start(CAN_ADDON_MCP2515, settings2515->actualBitRate(), 1);
+  }
+  if (canfd) {
+    start(CANFD_ADDON_MCP2518, settings2517->actualArbitrationBitRate(), (uint8_t)DataBitRateFactor::x4);
+  }
+  can_bus_last_sample_millis = millis();
+}
+
+void update_can_bus_statistics() {
+  const unsigned long now = millis();
+  const unsigned long elapsed = now - can_bus_last_sample_millis;
+  if (elapsed == 0 || can_tx_mutex == nullptr) {
+    return;
+  }
+  can_bus_last_sample_millis = now;
+
+  xSemaphoreTake(can_tx_mutex, portMAX_DELAY);
+  for (uint8_t i = 0; i < NO_CAN_INTERFACE; i++) {
+    if (can_bus_rx_counters[i] != nullptr) {
+      can_bus_rx_counters[i]->absorb(*can_bus_tx_counters[i]);
     }
-    Serial.println("");
   }
+  xSemaphoreGive(can_tx_mutex);
 
-  if (datalayer.system.info.can_logging_active) {  // If user clicked on CAN Logging page in webserver, start recording
-    if (frame.ID > user_selected_CAN_ID_cutoff_filter) {  //Only log the message if CAN ID is higher than user set value
-      dump_can_frame(frame, interface, msgDir);
+  for (uint8_t i = 0; i < NO_CAN_INTERFACE; i++) {
+    if (can_bus_rx_counters[i] != nullptr) {
+      can_bus_rx_counters[i]->sample(datalayer.system.status.can_bus_stats[i], elapsed);
     }
   }
-}
 
-void map_can_frame_to_variable(CAN_frame* rx_frame, CAN_Interface interface) {
-  if (interface !=
-      CANFD_NATIVE) {  //Avoid printing twice due to receive_frame_canfd_addon sending to both FD interfaces
-    //TODO: This check can be removed later when refactored to use inline functions for logging
-    print_can_frame(*rx_frame, interface, frameDirection(MSG_RX));
+  auto set_error_state = [](CAN_Interface interface, uint8_t tec, uint8_t rec, bool bus_off, uint8_t flags) {
+    auto& stats = datalayer.system.status.can_bus_stats[interface];
+    stats.tx_error_counter = tec;
+    stats.rx_error_counter = rec;
+    stats.error_passive = tec > 127 || rec > 127;
+    stats.bus_off = bus_off;
+    stats.error_flags = flags;
+  };
+
+  if (native_can_initialized) {
+    const uint8_t status = ACAN_ESP32::can.TWAI_STATUS_REG();
+    set_error_state(CAN_NATIVE, ACAN_ESP32::can.TWAI_TX_ERR_CNT_REG(), ACAN_ESP32::can.TWAI_RX_ERR_CNT_REG(),
+                    status & TWAI_BUS_OFF_ST, status);
   }
 
-  if (datalayer.system.info.CAN_SD_logging_active) {
-    if (interface !=
-        CANFD_NATIVE) {  //Avoid printing twice due to receive_frame_canfd_addon sending to both FD interfaces
-      //TODO: This check can be removed later when refactored to use inline functions for logging
-      add_can_frame_to_buffer(*rx_frame, frameDirection(MSG_RX));
-    }
+  if (can2515) {
+    const uint8_t eflg = can2515->errorFlagRegister();
+    // EFLG bit 5: TXBO
+    set_error_state(CAN_ADDON_MCP2515, can2515->transmitErrorCounter(), can2515->receiveErrorCounter(),
+                    eflg & 0x20, eflg);
   }
 
-  // Send the frame to all the receivers registered for this interface.
-  auto receivers = can_receivers.equal_range(interface);
+  if (canfd) {
+    // CiTREC: REC in bits 0-7, TEC in bits 8-15, EWARN..TXBO in bits 16-21
+    const uint32_t trec = canfd->errorCounters();
+    set_error_state(CANFD_ADDON_MCP2518, (trec >> 8) & 0xFF, trec & 0xFF, trec & (1UL << 21), (trec >> 16) & 0xFF);
+  }
+}
+
+// Support functions
+uint64_t can_frame_timestamp_us(const CAN_frame& frame) {
+  return frame.timestamp_us != 0 ? frame.timestamp_us : esp_timer_get_time();
+}
 
-  for (auto it = receivers.first; it != receivers.second; ++it) {
-    auto& receiver = it->second;
-    receiver.receiver->receive_can_frame(rx_frame);
+void record_can_flight_frame(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir) {
+  if (can_flight_recorder.state() == CanFlightState::Off) {
+    return;
   }
+  portENTER_CRITICAL(&can_flight_lock);
+  can_flight_recorder.record(frame, interface, msgDir, can_frame_timestamp_us(frame));
+  portEXIT_CRITICAL(&can_flight_lock);
 }
 
-void dump_can_frame(CAN_frame& frame, CAN_Interface interface, frameDirection msgDir) {
-  char* message_string = datalayer.system.info.logged_can_messages;
-  int offset = datalayer.system.info.logged_can_messages_offset;  // Keeps track of the current position in the buffer
-  size_t message_string_size = sizeof(datalayer.system.info.logged_can_messages);
+void init_can_flight_recorder() {
+  if (user_selected_can_flight_kb == 0) {
+    return;
+  }
+  // PSRAM holds a long history when the board has it, otherwise only a little of the internal RAM is taken
+  size_t size = (size_t)std::min<uint16_t>(user_selected_can_flight_kb, CAN_FLIGHT_MAX_KB) * 1024;
+  uint8_t* memory = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (memory == nullptr) {
+    size = std::min<size_t>(size, CAN_FLIGHT_MAX_INTERNAL_KB * 1024);
+    memory = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  if (memory == nullptr) {
+    LOG_E(CAN, "No memory for the CAN flight recorder\n");
+    return;
+  }
 
-  if (offset + 128 > sizeof(datalayer.system.info.logged_can_messages)) {
-    // Not enough space, reset and start from the beginning
-    offset = 0;
+  // Events that always freeze the recording, whatever the trigger setting
+  static const EVENTS_ENUM_TYPE listed_events[] = {EVENT_BATTERY_OVERHEAT, EVENT_THERMAL_RUNAWAY,
+                                                   EVENT_CONTACTOR_WELDED, EVENT_CAN_BATTERY_MISSING,
+                                                   EVENT_CAN_INVERTER_MISSING, EVENT_TASK_OVERRUN};
+  static_assert(EVENT_NOF_EVENTS <= CAN_FLIGHT_MAX_EVENTS, "Raise CAN_FLIGHT_MAX_EVENTS");
+  for (int event = 0; event < EVENT_NOF_EVENTS; event++) {
+    const EVENTS_LEVEL_TYPE level = get_event_pointer((EVENTS_ENUM_TYPE)event)->level;
+    bool enabled = std::find(std::begin(listed_events), std::end(listed_events), event) != std::end(listed_events);
+    if (user_selected_can_flight_trigger == CanFlightTrigger::Errors) {
+      enabled = enabled || level == EVENT_LEVEL_ERROR;
+    } else if (user_selected_can_flight_trigger == CanFlightTrigger::Warnings) {
+      enabled = enabled || level == EVENT_LEVEL_ERROR || level == EVENT_LEVEL_WARNING;
+    }
+    can_flight_recorder.set_trigger_event(event, enabled);
   }
-  unsigned long currentTime = millis();
-  // Add timestamp
-  offset += snprintf(message_string + offset, message_string_size - offset, "(%lu.%03lu) ", currentTime / 1000,
-                     currentTime % 1000);
 
-  // Add direction. Multiplying the interface by two ensures that SavvyCAN puts TX and RX in a different bus.
-  offset += snprintf(message_string + offset, message_string_size - offset, "%s%d ", (msgDir == MSG_RX) ? "RX" : "TX",
-                     (int)(interface * 2) + (msgDir == MSG_RX ? 0 : 1));
+  CanFlightRecorderConfig config;
+  config.pre_trigger_ms = (uint32_t)user_selected_can_flight_pre_s * 1000;
+  config.post_trigger_ms = (uint32_t)user_selected_can_flight_post_s * 1000;
+  can_flight_recorder.begin(memory, size, config);
+  LOG_I(CAN, "CAN flight recorder keeps %u kB\n", (unsigned)(size / 1024));
+}
 
-  // Add ID and DLC
-  offset += snprintf(message_string + offset, message_string_size - offset, "%lX [%u] ", frame.ID, frame.DLC);
+void print_can_frame(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir) {
 
-  // Add data bytes
-  for (uint8_t i = 0; i < frame.DLC; i++) {
-    if (i < frame.DLC - 1) {
-      offset += snprintf(message_string + offset, message_string_size - offset, "%02X ", frame.data.u8[i]);
-    } else {
-      offset += snprintf(message_string + offset, message_string_size - offset, "%02X", frame.data.u8[i]);
+  if (datalayer.system.info.CAN_usb_logging_active) {
+    usb_output_can_frame(frame, interface, msgDir, can_frame_timestamp_us(frame));
+  }
+
+  if (datalayer.system.info.can_logging_active) {  // If user clicked on CAN Logging page in webserver, start recording
+    if (frame.ID > user_selected_CAN_ID_cutoff_filter) {  //Only log the message if CAN ID is higher than user set value
+      dump_can_frame(frame, interface, msgDir);
     }
   }
-  // Add linebreak
-  offset += snprintf(message_string + offset, message_string_size - offset, "\n");
+}
 
-  datalayer.system.info.logged_can_messages_offset = offset;  // Update offset in buffer
+void map_can_frame_to_variable(const CAN_frame& rx_frame, CAN_Interface interface) {
+  print_can_frame(rx_frame, interface, frameDirection(MSG_RX));
+
+  if (datalayer.system.info.CAN_SD_logging_active) {
+    add_can_frame_to_buffer(rx_frame, interface, frameDirection(MSG_RX));
+  }
+  record_can_flight_frame(rx_frame, interface, frameDirection(MSG_RX));
+
+  // Send the frame to the receivers on this interface that declared interest in its ID.
+  if (can_dispatch_tables[interface] != nullptr) {
+    can_dispatch_tables[interface]->dispatch(rx_frame);
+  }
+  can_supervisor.frame_received(rx_frame, interface, can_frame_timestamp_us(rx_frame) / 1000);
+}
+
+void dump_can_frame(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir) {
+  // Kept as a binary record, the webserver formats it when the CAN log page asks for it
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  const size_t size = can_log_encode(frame, interface, msgDir, can_frame_timestamp_us(frame), record);
+  web_log.push(LOG_RING_CAN, record, size);
 }
 
 void stop_can() {
+  set_can_rx_paused(true);
+
   if (can_receivers.find(CAN_NATIVE) != can_receivers.end()) {
     ACAN_ESP32::can.end();
   }
@@ -489,18 +1069,20 @@ void stop_can() {
 
 void restart_can() {
   if (can_receivers.find(CAN_NATIVE) != can_receivers.end()) {
-    ACAN_ESP32::can.begin(*settingsespcan);
+    ACAN_ESP32::can.begin(*settingsespcan, native_can_filter());
   }
 
   if (can2515) {
     SPI2515.begin();
-    can2515->begin(*settings2515, [] { can2515->isr(); });
+    begin_can_addon();
   }
 
   if (canfd) {
     SPI2517.begin();
-    canfd->begin(*settings2517, [] { canfd->isr(); });
+    begin_canfd_addon();
   }
+
+  set_can_rx_paused(false);
 }
 
 // Initialize the native CAN interface with the given speed and pins.
@@ -523,14 +1105,16 @@ uint32_t init_native_can(CAN_Speed speed, gpio_num_t tx_pin, gpio_num_t rx_pin)
   settingsespcan->mRxPin = rx_pin;
 
   // (Re)start the CAN interface
-  return ACAN_ESP32::can.begin(*settingsespcan);
+  return ACAN_ESP32::can.begin(*settingsespcan, native_can_filter());
 }
 
 // Change the speed of the given CAN interface. Returns true if successful.
 bool change_can_speed(CAN_Interface interface, CAN_Speed speed) {
   if (interface == CAN_Interface::CAN_NATIVE && settingsespcan != nullptr) {
     // Reinitialize the native CAN interface with the new speed
+    set_can_rx_paused(true);
     const uint32_t errorCode = init_native_can(speed, settingsespcan->mTxPin, settingsespcan->mRxPin);
+    set_can_rx_paused(false);
     if (errorCode != 0) {
       logging.print("Error Native Can: 0x");
       logging.println(errorCode, HEX);
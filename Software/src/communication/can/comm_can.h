@@ -2,18 +2,60 @@
 #define _COMM_CAN_H_
 
 #include "../../devboard/utils/types.h"
+#include "CanFlightRecorder.h"
+#include "CanTxQueue.h"
 
 extern bool use_canfd_as_can;
+extern bool use_can_hw_filters;
 extern uint8_t user_selected_can_addon_crystal_frequency_mhz;
 extern uint8_t user_selected_canfd_addon_crystal_frequency_mhz;
 extern uint16_t user_selected_CAN_ID_cutoff_filter;
-
-void dump_can_frame(CAN_frame& frame, CAN_Interface interface, frameDirection msgDir);
-void transmit_can_frame_to_interface(const CAN_frame* tx_frame, CAN_Interface interface);
+extern uint16_t user_selected_can_native_rx_budget;
+extern uint16_t user_selected_can_addon_rx_budget;
+extern uint16_t user_selected_canfd_addon_rx_budget;
+extern uint16_t user_selected_can_addon_rx_buffer_size;
+extern uint16_t user_selected_can_flight_kb;
+extern uint16_t user_selected_can_flight_pre_s;
+extern uint16_t user_selected_can_flight_post_s;
+extern CanFlightTrigger user_selected_can_flight_trigger;
+
+void dump_can_frame(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir);
+// Receive time of the frame in microseconds, or the current time for frames without one (TX)
+uint64_t can_frame_timestamp_us(const CAN_frame& frame);
+// Queue a frame for sending on the interface. Frames wait in a per-interface queue until the controller accepts
+// them, higher priority frames first.
+void transmit_can_frame_to_interface(const CAN_frame* tx_frame, CAN_Interface interface,
+                                     CanTxPriority priority = CanTxPriority::Normal);
+void transmit_can_frame_to_interface(const CAN_classic_frame* tx_frame, CAN_Interface interface,
+                                     CanTxPriority priority = CanTxPriority::Normal);
+// Hand a frame to the local receivers of the interface as if it had been received there, used to replay recorded
+// traffic into the configured battery and inverter. The core task takes it on its next tick. Returns false while
+// CAN_LOOPBACK_RING_SIZE frames are waiting. Called from one task at a time.
+bool inject_can_frame(const CAN_frame& frame, CAN_Interface interface);
 
 //These defines are not used if user updates values via Settings page
 #define CRYSTAL_FREQUENCY_MHZ 8
 #define CANFD_ADDON_CRYSTAL_FREQUENCY_MHZ ACAN2517FDSettings::OSC_40MHz
+// Max amount of frames drained from each CAN interface per core task tick (1ms)
+#define CAN_RX_BUDGET_PER_TICK 16
+// Frames the MCP2515 driver can hold until the CAN ingestion task takes them
+#define CAN_ADDON_RX_BUFFER_SIZE 32
+// Frames that can wait between the CAN ingestion task and the core task, must be a power of two
+#define CAN_RX_RING_SIZE 64
+// Frames that can wait between inject_can_frame() and the core task, must be a power of two
+#define CAN_LOOPBACK_RING_SIZE 32
+// Frames that can wait in the transmit queue of each interface
+#define CAN_TX_QUEUE_SIZE 32
+// CAN flight recorder memory, 0 disables it and is the default. Taken from PSRAM when there is some, else at most
+// CAN_FLIGHT_MAX_INTERNAL_KB of the internal RAM
+#define CAN_FLIGHT_DEFAULT_KB 0
+#define CAN_FLIGHT_MAX_KB 4096
+#define CAN_FLIGHT_MAX_INTERNAL_KB 64
+// Seconds of traffic kept from before the trigger and recorded after it
+#define CAN_FLIGHT_DEFAULT_PRE_S 10
+#define CAN_FLIGHT_DEFAULT_POST_S 5
+// Frames the controller did not accept within this time are dropped
+#define CAN_TX_MAX_WAIT_MS 50
 
 class CanReceiver;
 
@@ -54,7 +96,8 @@ void register_can_receiver(CanReceiver* receiver, CAN_Interface interface,
 bool init_CAN();
 
 /**
- * @brief Receive CAN messages from all interfaces. Respective CanReceivers are called.
+ * @brief Hand the CAN messages received since the last call to the respective CanReceivers.
+ * Frames are taken from the controllers by the CAN ingestion task and queued with their receive timestamp.
  *
  * @param[in] void
  *
@@ -63,31 +106,44 @@ bool init_CAN();
 void receive_can();
 
 /**
- * @brief Receive CAN messages from CAN tranceiver natively installed on Lilygo hardware
+ * @brief Hand frames still waiting in the transmit queues to the controllers, as far as they accept them.
+ * Called every core task tick, frames are also handed on right when they are queued.
+ *
+ * @param[in] void
+ *
+ * @return void
+ */
+void transmit_queued_can_frames();
+
+/**
+ * @brief Sample transmit queue depths, losses and latencies of all CAN interfaces
+ * into datalayer.system.status.can_tx_stats. Should be called once per second.
  *
  * @param[in] void
  *
  * @return void
  */
-void receive_frame_can_native();
+void update_can_tx_statistics();
 
 /**
- * @brief Receive CAN messages from CAN addon chip
+ * @brief Sample receive buffer high-water marks, overruns and frame rates of all CAN interfaces
+ * into datalayer.system.status.can_rx_stats. Should be called once per second.
  *
  * @param[in] void
  *
  * @return void
  */
-void receive_frame_can_addon();
+void update_can_rx_statistics();
 
 /**
- * @brief Receive CAN messages from CANFD addon chip
+ * @brief Sample bus utilization, per-ID frame rates and controller error counters of all CAN interfaces
+ * into datalayer.system.status.can_bus_stats. Should be called once per second.
  *
  * @param[in] void
  *
  * @return void
  */
-void receive_frame_canfd_addon();
+void update_can_bus_statistics();
 
 /**
  * @brief print CAN frames via USB
@@ -96,7 +152,13 @@ void receive_frame_canfd_addon();
  *
  * @return void
  */
-void print_can_frame(CAN_frame frame, CAN_Interface interface, frameDirection msgDir);
+void print_can_frame(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir);
+
+// Hand a sent or received frame to the CAN flight recorder, if it is enabled
+void record_can_flight_frame(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir);
+
+// Allocate the CAN flight recorder memory and select its trigger events, from the settings
+void init_can_flight_recorder();
 
 // Stop/pause CAN communication for all interfaces
 void stop_can();
@@ -74,7 +74,7 @@ bool init_contactors() {
     auto precPin = esp32hal->PRECHARGE_PIN();
 
     if (!esp32hal->alloc_pins(contactors, posPin, negPin, precPin)) {
-      DEBUG_PRINTF("GPIO controlled contactor setup failed\n");
+      LOG_E(CONTACTORS, "GPIO controlled contactor setup failed\n");
       return false;
     }
 
@@ -98,7 +98,7 @@ bool init_contactors() {
   if (contactor_control_enabled_double_battery) {
     auto second_contactors = esp32hal->SECOND_BATTERY_CONTACTORS_PIN();
     if (!esp32hal->alloc_pins(contactors, second_contactors)) {
-      DEBUG_PRINTF("Secondary battery contactor control setup failed\n");
+      LOG_E(CONTACTORS, "Secondary battery contactor control setup failed\n");
       return false;
     }
 
@@ -109,7 +109,7 @@ bool init_contactors() {
   if (contactor_control_enabled_triple_battery) {
     auto triple_contactors = esp32hal->TRIPLE_BATTERY_CONTACTORS_PIN();
     if (!esp32hal->alloc_pins(contactors, triple_contactors)) {
-      DEBUG_PRINTF("Triple battery contactor control setup failed\n");
+      LOG_E(CONTACTORS, "Triple battery contactor control setup failed\n");
       return false;
     }
 
@@ -121,7 +121,7 @@ bool init_contactors() {
   if (periodic_bms_reset || remote_bms_reset || esp32hal->always_enable_bms_power()) {
     auto pin = esp32hal->BMS_POWER();
     if (!esp32hal->alloc_pins("BMS power", pin)) {
-      DEBUG_PRINTF("BMS power setup failed\n");
+      LOG_E(CONTACTORS, "BMS power setup failed\n");
       return false;
     }
     pinMode(pin, OUTPUT);
@@ -131,13 +131,6 @@ bool init_contactors() {
   return true;
 }
 
-static void dbg_contactors(const char* state) {
-  logging.print("[");
-  logging.print(millis());
-  logging.print(" ms] contactors control: ");
-  logging.println(state);
-}
-
 // Main functions of the handle_contactors include checking if inverter allows for closing, checking battery 2, checking BMS power output, and actual contactor closing/precharge via GPIO
 void handle_contactors() {
   if (inverter && inverter->controls_contactor()) {
@@ -217,7 +210,7 @@ void handle_contactors() {
     switch (contactorStatus) {
       case START_PRECHARGE:
         set(negPin, ON, PWM_ON_DUTY);
-        dbg_contactors("NEGATIVE");
+        LOG_I(CONTACTORS, "NEGATIVE\n");
         prechargeStartTime = currentTime;
         contactorStatus = PRECHARGE;
         datalayer.system.status.contactors_engaged = 3;
@@ -226,7 +219,7 @@ void handle_contactors() {
       case PRECHARGE:
         if (currentTime - prechargeStartTime >= NEGATIVE_CONTACTOR_TIME_MS) {
           set(prechargePin, ON);
-          dbg_contactors("PRECHARGE");
+          LOG_I(CONTACTORS, "PRECHARGE\n");
           negativeStartTime = currentTime;
           contactorStatus = POSITIVE;
           datalayer.system.status.contactors_engaged = 3;
@@ -236,7 +229,7 @@ void handle_contactors() {
       case POSITIVE:
         if (currentTime - negativeStartTime >= precharge_time_ms) {
           set(posPin, ON, PWM_ON_DUTY);
-          dbg_contactors("POSITIVE");
+          LOG_I(CONTACTORS, "POSITIVE\n");
           prechargeCompletedTime = currentTime;
           contactorStatus = PRECHARGE_OFF;
           datalayer.system.status.contactors_engaged = 3;
@@ -248,7 +241,7 @@ void handle_contactors() {
           set(prechargePin, OFF);
           set(negPin, ON, pwm_hold_duty);
           set(posPin, ON, pwm_hold_duty);
-          dbg_contactors("PRECHARGE_OFF");
+          LOG_I(CONTACTORS, "PRECHARGE_OFF\n");
           contactorStatus = COMPLETED;
           datalayer.system.status.contactors_engaged = 1;
         }
@@ -328,7 +321,7 @@ void handle_BMSpower() {
       } else if (currentTime - lastPowerRemovalTime >= 10000) {
         // There's still current, and we don't want to weld the contactors, so give up.
 
-        logging.printf("BMS reset: Aborting, contactors are still under load.\n");
+        LOG_W(CONTACTORS, "BMS reset: Aborting, contactors are still under load.\n");
 
         datalayer.system.status.bms_reset_status = BMS_RESET_IDLE;
         set_event(EVENT_PERIODIC_BMS_RESET_FAILURE, 0);
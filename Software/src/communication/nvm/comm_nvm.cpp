@@ -5,11 +5,14 @@
 #include "../../charger/CanCharger.h"
 #include "../../communication/can/comm_can.h"
 #include "../../devboard/mqtt/mqtt.h"
+#include "../../devboard/sdcard/sdcard.h"
+#include "../../devboard/utils/log_levels.h"
 #include "../../devboard/wifi/wifi.h"
 #include "../../inverter/INVERTERS.h"
 #include "../contactorcontrol/comm_contactorcontrol.h"
 #include "../equipmentstopbutton/comm_equipmentstopbutton.h"
 #include "../precharge_control/precharge_control.h"
+#include "../usb/comm_usb.h"
 
 // Parameters
 Preferences settings;  // Store user settings
@@ -98,6 +101,14 @@ void init_stored_settings() {
   user_selected_inverter_deye_workaround = settings.getBool("DEYEBYD", false);
   user_selected_can_addon_crystal_frequency_mhz = settings.getUInt("CANFREQ", 8);
   user_selected_canfd_addon_crystal_frequency_mhz = settings.getUInt("CANFDFREQ", 40);
+  user_selected_can_native_rx_budget = settings.getUInt("CANRXBUDNAT", CAN_RX_BUDGET_PER_TICK);
+  user_selected_can_addon_rx_budget = settings.getUInt("CANRXBUD2515", CAN_RX_BUDGET_PER_TICK);
+  user_selected_canfd_addon_rx_budget = settings.getUInt("CANRXBUDFD", CAN_RX_BUDGET_PER_TICK);
+  user_selected_can_addon_rx_buffer_size = settings.getUInt("CANBUF2515", CAN_ADDON_RX_BUFFER_SIZE);
+  user_selected_can_flight_kb = settings.getUInt("CANFLIGHTKB", CAN_FLIGHT_DEFAULT_KB);
+  user_selected_can_flight_pre_s = settings.getUInt("CANFLIGHTPRE", CAN_FLIGHT_DEFAULT_PRE_S);
+  user_selected_can_flight_post_s = settings.getUInt("CANFLIGHTPOST", CAN_FLIGHT_DEFAULT_POST_S);
+  user_selected_can_flight_trigger = (CanFlightTrigger)settings.getUInt("CANFLIGHTTRIG", (int)CanFlightTrigger::Listed);
   user_selected_LEAF_interlock_mandatory = settings.getBool("INTERLOCKREQ", false);
   user_selected_use_estimated_SOC = settings.getBool("SOCESTIMATED", false);
   user_selected_tesla_digital_HVIL = settings.getBool("DIGITALHVIL", false);
@@ -148,6 +159,7 @@ void init_stored_settings() {
   periodic_bms_reset = settings.getBool("PERBMSRESET", false);
   remote_bms_reset = settings.getBool("REMBMSRESET", false);
   use_canfd_as_can = settings.getBool("CANFDASCAN", false);
+  use_can_hw_filters = settings.getBool("CANHWFILTER", false);
 #ifdef HW_LILYGO2CAN
   user_selected_gpioopt1 = (GPIOOPT1)settings.getUInt("GPIOOPT1", 0);
 #endif
@@ -161,10 +173,20 @@ void init_stored_settings() {
 
   datalayer.system.info.performance_measurement_active = settings.getBool("PERFPROFILE", false);
   datalayer.system.info.CAN_usb_logging_active = settings.getBool("CANLOGUSB", false);
+  user_selected_can_usb_mode = (CanUsbMode)settings.getUInt("CANUSBMODE", (int)CanUsbMode::Text);
   datalayer.system.info.usb_logging_active = settings.getBool("USBENABLED", false);
   datalayer.system.info.web_logging_active = settings.getBool("WEBENABLED", false);
+  for (int module = 0; module < LOG_MODULE_COUNT; module++) {
+    set_log_level((LogModule)module, (LogLevel)settings.getUInt(log_module_setting((LogModule)module), LOG_LEVEL_INFO));
+  }
+  set_log_output_active(datalayer.system.info.web_logging_active || datalayer.system.info.usb_logging_active);
   datalayer.system.info.CAN_SD_logging_active = settings.getBool("CANLOGSD", false);
   datalayer.system.info.SD_logging_active = settings.getBool("SDLOGENABLED", false);
+  user_selected_sd_block_size_kb = settings.getUInt("SDBLOCKKB", SD_BLOCK_SIZE_KB);
+  user_selected_sd_flush_interval_s = settings.getUInt("SDFLUSHS", SD_FLUSH_INTERVAL_S);
+  user_selected_sd_rotate_size_mb = settings.getUInt("SDROTATEMB", SD_ROTATE_SIZE_MB);
+  user_selected_sd_rotate_interval_h = settings.getUInt("SDROTATEH", 0);
+  user_selected_sd_retained_files = settings.getUInt("SDKEEPFILES", SD_RETAINED_FILES);
   datalayer.battery.status.led_mode = (led_mode_enum)settings.getUInt("LEDMODE", false);
 
   //Some early integrations need manually set allowed charge/discharge power
@@ -35,7 +35,7 @@ bool init_precharge_control() {
   auto inverter_disconnect_contactor_pin = esp32hal->INVERTER_DISCONNECT_CONTACTOR_PIN();
 
   if (!esp32hal->alloc_pins("Precharge control", hia4v1_pin, inverter_disconnect_contactor_pin)) {
-    DEBUG_PRINTF("Precharge control setup failed\n");
+    LOG_E(CONTACTORS, "Precharge control setup failed\n");
     return false;
   }
 
@@ -76,7 +76,7 @@ void handle_precharge_control(unsigned long currentMillis) {
       ledcWriteTone(hia4v1_pin, freq);  // Set frequency and set dutycycle to 50%
       prechargeStartTime = currentMillis;
       datalayer.system.status.precharge_status = AUTO_PRECHARGE_PRECHARGING;
-      logging.printf("Precharge: Starting sequence\n");
+      LOG_I(CONTACTORS, "Precharge: Starting sequence\n");
       digitalWrite(inverter_disconnect_contactor_pin, CONTACTOR_OFF);
       break;
 
@@ -101,8 +101,8 @@ void handle_precharge_control(unsigned long currentMillis) {
           freq = Precharge_max_PWM_Freq;
         if (freq < Precharge_min_PWM_Freq)
           freq = Precharge_min_PWM_Freq;
-        logging.printf("Precharge: Target: %d V  Extern: %d V  Frequency: %u\n", target_voltage / 10,
-                       external_voltage / 10, freq);
+        LOG_D(CONTACTORS, "Precharge: Target: %d V  Extern: %d V  Frequency: %u\n", target_voltage / 10,
+              external_voltage / 10, freq);
         ledcWriteTone(hia4v1_pin, freq);
       }
 
@@ -112,7 +112,7 @@ void handle_precharge_control(unsigned long currentMillis) {
         digitalWrite(hia4v1_pin, LOW);
         digitalWrite(inverter_disconnect_contactor_pin, CONTACTOR_ON);
         datalayer.system.status.precharge_status = AUTO_PRECHARGE_FAILURE;
-        logging.printf("Precharge: CRITICAL FAILURE (timeout/BMS fault) -> REQUIRES REBOOT\n");
+        LOG_E(CONTACTORS, "Precharge: CRITICAL FAILURE (timeout/BMS fault) -> REQUIRES REBOOT\n");
         set_event(EVENT_AUTOMATIC_PRECHARGE_FAILURE, 0);
         // Force stop any further precharge attempts
         datalayer.system.info.start_precharging = false;
@@ -123,13 +123,13 @@ void handle_precharge_control(unsigned long currentMillis) {
         digitalWrite(hia4v1_pin, LOW);
         digitalWrite(inverter_disconnect_contactor_pin, CONTACTOR_ON);
         datalayer.system.status.precharge_status = AUTO_PRECHARGE_IDLE;
-        logging.printf("Precharge: Disabling Precharge bms not standby/active or equipment stop\n");
+        LOG_I(CONTACTORS, "Precharge: Disabling Precharge bms not standby/active or equipment stop\n");
       } else if (datalayer.system.status.battery_allows_contactor_closing) {
         pinMode(hia4v1_pin, OUTPUT);
         digitalWrite(hia4v1_pin, LOW);
         digitalWrite(inverter_disconnect_contactor_pin, CONTACTOR_ON);
         datalayer.system.status.precharge_status = AUTO_PRECHARGE_COMPLETED;
-        logging.printf("Precharge: Disabled (contacts closed) -> COMPLETED\n");
+        LOG_I(CONTACTORS, "Precharge: Disabled (contacts closed) -> COMPLETED\n");
       }
       break;
 
@@ -140,7 +140,7 @@ void handle_precharge_control(unsigned long currentMillis) {
       if (datalayer.system.info.equipment_stop_active || datalayer.battery.status.bms_status != ACTIVE ||
           datalayer.battery.status.real_bms_status == BMS_STANDBY) {
         datalayer.system.status.precharge_status = AUTO_PRECHARGE_IDLE;
-        logging.printf("Precharge: equipment stop activated -> IDLE\n");
+        LOG_I(CONTACTORS, "Precharge: equipment stop activated -> IDLE\n");
       }
       break;
 
@@ -152,7 +152,7 @@ void handle_precharge_control(unsigned long currentMillis) {
         datalayer.system.status.precharge_status = AUTO_PRECHARGE_IDLE;
         pinMode(hia4v1_pin, OUTPUT);
         digitalWrite(hia4v1_pin, LOW);
-        logging.printf("Precharge: equipment stop activated -> IDLE\n");
+        LOG_I(CONTACTORS, "Precharge: equipment stop activated -> IDLE\n");
       }
       break;
 
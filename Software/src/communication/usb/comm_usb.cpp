@@ -0,0 +1,130 @@
+#include "comm_usb.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <algorithm>
+#include "../../datalayer/datalayer.h"
+#include "../../devboard/hal/hal.h"
+#include "../../devboard/utils/spsc_ring.h"
+#include "../../system_settings.h"
+#include "../can/CanFrameText.h"
+
+CanUsbMode user_selected_can_usb_mode = CanUsbMode::Text;
+
+// Filled by the core task (CAN frames) and any task that logs, emptied by usb_output_task. The producers take turns
+// through usb_output_lock, which is held only to copy one message.
+static SpscByteRing<USB_OUTPUT_BUFFER_SIZE>* usb_output = nullptr;
+static portMUX_TYPE usb_output_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t usb_clock_us() {
+  return (uint32_t)esp_timer_get_time();
+}
+
+static GvretSession gvret_session(NO_CAN_INTERFACE, usb_clock_us);
+static SlcanSession slcan_session;
+// Set by usb_output_task once the host asked for frames, read by the core task
+static volatile bool host_streaming = false;
+static volatile bool host_timestamps = false;
+
+static bool usb_output_write(const uint8_t* data, size_t size) {
+  portENTER_CRITICAL(&usb_output_lock);
+  const bool written = usb_output->write(data, size);
+  if (!written) {
+    datalayer.system.status.usb_output_stats.dropped_bytes += size;
+  }
+  portEXIT_CRITICAL(&usb_output_lock);
+  return written;
+}
+
+static void receive_from_host() {
+  const CanUsbReply reply = [](const uint8_t* data, size_t size) { usb_output_write(data, size); };
+  while (Serial.available() > 0) {
+    const uint8_t byte = Serial.read();
+    if (user_selected_can_usb_mode == CanUsbMode::Gvret) {
+      gvret_session.receive(byte, reply);
+    } else if (user_selected_can_usb_mode == CanUsbMode::Slcan) {
+      slcan_session.receive(byte, reply);
+    }
+  }
+
+  switch (user_selected_can_usb_mode) {
+    case CanUsbMode::Gvret:
+      host_streaming = gvret_session.streaming();
+      break;
+    case CanUsbMode::Slcan:
+      host_streaming = slcan_session.streaming();
+      host_timestamps = slcan_session.timestamps();
+      break;
+    default:
+      host_streaming = true;
+      break;
+  }
+  datalayer.system.status.usb_output_stats.host_connected = host_streaming;
+}
+
+// Low priority task that hands the buffered output to the serial port, so a slow or absent host only ever delays
+// this task and never the ones that log
+static void usb_output_task(void*) {
+  while (true) {
+    receive_from_host();
+
+    const uint8_t* data;
+    const size_t size = usb_output->peek(data);
+    const size_t written = size == 0 ? 0 : Serial.write(data, std::min<size_t>(size, USB_OUTPUT_CHUNK_SIZE));
+    usb_output->pop(written);
+
+    auto& stats = datalayer.system.status.usb_output_stats;
+    stats.bytes_sent += written;
+    stats.buffer_peak_bytes = usb_output->peak_count();
+    if (written == 0) {
+      delay(1);
+    }
+  }
+}
+
+void init_usb_output() {
+  if (!datalayer.system.info.CAN_usb_logging_active && !datalayer.system.info.usb_logging_active) {
+    return;
+  }
+
+  if (!datalayer.system.info.CAN_usb_logging_active) {
+    // Only the general log goes out, as text
+    user_selected_can_usb_mode = CanUsbMode::Text;
+  }
+  usb_output = new SpscByteRing<USB_OUTPUT_BUFFER_SIZE>();
+  datalayer.system.status.usb_output_stats.active = true;
+  host_streaming = user_selected_can_usb_mode == CanUsbMode::Text;
+  xTaskCreatePinnedToCore((TaskFunction_t)&usb_output_task, "usb_output", 3072, NULL, TASK_USB_OUTPUT_PRIO, NULL,
+                          esp32hal->WIFICORE());
+}
+
+void usb_output_can_frame(const CAN_frame& frame, CAN_Interface interface, frameDirection direction,
+                          uint64_t timestamp_us) {
+  if (usb_output == nullptr || !host_streaming) {
+    return;
+  }
+
+  uint8_t message[CAN_USB_MAX_FRAME_LENGTH];
+  size_t size;
+  switch (user_selected_can_usb_mode) {
+    case CanUsbMode::Gvret:
+      size = gvret_encode_frame(frame, interface, timestamp_us, message);
+      break;
+    case CanUsbMode::Slcan:
+      size = slcan_encode_frame(frame, host_timestamps ? (timestamp_us / 1000) % 60000 : -1, message);
+      break;
+    default:
+      size = format_can_frame_text((char*)message, frame, interface, direction, timestamp_us);
+      break;
+  }
+
+  if (!usb_output_write(message, size)) {
+    datalayer.system.status.usb_output_stats.dropped_frames++;
+  }
+}
+
+void usb_output_text(const char* text, size_t size) {
+  if (usb_output == nullptr || user_selected_can_usb_mode != CanUsbMode::Text) {
+    return;
+  }
+  usb_output_write((const uint8_t*)text, size);
+}
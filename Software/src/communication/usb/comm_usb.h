@@ -0,0 +1,32 @@
+#ifndef _COMM_USB_H_
+#define _COMM_USB_H_
+
+#include "../../devboard/utils/types.h"
+#include "../can/CanUsbProtocol.h"
+
+extern CanUsbMode user_selected_can_usb_mode;
+
+// Bytes that can wait for the USB serial port, must be a power of two
+#define USB_OUTPUT_BUFFER_SIZE 8192
+// Bytes handed to the serial port at once
+#define USB_OUTPUT_CHUNK_SIZE 256
+
+/**
+ * @brief Starts the USB output task if CAN or general logging via USB is enabled
+ *
+ * @param[in] void
+ *
+ * @return void
+ */
+void init_usb_output();
+
+// Queues a CAN frame for the USB serial port in the selected CanUsbMode. Never blocks: if the output buffer is full,
+// the frame is dropped and counted.
+void usb_output_can_frame(const CAN_frame& frame, CAN_Interface interface, frameDirection direction,
+                          uint64_t timestamp_us);
+
+// Queues general log text for the USB serial port. Never blocks, dropped if the buffer is full. Text is only sent in
+// the text mode, it would break the GVRET and SLCAN streams.
+void usb_output_text(const char* text, size_t size);
+
+#endif
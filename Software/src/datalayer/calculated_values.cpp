@@ -0,0 +1,208 @@
+#include "calculated_values.h"
+#include <Arduino.h>
+#include "../battery/BATTERIES.h"
+#include "../devboard/utils/value_mapping.h"
+#include "datalayer.h"
+
+void update_calculated_values(unsigned long currentMillis) {
+  /* Update CPU temperature*/
+  union {
+    float temp;
+    uint32_t hex;
+  } temp = {.temp = temperatureRead()};
+  if (temp.hex != 0x42555555) {
+    // Ignoring erroneous temperature value that ESP32 sometimes returns
+    datalayer.system.info.CPU_temperature = temp.temp;
+  }
+
+  /*Update free heap*/
+  datalayer.system.info.CPU_free_heap = ESP.getFreeHeap();
+
+  /* Check is remote set limits have timed out */
+  if (currentMillis > datalayer.battery.settings.remote_set_timestamp + datalayer.battery.settings.remote_set_timeout) {
+    datalayer.battery.settings.remote_settings_limit_charge = false;
+    datalayer.battery.settings.remote_settings_limit_discharge = false;
+    datalayer.battery.settings.max_remote_set_charge_dA = 0;
+    datalayer.battery.settings.max_remote_set_discharge_dA = 0;
+  }
+
+  /* Calculate allowed charge/discharge currents*/
+  if (datalayer.battery.status.voltage_dV > 10) {
+    // Only update value when we have voltage available to avoid div0. TODO: This should be based on nominal voltage
+    datalayer.battery.status.max_charge_current_dA =
+        ((datalayer.battery.status.max_charge_power_W * 100) / datalayer.battery.status.voltage_dV);
+    datalayer.battery.status.max_discharge_current_dA =
+        ((datalayer.battery.status.max_discharge_power_W * 100) / datalayer.battery.status.voltage_dV);
+  }
+
+  /* Apply remote restrictions if set*/
+  if (datalayer.battery.settings.remote_settings_limit_charge) {
+    if (datalayer.battery.status.max_charge_current_dA > datalayer.battery.settings.max_remote_set_charge_dA) {
+      datalayer.battery.status.max_charge_current_dA = datalayer.battery.settings.max_remote_set_charge_dA;
+    }
+  } else {
+    /* Restrict values from user settings if needed*/
+    if (datalayer.battery.status.max_charge_current_dA > datalayer.battery.settings.max_user_set_charge_dA) {
+      datalayer.battery.status.max_charge_current_dA = datalayer.battery.settings.max_user_set_charge_dA;
+      datalayer.battery.settings.user_settings_limit_charge = true;
+    } else {
+      datalayer.battery.settings.user_settings_limit_charge = false;
+    }
+  }
+
+  /* Apply remote restrictions if set*/
+  if (datalayer.battery.settings.remote_settings_limit_discharge) {
+    if (datalayer.battery.status.max_discharge_current_dA > datalayer.battery.settings.max_remote_set_charge_dA) {
+      datalayer.battery.status.max_discharge_current_dA = datalayer.battery.settings.max_remote_set_discharge_dA;
+    }
+  } else {
+    /* Restrict values from user settings if needed*/
+    if (datalayer.battery.status.max_discharge_current_dA > datalayer.battery.settings.max_user_set_discharge_dA) {
+      datalayer.battery.status.max_discharge_current_dA = datalayer.battery.settings.max_user_set_discharge_dA;
+      datalayer.battery.settings.user_settings_limit_discharge = true;
+    } else {
+      datalayer.battery.settings.user_settings_limit_discharge = false;
+    }
+  }
+
+  /* Calculate sum of all currents from all batteries*/
+  if (battery3) {
+    datalayer.battery.status.reported_current_dA =
+        (datalayer.battery.status.current_dA + datalayer.battery2.status.current_dA +
+         datalayer.battery3.status.current_dA);
+  } else if (battery2) {
+    datalayer.battery.status.reported_current_dA =
+        (datalayer.battery.status.current_dA + datalayer.battery2.status.current_dA);
+  } else {  // Only one battery in use
+    datalayer.battery.status.reported_current_dA = datalayer.battery.status.current_dA;
+  }
+
+  /* Calculate active power based on voltage and current*/
+  datalayer.battery.status.active_power_W =
+      (datalayer.battery.status.current_dA * (datalayer.battery.status.voltage_dV / 100));
+  /* Calculate if battery or inverter is limiting factor*/
+
+  if (datalayer.battery.status.current_dA == 0) {  //Battery idle
+    if (datalayer.battery.status.max_discharge_current_dA > 0) {
+      //We allow discharge, but inverter does nothing. Inverter is limiting
+      datalayer.battery.settings.inverter_limits_discharge = true;
+    } else {
+      datalayer.battery.settings.inverter_limits_discharge = false;
+    }
+    if (datalayer.battery.status.max_charge_current_dA > 0) {
+      //We allow charge, but inverter does nothing. Inverter is limiting
+      datalayer.battery.settings.inverter_limits_charge = true;
+    } else {
+      datalayer.battery.settings.inverter_limits_charge = false;
+    }
+  } else if (datalayer.battery.status.current_dA < 0) {  //Battery discharging
+    if (-datalayer.battery.status.current_dA < datalayer.battery.status.max_discharge_current_dA) {
+      datalayer.battery.settings.inverter_limits_discharge = true;
+    } else {
+      datalayer.battery.settings.inverter_limits_discharge = false;
+    }
+  } else {  // > 0 Battery charging
+    //If actual current is smaller than max we allow, inverter is limiting factor
+    if (datalayer.battery.status.current_dA < datalayer.battery.status.max_charge_current_dA) {
+      datalayer.battery.settings.inverter_limits_charge = true;
+    } else {
+      datalayer.battery.settings.inverter_limits_charge = false;
+    }
+  }
+
+  if (battery2) {
+    /* Calculate active power based on voltage and current for battery 2*/
+    datalayer.battery2.status.active_power_W =
+        (datalayer.battery2.status.current_dA * (datalayer.battery2.status.voltage_dV / 100));
+  }
+  if (battery3) {
+    /* Calculate active power based on voltage and current for battery 2*/
+    datalayer.battery3.status.active_power_W =
+        (datalayer.battery3.status.current_dA * (datalayer.battery3.status.voltage_dV / 100));
+  }
+
+  if (datalayer.battery.settings.soc_scaling_active) {
+    /** SOC Scaling
+   * A static version of a stochastic oscillator. The scaled SoC is calculated as:
+   * 
+   *     10000 * (real_soc - min_percentage)
+   * ---------------------------------------
+   *     (max_percentage - min_percentage)
+   * 
+   * And scaled capacity is:
+   * 
+   *     reported_total_capacity_Wh = total_capacity_Wh * (max - min) / 10000
+   *     reported_remaining_capacity_Wh = reported_total_capacity_Wh * scaled_soc / 10000
+   */
+    // Compute delta_pct and clamped_soc
+    int32_t delta_pct = datalayer.battery.settings.max_percentage - datalayer.battery.settings.min_percentage;
+    int32_t clamped_soc = CONSTRAIN(datalayer.battery.status.real_soc, datalayer.battery.settings.min_percentage,
+                                    datalayer.battery.settings.max_percentage);
+    int32_t scaled_soc = 0;
+    int32_t scaled_total_capacity = 0;
+    if (delta_pct != 0) {  //Safeguard against division by 0
+      scaled_soc = 10000 * (clamped_soc - datalayer.battery.settings.min_percentage) / delta_pct;
+    }
+
+    datalayer.battery.status.reported_soc = scaled_soc;
+
+    // If battery info is valid
+    if (datalayer.battery.info.total_capacity_Wh > 0 && datalayer.battery.status.real_soc > 0) {
+      // Scale total usable capacity
+      scaled_total_capacity = (datalayer.battery.info.total_capacity_Wh * delta_pct) / 10000;
+      datalayer.battery.info.reported_total_capacity_Wh = scaled_total_capacity;
+
+      // Scale remaining capacity based on scaled SOC
+      datalayer.battery.status.reported_remaining_capacity_Wh = (scaled_total_capacity * scaled_soc) / 10000;
+
+    } else {
+      // Fallback if scaling cannot be performed
+      datalayer.battery.info.reported_total_capacity_Wh = datalayer.battery.info.total_capacity_Wh;
+      datalayer.battery.status.reported_remaining_capacity_Wh = datalayer.battery.status.remaining_capacity_Wh;
+    }
+
+    if (battery2) {
+      // If battery info is valid
+      if (datalayer.battery2.info.total_capacity_Wh > 0 && datalayer.battery.status.real_soc > 0) {
+
+        datalayer.battery2.info.reported_total_capacity_Wh = scaled_total_capacity;
+        // Scale remaining capacity based on scaled SOC
+        datalayer.battery2.status.reported_remaining_capacity_Wh = (scaled_total_capacity * scaled_soc) / 10000;
+
+      } else {
+        // Fallback if scaling cannot be performed
+        datalayer.battery2.info.reported_total_capacity_Wh = datalayer.battery2.info.total_capacity_Wh;
+        datalayer.battery2.status.reported_remaining_capacity_Wh = datalayer.battery2.status.remaining_capacity_Wh;
+      }
+
+      //Since we are running double battery, the scaled value of battery1 becomes the sum of battery1+battery2
+      //This way the inverter connected to the system sees both batteries as one large battery
+      datalayer.battery.info.reported_total_capacity_Wh += datalayer.battery2.info.reported_total_capacity_Wh;
+      datalayer.battery.status.reported_remaining_capacity_Wh +=
+          datalayer.battery2.status.reported_remaining_capacity_Wh;
+    }
+
+  } else {  // soc_scaling_active == false. No SOC window wanted. Set scaled to same as real.
+    datalayer.battery.status.reported_soc = datalayer.battery.status.real_soc;
+    datalayer.battery.status.reported_remaining_capacity_Wh = datalayer.battery.status.remaining_capacity_Wh;
+    datalayer.battery.info.reported_total_capacity_Wh = datalayer.battery.info.total_capacity_Wh;
+
+    if (battery2) {
+      datalayer.battery2.status.reported_soc = datalayer.battery2.status.real_soc;
+      datalayer.battery2.status.reported_remaining_capacity_Wh = datalayer.battery2.status.remaining_capacity_Wh;
+      datalayer.battery2.info.reported_total_capacity_Wh = datalayer.battery2.info.total_capacity_Wh;
+    }
+  }
+
+  //Check each extra battery, and if they are at the extremes, report the SOC from these batteries instead
+  if (battery2 && datalayer.system.status.battery2_allowed_contactor_closing) {  //Battery2 is in the mix
+    if ((datalayer.battery2.status.real_soc < 100) || (datalayer.battery2.status.real_soc > 9900)) {
+      datalayer.battery.status.reported_soc = datalayer.battery2.status.real_soc;
+    }
+  }
+  if (battery3 && datalayer.system.status.battery3_allowed_contactor_closing) {  //Battery3 is in the mix
+    if ((datalayer.battery3.status.real_soc < 100) || (datalayer.battery3.status.real_soc > 9900)) {
+      datalayer.battery.status.reported_soc = datalayer.battery3.status.real_soc;
+    }
+  }
+}
@@ -0,0 +1,9 @@
+#ifndef _CALCULATED_VALUES_H_
+#define _CALCULATED_VALUES_H_
+
+// Derives the values reported to the inverter from what the batteries reported: allowed currents within the user
+// and remote limits, summed current and power, scaled SOC and capacity. Called by the core task once per second,
+// after the batteries updated their values.
+void update_calculated_values(unsigned long currentMillis);
+
+#endif
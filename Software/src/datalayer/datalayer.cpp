@@ -1,3 +1,4 @@
 #include "datalayer.h"
 
 DataLayer datalayer;
+SnapshotBuffer<DataLayer> datalayer_snapshot;
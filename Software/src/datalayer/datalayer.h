@@ -1,6 +1,7 @@
 #ifndef _DATALAYER_H_
 #define _DATALAYER_H_
 
+#include "../devboard/utils/snapshot_buffer.h"
 #include "../devboard/utils/types.h"
 #include "../system_settings.h"
 
@@ -259,16 +260,12 @@ struct DATALAYER_SHUNT_TYPE {
 };
 
 struct DATALAYER_SYSTEM_INFO_TYPE {
-  /** array with incoming CAN messages, for displaying on webserver */
-  char logged_can_messages[15000] = {0};
   /** array with type of battery used, for displaying on webserver */
   char battery_protocol[64] = {0};
   /** array with type of battery used, for displaying on webserver */
   char shunt_protocol[32] = {0};
   /** array with type of inverter brand used, for displaying on webserver */
   char inverter_brand[8] = {0};
-
-  size_t logged_can_messages_offset = 0;
   /** ESP32 main CPU temperature, for displaying on webserver and for safeties */
   float CPU_temperature = 0;
   /** ESP32 free heap amount, for displaying on webserver and for safeties */
@@ -303,6 +300,112 @@ struct DATALAYER_SYSTEM_INFO_TYPE {
   bool start_precharging = false;      //Is precharge ongoing?
 };
 
+struct DATALAYER_CAN_RX_STATS_TYPE {
+  /** True if the interface was initialized successfully and the statistics are being sampled */
+  bool active = false;
+  /** Size of the driver receive buffer, in frames */
+  uint16_t buffer_size = 0;
+  /** Highest driver receive buffer fill level seen since boot. Larger than buffer_size if it ever overflowed */
+  uint16_t buffer_high_water = 0;
+  /** Most frames drained from the interface during one core task tick */
+  uint16_t max_frames_per_tick = 0;
+  /** Total frames lost since boot because the driver or controller receive buffer was full */
+  uint32_t overruns = 0;
+  /** Frames received during the last second */
+  uint32_t frames_per_second = 0;
+};
+
+struct DATALAYER_CAN_TX_STATS_TYPE {
+  /** True if the interface was initialized successfully and the statistics are being sampled */
+  bool active = false;
+  /** Size of the software transmit queue, in frames */
+  uint16_t queue_size = 0;
+  /** Highest transmit queue fill level seen since boot */
+  uint16_t queue_high_water = 0;
+  /** Frames accepted by the controller since boot */
+  uint32_t sent = 0;
+  /** Frames accepted by the controller during the last second */
+  uint32_t frames_per_second = 0;
+  /** Total frames lost since boot because the transmit queue was full */
+  uint32_t dropped = 0;
+  /** Total frames lost since boot because the controller did not accept them within CAN_TX_MAX_WAIT_MS */
+  uint32_t expired = 0;
+  /** Total times since boot a queued frame was refused by the controller and kept for a retry */
+  uint32_t retries = 0;
+  /** Average and maximum time from queueing a frame until the controller accepted it, during the last second */
+  uint32_t latency_avg_us = 0;
+  uint32_t latency_max_us = 0;
+};
+
+/** Amount of CAN IDs listed per interface in DATALAYER_CAN_BUS_STATS_TYPE::id_rates */
+#define CAN_ID_RATE_TABLE_SIZE 16
+
+struct DATALAYER_CAN_ID_RATE_TYPE {
+  uint32_t id = 0;
+  bool ext_ID = false;
+  /** Frames with this ID received and sent during the last second */
+  uint16_t rx_per_second = 0;
+  uint16_t tx_per_second = 0;
+};
+
+struct DATALAYER_CAN_BUS_STATS_TYPE {
+  /** True if the interface was initialized successfully and the statistics are being sampled */
+  bool active = false;
+  /** Nominal (arbitration) bit rate of the interface */
+  uint32_t bitrate = 0;
+  /** Frames received and sent during the last second */
+  uint32_t frames_per_second = 0;
+  /** Bus time used during the last second, in nominal bit times. Stuff bits are estimated as the worst case */
+  uint32_t bits_per_second = 0;
+  /** Share of the last second the bus was busy, in 0.1% */
+  uint16_t utilization_dpct = 0;
+  /** Controller transmit and receive error counters */
+  uint8_t tx_error_counter = 0;
+  uint8_t rx_error_counter = 0;
+  /** Controller is error passive, one of the error counters is above 127 */
+  bool error_passive = false;
+  /** Controller is bus-off and no longer takes part in bus traffic */
+  bool bus_off = false;
+  /** Raw controller error state: TWAI STATUS register, MCP2515 EFLG register or MCP2518FD CiTREC bits 16-23 */
+  uint8_t error_flags = 0;
+  /** Distinct IDs seen during the last second. Can be more than fit in id_rates */
+  uint16_t id_count = 0;
+  /** Busiest IDs of the last second, busiest first */
+  DATALAYER_CAN_ID_RATE_TYPE id_rates[CAN_ID_RATE_TABLE_SIZE];
+};
+
+struct DATALAYER_SD_LOG_STATS_TYPE {
+  /** True if this log is being written to the SD card */
+  bool active = false;
+  /** Bytes written to the card since boot */
+  uint64_t bytes_written = 0;
+  /** Bytes written to the card during the last second */
+  uint32_t bytes_per_second = 0;
+  /** Bytes lost because the ring buffer was full or the card did not take them */
+  uint32_t dropped_bytes = 0;
+  /** Block writes the card did not complete */
+  uint32_t write_errors = 0;
+  /** Slowest block write since boot */
+  uint32_t write_latency_max_us = 0;
+  /** Times the log file was full or old enough to start a new one */
+  uint32_t files_rotated = 0;
+};
+
+struct DATALAYER_USB_OUTPUT_STATS_TYPE {
+  /** True if CAN frames or the general log are sent over USB */
+  bool active = false;
+  /** True while the host takes frames: always in text mode, after the handshake with GVRET and SLCAN */
+  bool host_connected = false;
+  /** Bytes handed to the USB serial port since boot */
+  uint64_t bytes_sent = 0;
+  /** CAN frames lost because the output buffer was full */
+  uint32_t dropped_frames = 0;
+  /** Bytes lost because the output buffer was full, CAN frames and log text */
+  uint32_t dropped_bytes = 0;
+  /** Highest amount of bytes that waited for the serial port */
+  uint32_t buffer_peak_bytes = 0;
+};
+
 struct DATALAYER_SYSTEM_STATUS_TYPE {
   /** Core task measurement variable */
   int64_t core_task_max_us = 0;
@@ -322,6 +425,8 @@ struct DATALAYER_SYSTEM_STATUS_TYPE {
   int64_t time_values_us = 0;
   /** CAN TX function measurement variable */
   int64_t time_cantx_us = 0;
+  /** Datalayer snapshot publish measurement variable, reset each 10 seconds */
+  int64_t time_snapshot_us = 0;
   /** Function measurement snapshot variable.
    * This will show the performance of OTA handling when the total time reached a new worst case
    */
@@ -343,6 +448,19 @@ struct DATALAYER_SYSTEM_STATUS_TYPE {
    */
   int64_t time_snap_cantx_us = 0;
 
+  /** CAN receive statistics, indexed by CAN_Interface. MCP2518 statistics are kept under CANFD_ADDON_MCP2518 */
+  DATALAYER_CAN_RX_STATS_TYPE can_rx_stats[NO_CAN_INTERFACE];
+  /** CAN transmit statistics, indexed by CAN_Interface. MCP2518 statistics are kept under CANFD_ADDON_MCP2518 */
+  DATALAYER_CAN_TX_STATS_TYPE can_tx_stats[NO_CAN_INTERFACE];
+  /** CAN bus utilization, per-ID rates and controller error state, indexed by CAN_Interface.
+   * MCP2518 statistics are kept under CANFD_ADDON_MCP2518 */
+  DATALAYER_CAN_BUS_STATS_TYPE can_bus_stats[NO_CAN_INTERFACE];
+  /** SD card writer statistics of the CAN log and the general log */
+  DATALAYER_SD_LOG_STATS_TYPE sd_can_log_stats;
+  DATALAYER_SD_LOG_STATS_TYPE sd_log_stats;
+  /** USB serial output statistics */
+  DATALAYER_USB_OUTPUT_STATS_TYPE usb_output_stats;
+
   /** uint8_t */
   /** A counter set each time a new message comes from inverter.
    * This value then gets decremented every second. Incase we reach 0
@@ -384,5 +502,8 @@ class DataLayer {
 };
 
 extern DataLayer datalayer;
+// Copy of the datalayer published by the core task at the end of each values update. The MQTT, webserver and display
+// tasks read from it instead of the live datalayer, so they never see a half updated cycle.
+extern SnapshotBuffer<DataLayer> datalayer_snapshot;
 
 #endif
@@ -454,14 +454,14 @@ void update_display() {
   int battery_index = current_phase % num_batteries;
   int page = (current_phase / num_batteries) % NUM_PAGES;
 
-  // Print the battery status for current battery
-  if (battery_index == 0) {
-    print_battery_status(0, datalayer.battery.status, 1, page);
-  } else if (battery_index == 1) {
-    print_battery_status(0, datalayer.battery2.status, 2, page);
-  } else {
-    print_battery_status(0, datalayer.battery3.status, 3, page);
-  }
+  // Print the battery status for current battery, copied from the datalayer snapshot
+  static DATALAYER_BATTERY_STATUS_TYPE status;
+  datalayer_snapshot.read_with([battery_index](const DataLayer& snapshot) {
+    status = battery_index == 0 ? snapshot.battery.status
+             : battery_index == 1 ? snapshot.battery2.status
+                                  : snapshot.battery3.status;
+  });
+  print_battery_status(0, status, battery_index + 1, page);
 
   write_text(0, 2, "---------------------", false);
 
@@ -57,6 +57,9 @@ static String object_id_prefix = "";
 static String device_name = "";
 static String device_id = "";
 
+// The datalayer snapshot the values are published from, refreshed each publish interval
+static DataLayer snapshot;
+
 static bool publish_common_info(void);
 static bool publish_cell_voltages(void);
 static bool publish_cell_balancing(void);
@@ -64,6 +67,7 @@ static bool publish_events(void);
 
 /** Publish global values and call callbacks for specific modules */
 static void publish_values(void) {
+  datalayer_snapshot.read(snapshot);
 
   if (mqtt_publish((topic_name + "/status").c_str(), "online", false) == false) {
     return;
@@ -140,8 +144,36 @@ SensorConfig globalSensorConfigTemplate[] = {{"bms_status", "BMS Status", "", ""
                                              {"event_level", "Event Level", "", "", "", always},
                                              {"emulator_status", "Emulator Status", "", "", "", always}};
 
+SensorConfig canSensorConfigTemplate[] = {{"rx_frames_per_second", "RX Frames Per Second", "", "", "", always},
+                                          {"rx_overruns", "RX Overruns", "", "", "", always},
+                                          {"rx_buffer_peak", "RX Buffer Peak", "", "", "", always},
+                                          {"tx_frames_per_second", "TX Frames Per Second", "", "", "", always},
+                                          {"tx_dropped", "TX Dropped", "", "", "", always},
+                                          {"tx_expired", "TX Expired", "", "", "", always},
+                                          {"tx_queue_peak", "TX Queue Peak", "", "", "", always},
+                                          {"tx_latency_max", "TX Latency Max", "", "µs", "", always},
+                                          {"bus_load", "Bus Load", "", "%", "", always},
+                                          {"bus_bits_per_second", "Bus Bits Per Second", "", "bit/s", "", always},
+                                          {"tx_error_counter", "TX Error Counter", "", "", "", always},
+                                          {"rx_error_counter", "RX Error Counter", "", "", "", always},
+                                          {"bus_off", "Bus Off", "", "", "", always}};
+
 static std::list<SensorConfig> sensorConfigs;
 
+// Prefix used for the CAN statistics of an interface, e.g. "can_native_rx_overruns"
+static const char* get_can_stats_prefix(CAN_Interface interface) {
+  switch (interface) {
+    case CAN_NATIVE:
+      return "can_native_";
+    case CAN_ADDON_MCP2515:
+      return "can_addon_";
+    case CANFD_ADDON_MCP2518:
+      return "canfd_addon_";
+    default:
+      return "can_unknown_";
+  }
+}
+
 void create_battery_sensor_configs() {
   for (auto& config : batterySensorConfigTemplate) {
     config.value_template = strdup(("{{ value_json." + std::string(config.object_id) + " }}").c_str());
@@ -165,6 +197,48 @@ void create_global_sensor_configs() {
   }
 }
 
+void create_can_sensor_configs() {
+  for (int i = 0; i < NO_CAN_INTERFACE; i++) {
+    if (!datalayer.system.status.can_rx_stats[i].active) {
+      continue;
+    }
+    for (auto config : canSensorConfigTemplate) {
+      std::string object_id = std::string(get_can_stats_prefix((CAN_Interface)i)) + config.object_id;
+      config.object_id = strdup(object_id.c_str());
+      config.name = strdup((std::string(getCANInterfaceName((CAN_Interface)i)) + " " + config.name).c_str());
+      config.value_template = strdup(("{{ value_json." + object_id + " }}").c_str());
+      sensorConfigs.push_back(config);
+    }
+  }
+}
+
+void set_can_stats_attributes(JsonDocument& doc) {
+  for (int i = 0; i < NO_CAN_INTERFACE; i++) {
+    const auto& rx_stats = snapshot.system.status.can_rx_stats[i];
+    if (!rx_stats.active) {
+      continue;
+    }
+    String prefix = get_can_stats_prefix((CAN_Interface)i);
+    doc[prefix + "rx_frames_per_second"] = rx_stats.frames_per_second;
+    doc[prefix + "rx_overruns"] = rx_stats.overruns;
+    doc[prefix + "rx_buffer_peak"] = rx_stats.buffer_high_water;
+
+    const auto& tx_stats = snapshot.system.status.can_tx_stats[i];
+    doc[prefix + "tx_frames_per_second"] = tx_stats.frames_per_second;
+    doc[prefix + "tx_dropped"] = tx_stats.dropped;
+    doc[prefix + "tx_expired"] = tx_stats.expired;
+    doc[prefix + "tx_queue_peak"] = tx_stats.queue_high_water;
+    doc[prefix + "tx_latency_max"] = tx_stats.latency_max_us;
+
+    const auto& bus_stats = snapshot.system.status.can_bus_stats[i];
+    doc[prefix + "bus_load"] = bus_stats.utilization_dpct / 10.0f;
+    doc[prefix + "bus_bits_per_second"] = bus_stats.bits_per_second;
+    doc[prefix + "tx_error_counter"] = bus_stats.tx_error_counter;
+    doc[prefix + "rx_error_counter"] = bus_stats.rx_error_counter;
+    doc[prefix + "bus_off"] = bus_stats.bus_off;
+  }
+}
+
 SensorConfig buttonConfigs[] = {{"BMSRESET", "Reset BMS", nullptr, nullptr, nullptr, nullptr},
                                 {"PAUSE", "Pause charge/discharge", nullptr, nullptr, nullptr, nullptr},
                                 {"RESUME", "Resume charge/discharge", nullptr, nullptr, nullptr, nullptr},
@@ -236,7 +310,7 @@ void set_battery_attributes(JsonDocument& doc, const DATALAYER_BATTERY_TYPE& bat
   doc["state_of_health" + suffix] = ((float)battery.status.soh_pptt) / 100.0f;
   doc["temperature_min" + suffix] = ((float)((int16_t)battery.status.temperature_min_dC)) / 10.0f;
   doc["temperature_max" + suffix] = ((float)((int16_t)battery.status.temperature_max_dC)) / 10.0f;
-  doc["cpu_temp" + suffix] = datalayer.system.info.CPU_temperature;
+  doc["cpu_temp" + suffix] = snapshot.system.info.CPU_temperature;
   doc["stat_batt_power" + suffix] = ((float)((int32_t)battery.status.active_power_W));
   doc["battery_current" + suffix] = ((float)((int16_t)battery.status.current_dA)) / 10.0f;
   doc["battery_voltage" + suffix] = ((float)battery.status.voltage_dV) / 10.0f;
@@ -253,10 +327,10 @@ void set_battery_attributes(JsonDocument& doc, const DATALAYER_BATTERY_TYPE& bat
   doc["max_charge_power" + suffix] = ((float)battery.status.max_charge_power_W);
 
   if (supports_charged) {
-    if (datalayer.battery.status.total_charged_battery_Wh != 0 &&
-        datalayer.battery.status.total_discharged_battery_Wh != 0) {
-      doc["charged_energy" + suffix] = ((float)datalayer.battery.status.total_charged_battery_Wh);
-      doc["discharged_energy" + suffix] = ((float)datalayer.battery.status.total_discharged_battery_Wh);
+    if (snapshot.battery.status.total_charged_battery_Wh != 0 &&
+        snapshot.battery.status.total_discharged_battery_Wh != 0) {
+      doc["charged_energy" + suffix] = ((float)snapshot.battery.status.total_charged_battery_Wh);
+      doc["discharged_energy" + suffix] = ((float)snapshot.battery.status.total_discharged_battery_Wh);
     }
   }
 
@@ -310,24 +384,26 @@ static bool publish_common_info(void) {
     }
 
   } else {
-    doc["bms_status"] = getBMSStatus(datalayer.battery.status.bms_status);
+    doc["bms_status"] = getBMSStatus(snapshot.battery.status.bms_status);
     doc["pause_status"] = get_emulator_pause_status();
 
     //only publish these values if BMS is active and we are comunication  with the battery (can send CAN messages to the battery)
-    if (datalayer.battery.status.CAN_battery_still_alive && allowed_to_send_CAN && esp32hal->system_booted_up()) {
-      set_battery_attributes(doc, datalayer.battery, "", battery->supports_charged_energy());
+    if (snapshot.battery.status.CAN_battery_still_alive && allowed_to_send_CAN && esp32hal->system_booted_up()) {
+      set_battery_attributes(doc, snapshot.battery, "", battery->supports_charged_energy());
     }
 
     if (battery2) {
       //only publish these values if BMS is active and we are comunication  with the battery (can send CAN messages to the battery)
-      if (datalayer.battery2.status.CAN_battery_still_alive && allowed_to_send_CAN && esp32hal->system_booted_up()) {
-        set_battery_attributes(doc, datalayer.battery2, "_2", battery2->supports_charged_energy());
+      if (snapshot.battery2.status.CAN_battery_still_alive && allowed_to_send_CAN && esp32hal->system_booted_up()) {
+        set_battery_attributes(doc, snapshot.battery2, "_2", battery2->supports_charged_energy());
       }
     }
 
     doc["event_level"] = get_event_level_string(get_event_level());
     doc["emulator_status"] = get_emulator_status_string(get_emulator_status());
 
+    set_can_stats_attributes(doc);
+
     serializeJson(doc, mqtt_msg);
     if (mqtt_publish(state_topic.c_str(), mqtt_msg, false) == false) {
       logging.println("Common info MQTT msg could not be sent");
@@ -348,9 +424,9 @@ static bool publish_cell_voltages(void) {
     if (ha_cell_voltages_published == false) {
 
       // If the cell voltage number isn't initialized...
-      if (datalayer.battery.info.number_of_cells != 0u) {
+      if (snapshot.battery.info.number_of_cells != 0u) {
 
-        for (int i = 0; i < datalayer.battery.info.number_of_cells; i++) {
+        for (int i = 0; i < snapshot.battery.info.number_of_cells; i++) {
           int cellNumber = i + 1;
           set_battery_voltage_attributes(doc, i, cellNumber, state_topic, object_id_prefix, "");
           set_common_discovery_attributes(doc);
@@ -368,9 +444,9 @@ static bool publish_cell_voltages(void) {
         successfully_published = false;
         // TODO: Combine this identical block with the previous one.
         // If the cell voltage number isn't initialized...
-        if (datalayer.battery2.info.number_of_cells != 0u) {
+        if (snapshot.battery2.info.number_of_cells != 0u) {
 
-          for (int i = 0; i < datalayer.battery2.info.number_of_cells; i++) {
+          for (int i = 0; i < snapshot.battery2.info.number_of_cells; i++) {
             int cellNumber = i + 1;
             set_battery_voltage_attributes(doc, i, cellNumber, state_topic_2, object_id_prefix + "2_", " 2");
             set_common_discovery_attributes(doc);
@@ -391,12 +467,12 @@ static bool publish_cell_voltages(void) {
   }
 
   // If cell voltages have been populated...
-  if (datalayer.battery.info.number_of_cells != 0u &&
-      datalayer.battery.status.cell_voltages_mV[datalayer.battery.info.number_of_cells - 1] != 0u) {
+  if (snapshot.battery.info.number_of_cells != 0u &&
+      snapshot.battery.status.cell_voltages_mV[snapshot.battery.info.number_of_cells - 1] != 0u) {
 
     JsonArray cell_voltages = doc["cell_voltages"].to<JsonArray>();
-    for (size_t i = 0; i < datalayer.battery.info.number_of_cells; ++i) {
-      cell_voltages.add(((float)datalayer.battery.status.cell_voltages_mV[i]) / 1000.0f);
+    for (size_t i = 0; i < snapshot.battery.info.number_of_cells; ++i) {
+      cell_voltages.add(((float)snapshot.battery.status.cell_voltages_mV[i]) / 1000.0f);
     }
 
     serializeJson(doc, mqtt_msg, sizeof(mqtt_msg));
@@ -410,12 +486,12 @@ static bool publish_cell_voltages(void) {
 
   if (battery2) {
     // If cell voltages have been populated...
-    if (datalayer.battery2.info.number_of_cells != 0u &&
-        datalayer.battery2.status.cell_voltages_mV[datalayer.battery2.info.number_of_cells - 1] != 0u) {
+    if (snapshot.battery2.info.number_of_cells != 0u &&
+        snapshot.battery2.status.cell_voltages_mV[snapshot.battery2.info.number_of_cells - 1] != 0u) {
 
       JsonArray cell_voltages = doc["cell_voltages"].to<JsonArray>();
-      for (size_t i = 0; i < datalayer.battery2.info.number_of_cells; ++i) {
-        cell_voltages.add(((float)datalayer.battery2.status.cell_voltages_mV[i]) / 1000.0f);
+      for (size_t i = 0; i < snapshot.battery2.info.number_of_cells; ++i) {
+        cell_voltages.add(((float)snapshot.battery2.status.cell_voltages_mV[i]) / 1000.0f);
       }
 
       serializeJson(doc, mqtt_msg, sizeof(mqtt_msg));
@@ -436,11 +512,11 @@ static bool publish_cell_balancing(void) {
   static String state_topic_2 = topic_name + "/balancing_data_2";
 
   // If cell balancing data is available...
-  if (datalayer.battery.info.number_of_cells != 0u) {
+  if (snapshot.battery.info.number_of_cells != 0u) {
 
     JsonArray cell_balancing = doc["cell_balancing"].to<JsonArray>();
-    for (size_t i = 0; i < datalayer.battery.info.number_of_cells; ++i) {
-      cell_balancing.add(datalayer.battery.status.cell_balancing_status[i]);
+    for (size_t i = 0; i < snapshot.battery.info.number_of_cells; ++i) {
+      cell_balancing.add(snapshot.battery.status.cell_balancing_status[i]);
     }
 
     serializeJson(doc, mqtt_msg, sizeof(mqtt_msg));
@@ -454,11 +530,11 @@ static bool publish_cell_balancing(void) {
 
   // Handle second battery if available
   if (battery2) {
-    if (datalayer.battery2.info.number_of_cells != 0u) {
+    if (snapshot.battery2.info.number_of_cells != 0u) {
 
       JsonArray cell_balancing = doc["cell_balancing"].to<JsonArray>();
-      for (size_t i = 0; i < datalayer.battery2.info.number_of_cells; ++i) {
-        cell_balancing.add(datalayer.battery2.status.cell_balancing_status[i]);
+      for (size_t i = 0; i < snapshot.battery2.info.number_of_cells; ++i) {
+        cell_balancing.add(snapshot.battery2.status.cell_balancing_status[i]);
       }
 
       serializeJson(doc, mqtt_msg, sizeof(mqtt_msg));
@@ -681,6 +757,7 @@ bool init_mqtt(void) {
   if (ha_autodiscovery_enabled) {
     create_battery_sensor_configs();
     create_global_sensor_configs();
+    create_can_sensor_configs();
   }
 
   if (mqtt_manual_topic_object_name) {
@@ -215,7 +215,8 @@ void update_machineryprotection() {
       }
     }
 
-    // Check if the BMS is still sending CAN messages. If we go 60s without messages we raise an error
+    // Check if the BMS is still sending CAN messages. If we go 60s without messages we raise an error.
+    // Batteries with supervised CAN IDs (see CanSupervisor) have the counter zeroed once a critical ID goes missing.
     if (!datalayer.battery.status.CAN_battery_still_alive) {
       set_event(EVENT_CAN_BATTERY_MISSING, can_config.battery);
     } else {
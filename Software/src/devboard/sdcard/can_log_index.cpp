@@ -0,0 +1,202 @@
+#include "can_log_index.h"
+#include <string.h>
+#include <algorithm>
+#include "../../communication/can/CanIdSet.h"
+
+// ID and extended flag, the part of id_flags that tells frames apart
+#define CAN_LOG_ID_KEY_MASK (CAN_EXT_ID_MASK | CAN_LOG_EXTENDED)
+
+static uint32_t id_hash(uint32_t id_flags) {
+  return (id_flags & CAN_LOG_ID_KEY_MASK) * 2654435761UL;
+}
+
+void can_log_index_add_id(uint32_t* bitmap, uint32_t id_flags) {
+  const uint32_t hash = id_hash(id_flags);
+  const uint8_t bit1 = hash >> 24;
+  const uint8_t bit2 = hash >> 16;
+  bitmap[bit1 / 32] |= 1UL << (bit1 % 32);
+  bitmap[bit2 / 32] |= 1UL << (bit2 % 32);
+}
+
+bool can_log_index_may_contain(const uint32_t* bitmap, uint32_t id_flags) {
+  const uint32_t hash = id_hash(id_flags);
+  const uint8_t bit1 = hash >> 24;
+  const uint8_t bit2 = hash >> 16;
+  return (bitmap[bit1 / 32] & (1UL << (bit1 % 32))) && (bitmap[bit2 / 32] & (1UL << (bit2 % 32)));
+}
+
+void CanLogIndexer::add(const uint8_t* data, size_t size, uint64_t offset) {
+  while (size > 0) {
+    if (partial_size == 0) {
+      partial_offset = offset;
+      partial_needed = CAN_LOG_BLOCK_SIZE;
+    }
+    const size_t count = std::min(size, partial_needed - partial_size);
+    memcpy(partial + partial_size, data, count);
+    partial_size += count;
+    data += count;
+    size -= count;
+    offset += count;
+
+    if (partial_size < partial_needed) {
+      continue;
+    }
+    if (partial_needed == CAN_LOG_BLOCK_SIZE) {
+      const size_t record_size = can_log_record_size(partial);
+      if (record_size == 0) {
+        // Not a record, the log is written in whole records so this does not happen
+        partial_size = 0;
+        continue;
+      }
+      if (record_size > CAN_LOG_BLOCK_SIZE) {
+        partial_needed = record_size;
+        continue;
+      }
+    }
+    add_record(partial, partial_size, partial_offset);
+    partial_size = 0;
+  }
+}
+
+void CanLogIndexer::add_record(const uint8_t* bytes, size_t size, uint64_t offset) {
+  CanLogRecord record;
+  memcpy(&record, bytes, sizeof(record));
+
+  if (segment_open && record.timestamp_us >= segment.first_timestamp_us + CAN_LOG_INDEX_SEGMENT_US) {
+    finish();
+  }
+  // Timestamps restart after a reboot, or a record was skipped between the calls
+  if (segment_open &&
+      (record.timestamp_us < segment.first_timestamp_us || offset != segment.offset + segment.size)) {
+    finish();
+  }
+
+  if (!segment_open) {
+    memset(&segment, 0, sizeof(segment));
+    segment.offset = offset;
+    segment.first_timestamp_us = record.timestamp_us;
+    segment.last_timestamp_us = record.timestamp_us;
+    segment_open = true;
+  }
+  segment.size += size;
+  segment.records++;
+  segment.last_timestamp_us = std::max(segment.last_timestamp_us, record.timestamp_us);
+  can_log_index_add_id(segment.id_bitmap, record.id_flags);
+}
+
+void CanLogIndexer::finish() {
+  if (segment_open) {
+    output(segment);
+    segment_open = false;
+  }
+}
+
+CanLogRangeReader::CanLogRangeReader(ReadAt log, ReadAt index, uint64_t from_us, uint64_t to_us,
+                                     const std::vector<uint32_t>& ids)
+    : log(log), index(index), from_us(from_us), to_us(to_us), ids(ids) {}
+
+size_t CanLogRangeReader::read(uint8_t* buffer, size_t size) {
+  size_t done = 0;
+  while (done < size) {
+    if (record_position == record_size && !next_record()) {
+      break;
+    }
+    const size_t count = std::min(size - done, record_size - record_position);
+    memcpy(buffer + done, record + record_position, count);
+    record_position += count;
+    done += count;
+  }
+  return done;
+}
+
+bool CanLogRangeReader::next_segment() {
+  CanLogIndexEntry entry;
+  while (index(index_position, (uint8_t*)&entry, sizeof(entry)) == sizeof(entry)) {
+    index_position += sizeof(entry);
+    indexed_end = std::max(indexed_end, entry.offset + entry.size);
+
+    bool wanted = entry.last_timestamp_us >= from_us && entry.first_timestamp_us <= to_us;
+    if (wanted && !ids.empty()) {
+      wanted = std::any_of(ids.begin(), ids.end(),
+                           [&entry](uint32_t id) { return can_log_index_may_contain(entry.id_bitmap, id); });
+    }
+    if (wanted) {
+      position = entry.offset;
+      end = entry.offset + entry.size;
+      read_segments++;
+      return true;
+    }
+    skipped_segments++;
+  }
+
+  // The records after the last entry are not indexed yet, or there is no index at all
+  if (!tail_done) {
+    tail_done = true;
+    position = indexed_end;
+    end = 0;
+    return true;
+  }
+  return false;
+}
+
+bool CanLogRangeReader::next_record() {
+  while (true) {
+    if (!scanning) {
+      if (!next_segment()) {
+        return false;
+      }
+      scanning = true;
+    }
+    if (end != 0 && position >= end) {
+      scanning = false;
+      continue;
+    }
+    if (!read_bytes(position, record, CAN_LOG_BLOCK_SIZE)) {
+      scanning = false;
+      continue;
+    }
+    const size_t size = can_log_record_size(record);
+    if (size == 0) {
+      position += CAN_LOG_BLOCK_SIZE;
+      continue;
+    }
+    if (size > CAN_LOG_BLOCK_SIZE &&
+        !read_bytes(position + CAN_LOG_BLOCK_SIZE, record + CAN_LOG_BLOCK_SIZE, size - CAN_LOG_BLOCK_SIZE)) {
+      scanning = false;
+      continue;
+    }
+    position += size;
+
+    CanLogRecord header;
+    memcpy(&header, record, sizeof(header));
+    if (record_matches(header)) {
+      record_size = size;
+      record_position = 0;
+      return true;
+    }
+  }
+}
+
+bool CanLogRangeReader::record_matches(const CanLogRecord& header) const {
+  if (header.timestamp_us < from_us || header.timestamp_us > to_us) {
+    return false;
+  }
+  if (ids.empty()) {
+    return true;
+  }
+  const uint32_t key = header.id_flags & CAN_LOG_ID_KEY_MASK;
+  return std::find(ids.begin(), ids.end(), key) != ids.end();
+}
+
+bool CanLogRangeReader::read_bytes(uint64_t offset, uint8_t* out, size_t size) {
+  // Records are read from a chunk of the log, so the SD card is read in sectors and not per record
+  if (offset < chunk_offset || offset + size > chunk_offset + chunk_size) {
+    chunk_offset = offset;
+    chunk_size = log(offset, chunk, sizeof(chunk));
+    if (chunk_size < size) {
+      return false;
+    }
+  }
+  memcpy(out, chunk + (offset - chunk_offset), size);
+  return true;
+}
@@ -0,0 +1,115 @@
+#ifndef CAN_LOG_INDEX_H
+#define CAN_LOG_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include <vector>
+#include "can_log_record.h"
+
+// Side index of the binary CAN log, so a time window can be read without going through the whole log. The log is cut
+// in segments of CAN_LOG_INDEX_SEGMENT_US of timestamps. Each segment gets an entry with its place in the log file,
+// its time range and a bitmap of the IDs in it. Timestamps restart at every boot, so a window can match several
+// parts of a log that spans reboots.
+typedef struct {
+  uint64_t offset;  // First record of the segment in the log file
+  uint32_t size;    // Bytes of records in the segment
+  uint32_t records;
+  uint64_t first_timestamp_us;  // Lowest and highest timestamp in the segment
+  uint64_t last_timestamp_us;
+  uint32_t id_bitmap[8];  // Bloom filter of the IDs, see can_log_index_id_bits()
+} CanLogIndexEntry;
+
+static_assert(sizeof(CanLogIndexEntry) == 64, "CanLogIndexEntry should stay 64 bytes");
+
+#define CAN_LOG_INDEX_SEGMENT_US 10000000ULL
+
+// Sets the two bloom filter bits of an ID in bitmap
+void can_log_index_add_id(uint32_t* bitmap, uint32_t id_flags);
+// False if the ID is certainly not in the segment
+bool can_log_index_may_contain(const uint32_t* bitmap, uint32_t id_flags);
+
+// Builds the index while the log is written, from the same bytes that go to the log file
+class CanLogIndexer {
+ public:
+  typedef std::function<void(const CanLogIndexEntry& entry)> Output;
+
+  explicit CanLogIndexer(Output output) : output(output) {}
+
+  // Data as appended to the log file at offset. Records may be split over several calls
+  void add(const uint8_t* data, size_t size, uint64_t offset);
+
+  // Outputs the open segment, e.g. before the log file is rotated. The next record starts a new segment
+  void finish();
+
+  // Forgets the open segment, after the log was deleted
+  void reset() {
+    segment_open = false;
+    partial_size = 0;
+  }
+
+  // False while only part of a record was added
+  bool at_record_boundary() const { return partial_size == 0; }
+
+ private:
+  void add_record(const uint8_t* record, size_t size, uint64_t offset);
+
+  Output output;
+  CanLogIndexEntry segment;
+  bool segment_open = false;
+  uint8_t partial[CAN_LOG_MAX_RECORD_SIZE];
+  size_t partial_size = 0;
+  size_t partial_needed = 0;
+  uint64_t partial_offset = 0;
+};
+
+// Reads the records of a time window, optionally only some IDs, using the index to skip the rest of the log.
+// Segments written after the last index entry are scanned completely. Works as the reader of a CanLogTextStream.
+class CanLogRangeReader {
+ public:
+  // Reads up to size bytes at offset, returns the amount read, less at the end of the file
+  typedef std::function<size_t(uint64_t offset, uint8_t* buffer, size_t size)> ReadAt;
+
+  // Timestamps are inclusive. ids with CAN_LOG_EXTENDED set for extended IDs, empty for all IDs
+  CanLogRangeReader(ReadAt log, ReadAt index, uint64_t from_us, uint64_t to_us, const std::vector<uint32_t>& ids);
+
+  // Copies up to size bytes of matching records, returns 0 at the end
+  size_t read(uint8_t* buffer, size_t size);
+
+  uint32_t segments_read() const { return read_segments; }
+  uint32_t segments_skipped() const { return skipped_segments; }
+
+ private:
+  bool next_segment();
+  bool next_record();
+  bool record_matches(const CanLogRecord& record) const;
+  bool read_bytes(uint64_t offset, uint8_t* out, size_t size);
+
+  ReadAt log;
+  ReadAt index;
+  uint64_t from_us;
+  uint64_t to_us;
+  std::vector<uint32_t> ids;
+
+  uint64_t index_position = 0;
+  // End of the indexed part of the log
+  uint64_t indexed_end = 0;
+  bool tail_done = false;
+  // Part of the log still to be scanned, end 0 for up to the end of the file
+  uint64_t position = 0;
+  uint64_t end = 0;
+  bool scanning = false;
+  // Bytes already read ahead from the log
+  uint8_t chunk[512];
+  uint64_t chunk_offset = 0;
+  size_t chunk_size = 0;
+
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  size_t record_size = 0;
+  size_t record_position = 0;
+
+  uint32_t read_segments = 0;
+  uint32_t skipped_segments = 0;
+};
+
+#endif  // CAN_LOG_INDEX_H
@@ -0,0 +1,211 @@
+#include "can_log_record.h"
+#include "../../communication/can/CanIdSet.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+size_t can_log_encode(const CAN_frame& frame, CAN_Interface interface, frameDirection direction, uint64_t timestamp_us,
+                      uint8_t* out) {
+  const uint8_t length = std::min<uint8_t>(frame.DLC, 64);
+
+  CanLogRecord record;
+  record.timestamp_us = timestamp_us;
+  record.id_flags = (frame.ID & CAN_EXT_ID_MASK) | (frame.ext_ID ? CAN_LOG_EXTENDED : 0) |
+                    (direction == MSG_TX ? CAN_LOG_TX : 0) | (frame.FD ? CAN_LOG_FD : 0);
+  record.interface = interface;
+  record.length = length;
+  record.magic = CAN_LOG_MAGIC;
+  memcpy(record.data, frame.data.u8, sizeof(record.data));
+  memcpy(out, &record, sizeof(record));
+
+  if (length <= sizeof(record.data)) {
+    return CAN_LOG_BLOCK_SIZE;
+  }
+  const size_t rest = length - sizeof(record.data);
+  const size_t size = CAN_LOG_BLOCK_SIZE + (rest + CAN_LOG_BLOCK_SIZE - 1) / CAN_LOG_BLOCK_SIZE * CAN_LOG_BLOCK_SIZE;
+  memcpy(out + CAN_LOG_BLOCK_SIZE, frame.data.u8 + sizeof(record.data), rest);
+  memset(out + CAN_LOG_BLOCK_SIZE + rest, 0, size - CAN_LOG_BLOCK_SIZE - rest);
+  return size;
+}
+
+size_t can_log_record_size(const uint8_t* block) {
+  CanLogRecord record;
+  memcpy(&record, block, sizeof(record));
+  if (record.magic != CAN_LOG_MAGIC || record.length > 64) {
+    return 0;
+  }
+  if (record.length <= sizeof(record.data)) {
+    return CAN_LOG_BLOCK_SIZE;
+  }
+  const size_t rest = record.length - sizeof(record.data);
+  return CAN_LOG_BLOCK_SIZE + (rest + CAN_LOG_BLOCK_SIZE - 1) / CAN_LOG_BLOCK_SIZE * CAN_LOG_BLOCK_SIZE;
+}
+
+uint64_t can_log_decode(const uint8_t* record_bytes, CAN_frame& frame, CAN_Interface& interface,
+                        frameDirection& direction) {
+  CanLogRecord record;
+  memcpy(&record, record_bytes, sizeof(record));
+
+  frame = {};
+  frame.ID = record.id_flags & CAN_EXT_ID_MASK;
+  frame.ext_ID = (record.id_flags & CAN_LOG_EXTENDED) != 0;
+  frame.FD = (record.id_flags & CAN_LOG_FD) != 0;
+  frame.DLC = record.length;
+  memcpy(frame.data.u8, record.data, sizeof(record.data));
+  if (record.length > sizeof(record.data)) {
+    memcpy(frame.data.u8 + sizeof(record.data), record_bytes + CAN_LOG_BLOCK_SIZE, record.length - sizeof(record.data));
+  }
+  interface = (CAN_Interface)record.interface;
+  direction = (record.id_flags & CAN_LOG_TX) ? MSG_TX : MSG_RX;
+  return record.timestamp_us;
+}
+
+size_t can_log_format_text(const uint8_t* record_bytes, char* out) {
+  CanLogRecord record;
+  memcpy(&record, record_bytes, sizeof(record));
+
+  // The payload continues in the blocks after the record
+  uint8_t data[64];
+  memcpy(data, record.data, sizeof(record.data));
+  if (record.length > sizeof(record.data)) {
+    memcpy(data + sizeof(record.data), record_bytes + CAN_LOG_BLOCK_SIZE, record.length - sizeof(record.data));
+  }
+  return format_can_frame_text(out, record.timestamp_us, (record.id_flags & CAN_LOG_TX) != 0, record.interface,
+                               record.id_flags, data, record.length);
+}
+
+static inline int hex_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  return -1;
+}
+
+static inline bool is_digit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+size_t can_log_parse_text(const char* line, size_t length, uint8_t* out) {
+  const char* p = line;
+  const char* end = line + length;
+  auto skip_spaces = [&]() {
+    while (p < end && (*p == ' ' || *p == '\t')) {
+      p++;
+    }
+  };
+
+  // (1700000000.123456)
+  skip_spaces();
+  if (p == end || *p++ != '(' || p == end || !is_digit(*p)) {
+    return 0;
+  }
+  uint64_t seconds = 0;
+  while (p < end && is_digit(*p)) {
+    seconds = seconds * 10 + (*p++ - '0');
+  }
+  uint32_t microseconds = 0;
+  int fraction_digits = 0;
+  if (p < end && *p == '.') {
+    p++;
+    for (; p < end && is_digit(*p); p++) {
+      if (fraction_digits < 6) {
+        microseconds = microseconds * 10 + (*p - '0');
+        fraction_digits++;
+      }
+    }
+  }
+  for (; fraction_digits < 6; fraction_digits++) {
+    microseconds *= 10;
+  }
+  if (p == end || *p++ != ')') {
+    return 0;
+  }
+
+  // RX0, the interface times two plus one for TX
+  skip_spaces();
+  bool tx = false;
+  uint32_t column = 0;
+  if (end - p >= 3 && (p[0] == 'R' || p[0] == 'T') && p[1] == 'X' && is_digit(p[2])) {
+    tx = p[0] == 'T';
+    for (p += 2; p < end && is_digit(*p); p++) {
+      column = column * 10 + (*p - '0');
+    }
+    skip_spaces();
+  }
+
+  CAN_frame frame = {};
+  int digits = 0;
+  for (int value; p < end && (value = hex_value(*p)) >= 0; p++, digits++) {
+    frame.ID = (frame.ID << 4) | value;
+  }
+  if (digits == 0 || digits > 8 || frame.ID > CAN_EXT_ID_MASK) {
+    return 0;
+  }
+  frame.ext_ID = frame.ID > 0x7FF;
+
+  // [8] 00 11 22 33 44 55 66 77
+  skip_spaces();
+  if (p == end || *p++ != '[' || p == end || !is_digit(*p)) {
+    return 0;
+  }
+  uint32_t data_length = 0;
+  while (p < end && is_digit(*p)) {
+    data_length = data_length * 10 + (*p++ - '0');
+  }
+  if (p == end || *p++ != ']' || data_length > 64) {
+    return 0;
+  }
+  frame.DLC = data_length;
+  frame.FD = data_length > 8;
+  for (uint32_t i = 0; i < data_length; i++) {
+    skip_spaces();
+    if (end - p < 2 || hex_value(p[0]) < 0 || hex_value(p[1]) < 0) {
+      return 0;
+    }
+    frame.data.u8[i] = hex_value(p[0]) << 4 | hex_value(p[1]);
+    p += 2;
+  }
+
+  return can_log_encode(frame, (CAN_Interface)(column / 2), tx ? MSG_TX : MSG_RX, seconds * 1000000 + microseconds,
+                        out);
+}
+
+size_t CanLogTextStream::fill(uint8_t* buffer, size_t max_length) {
+  size_t filled = 0;
+  while (filled < max_length) {
+    if (line_position == line_length && !next_line()) {
+      break;
+    }
+    const size_t count = std::min(max_length - filled, line_length - line_position);
+    memcpy(buffer + filled, line + line_position, count);
+    line_position += count;
+    filled += count;
+  }
+  return filled;
+}
+
+bool CanLogTextStream::next_line() {
+  while (true) {
+    if (reader(record, CAN_LOG_BLOCK_SIZE) != CAN_LOG_BLOCK_SIZE) {
+      return false;
+    }
+    const size_t size = can_log_record_size(record);
+    if (size == 0) {
+      skipped++;
+      continue;
+    }
+    if (size > CAN_LOG_BLOCK_SIZE &&
+        reader(record + CAN_LOG_BLOCK_SIZE, size - CAN_LOG_BLOCK_SIZE) != size - CAN_LOG_BLOCK_SIZE) {
+      return false;
+    }
+    line_length = can_log_format_text(record, line);
+    line_position = 0;
+    return true;
+  }
+}
@@ -0,0 +1,77 @@
+#ifndef CAN_LOG_RECORD_H
+#define CAN_LOG_RECORD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include "../../communication/can/CanFrameText.h"
+#include "../utils/types.h"
+
+// Binary CAN log as written to the SD card. Every frame is one 24 byte record. CAN-FD frames with more than 8 data
+// bytes continue their payload in 24 byte blocks right behind it, so the log is a plain sequence of fixed-size
+// blocks. Records are little endian, as stored by the ESP32.
+typedef struct {
+  uint64_t timestamp_us;  // Receive time (esp_timer), or send time for TX frames
+  uint32_t id_flags;      // ID in bits 0-28, CAN_LOG_EXTENDED, CAN_LOG_TX, CAN_LOG_FD
+  uint8_t interface;      // CAN_Interface
+  uint8_t length;         // Data bytes, 0 ... 64
+  uint16_t magic;         // CAN_LOG_MAGIC, marks the start of a record
+  uint8_t data[8];
+} CanLogRecord;
+
+static_assert(sizeof(CanLogRecord) == 24, "CanLogRecord should stay 24 bytes");
+
+#define CAN_LOG_BLOCK_SIZE 24
+#define CAN_LOG_MAGIC 0xCA4E
+#define CAN_LOG_EXTENDED (1UL << 29)
+#define CAN_LOG_TX (1UL << 30)
+#define CAN_LOG_FD (1UL << 31)
+// A frame with 64 data bytes takes a record and 3 continuation blocks
+#define CAN_LOG_MAX_RECORD_SIZE (4 * CAN_LOG_BLOCK_SIZE)
+// Longest text line
+#define CAN_LOG_MAX_LINE_LENGTH CAN_FRAME_TEXT_MAX_LENGTH
+
+// Writes the frame as a record to out, which must hold CAN_LOG_MAX_RECORD_SIZE bytes. Returns the record size.
+size_t can_log_encode(const CAN_frame& frame, CAN_Interface interface, frameDirection direction, uint64_t timestamp_us,
+                      uint8_t* out);
+
+// Size of the record starting with this block, 0 if the block does not start a record
+size_t can_log_record_size(const uint8_t* block);
+
+// Reads a complete record back into a frame, the reverse of can_log_encode(). Returns the timestamp of the record.
+uint64_t can_log_decode(const uint8_t* record, CAN_frame& frame, CAN_Interface& interface, frameDirection& direction);
+
+// Formats a complete record as a candump style line with format_can_frame_text(), like the other CAN logs:
+// "(1700000000.123456) RX0 7FF [8] 00 11 22 33 44 55 66 77\n". Returns the line length.
+size_t can_log_format_text(const uint8_t* record, char* out);
+
+// Reads a line as written by can_log_format_text() back into a record, e.g. from an uploaded log. Also takes lower case
+// hex and lines without the RX/TX column. Returns the record size, 0 if the line is not a frame (comment, torn line).
+size_t can_log_parse_text(const char* line, size_t length, uint8_t* out);
+
+// Turns a binary log into text while it is read, for streaming the log to a web client piece by piece
+class CanLogTextStream {
+ public:
+  // Reads up to size bytes of the log, returns the amount read, 0 at the end
+  typedef std::function<size_t(uint8_t* buffer, size_t size)> Reader;
+
+  explicit CanLogTextStream(Reader reader) : reader(reader) {}
+
+  // Fills buffer with up to max_length bytes of text, returns 0 once the whole log was converted
+  size_t fill(uint8_t* buffer, size_t max_length);
+
+  // Blocks skipped because they did not start a record, e.g. after a torn write
+  uint32_t skipped_blocks() const { return skipped; }
+
+ private:
+  bool next_line();
+
+  Reader reader;
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  char line[CAN_LOG_MAX_LINE_LENGTH];
+  size_t line_length = 0;
+  size_t line_position = 0;
+  uint32_t skipped = 0;
+};
+
+#endif  // CAN_LOG_RECORD_H
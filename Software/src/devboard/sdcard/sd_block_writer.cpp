@@ -0,0 +1,177 @@
+#include "sd_block_writer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+SdBlockWriter::~SdBlockWriter() {
+  free(block);
+}
+
+bool SdBlockWriter::begin(const SdBlockWriterConfig& new_config) {
+  config = new_config;
+  config.block_size = std::max<size_t>(config.block_size / 512 * 512, 512);
+
+  free(block);
+  block = (uint8_t*)malloc(config.block_size);
+  fill = 0;
+  return block != nullptr;
+}
+
+void SdBlockWriter::append(const uint8_t* data, size_t size) {
+  if (block == nullptr) {
+    statistics.dropped_bytes += size;
+    return;
+  }
+
+  while (size > 0) {
+    if (!ensure_open()) {
+      statistics.dropped_bytes += size;
+      return;
+    }
+    if (fill == 0 && unsynced_since_us == 0) {
+      unsynced_since_us = clock_us();
+    }
+
+    // Blocks end at a multiple of the block size in the file, so appending to an existing file realigns the writes
+    const size_t block_end = config.block_size - (file_size % config.block_size);
+    const size_t count = std::min(size, block_end - fill);
+    memcpy(block + fill, data, count);
+    fill += count;
+    data += count;
+    size -= count;
+
+    if (fill == block_end) {
+      write_block();
+    }
+  }
+}
+
+void SdBlockWriter::poll(bool may_rotate) {
+  const uint64_t now_us = clock_us();
+  count_throughput(now_us);
+
+  if (!open) {
+    return;
+  }
+
+  if (unsynced_since_us != 0 && now_us - unsynced_since_us >= (uint64_t)config.flush_interval_ms * 1000) {
+    write_block();
+    storage.flush();
+    unsynced_since_us = 0;
+  }
+
+  const uint64_t position = file_size + fill;
+  if (!may_rotate || position == 0) {
+    return;
+  }
+  if ((config.rotate_size != 0 && position >= config.rotate_size) ||
+      (config.rotate_interval_ms != 0 && now_us - opened_us >= (uint64_t)config.rotate_interval_ms * 1000)) {
+    rotate();
+  }
+}
+
+void SdBlockWriter::close() {
+  if (!open) {
+    return;
+  }
+  write_block();
+  storage.flush();
+  storage.close();
+  open = false;
+  unsynced_since_us = 0;
+}
+
+uint64_t SdBlockWriter::position() {
+  ensure_open();
+  return file_size + fill;
+}
+
+void SdBlockWriter::remove_all() {
+  close();
+  fill = 0;
+  storage.remove(path);
+  char name[64];
+  for (uint8_t i = 1; i <= config.retained_files; i++) {
+    rotated_name(path, i, name, sizeof(name));
+    storage.remove(name);
+  }
+}
+
+void SdBlockWriter::rotated_name(const char* path, uint8_t index, char* out, size_t out_size) {
+  // The number goes in front of the extension, so the rotated files keep it
+  const char* slash = strrchr(path, '/');
+  const char* dot = strrchr(path, '.');
+  if (dot == nullptr || (slash != nullptr && dot < slash)) {
+    dot = path + strlen(path);
+  }
+  snprintf(out, out_size, "%.*s.%u%s", (int)(dot - path), path, index, dot);
+}
+
+bool SdBlockWriter::ensure_open() {
+  if (open) {
+    return true;
+  }
+  if (!storage.open(path)) {
+    return false;
+  }
+  open = true;
+  file_size = storage.size();
+  opened_us = clock_us();
+  return true;
+}
+
+void SdBlockWriter::write_block() {
+  if (fill == 0) {
+    return;
+  }
+
+  const uint64_t start_us = clock_us();
+  const size_t written = storage.write(block, fill);
+  const uint64_t end_us = clock_us();
+
+  statistics.write_latency_max_us = std::max<uint32_t>(statistics.write_latency_max_us, end_us - start_us);
+  statistics.bytes_written += written;
+  window_bytes += written;
+  if (written < fill) {
+    statistics.dropped_bytes += fill - written;
+    statistics.write_errors++;
+  }
+  file_size += written;
+  fill = 0;
+}
+
+void SdBlockWriter::rotate() {
+  close();
+
+  char from[64];
+  char to[64];
+  if (config.retained_files == 0) {
+    storage.remove(path);
+  } else {
+    rotated_name(path, config.retained_files, to, sizeof(to));
+    storage.remove(to);
+    for (uint8_t i = config.retained_files - 1; i >= 1; i--) {
+      rotated_name(path, i, from, sizeof(from));
+      if (storage.exists(from)) {
+        storage.rename(from, to);
+      }
+      strcpy(to, from);
+    }
+    storage.rename(path, to);
+  }
+  statistics.files_rotated++;
+}
+
+void SdBlockWriter::count_throughput(uint64_t now_us) {
+  if (window_start_us == 0) {
+    window_start_us = now_us;
+    return;
+  }
+  const uint64_t elapsed_us = now_us - window_start_us;
+  if (elapsed_us >= 1000000) {
+    statistics.bytes_per_second = (uint64_t)window_bytes * 1000000 / elapsed_us;
+    window_bytes = 0;
+    window_start_us = now_us;
+  }
+}
@@ -0,0 +1,108 @@
+#ifndef SD_BLOCK_WRITER_H
+#define SD_BLOCK_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// File access used by SdBlockWriter. Implemented on SD_MMC by sdcard.cpp, and in memory by the tests
+class SdLogStorage {
+ public:
+  virtual ~SdLogStorage() = default;
+  // Opens path for appending, creating it if needed
+  virtual bool open(const char* path) = 0;
+  virtual void close() = 0;
+  // Size of the open file
+  virtual uint64_t size() = 0;
+  virtual size_t write(const uint8_t* data, size_t size) = 0;
+  // Commits written data and the file size to the FAT
+  virtual void flush() = 0;
+  virtual bool exists(const char* path) = 0;
+  virtual bool rename(const char* from, const char* to) = 0;
+  virtual bool remove(const char* path) = 0;
+};
+
+struct SdBlockWriterConfig {
+  // Bytes gathered before they are written, a multiple of the 512 byte sector
+  size_t block_size = 16 * 1024;
+  // A partial block is written and the file flushed once its oldest byte is this old
+  uint32_t flush_interval_ms = 2000;
+  // Start a new file once the current one reaches this size or age, 0 to never rotate on it
+  uint64_t rotate_size = 0;
+  uint32_t rotate_interval_ms = 0;
+  // Older files kept as <name>.1<ext> (newest) ... <name>.<retained_files><ext>
+  uint8_t retained_files = 4;
+};
+
+struct SdBlockWriterStats {
+  uint64_t bytes_written = 0;
+  // Bytes written to the card during the last full second
+  uint32_t bytes_per_second = 0;
+  // Bytes the card did not take
+  uint32_t dropped_bytes = 0;
+  uint32_t write_errors = 0;
+  uint32_t write_latency_max_us = 0;
+  uint32_t files_rotated = 0;
+};
+
+// Gathers log data into blocks aligned to the file offset and writes them whole, flushing on a time policy instead of
+// after every piece of data, and rotates the file by size or age keeping a bounded number of older files.
+// Used from the logging task only.
+class SdBlockWriter {
+ public:
+  SdBlockWriter(SdLogStorage& storage, const char* path, uint64_t (*clock_us)())
+      : storage(storage), path(path), clock_us(clock_us) {}
+  ~SdBlockWriter();
+
+  // Allocates the block buffer, returns false if there is not enough memory
+  bool begin(const SdBlockWriterConfig& config);
+
+  // Copies data into the current block, writing the block when it is full
+  void append(const uint8_t* data, size_t size);
+
+  // Applies the flush and rotation policy, call regularly also when there is no data. Pass false for may_rotate while
+  // a record is only partly appended, so records never span two files
+  void poll(bool may_rotate = true);
+
+  // Offset in the file of the next appended byte, opens the file if needed
+  uint64_t position();
+
+  // Starts a new file right away, like the size and age policy does
+  void start_new_file() { rotate(); }
+
+  // Writes what is buffered and closes the file, e.g. before the log is exported or deleted
+  void close();
+
+  // Closes and deletes the file and all rotated files
+  void remove_all();
+
+  const SdBlockWriterStats& stats() const { return statistics; }
+
+  // "/canlog.bin", 2 -> "/canlog.2.bin"
+  static void rotated_name(const char* path, uint8_t index, char* out, size_t out_size);
+
+ private:
+  bool ensure_open();
+  void write_block();
+  void rotate();
+  void count_throughput(uint64_t now_us);
+
+  SdLogStorage& storage;
+  const char* path;
+  uint64_t (*clock_us)();
+  SdBlockWriterConfig config;
+
+  uint8_t* block = nullptr;
+  size_t fill = 0;
+  bool open = false;
+  // Size of the file including what was written but not flushed yet
+  uint64_t file_size = 0;
+  uint64_t opened_us = 0;
+  // Time of the oldest byte that is buffered or written without a flush, 0 if there is none
+  uint64_t unsynced_since_us = 0;
+
+  uint64_t window_start_us = 0;
+  uint32_t window_bytes = 0;
+  SdBlockWriterStats statistics;
+};
+
+#endif  // SD_BLOCK_WRITER_H
@@ -1,120 +1,191 @@
 #include "sdcard.h"
+#include <algorithm>
+#include "esp_timer.h"
+#include "can_log_index.h"
 #include "freertos/ringbuf.h"
+#include "sd_block_writer.h"
+#include "../utils/logging.h"
+
+uint16_t user_selected_sd_block_size_kb = SD_BLOCK_SIZE_KB;
+uint16_t user_selected_sd_flush_interval_s = SD_FLUSH_INTERVAL_S;
+uint16_t user_selected_sd_rotate_size_mb = SD_ROTATE_SIZE_MB;
+uint16_t user_selected_sd_rotate_interval_h = 0;
+uint16_t user_selected_sd_retained_files = SD_RETAINED_FILES;
+
+// SdLogStorage on the SD card, one per log file
+class SdMmcLogStorage : public SdLogStorage {
+ public:
+  bool open(const char* path) override {
+    file = SD_MMC.open(path, FILE_APPEND);
+    return (bool)file;
+  }
+  void close() override { file.close(); }
+  uint64_t size() override { return file.size(); }
+  size_t write(const uint8_t* data, size_t size) override { return file.write(data, size); }
+  void flush() override { file.flush(); }
+  bool exists(const char* path) override { return SD_MMC.exists(path); }
+  bool rename(const char* from, const char* to) override { return SD_MMC.rename(from, to); }
+  bool remove(const char* path) override { return SD_MMC.remove(path); }
+
+ private:
+  File file;
+};
+
+static uint64_t sd_clock_us() {
+  return esp_timer_get_time();
+}
+
+SdMmcLogStorage can_log_storage;
+SdMmcLogStorage log_storage;
+SdBlockWriter can_log_writer(can_log_storage, CAN_LOG_FILE, sd_clock_us);
+SdBlockWriter log_writer(log_storage, LOG_FILE, sd_clock_us);
+
+SdMmcLogStorage can_index_storage;
+SdBlockWriter can_index_writer(can_index_storage, CAN_LOG_INDEX_FILE, sd_clock_us);
+CanLogIndexer can_log_indexer(
+    [](const CanLogIndexEntry& entry) { can_index_writer.append((const uint8_t*)&entry, sizeof(entry)); });
+
+SdMmcLogStorage can_flight_storage;
+SdBlockWriter can_flight_writer(can_flight_storage, CAN_FLIGHT_FILE, sd_clock_us);
+static bool can_flight_writer_ready = false;
 
-File can_log_file;
-File log_file;
 RingbufHandle_t can_bufferHandle;
 RingbufHandle_t log_bufferHandle;
 
-bool can_logging_paused = false;
-bool can_file_open = false;
-bool delete_can_file = false;
+// Requests from the webserver, carried out by the logging task
+volatile bool can_logging_paused = false;
+volatile bool can_writer_closed = false;
+volatile bool delete_can_file = false;
 
-bool logging_paused = false;
-bool log_file_open = false;
-bool delete_log_file = false;
+volatile bool logging_paused = false;
+volatile bool log_writer_closed = false;
+volatile bool delete_log_file = false;
 
 bool sd_card_active = false;
 
+// Bytes that did not fit in the ring buffers
+volatile uint32_t can_log_dropped_bytes = 0;
+volatile uint32_t log_dropped_bytes = 0;
+
+// Waits until the logging task has written what it buffered and closed the file
+static void wait_until_closed(volatile bool& closed) {
+  for (int i = 0; i < SD_PAUSE_WAIT_MS / 10 && !closed; i++) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+}
+
 void delete_can_log() {
-  can_logging_paused = true;
   delete_can_file = true;
 }
 
 void resume_can_writing() {
   can_logging_paused = false;
-  can_log_file = SD_MMC.open(CAN_LOG_FILE, FILE_APPEND);
-  can_file_open = true;
 }
 
 void pause_can_writing() {
+  can_writer_closed = false;
   can_logging_paused = true;
+  if (sd_card_active) {
+    wait_until_closed(can_writer_closed);
+  }
 }
 
 void delete_log() {
-  logging_paused = true;
-  if (log_file_open) {
-    log_file.close();
-    log_file_open = false;
-  }
-  SD_MMC.remove(LOG_FILE);
-  logging_paused = false;
+  delete_log_file = true;
 }
 
 void resume_log_writing() {
   logging_paused = false;
-  log_file = SD_MMC.open(LOG_FILE, FILE_APPEND);
-  log_file_open = true;
 }
 
 void pause_log_writing() {
+  log_writer_closed = false;
   logging_paused = true;
+  if (sd_card_active) {
+    wait_until_closed(log_writer_closed);
+  }
 }
 
-void add_can_frame_to_buffer(CAN_frame frame, frameDirection msgDir) {
+void add_can_frame_to_buffer(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir) {
 
   if (!sd_card_active)
     return;
 
-  unsigned long currentTime = millis();
-  static char messagestr_buffer[32];
-  size_t size = 0;
-  size = snprintf(messagestr_buffer + size, sizeof(messagestr_buffer) - size, "(%lu.%03lu) %s %lX [%u] ",
-                  currentTime / 1000, currentTime % 1000, (msgDir == MSG_RX ? "RX0" : "TX1"), frame.ID, frame.DLC);
+  // One fixed-size record per frame, sent without waiting: a full buffer drops the frame instead of stalling CAN
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  const size_t size = can_log_encode(frame, interface, msgDir, can_frame_timestamp_us(frame), record);
 
-  if (xRingbufferSend(can_bufferHandle, &messagestr_buffer, size, pdMS_TO_TICKS(2)) != pdTRUE) {
-    logging.println("Failed to send message to can ring buffer!");
-    return;
+  if (xRingbufferSend(can_bufferHandle, record, size, 0) != pdTRUE) {
+    can_log_dropped_bytes += size;
   }
+}
 
-  uint8_t i = 0;
-  for (i = 0; i < frame.DLC; i++) {
-    if (i < frame.DLC - 1)
-      size = snprintf(messagestr_buffer, sizeof(messagestr_buffer), "%02X ", frame.data.u8[i]);
-    else
-      size = snprintf(messagestr_buffer, sizeof(messagestr_buffer), "%02X\n", frame.data.u8[i]);
-
-    if (xRingbufferSend(can_bufferHandle, &messagestr_buffer, size, pdMS_TO_TICKS(2)) != pdTRUE) {
-      logging.println("Failed to send message to can ring buffer!");
-      return;
+// Moves what the ring buffer holds into the block writer and carries out the webserver requests. The CAN log also
+// feeds its index
+static void write_buffer_to_sdcard(RingbufHandle_t handle, SdBlockWriter& writer, volatile bool& paused,
+                                   volatile bool& closed, volatile bool& remove, volatile uint32_t& buffer_dropped,
+                                   DATALAYER_SD_LOG_STATS_TYPE& stats, CanLogIndexer* indexer = nullptr,
+                                   SdBlockWriter* index_writer = nullptr) {
+  if (remove) {
+    writer.remove_all();
+    if (indexer != nullptr) {
+      indexer->reset();
+      index_writer->remove_all();
     }
+    remove = false;
   }
-}
 
-void write_can_frame_to_sdcard() {
-
-  if (!sd_card_active)
+  if (paused) {
+    // Data keeps waiting in the ring buffer while the file is being read
+    writer.close();
+    if (index_writer != nullptr) {
+      index_writer->close();
+    }
+    closed = true;
+    vTaskDelay(pdMS_TO_TICKS(10));
     return;
+  }
 
   size_t receivedMessageSize;
-  uint8_t* buffer = (uint8_t*)xRingbufferReceive(can_bufferHandle, &receivedMessageSize, pdMS_TO_TICKS(10));
-
+  uint8_t* buffer = (uint8_t*)xRingbufferReceive(handle, &receivedMessageSize, pdMS_TO_TICKS(10));
   if (buffer != NULL) {
-
-    if (can_logging_paused) {
-      if (can_file_open) {
-        can_log_file.close();
-        can_file_open = false;
-      }
-      if (delete_can_file) {
-        SD_MMC.remove(CAN_LOG_FILE);
-        delete_can_file = false;
-        can_logging_paused = false;
-      }
-      vRingbufferReturnItem(can_bufferHandle, (void*)buffer);
-      return;
+    if (indexer != nullptr) {
+      indexer->add(buffer, receivedMessageSize, writer.position());
     }
+    writer.append(buffer, receivedMessageSize);
+    vRingbufferReturnItem(handle, (void*)buffer);
+  }
 
-    if (can_file_open == false) {
-      can_log_file = SD_MMC.open(CAN_LOG_FILE, FILE_APPEND);
-      can_file_open = true;
+  if (indexer != nullptr) {
+    // The index rotates together with the log, its last segment stays in the old index
+    const uint32_t rotated = writer.stats().files_rotated;
+    writer.poll(indexer->at_record_boundary());
+    if (writer.stats().files_rotated != rotated) {
+      indexer->finish();
+      index_writer->start_new_file();
     }
+    index_writer->poll(false);
+  } else {
+    writer.poll();
+  }
 
-    can_log_file.write(buffer, receivedMessageSize);
-    can_log_file.flush();
+  const SdBlockWriterStats& writer_stats = writer.stats();
+  stats.bytes_written = writer_stats.bytes_written;
+  stats.bytes_per_second = writer_stats.bytes_per_second;
+  stats.dropped_bytes = writer_stats.dropped_bytes + buffer_dropped;
+  stats.write_errors = writer_stats.write_errors;
+  stats.write_latency_max_us = writer_stats.write_latency_max_us;
+  stats.files_rotated = writer_stats.files_rotated;
+}
 
-    vRingbufferReturnItem(can_bufferHandle, (void*)buffer);
-  }
+void write_can_frame_to_sdcard() {
+
+  if (!sd_card_active)
+    return;
+
+  write_buffer_to_sdcard(can_bufferHandle, can_log_writer, can_logging_paused, can_writer_closed, delete_can_file,
+                         can_log_dropped_bytes, datalayer.system.status.sd_can_log_stats, &can_log_indexer,
+                         &can_index_writer);
 }
 
 void add_log_to_buffer(const uint8_t* buffer, size_t size) {
@@ -122,9 +193,9 @@ void add_log_to_buffer(const uint8_t* buffer, size_t size) {
   if (!sd_card_active)
     return;
 
+  // Not logged, that would come right back here
   if (xRingbufferSend(log_bufferHandle, buffer, size, pdMS_TO_TICKS(1)) != pdTRUE) {
-    logging.println("Failed to send message to log ring buffer!");
-    return;
+    log_dropped_bytes += size;
   }
 }
 
@@ -133,28 +204,45 @@ void write_log_to_sdcard() {
   if (!sd_card_active)
     return;
 
-  size_t receivedMessageSize;
-  uint8_t* buffer = (uint8_t*)xRingbufferReceive(log_bufferHandle, &receivedMessageSize, pdMS_TO_TICKS(10));
-
-  if (buffer != NULL) {
+  write_buffer_to_sdcard(log_bufferHandle, log_writer, logging_paused, log_writer_closed, delete_log_file,
+                         log_dropped_bytes, datalayer.system.status.sd_log_stats);
+}
 
-    if (logging_paused) {
-      vRingbufferReturnItem(log_bufferHandle, (void*)buffer);
+void save_can_flight_recording() {
+  if (!sd_card_active || can_flight_recorder.state() != CanFlightState::Frozen) {
+    return;
+  }
+  if (!can_flight_writer_ready) {
+    SdBlockWriterConfig config;
+    config.block_size = SD_LOG_BLOCK_SIZE;
+    config.retained_files = SD_FLIGHT_RETAINED_FILES;
+    can_flight_writer_ready = can_flight_writer.begin(config);
+    if (!can_flight_writer_ready) {
+      LOG_E(SD, "Failed to allocate CAN flight recording block!\n");
       return;
     }
+  }
 
-    if (log_file_open == false) {
-      log_file = SD_MMC.open(LOG_FILE, FILE_APPEND);
-      log_file_open = true;
-    }
-
-    log_file.write(buffer, receivedMessageSize);
-    log_file.flush();
-    vRingbufferReturnItem(log_bufferHandle, (void*)buffer);
+  // The previous recording moves aside, each one gets its own file
+  can_flight_writer.start_new_file();
+  static uint8_t buffer[1024];
+  uint32_t cursor = 0;
+  size_t size;
+  while ((size = can_flight_recorder.read(cursor, buffer, sizeof(buffer))) > 0) {
+    can_flight_writer.append(buffer, size);
   }
+  can_flight_writer.close();
+  LOG_I(SD, "CAN flight recording of %s saved to %s\n",
+        get_event_enum_string((EVENTS_ENUM_TYPE)can_flight_recorder.trigger_reason()), CAN_FLIGHT_FILE);
+  can_flight_recorder.rearm();
 }
 
 void init_logging_buffers() {
+  SdBlockWriterConfig config;
+  config.flush_interval_ms = std::max<uint16_t>(user_selected_sd_flush_interval_s, 1) * 1000;
+  config.rotate_size = (uint64_t)user_selected_sd_rotate_size_mb * 1024 * 1024;
+  config.rotate_interval_ms = (uint32_t)user_selected_sd_rotate_interval_h * 3600 * 1000;
+  config.retained_files = std::min<uint16_t>(user_selected_sd_retained_files, SD_MAX_RETAINED_FILES);
 
   if (datalayer.system.info.CAN_SD_logging_active) {
     can_bufferHandle = xRingbufferCreate(32 * 1024, RINGBUF_TYPE_BYTEBUF);
@@ -162,6 +250,21 @@ void init_logging_buffers() {
       logging.println("Failed to create CAN ring buffer!");
       return;
     }
+    config.block_size =
+        (size_t)std::clamp<uint16_t>(user_selected_sd_block_size_kb, SD_MIN_BLOCK_SIZE_KB, SD_MAX_BLOCK_SIZE_KB) *
+        1024;
+    if (!can_log_writer.begin(config)) {
+      logging.println("Failed to allocate CAN log block!");
+    }
+    // The index only gets an entry every few seconds
+    SdBlockWriterConfig index_config = config;
+    index_config.block_size = 512;
+    index_config.rotate_size = 0;
+    index_config.rotate_interval_ms = 0;
+    if (!can_index_writer.begin(index_config)) {
+      logging.println("Failed to allocate CAN log index block!");
+    }
+    datalayer.system.status.sd_can_log_stats.active = true;
   }
 
   if (datalayer.system.info.SD_logging_active) {
@@ -170,6 +273,12 @@ void init_logging_buffers() {
       logging.println("Failed to create log ring buffer!");
       return;
     }
+    // The general log is slow, a small block keeps the memory use down
+    config.block_size = SD_LOG_BLOCK_SIZE;
+    if (!log_writer.begin(config)) {
+      logging.println("Failed to allocate log block!");
+    }
+    datalayer.system.status.sd_log_stats.active = true;
   }
 }
 
@@ -189,6 +298,11 @@ bool init_sdcard() {
   auto mosi_pin = esp32hal->SD_MOSI_PIN();
   auto sclk_pin = esp32hal->SD_SCLK_PIN();
 
+  if (miso_pin == GPIO_NUM_NC) {
+    logging.println("No SD card slot on this board");
+    return false;
+  }
+
   if (!esp32hal->alloc_pins("SD Card", miso_pin, mosi_pin, sclk_pin)) {
     return false;
   }
@@ -5,9 +5,38 @@
 #include "../../communication/can/comm_can.h"
 #include "../hal/hal.h"
 #include "../utils/events.h"
+#include "can_log_record.h"
 
-#define CAN_LOG_FILE "/canlog.txt"
+#define CAN_LOG_FILE "/canlog.bin"
+#define CAN_LOG_INDEX_FILE "/canlog.idx"
 #define LOG_FILE "/log.txt"
+#define CAN_FLIGHT_FILE "/canflight.bin"
+
+extern uint16_t user_selected_sd_block_size_kb;
+extern uint16_t user_selected_sd_flush_interval_s;
+extern uint16_t user_selected_sd_rotate_size_mb;
+extern uint16_t user_selected_sd_rotate_interval_h;
+extern uint16_t user_selected_sd_retained_files;
+
+// Size of the blocks the CAN log is written to the SD card in
+#define SD_BLOCK_SIZE_KB 16
+#define SD_MIN_BLOCK_SIZE_KB 4
+#define SD_MAX_BLOCK_SIZE_KB 32
+// Block size of the general log
+#define SD_LOG_BLOCK_SIZE 4096
+// Longest time logged data waits in memory before it is written and flushed
+#define SD_FLUSH_INTERVAL_S 2
+// Log files start over at this size, the older files are kept next to them
+#define SD_ROTATE_SIZE_MB 64
+#define SD_RETAINED_FILES 4
+#define SD_MAX_RETAINED_FILES 20
+// Longest time pausing waits for the logging task to close the file
+#define SD_PAUSE_WAIT_MS 200
+// Flight recordings kept next to the newest one
+#define SD_FLIGHT_RETAINED_FILES 4
+
+// The card is mounted, set by the logging task
+extern bool sd_card_active;
 
 void init_logging_buffers();
 void deinit_logging_buffers();
@@ -15,9 +44,11 @@ void deinit_logging_buffers();
 bool init_sdcard();
 void log_sdcard_details();
 
-void add_can_frame_to_buffer(CAN_frame frame, frameDirection msgDir);
+// Queues the frame as a binary record (see can_log_record.h), dropping it if the buffer is full
+void add_can_frame_to_buffer(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir);
 void write_can_frame_to_sdcard();
 
+// Pausing writes out what is buffered and closes the file, so it can be read. Data logged meanwhile waits
 void pause_can_writing();
 void resume_can_writing();
 void delete_can_log();
@@ -28,4 +59,7 @@ void pause_log_writing();
 void add_log_to_buffer(const uint8_t* buffer, size_t size);
 void write_log_to_sdcard();
 
+// Writes a frozen CAN flight recording to a new CAN_FLIGHT_FILE, in the CAN log format, and rearms the recorder
+void save_can_flight_recording();
+
 #endif  // SDCARD_H
@@ -0,0 +1,199 @@
+#include "deferred_log.h"
+#include <stdio.h>
+
+namespace {
+
+// Walks the arguments stored behind a record header
+class ArgumentReader {
+ public:
+  ArgumentReader(const uint8_t* position, const uint8_t* end) : position(position), end(end) {}
+
+  uint8_t next_tag() const { return position < end ? *position : 0; }
+
+  // Integer argument, sign or zero extended from the width the caller passed, false on a different type
+  bool integer(int64_t& value, bool& wide) {
+    const uint8_t tag = next_tag();
+    if (tag == DEFERRED_LOG_INT32 || tag == DEFERRED_LOG_UINT32) {
+      uint32_t raw;
+      memcpy(&raw, position + 1, sizeof(raw));
+      value = tag == DEFERRED_LOG_INT32 ? (int64_t)(int32_t)raw : (int64_t)raw;
+      wide = false;
+      position += 1 + sizeof(raw);
+      return true;
+    }
+    if (tag == DEFERRED_LOG_INT64) {
+      memcpy(&value, position + 1, sizeof(value));
+      wide = true;
+      position += 1 + sizeof(value);
+      return true;
+    }
+    return false;
+  }
+
+  bool number(double& value) {
+    if (next_tag() != DEFERRED_LOG_DOUBLE) {
+      return false;
+    }
+    memcpy(&value, position + 1, sizeof(value));
+    position += 1 + sizeof(value);
+    return true;
+  }
+
+  // Copies a string argument into text, which holds DEFERRED_LOG_MAX_STRING + 1 characters
+  bool string(char* text) {
+    if (next_tag() != DEFERRED_LOG_STRING) {
+      return false;
+    }
+    const uint8_t length = position[1];
+    memcpy(text, position + 2, length);
+    text[length] = '\0';
+    position += 2 + length;
+    return true;
+  }
+
+  bool pointer(const void*& value) {
+    if (next_tag() != DEFERRED_LOG_POINTER) {
+      return false;
+    }
+    memcpy(&value, position + 1, sizeof(value));
+    position += 1 + sizeof(value);
+    return true;
+  }
+
+ private:
+  const uint8_t* position;
+  const uint8_t* end;
+};
+
+// snprintf with the widths and precisions given by '*'
+template <typename T>
+int print_value(char* out, size_t size, const char* spec, const int* stars, int star_count, T value) {
+  switch (star_count) {
+    case 0:
+      return snprintf(out, size, spec, value);
+    case 1:
+      return snprintf(out, size, spec, stars[0], value);
+    default:
+      return snprintf(out, size, spec, stars[0], stars[1], value);
+  }
+}
+
+bool is_one_of(char c, const char* set) {
+  return c != '\0' && strchr(set, c) != nullptr;
+}
+
+}  // namespace
+
+size_t deferred_log_render(const uint8_t* record, char* out, size_t out_size) {
+  DeferredLogHeader header;
+  memcpy(&header, record, sizeof(header));
+  const uint8_t* arguments = record + sizeof(header);
+  const uint8_t* end = record + header.size;
+  size_t length = 0;
+
+  if (header.kind == DEFERRED_LOG_TEXT) {
+    length = std::min<size_t>(end - arguments, out_size - 1);
+    memcpy(out, arguments, length);
+    out[length] = '\0';
+    return length;
+  }
+
+  ArgumentReader reader(arguments, end);
+  const char* f = header.format;
+  while (*f != '\0' && length < out_size - 1) {
+    if (*f != '%') {
+      out[length++] = *f++;
+      continue;
+    }
+    const char* conversion_start = f++;
+    if (*f == '%') {
+      out[length++] = '%';
+      f++;
+      continue;
+    }
+
+    // Flags, width and precision are kept, the length modifier is replaced to match the stored value
+    char spec[24] = "%";
+    size_t spec_length = 1;
+    int stars[2];
+    int star_count = 0;
+    bool valid = true;
+    while (is_one_of(*f, "-+ #0123456789.*") && spec_length < sizeof(spec) - 4) {
+      if (*f == '*') {
+        int64_t star;
+        bool wide;
+        valid = valid && star_count < 2 && reader.integer(star, wide);
+        if (valid) {
+          stars[star_count++] = (int)star;
+        }
+      }
+      spec[spec_length++] = *f++;
+    }
+    char modifier[3] = "";
+    size_t modifier_length = 0;
+    while (is_one_of(*f, "hljztL") && modifier_length < 2) {
+      modifier[modifier_length++] = *f++;
+    }
+    const char conversion = *f;
+    if (conversion != '\0') {
+      f++;
+    }
+
+    int printed = -1;
+    char* target = out + length;
+    const size_t room = out_size - length;
+    if (valid && is_one_of(conversion, "diuoxXc")) {
+      int64_t value;
+      bool wide;
+      if (reader.integer(value, wide)) {
+        // Truncated to what the caller passed, like printf reads it
+        const bool is_signed = conversion == 'd' || conversion == 'i';
+        if (strcmp(modifier, "hh") == 0) {
+          value = is_signed ? (int64_t)(int8_t)value : (int64_t)(uint8_t)value;
+        } else if (strcmp(modifier, "h") == 0) {
+          value = is_signed ? (int64_t)(int16_t)value : (int64_t)(uint16_t)value;
+        } else if (!wide) {
+          value = is_signed ? (int64_t)(int32_t)value : (int64_t)(uint32_t)value;
+        }
+        if (conversion == 'c') {
+          strcpy(spec + spec_length, "c");
+          printed = print_value(target, room, spec, stars, star_count, (int)value);
+        } else {
+          spec[spec_length++] = 'l';
+          spec[spec_length++] = 'l';
+          spec[spec_length++] = conversion;
+          spec[spec_length] = '\0';
+          printed = is_signed ? print_value(target, room, spec, stars, star_count, (long long)value)
+                              : print_value(target, room, spec, stars, star_count, (unsigned long long)value);
+        }
+      }
+    } else if (valid && is_one_of(conversion, "fFeEgGaA")) {
+      double value;
+      if (reader.number(value)) {
+        spec[spec_length++] = conversion;
+        spec[spec_length] = '\0';
+        printed = print_value(target, room, spec, stars, star_count, value);
+      }
+    } else if (valid && conversion == 's') {
+      char text[DEFERRED_LOG_MAX_STRING + 1];
+      if (reader.string(text)) {
+        strcpy(spec + spec_length, "s");
+        printed = print_value(target, room, spec, stars, star_count, (const char*)text);
+      }
+    } else if (valid && conversion == 'p') {
+      const void* value;
+      if (reader.pointer(value)) {
+        strcpy(spec + spec_length, "p");
+        printed = print_value(target, room, spec, stars, star_count, value);
+      }
+    }
+
+    if (printed < 0) {
+      // Unknown conversion, or the argument is missing or of another type: shown as written
+      printed = snprintf(target, room, "%.*s", (int)(f - conversion_start), conversion_start);
+    }
+    length += std::min<size_t>(printed, room - 1);
+  }
+  out[length] = '\0';
+  return length;
+}
@@ -0,0 +1,270 @@
+#ifndef _DEFERRED_LOG_H_
+#define _DEFERRED_LOG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include "spsc_ring.h"
+
+// Deferred logging: a log call only stores the pointer to its constant format string and the raw values of its
+// arguments in a record. The text is made later, away from the task that logged, by deferred_log_render().
+
+// Largest record, a log call whose arguments do not fit is rendered with the missing ones left as they are
+#define DEFERRED_LOG_MAX_RECORD 192
+// Characters of a string argument that are kept
+#define DEFERRED_LOG_MAX_STRING 64
+// Longest rendered record
+#define DEFERRED_LOG_MAX_LINE 256
+
+enum DeferredLogKind : uint8_t { DEFERRED_LOG_FORMAT = 1, DEFERRED_LOG_TEXT = 2 };
+
+enum DeferredLogArg : uint8_t {
+  DEFERRED_LOG_INT32 = 1,
+  DEFERRED_LOG_UINT32,
+  DEFERRED_LOG_INT64,
+  DEFERRED_LOG_DOUBLE,
+  DEFERRED_LOG_STRING,
+  DEFERRED_LOG_POINTER,
+};
+
+typedef struct {
+  uint16_t size;  // Of the whole record
+  uint8_t kind;   // DeferredLogKind
+  uint8_t reserved;
+  uint32_t timestamp_ms;
+  const char* format;  // DEFERRED_LOG_FORMAT: format string, the arguments follow. DEFERRED_LOG_TEXT: the text follows
+} DeferredLogHeader;
+
+class DeferredLogRecord {
+ public:
+  // A log call with a format string that stays valid, a string literal. Each argument is stored as a type tag and
+  // its value; strings are copied, so temporaries like String::c_str() may be passed.
+  template <typename... Args>
+  DeferredLogRecord(uint32_t timestamp_ms, const char* format, Args... args) {
+    start(DEFERRED_LOG_FORMAT, timestamp_ms, format);
+    (add(args), ...);
+    finish();
+  }
+
+  // Text that is already rendered, up to DEFERRED_LOG_MAX_RECORD - sizeof(DeferredLogHeader) characters
+  DeferredLogRecord(uint32_t timestamp_ms, const char* text, size_t length) {
+    start(DEFERRED_LOG_TEXT, timestamp_ms, nullptr);
+    put(text, length < sizeof(bytes) - size ? length : sizeof(bytes) - size);
+    finish();
+  }
+
+  const uint8_t* data() const { return bytes; }
+  size_t length() const { return size; }
+
+ private:
+  void start(DeferredLogKind kind, uint32_t timestamp_ms, const char* format) {
+    DeferredLogHeader header = {0, kind, 0, timestamp_ms, format};
+    memcpy(bytes, &header, sizeof(header));
+    size = sizeof(header);
+  }
+
+  void finish() {
+    const uint16_t record_size = size;
+    memcpy(bytes, &record_size, sizeof(record_size));
+  }
+
+  void put(const void* data, size_t count) {
+    memcpy(bytes + size, data, count);
+    size += count;
+  }
+
+  // Stores one argument if it fits completely
+  template <typename T>
+  void add(T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+      const double number = value;
+      tagged(DEFERRED_LOG_DOUBLE, &number, sizeof(number));
+    } else if constexpr (std::is_enum_v<T>) {
+      add(static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_integral_v<T> && sizeof(T) <= 4) {
+      if constexpr (std::is_signed_v<T>) {
+        const int32_t number = value;
+        tagged(DEFERRED_LOG_INT32, &number, sizeof(number));
+      } else {
+        const uint32_t number = value;
+        tagged(DEFERRED_LOG_UINT32, &number, sizeof(number));
+      }
+    } else if constexpr (std::is_integral_v<T>) {
+      const int64_t number = value;
+      tagged(DEFERRED_LOG_INT64, &number, sizeof(number));
+    } else if constexpr (std::is_convertible_v<T, const char*>) {
+      const char* text = value == nullptr ? "(null)" : value;
+      const size_t length = strnlen(text, DEFERRED_LOG_MAX_STRING);
+      if (size + 2 + length <= sizeof(bytes)) {
+        const uint8_t tag[2] = {DEFERRED_LOG_STRING, (uint8_t)length};
+        put(tag, sizeof(tag));
+        put(text, length);
+      }
+    } else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>) {
+      const void* pointer = value;
+      tagged(DEFERRED_LOG_POINTER, &pointer, sizeof(pointer));
+    } else {
+      static_assert(std::is_void_v<T>, "Argument type can not be logged");
+    }
+  }
+
+  void tagged(DeferredLogArg tag, const void* value, size_t count) {
+    if (size + 1 + count <= sizeof(bytes)) {
+      bytes[size++] = tag;
+      put(value, count);
+    }
+  }
+
+  uint8_t bytes[DEFERRED_LOG_MAX_RECORD];
+  size_t size;
+};
+
+// Renders a record as text, printf style. Returns the text length, at most out_size - 1; out is null terminated.
+size_t deferred_log_render(const uint8_t* record, char* out, size_t out_size);
+
+// One ring of records per task that logs, so the tasks never wait for each other, plus a shared ring for tasks that
+// come after all rings are taken, which the caller serializes. A single consumer renders the records in time order.
+template <size_t TASKS, size_t BUFFER>
+class DeferredLogBuffers {
+ public:
+  typedef SpscByteRing<BUFFER> Ring;
+
+  DeferredLogBuffers() {
+    for (auto& owner : owners) {
+      owner.store(nullptr);
+    }
+    for (size_t i = 0; i <= TASKS; i++) {
+      rings[i].store(nullptr);
+      line_start[i] = true;
+    }
+  }
+
+  ~DeferredLogBuffers() {
+    for (auto& ring : rings) {
+      delete ring.load();
+    }
+  }
+
+  // Adds the record to the ring of owner, claiming one the first time. Returns false if owner has no ring, the
+  // record should then go to write_shared(). A full ring drops the record.
+  bool write(const void* owner, const DeferredLogRecord& record) {
+    Ring* ring = ring_for(owner);
+    if (ring == nullptr) {
+      return false;
+    }
+    if (!ring->write(record.data(), record.length())) {
+      dropped_records.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+  // Adds the record to the shared ring. Calls must not overlap
+  void write_shared(const DeferredLogRecord& record) {
+    Ring* ring = rings[TASKS].load(std::memory_order_acquire);
+    if (ring == nullptr) {
+      ring = new (std::nothrow) Ring();
+      rings[TASKS].store(ring, std::memory_order_release);
+    }
+    if (ring == nullptr || !ring->write(record.data(), record.length())) {
+      dropped_records.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Consumer: renders the oldest record, prefixed with its time at the start of a line, and passes the text to
+  // output(const char* text, size_t length). A line a task started is finished before other tasks get their turn,
+  // as long as its next record is there. Returns false if there was no record.
+  template <typename Output>
+  bool render_next(Output output) {
+    int chosen = -1;
+    uint32_t oldest_ms = 0;
+    DeferredLogHeader header;
+    if (open_line >= 0 && peek_header(open_line, header)) {
+      chosen = open_line;
+    } else {
+      for (size_t i = 0; i <= TASKS; i++) {
+        if (peek_header(i, header) && (chosen < 0 || (int32_t)(header.timestamp_ms - oldest_ms) < 0)) {
+          chosen = i;
+          oldest_ms = header.timestamp_ms;
+        }
+      }
+    }
+    if (chosen < 0) {
+      return false;
+    }
+
+    Ring* ring = rings[chosen].load(std::memory_order_acquire);
+    uint8_t record[DEFERRED_LOG_MAX_RECORD];
+    peek_header(chosen, header);
+    const size_t size = ring->copy(record, header.size);
+    ring->pop(size);
+
+    char text[DEFERRED_LOG_MAX_LINE + 16];
+    size_t length = 0;
+    if (line_start[chosen]) {
+      length = format_timestamp(header.timestamp_ms, text);
+    }
+    length += deferred_log_render(record, text + length, sizeof(text) - length);
+    line_start[chosen] = length > 0 && text[length - 1] == '\n';
+    open_line = line_start[chosen] ? -1 : chosen;
+    output((const char*)text, length);
+    return true;
+  }
+
+  // Records lost because a ring was full
+  uint32_t dropped() const { return dropped_records.load(std::memory_order_relaxed); }
+
+ private:
+  Ring* ring_for(const void* owner) {
+    for (size_t i = 0; i < TASKS; i++) {
+      const void* current = owners[i].load(std::memory_order_acquire);
+      if (current == nullptr && owners[i].compare_exchange_strong(current, owner, std::memory_order_acq_rel)) {
+        // Only the owner ever writes this slot, the consumer skips it until the ring is stored
+        Ring* ring = new (std::nothrow) Ring();
+        rings[i].store(ring, std::memory_order_release);
+        return ring;
+      }
+      if (current == owner) {
+        return rings[i].load(std::memory_order_relaxed);
+      }
+    }
+    return nullptr;
+  }
+
+  bool peek_header(size_t index, DeferredLogHeader& header) const {
+    const Ring* ring = rings[index].load(std::memory_order_acquire);
+    return ring != nullptr && ring->copy((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+           header.size >= sizeof(header) && header.size <= DEFERRED_LOG_MAX_RECORD;
+  }
+
+  // "   12345.678 ", like the synchronous log always had
+  static size_t format_timestamp(uint32_t timestamp_ms, char* out) {
+    uint32_t seconds = timestamp_ms / 1000;
+    uint32_t milliseconds = timestamp_ms % 1000;
+    char* p = out + 13;
+    *--p = ' ';
+    for (int i = 0; i < 3; i++, milliseconds /= 10) {
+      *--p = '0' + milliseconds % 10;
+    }
+    *--p = '.';
+    do {
+      *--p = '0' + seconds % 10;
+      seconds /= 10;
+    } while (seconds > 0 && p > out);
+    while (p > out) {
+      *--p = ' ';
+    }
+    return 13;
+  }
+
+  std::atomic<const void*> owners[TASKS];
+  // The last one is the shared ring
+  std::atomic<Ring*> rings[TASKS + 1];
+  bool line_start[TASKS + 1];
+  int open_line = -1;
+  std::atomic<uint32_t> dropped_records{0};
+};
+
+#endif
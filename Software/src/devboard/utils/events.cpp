@@ -1,5 +1,6 @@
 #include "events.h"
 #include <Arduino.h>
+#include "../../communication/can/CanFlightRecorder.h"
 #include "../../datalayer/datalayer.h"
 #include "../../devboard/hal/hal.h"
 #include "../../devboard/utils/logging.h"
@@ -464,6 +465,11 @@ static void set_event(EVENTS_ENUM_TYPE event, uint8_t data, bool latched) {
     events.entries[event].MQTTpublished = false;
 
     DEBUG_PRINTF("Event: %s\n", get_event_message_string(event).c_str());
+
+    if (can_flight_recorder.triggered_by(event)) {
+      // millis64() runs on the esp_timer clock of the CAN frame timestamps
+      can_flight_recorder.trigger(event, millis64() * 1000);
+    }
   }
 
   // We should set the event, update event info
@@ -0,0 +1,40 @@
+#include "log_levels.h"
+
+uint8_t log_thresholds[LOG_MODULE_COUNT] = {};
+
+static LogLevel log_levels[LOG_MODULE_COUNT] = {LOG_LEVEL_INFO, LOG_LEVEL_INFO, LOG_LEVEL_INFO, LOG_LEVEL_INFO,
+                                                LOG_LEVEL_INFO, LOG_LEVEL_INFO, LOG_LEVEL_INFO};
+static bool log_output_active = false;
+
+static const char* const module_names[LOG_MODULE_COUNT] = {"General",    "Battery", "Inverter", "CAN",
+                                                           "Contactors", "Network", "SD card"};
+
+static const char* const module_settings[LOG_MODULE_COUNT] = {"LOGGENERAL",  "LOGBATTERY", "LOGINVERTER", "LOGCAN",
+                                                              "LOGCONTACTOR", "LOGNETWORK", "LOGSD"};
+
+const char* log_module_name(LogModule module) {
+  return module < LOG_MODULE_COUNT ? module_names[module] : "";
+}
+
+const char* log_module_setting(LogModule module) {
+  return module < LOG_MODULE_COUNT ? module_settings[module] : "";
+}
+
+void set_log_level(LogModule module, LogLevel level) {
+  if (module >= LOG_MODULE_COUNT) {
+    return;
+  }
+  log_levels[module] = level > LOG_LEVEL_VERBOSE ? LOG_LEVEL_VERBOSE : level;
+  log_thresholds[module] = log_output_active ? log_levels[module] : LOG_LEVEL_NONE;
+}
+
+LogLevel get_log_level(LogModule module) {
+  return module < LOG_MODULE_COUNT ? log_levels[module] : LOG_LEVEL_NONE;
+}
+
+void set_log_output_active(bool active) {
+  log_output_active = active;
+  for (int module = 0; module < LOG_MODULE_COUNT; module++) {
+    log_thresholds[module] = active ? log_levels[module] : LOG_LEVEL_NONE;
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef _LOG_LEVELS_H_
+#define _LOG_LEVELS_H_
+
+#include <stdint.h>
+
+// Severity of a log message. A module logs the messages up to its threshold, LOG_LEVEL_NONE silences it.
+enum LogLevel : uint8_t {
+  LOG_LEVEL_NONE = 0,
+  LOG_LEVEL_ERROR,
+  LOG_LEVEL_WARNING,
+  LOG_LEVEL_INFO,
+  LOG_LEVEL_DEBUG,
+  LOG_LEVEL_VERBOSE,
+};
+
+// Most detailed level that is compiled in. Log calls above it are removed entirely, set it lower with a build flag
+// such as -DLOG_COMPILED_LEVEL=LOG_LEVEL_INFO.
+#ifndef LOG_COMPILED_LEVEL
+#define LOG_COMPILED_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+// Part of the firmware a log message belongs to, each with its own threshold. Used without the LOG_MODULE_ prefix in
+// the LOG_* macros of logging.h, which put the tag in front of the message.
+enum LogModule : uint8_t {
+  LOG_MODULE_GENERAL = 0,  // DEBUG_PRINTF, untagged
+  LOG_MODULE_BATTERY,
+  LOG_MODULE_INVERTER,
+  LOG_MODULE_CAN,
+  LOG_MODULE_CONTACTORS,
+  LOG_MODULE_NETWORK,
+  LOG_MODULE_SD,
+  LOG_MODULE_COUNT
+};
+
+#define LOG_TAG_GENERAL ""
+#define LOG_TAG_BATTERY "[battery] "
+#define LOG_TAG_INVERTER "[inverter] "
+#define LOG_TAG_CAN "[can] "
+#define LOG_TAG_CONTACTORS "[contactors] "
+#define LOG_TAG_NETWORK "[network] "
+#define LOG_TAG_SD "[sd] "
+
+// Thresholds in effect, all LOG_LEVEL_NONE while no log output is enabled. Read by every log call, so a message that
+// is not wanted costs one comparison.
+extern uint8_t log_thresholds[LOG_MODULE_COUNT];
+
+static inline bool log_enabled(LogLevel level, LogModule module) {
+  return level <= LOG_COMPILED_LEVEL && level <= log_thresholds[module];
+}
+
+// Name shown in the settings page
+const char* log_module_name(LogModule module);
+// Key of the module's threshold in the stored settings
+const char* log_module_setting(LogModule module);
+
+// The threshold of a module, used whenever a log output is enabled
+void set_log_level(LogModule module, LogLevel level);
+LogLevel get_log_level(LogModule module);
+
+// Enables or silences all modules at once, when USB or web logging is switched
+void set_log_output_active(bool active);
+
+#endif
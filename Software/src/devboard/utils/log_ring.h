@@ -0,0 +1,162 @@
+#ifndef _LOG_RING_H_
+#define _LOG_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+enum LogRingKind : uint8_t { LOG_RING_CAN = 1, LOG_RING_TEXT = 2 };
+
+// Bytes per slot, one CAN log record block (see can_log_record.h)
+#define LOG_RING_PAYLOAD 24
+// Most slots one entry can take, a CAN-FD record with 64 data bytes
+#define LOG_RING_MAX_PARTS 4
+
+// Lock-free history of log entries for the webserver. Any task can add entries, and readers never block them.
+// Every slot gets the next number of an ever increasing sequence, so a reader asks for everything after the last
+// sequence it has seen. Once the ring is full the oldest entries are overwritten, a reader that fell behind is told
+// how many it missed. An entry takes 1 ... LOG_RING_MAX_PARTS consecutive slots; text is stored in single-slot pieces.
+template <size_t N>
+class LogRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "LogRing size must be a power of two");
+
+ public:
+  // Adds an entry of up to LOG_RING_MAX_PARTS * LOG_RING_PAYLOAD bytes
+  void push(LogRingKind kind, const uint8_t* data, size_t size) {
+    const uint8_t parts = size == 0 ? 1 : (size + LOG_RING_PAYLOAD - 1) / LOG_RING_PAYLOAD;
+    const uint32_t first = next.fetch_add(parts, std::memory_order_relaxed);
+    for (uint8_t part = 0; part < parts; part++) {
+      const size_t length = size > LOG_RING_PAYLOAD ? LOG_RING_PAYLOAD : size;
+      Slot& slot = slots[(first + part) & (N - 1)];
+      // A reader that sees 0, or a different sequence after copying, knows the slot changed under it
+      slot.sequence.store(0, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      slot.kind = kind;
+      slot.part = part;
+      slot.parts = parts;
+      slot.length = length;
+      memcpy(slot.payload, data, length);
+      slot.sequence.store(first + part, std::memory_order_release);
+      data += length;
+      size -= length;
+    }
+  }
+
+  // Adds text of any length
+  void push_text(const char* text, size_t size) {
+    while (size > 0) {
+      const size_t length = size > LOG_RING_PAYLOAD ? LOG_RING_PAYLOAD : size;
+      push(LOG_RING_TEXT, (const uint8_t*)text, length);
+      text += length;
+      size -= length;
+    }
+  }
+
+  // Sequence the next entry gets. Reading from here on returns only entries added later
+  uint32_t next_sequence() const { return next.load(std::memory_order_acquire); }
+
+  // Calls output(kind, data, size) for the complete entries from sequence since on, oldest first, until output returns
+  // false or no more entries are ready. Adds the amount of overwritten slots that were skipped to lost. Returns the
+  // sequence to continue from.
+  template <typename Output>
+  uint32_t read(uint32_t since, uint32_t& lost, Output output) const {
+    const uint32_t end = next.load(std::memory_order_acquire);
+    uint32_t sequence = since;
+    const uint32_t oldest = end > N ? end - N : 1;
+    if (sequence == 0 || (int32_t)(end - sequence) < 0) {
+      // From the start, or a sequence from before a reboot
+      sequence = oldest;
+    } else if ((int32_t)(oldest - sequence) > 0) {
+      lost += oldest - sequence;
+      sequence = oldest;
+    }
+
+    uint8_t entry[LOG_RING_MAX_PARTS * LOG_RING_PAYLOAD];
+    while ((int32_t)(end - sequence) > 0) {
+      Slot copy;
+      const int state = read_slot(sequence, copy);
+      if (state == NOT_READY) {
+        break;  // Still being written, next time
+      }
+      if (state == OVERWRITTEN || copy.part != 0) {
+        lost++;
+        sequence++;
+        continue;
+      }
+
+      const LogRingKind kind = (LogRingKind)copy.kind;
+      size_t size = copy.length;
+      memcpy(entry, copy.payload, copy.length);
+      const uint8_t parts = copy.parts;
+      int part_state = COMPLETE;
+      for (uint8_t part = 1; part < parts; part++) {
+        part_state = read_slot(sequence + part, copy);
+        if (part_state == COMPLETE && copy.part != part) {
+          part_state = OVERWRITTEN;
+        }
+        if (part_state != COMPLETE) {
+          break;
+        }
+        memcpy(entry + size, copy.payload, copy.length);
+        size += copy.length;
+      }
+      if (part_state == NOT_READY) {
+        break;
+      }
+      if (part_state == OVERWRITTEN) {
+        lost += parts;
+        sequence += parts;
+        continue;
+      }
+
+      if (!output(kind, (const uint8_t*)entry, size)) {
+        break;
+      }
+      sequence += parts;
+    }
+    return sequence;
+  }
+
+  static constexpr size_t capacity() { return N; }
+
+ private:
+  struct Slot {
+    std::atomic<uint32_t> sequence{0};
+    uint8_t kind = 0;
+    uint8_t part = 0;
+    uint8_t parts = 0;
+    uint8_t length = 0;
+    uint8_t payload[LOG_RING_PAYLOAD];
+  };
+
+  enum { COMPLETE, NOT_READY, OVERWRITTEN };
+
+  // Copies the slot of sequence without blocking the writers, like reading a seqlock
+  int read_slot(uint32_t sequence, Slot& copy) const {
+    const Slot& slot = slots[sequence & (N - 1)];
+    const uint32_t before = slot.sequence.load(std::memory_order_acquire);
+    if (before != sequence) {
+      // 0 is a slot being written, an older sequence one the writer did not get to yet
+      return (before == 0 || (int32_t)(before - sequence) < 0) ? NOT_READY : OVERWRITTEN;
+    }
+    copy.kind = slot.kind;
+    copy.part = slot.part;
+    copy.parts = slot.parts > LOG_RING_MAX_PARTS ? LOG_RING_MAX_PARTS : slot.parts;
+    copy.length = slot.length > LOG_RING_PAYLOAD ? LOG_RING_PAYLOAD : slot.length;
+    memcpy(copy.payload, slot.payload, copy.length);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == sequence ? COMPLETE : OVERWRITTEN;
+  }
+
+  Slot slots[N];
+  // Sequence 0 marks a slot being written, so numbering starts at 1
+  std::atomic<uint32_t> next{1};
+};
+
+// History shown on the CAN log and debug log pages of the webserver
+#define WEB_LOG_RING_SLOTS 512
+typedef LogRing<WEB_LOG_RING_SLOTS> WebLogRing;
+extern WebLogRing web_log;
+
+#endif
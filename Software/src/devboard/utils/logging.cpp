@@ -1,53 +1,25 @@
 #include "logging.h"
+#include "../../communication/usb/comm_usb.h"
 #include "../../datalayer/datalayer.h"
+#include "../../system_settings.h"
+#include "../hal/hal.h"
 #include "../sdcard/sdcard.h"
+#include "log_ring.h"
 
 #define MAX_LINE_LENGTH_PRINTF 128
-#define MAX_LENGTH_TIME_STR 14
 
-bool previous_message_was_newline = true;
+WebLogRing web_log;
 
-void Logging::add_timestamp(size_t size) {
-  // Check if any logging is enabled at runtime
-  if (!datalayer.system.info.web_logging_active && !datalayer.system.info.usb_logging_active) {
-    return;
-  }
-
-  int offset = datalayer.system.info.logged_can_messages_offset;  // Keeps track of the current position in the buffer
-  size_t message_string_size = sizeof(datalayer.system.info.logged_can_messages);
-  unsigned long currentTime = millis();
-  char* timestr;
-  static char timestr_buffer[MAX_LENGTH_TIME_STR];
-
-  if (datalayer.system.info.web_logging_active) {
-    if (!datalayer.system.info.can_logging_active) {
-      /* If web debug is active and can logging is inactive, 
-       * we use the debug logging memory directly for writing the timestring */
-      if (offset + size + MAX_LENGTH_TIME_STR > message_string_size) {
-        offset = 0;
-      }
-      timestr = datalayer.system.info.logged_can_messages + offset;
-    } else {
-      timestr = timestr_buffer;
-    }
-  } else {
-    timestr = timestr_buffer;
-  }
-
-  offset += min(MAX_LENGTH_TIME_STR - 1,
-                snprintf(timestr, MAX_LENGTH_TIME_STR, "%8lu.%03lu ", currentTime / 1000, currentTime % 1000));
-
-  if (datalayer.system.info.web_logging_active && !datalayer.system.info.can_logging_active) {
-    datalayer.system.info.logged_can_messages_offset = offset;  // Update offset in buffer
-  }
+// Records of every task that logs, rendered by log_render_task
+static DeferredLogBuffers<DEFERRED_LOG_TASKS, DEFERRED_LOG_TASK_BUFFER_SIZE> deferred_log;
+// Serializes the tasks that found no free ring of their own
+static portMUX_TYPE deferred_log_shared_lock = portMUX_INITIALIZER_UNLOCKED;
 
-  // LOG_TO_SD remains as compile-time option for now
-#ifdef LOG_TO_SD
-  add_log_to_buffer((uint8_t*)timestr, MAX_LENGTH_TIME_STR);
-#endif  // LOG_TO_SD
-
-  if (datalayer.system.info.usb_logging_active) {
-    Serial.write(timestr);
+void Logging::add_record(const DeferredLogRecord& record) {
+  if (!deferred_log.write(xTaskGetCurrentTaskHandle(), record)) {
+    portENTER_CRITICAL(&deferred_log_shared_lock);
+    deferred_log.write_shared(record);
+    portEXIT_CRITICAL(&deferred_log_shared_lock);
   }
 }
 
@@ -57,31 +29,11 @@ size_t Logging::write(const uint8_t* buffer, size_t size) {
     return 0;
   }
 
-  if (previous_message_was_newline) {
-    add_timestamp(size);
-  }
-
-#ifdef LOG_TO_SD
-  add_log_to_buffer(buffer, size);
-#endif
-
-  if (datalayer.system.info.usb_logging_active) {
-    Serial.write(buffer, size);
-  }
-
-  if (datalayer.system.info.web_logging_active && !datalayer.system.info.can_logging_active) {
-    char* message_string = datalayer.system.info.logged_can_messages;
-    int offset = datalayer.system.info.logged_can_messages_offset;  // Keeps track of the current position in the buffer
-    size_t message_string_size = sizeof(datalayer.system.info.logged_can_messages);
-
-    if (offset + size > message_string_size) {
-      offset = 0;
-    }
-    memcpy(message_string + offset, buffer, size);
-    datalayer.system.info.logged_can_messages_offset = offset + size;  // Update offset in buffer
+  const uint32_t now = millis();
+  const size_t piece = DEFERRED_LOG_MAX_RECORD - sizeof(DeferredLogHeader);
+  for (size_t offset = 0; offset < size; offset += piece) {
+    add_record(DeferredLogRecord(now, (const char*)buffer + offset, std::min(piece, size - offset)));
   }
-
-  previous_message_was_newline = buffer[size - 1] == '\n';
   return size;
 }
 
@@ -91,50 +43,57 @@ void Logging::printf(const char* fmt, ...) {
     return;
   }
 
-  if (previous_message_was_newline) {
-    add_timestamp(MAX_LINE_LENGTH_PRINTF);
-  }
-
-  char* message_string = datalayer.system.info.logged_can_messages;
-  size_t message_string_size = sizeof(datalayer.system.info.logged_can_messages);
-  int offset = datalayer.system.info.logged_can_messages_offset;  // Keeps track of the current position in the buffer
-  static char buffer[MAX_LINE_LENGTH_PRINTF];
-  char* message_buffer;
-
-  if (datalayer.system.info.web_logging_active) {
-    if (!datalayer.system.info.can_logging_active) {
-      /* If web debug is active and can logging is inactive, 
-       * we use the debug logging memory directly for writing the output */
-      if (offset + MAX_LINE_LENGTH_PRINTF > message_string_size) {
-        // Not enough space, reset and start from the beginning
-        offset = 0;
-      }
-      message_buffer = message_string + offset;
-    } else {
-      message_buffer = buffer;
-    }
-  } else {
-    message_buffer = buffer;
-  }
-
+  // The format may be a temporary buffer, so it is rendered right away
+  char message_buffer[MAX_LINE_LENGTH_PRINTF];
   va_list args;
   va_start(args, fmt);
   int size = min(MAX_LINE_LENGTH_PRINTF - 1, vsnprintf(message_buffer, MAX_LINE_LENGTH_PRINTF, fmt, args));
   va_end(args);
 
+  if (size > 0) {
+    write((const uint8_t*)message_buffer, size);
+  }
+}
+
+// Hands rendered text to the enabled outputs
+static void output_rendered(const char* text, size_t length) {
 #ifdef LOG_TO_SD
-  add_log_to_buffer((uint8_t*)message_buffer, size);
+  // LOG_TO_SD remains as compile-time option for now
+  add_log_to_buffer((const uint8_t*)text, length);
 #endif  // LOG_TO_SD
 
   if (datalayer.system.info.usb_logging_active) {
-    Serial.write(message_buffer, size);
+    usb_output_text(text, length);
   }
 
   if (datalayer.system.info.web_logging_active && !datalayer.system.info.can_logging_active) {
-    // Data was already added to buffer, just move offset
-    datalayer.system.info.logged_can_messages_offset =
-        offset + size;  // Keeps track of the current position in the buffer
+    web_log.push_text(text, length);
+  }
+}
+
+// Low priority task that turns the records of all tasks into text
+static void log_render_task(void*) {
+  uint32_t reported_dropped = 0;
+  while (true) {
+    while (deferred_log.render_next(output_rendered)) {
+    }
+
+    const uint32_t dropped = deferred_log.dropped();
+    if (dropped != reported_dropped) {
+      char notice[48];
+      const int length = snprintf(notice, sizeof(notice), "[%lu log messages dropped]\n",
+                                  (unsigned long)(dropped - reported_dropped));
+      output_rendered(notice, length);
+      reported_dropped = dropped;
+    }
+    delay(DEFERRED_LOG_RENDER_INTERVAL_MS);
   }
+}
 
-  previous_message_was_newline = message_buffer[size - 1] == '\n';
+void init_deferred_logging() {
+  if (!datalayer.system.info.web_logging_active && !datalayer.system.info.usb_logging_active) {
+    return;
+  }
+  xTaskCreatePinnedToCore((TaskFunction_t)&log_render_task, "log_render", 4096, NULL, TASK_LOG_RENDER_PRIO, NULL,
+                          esp32hal->WIFICORE());
 }
@@ -4,34 +4,52 @@
 #include <inttypes.h>
 #include "../../datalayer/datalayer.h"
 #include "Print.h"
+#include "deferred_log.h"
+#include "log_levels.h"
 #include "types.h"
 
 #ifndef UNIT_TEST
 // Real implementation for production
 
+// Tasks that get a record buffer of their own, later ones share one
+#define DEFERRED_LOG_TASKS 10
+// Bytes of records each task can have waiting, must be a power of two
+#define DEFERRED_LOG_TASK_BUFFER_SIZE 1024
+// Pause of the rendering task once all records are rendered
+#define DEFERRED_LOG_RENDER_INTERVAL_MS 5
+
+// Everything logged is turned into records (see deferred_log.h) and rendered to the USB, web and SD outputs by a low
+// priority task, in time order, with the tasks' lines kept whole.
 class Logging : public Print {
-  void add_timestamp(size_t size);
+  void add_record(const DeferredLogRecord& record);
 
  public:
+  // Text, e.g. from print() and println()
   virtual size_t write(const uint8_t* buffer, size_t size);
   virtual size_t write(uint8_t) { return 0; }
+  // Renders right away, for formats that are not string literals
   void printf(const char* fmt, ...);
+
+  // Stores the format pointer and the arguments only, see DEBUG_PRINTF
+  template <typename... Args>
+  void printf_deferred(const char* format, Args... args) {
+    add_record(DeferredLogRecord(millis(), format, args...));
+  }
+
   Logging() {}
 };
 
-// Production macros
-#define DEBUG_PRINTF(fmt, ...)                                                                  \
-  do {                                                                                          \
-    if (datalayer.system.info.web_logging_active || datalayer.system.info.usb_logging_active) { \
-      logging.printf(fmt, ##__VA_ARGS__);                                                       \
-    }                                                                                           \
-  } while (0)
+// Starts the task rendering the log, if logging via USB or webserver is enabled
+void init_deferred_logging();
+
+// Production macros. The format must be a string literal, it is rendered after the call returned
+#define DEBUG_PRINTF(fmt, ...) LOG_PRINTF(LOG_LEVEL_INFO, GENERAL, fmt, ##__VA_ARGS__)
 
-#define DEBUG_PRINTLN(str)                                                                      \
-  do {                                                                                          \
-    if (datalayer.system.info.web_logging_active || datalayer.system.info.usb_logging_active) { \
-      logging.println(str);                                                                     \
-    }                                                                                           \
+#define DEBUG_PRINTLN(str)                                 \
+  do {                                                     \
+    if (log_enabled(LOG_LEVEL_INFO, LOG_MODULE_GENERAL)) { \
+      logging.println(str);                                \
+    }                                                      \
   } while (0)
 
 #else
@@ -100,6 +118,12 @@ class Logging {
   static void println(bool b) { (void)b; }
   static void println() {}  // Empty println
 
+  template <typename... Args>
+  static void printf_deferred(const char* format, Args... args) {
+    (void)format;
+    ((void)args, ...);
+  }
+
   Logging() {}
 };
 
@@ -110,6 +134,26 @@ class Logging {
 
 #endif
 
+// Logs a message of a module (a LogModule without the LOG_MODULE_ prefix) when its threshold allows the level. Calls
+// above LOG_COMPILED_LEVEL are removed at compile time, the arguments are only evaluated when the message is logged.
+#define LOG_PRINTF(level, module, fmt, ...)                              \
+  do {                                                                   \
+    if constexpr ((level) <= LOG_COMPILED_LEVEL) {                       \
+      if ((level) <= log_thresholds[LOG_MODULE_##module]) {              \
+        logging.printf_deferred("" LOG_TAG_##module fmt, ##__VA_ARGS__); \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define LOG_E(module, fmt, ...) LOG_PRINTF(LOG_LEVEL_ERROR, module, fmt, ##__VA_ARGS__)
+#define LOG_W(module, fmt, ...) LOG_PRINTF(LOG_LEVEL_WARNING, module, fmt, ##__VA_ARGS__)
+#define LOG_I(module, fmt, ...) LOG_PRINTF(LOG_LEVEL_INFO, module, fmt, ##__VA_ARGS__)
+#define LOG_D(module, fmt, ...) LOG_PRINTF(LOG_LEVEL_DEBUG, module, fmt, ##__VA_ARGS__)
+#define LOG_V(module, fmt, ...) LOG_PRINTF(LOG_LEVEL_VERBOSE, module, fmt, ##__VA_ARGS__)
+
+// For log output made of several calls, e.g. a hex dump: if (LOG_ENABLED(LOG_LEVEL_DEBUG, INVERTER)) { ... }
+#define LOG_ENABLED(level, module) log_enabled(level, LOG_MODULE_##module)
+
 extern Logging logging;
 
 #endif  // __LOGGING_H__
@@ -0,0 +1,79 @@
+#ifndef _SNAPSHOT_BUFFER_H_
+#define _SNAPSHOT_BUFFER_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+// Consistent copies of a struct for exactly one writer and any amount of readers, each possibly running in its own
+// task. The writer alternates between two slots, so it never waits for a reader. Each slot has a sequence counter
+// that is odd while the slot is written, a reader that saw it change during its copy throws the copy away and
+// reads the newer snapshot instead. A reader only has to retry when the writer published twice during one copy.
+template <typename T>
+class SnapshotBuffer {
+  static_assert(std::is_trivially_copyable<T>::value, "SnapshotBuffer needs a type that can be copied as bytes");
+
+ public:
+  // Writer: copies value into the slot the readers are not on and makes it the latest snapshot
+  void publish(const T& value) {
+    const uint32_t next = latest.load(std::memory_order_relaxed) + 1;
+    Slot& slot = slots[next & 1];
+    const uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&slot.value, &value, sizeof(T));
+    slot.generation.store(next, std::memory_order_relaxed);
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+    latest.store(next, std::memory_order_release);
+  }
+
+  // Reader: copies the latest snapshot to out. Returns its generation, or 0 leaving out as it was if nothing has been
+  // published yet.
+  uint32_t read(T& out) const {
+    return read_with([&out](const T& snapshot) { memcpy(&out, &snapshot, sizeof(T)); });
+  }
+
+  // Reader: calls copy with the latest snapshot, e.g. to copy only a part of it. copy may run more than once and must
+  // only copy, the snapshot can change under it until read_with() returns. Returns the generation like read().
+  template <typename F>
+  uint32_t read_with(F copy) const {
+    while (true) {
+      const uint32_t current = latest.load(std::memory_order_acquire);
+      if (current == 0) {
+        return 0;
+      }
+      // The writer may have published twice since latest was loaded and refilled the same slot. The generation kept
+      // in the slot, read under the same sequence, tells the copy is still the snapshot latest pointed at.
+      const Slot& slot = slots[current & 1];
+      const uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if ((sequence & 1) == 0 && slot.generation.load(std::memory_order_relaxed) == current) {
+        copy(slot.value);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == sequence) {
+          return current;
+        }
+      }
+      retry_count.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Amount of snapshots published so far
+  uint32_t generation() const { return latest.load(std::memory_order_acquire); }
+  // Copies the readers threw away because the writer overwrote the slot meanwhile
+  uint32_t retries() const { return retry_count.load(std::memory_order_relaxed); }
+
+ private:
+  struct Slot {
+    std::atomic<uint32_t> sequence{0};
+    // Generation of the snapshot in value
+    std::atomic<uint32_t> generation{0};
+    T value;
+  };
+
+  Slot slots[2];
+  std::atomic<uint32_t> latest{0};
+  mutable std::atomic<uint32_t> retry_count{0};
+};
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef _SPSC_RING_H_
+#define _SPSC_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+
+// Lock-free ring buffer for exactly one producer and one consumer, each possibly running in its own task.
+// The producer only moves head and the consumer only moves tail, so neither side ever blocks the other.
+// Items can be filled and consumed in place (reserve/commit, peek/pop) to avoid copying large frames.
+template <typename T, size_t N>
+class SpscRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+ public:
+  // Producer: slot to fill in place, or nullptr if the ring is full. Publish it with commit().
+  T* reserve() {
+    const uint32_t current = head.load(std::memory_order_relaxed);
+    if (current - tail.load(std::memory_order_acquire) >= N) {
+      return nullptr;
+    }
+    return &items[current & (N - 1)];
+  }
+
+  // Producer: makes the slot returned by reserve() visible to the consumer
+  void commit() {
+    const uint32_t next = head.load(std::memory_order_relaxed) + 1;
+    head.store(next, std::memory_order_release);
+    const uint32_t used = next - tail.load(std::memory_order_relaxed);
+    if (used > peak.load(std::memory_order_relaxed)) {
+      peak.store(used, std::memory_order_relaxed);
+    }
+  }
+
+  // Producer: copies item into the ring. Returns false if the ring is full.
+  bool push(const T& item) {
+    T* slot = reserve();
+    if (slot == nullptr) {
+      return false;
+    }
+    *slot = item;
+    commit();
+    return true;
+  }
+
+  // Consumer: oldest item, or nullptr if the ring is empty. It stays valid until pop().
+  const T* peek() const {
+    const uint32_t current = tail.load(std::memory_order_relaxed);
+    if (head.load(std::memory_order_acquire) == current) {
+      return nullptr;
+    }
+    return &items[current & (N - 1)];
+  }
+
+  // Consumer: releases the item returned by peek()
+  void pop() { tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // Consumer: copies the oldest item out of the ring. Returns false if the ring is empty.
+  bool pop(T& item) {
+    const T* slot = peek();
+    if (slot == nullptr) {
+      return false;
+    }
+    item = *slot;
+    pop();
+    return true;
+  }
+
+  size_t count() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+  // Highest amount of items that were waiting in the ring at the same time
+  size_t peak_count() const { return peak.load(std::memory_order_relaxed); }
+  static constexpr size_t capacity() { return N; }
+
+ private:
+  T items[N];
+  std::atomic<uint32_t> head{0};
+  std::atomic<uint32_t> tail{0};
+  std::atomic<uint32_t> peak{0};
+};
+
+// Lock-free ring of bytes for exactly one producer and one consumer, for streams of variable length messages.
+// A message is either written completely or not at all, so a full ring drops whole messages instead of cutting them.
+template <size_t N>
+class SpscByteRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscByteRing size must be a power of two");
+
+ public:
+  // Producer: copies all size bytes into the ring. Returns false, copying nothing, if they do not fit.
+  bool write(const uint8_t* data, size_t size) {
+    const uint32_t current = head.load(std::memory_order_relaxed);
+    const uint32_t used = current - tail.load(std::memory_order_acquire);
+    if (size > N - used) {
+      return false;
+    }
+    const size_t offset = current & (N - 1);
+    const size_t first = std::min(size, N - offset);
+    memcpy(bytes + offset, data, first);
+    memcpy(bytes, data + first, size - first);
+    head.store(current + size, std::memory_order_release);
+    if (used + size > peak.load(std::memory_order_relaxed)) {
+      peak.store(used + size, std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+  // Consumer: points data at the oldest bytes and returns how many of them are contiguous, 0 if the ring is empty.
+  // They stay valid until pop().
+  size_t peek(const uint8_t*& data) const {
+    const uint32_t current = tail.load(std::memory_order_relaxed);
+    const size_t offset = current & (N - 1);
+    data = bytes + offset;
+    return std::min<size_t>(head.load(std::memory_order_acquire) - current, N - offset);
+  }
+
+  // Consumer: copies up to size of the oldest bytes to out without releasing them, returns the amount copied
+  size_t copy(uint8_t* out, size_t size) const {
+    const uint32_t current = tail.load(std::memory_order_relaxed);
+    size = std::min<size_t>(size, head.load(std::memory_order_acquire) - current);
+    const size_t offset = current & (N - 1);
+    const size_t first = std::min(size, N - offset);
+    memcpy(out, bytes + offset, first);
+    memcpy(out + first, bytes, size - first);
+    return size;
+  }
+
+  // Consumer: releases size bytes returned by peek() or copy()
+  void pop(size_t size) { tail.store(tail.load(std::memory_order_relaxed) + size, std::memory_order_release); }
+
+  size_t count() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+  // Highest amount of bytes that were waiting in the ring at the same time
+  size_t peak_count() const { return peak.load(std::memory_order_relaxed); }
+  static constexpr size_t capacity() { return N; }
+
+ private:
+  uint8_t bytes[N];
+  std::atomic<uint32_t> head{0};
+  std::atomic<uint32_t> tail{0};
+  std::atomic<uint32_t> peak{0};
+};
+
+#endif
@@ -100,8 +100,48 @@ typedef struct {
     uint32_t u32[2];
     uint64_t u64;
   } data;
+  uint64_t timestamp_us = 0;  // Receive time from esp_timer, taken as the frame left the CAN controller. 0 for TX frames
 } CAN_frame;
 
+/* Classic CAN frame (max 8 data bytes), 16 bytes instead of the 80 of CAN_frame.
+   Used for TX templates. Members match CAN_frame so templates
+   can be initialized the same way, FD is always false. */
+typedef struct {
+  bool FD;
+  bool ext_ID;
+  uint8_t DLC;
+  uint32_t ID;
+  union {
+    uint8_t u8[8];
+    uint32_t u32[2];
+    uint64_t u64;
+  } data;
+} CAN_classic_frame;
+
+static_assert(sizeof(CAN_classic_frame) == 16, "CAN_classic_frame should stay 16 bytes");
+
+inline CAN_frame to_can_frame(const CAN_classic_frame& classic) {
+  CAN_frame frame;
+  frame.FD = false;
+  frame.ext_ID = classic.ext_ID;
+  frame.DLC = classic.DLC;
+  frame.ID = classic.ID;
+  frame.data.u64 = classic.data.u64;
+  frame.timestamp_us = 0;
+  return frame;
+}
+
+// Only valid for frames with DLC <= 8, longer FD payloads are cut
+inline CAN_classic_frame to_classic_frame(const CAN_frame& frame) {
+  CAN_classic_frame classic;
+  classic.FD = false;
+  classic.ext_ID = frame.ext_ID;
+  classic.DLC = frame.DLC > 8 ? 8 : frame.DLC;
+  classic.ID = frame.ID;
+  classic.data.u64 = frame.data.u64;
+  return classic;
+}
+
 enum frameDirection { MSG_RX, MSG_TX };  //RX = 0, TX = 1
 
 typedef struct {
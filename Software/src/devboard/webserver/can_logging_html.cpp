@@ -2,13 +2,15 @@
 #include <Arduino.h>
 #include "../../communication/can/comm_can.h"
 #include "../../datalayer/datalayer.h"
+#include "../utils/log_ring.h"
 #include "index_html.h"
 
+// Lines the page keeps, older ones are removed as new ones come in
+#define CAN_LOG_PAGE_LINES 500
+
 String can_logger_processor(void) {
-  if (!datalayer.system.info.can_logging_active) {
-    datalayer.system.info.logged_can_messages_offset = 0;
-    datalayer.system.info.logged_can_messages[0] = '\0';
-  }
+  // Only frames from now on when the logger was not running, otherwise what is still in the history
+  const uint32_t since = datalayer.system.info.can_logging_active ? 0 : web_log.next_sequence();
   datalayer.system.info.can_logging_active =
       true;  // Signal to main loop that we should log messages. Disabled by default for performance reasons
   String content = index_html_header;
@@ -30,43 +32,60 @@ String can_logger_processor(void) {
   content += "<h3>CAN Logger Configuration</h3>";
   content += "<div class='config-item'><span>CAN ID Cutoff Filter: " + String(user_selected_CAN_ID_cutoff_filter) +
              "</span> <button onclick='editCANIDCutoff()'>Edit</button></div>";
-  content += "<button onclick='refreshPage()'>Refresh data</button> ";
   content += "<button onclick='exportLog()'>Export to .txt</button> ";
+  if (datalayer.system.info.CAN_SD_logging_active) {
+    content += "<button onclick='exportLogRange()'>Export time window</button> ";
+  }
 #ifdef LOG_CAN_TO_SD
   content += "<button onclick='deleteLogFile()'>Delete log file</button> ";
 #endif
   content += "<button onclick='stopLoggingAndGoToMainPage()'>Stop &amp; Back to main page</button>";
   content += "</div>";
 
-  // Start a new block for the CAN messages
-  content += "<div style='background-color: #303E47; padding: 20px; border-radius: 15px'>";
-
-  // Check for messages
-  if (datalayer.system.info.logged_can_messages[0] == 0) {
-    content += "CAN logger started! Refresh page to display incoming(RX) and outgoing(TX) messages";
-  } else {
-    // Split the messages using the newline character
-    String messages = String(datalayer.system.info.logged_can_messages);
-    int startIndex = 0;
-    int endIndex = messages.indexOf('\n');
-    while (endIndex != -1) {
-      // Extract a single message and wrap it in a styled div
-      String singleMessage = messages.substring(startIndex, endIndex);
-      content += "<div class='can-message'>" + singleMessage + "</div>";
-      startIndex = endIndex + 1;  // Move past the newline character
-      endIndex = messages.indexOf('\n', startIndex);
-    }
-  }
-
+  // Block for the CAN messages, filled by the script below
+  content += "<div id='log' style='background-color: #303E47; padding: 20px; border-radius: 15px'>";
+  content += "CAN logger started! Incoming(RX) and outgoing(TX) messages show up here";
   content += "</div>";
 
   // Add JavaScript for navigation and configuration
   content += "<script>";
-  content += "function refreshPage(){ location.reload(true); }";
+  // New frames are fetched from the history by sequence number, formatted by the webserver when asked for
+  content += "var next = " + String(since) + ";";
+  content += "function addLine(text) {";
+  content += "  var log = document.getElementById('log');";
+  content += "  var line = document.createElement('div');";
+  content += "  line.className = 'can-message';";
+  content += "  line.textContent = text;";
+  content += "  log.appendChild(line);";
+  content += "  while (log.childElementCount > " + String(CAN_LOG_PAGE_LINES) + ") log.removeChild(log.firstChild);";
+  content += "}";
+  content += "function poll() {";
+  content += "  fetch('/can_log_entries?since=' + next).then(function(response) {";
+  content += "    next = response.headers.get('X-Log-Next');";
+  content += "    var lost = Number(response.headers.get('X-Log-Lost'));";
+  content += "    var more = response.headers.get('X-Log-More') == '1';";
+  content += "    return response.text().then(function(text) {";
+  content += "      if (lost > 0) addLine(lost + ' log entries were overwritten before they could be shown');";
+  content += "      text.split('\\n').forEach(function(line) { if (line.length > 0) addLine(line); });";
+  content += "      setTimeout(poll, more ? 0 : 1000);";
+  content += "    });";
+  content += "  }).catch(function() { setTimeout(poll, 2000); });";
+  content += "}";
+  content += "poll();";
   content += "function exportLog() { window.location.href = '/export_can_log'; }";
 #ifdef LOG_CAN_TO_SD
   content += "function deleteLogFile() { window.location.href = '/delete_can_log'; }";
 #endif
+  content += "function exportLogRange() {";
+  content += "  var from = prompt('From, seconds since boot as in the log:', '0');";
+  content += "  if (from === null) return;";
+  content += "  var to = prompt('To, seconds since boot:', Number(from) + 60);";
+  content += "  if (to === null) return;";
+  content += "  var ids = prompt('Only these CAN IDs, hex and comma separated. Empty for all:', '');";
+  content += "  if (ids === null) return;";
+  content += "  window.location.href = '/export_can_log_range?from=' + encodeURIComponent(from) + '&to=' +";
+  content += "    encodeURIComponent(to) + '&ids=' + encodeURIComponent(ids);";
+  content += "}";
   content += "function stopLoggingAndGoToMainPage() {";
   content += "  fetch('/stop_can_logging').then(() => window.location.href = '/');";
   content += "}";
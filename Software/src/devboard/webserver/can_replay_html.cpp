@@ -1,13 +1,11 @@
 #include "can_replay_html.h"
 #include <Arduino.h>
+#include "../../communication/can/CanReplay.h"
 #include "../../datalayer/datalayer.h"
+#include "../sdcard/sdcard.h"
 #include "index_html.h"
 
 String can_replay_processor(void) {
-  if (!datalayer.system.info.can_logging_active) {
-    datalayer.system.info.logged_can_messages_offset = 0;
-    datalayer.system.info.logged_can_messages[0] = '\0';
-  }
   datalayer.system.info.can_logging_active =
       true;  // Signal to main loop that we should log messages. Disabled by default for performance reasons
   String content = index_html_header;
@@ -51,12 +49,36 @@ String can_replay_processor(void) {
   content += "<button onclick='sendCANSelection()'>Apply</button>";
 
   content += "<h3>Step 2: Upload CAN Log File</h3>";
-  content += "<p>Click Browse to select a .txt CANdump log file to upload</p>";
-  content += "<input type='file' id='file-input' accept='.txt'>";
+  content += "<p>Click Browse to select a .txt CANdump log file, or a .bin log of the SD card, to upload</p>";
+  content += "<input type='file' id='file-input' accept='.txt,.bin'>";
   content += "<button id='upload-btn'>Upload</button>";
+  if (sd_card_active) {
+    // Binary logs on the card are streamed from it, whatever their size
+    content += "<p><label for='replayFile'>Or replay from the SD card:</label> <select id='replayFile'>";
+    content += "<option value=''>Uploaded log</option>";
+    content += "<option value='" CAN_LOG_FILE "'>CAN log</option>";
+    content += "<option value='" CAN_FLIGHT_FILE "'>CAN flight recording</option>";
+    content += "</select></p>";
+  }
 
   content += "<h3>Step 3: Playback control</h3>";
 
+  // Pace of the replay against the timestamps of the log
+  content += "<label for='replaySpeed'>Speed:</label> <select id='replaySpeed'>";
+  const int speeds[] = {10, 25, 50, 100, 200, 500, 1000};
+  for (int speed : speeds) {
+    content += "<option value='" + String(speed) + "'" + (speed == 100 ? " selected" : "") + ">" +
+               String(speed / 100.0, speed % 100 == 0 ? 0 : 2) + "x</option>";
+  }
+  content += "<option value='" + String(CAN_REPLAY_AS_FAST_AS_POSSIBLE) + "'>As fast as possible</option>";
+  content += "</select> ";
+
+  // Send the frames out of the interface, or hand them to the battery and inverter of this device on it
+  content += "<label for='replayTarget'>Target:</label> <select id='replayTarget'>";
+  content += "<option value='bus'>Transmit on the interface</option>";
+  content += "<option value='loopback'>Loopback into own receivers</option>";
+  content += "</select> ";
+
   //Checkbox to see if the user wants the log to repeat once it reaches the end
   content += "<input type=\"checkbox\" id=\"loopCheckbox\"> Loop ";
 
@@ -68,6 +90,7 @@ String can_replay_processor(void) {
 
   // Status indicator
   content += "<span id='statusIndicator' style='margin-left:10px; font-weight:bold;'>Stopped</span> ";
+  content += "<p id='replayStats'></p>";
 
   content += "<h3>Uploaded Log Preview:</h3>";
   content += "<pre id='file-content'></pre>";
@@ -100,21 +123,27 @@ String can_replay_processor(void) {
   content += "<script>";
   content += "function startReplay() {";
   content += "  let loop = document.getElementById('loopCheckbox').checked ? 1 : 0;";
-  content += "  fetch('/startReplay?loop=' + loop, { method: 'GET' })";
-  content += "    .then(response => response.text())";
-  content += "    .then(data => {";
-  content += "      console.log(data);";
-  content += "      document.getElementById('statusIndicator').innerText = 'Running...';";
-  content += "      document.getElementById('statusIndicator').style.color = 'green';";
-  content += "      if (loop === 0) {";  // If loop is not checked
-  content += "        setTimeout(() => {";
-  content += "          document.getElementById('statusIndicator').innerText = 'Completed';";
-  content += "          document.getElementById('statusIndicator').style.color = 'white';";
-  content += "        }, 5000);";  // 5-second timeout before reverting the text
-  content += "      }";
-  content += "    })";
+  content += "  let query = '/startReplay?loop=' + loop + '&speed=' + document.getElementById('replaySpeed').value;";
+  content += "  query += '&target=' + document.getElementById('replayTarget').value;";
+  content += "  const file = document.getElementById('replayFile');";
+  content += "  if (file && file.value) { query += '&file=' + encodeURIComponent(file.value); }";
+  content += "  fetch(query, { method: 'GET' })";
+  content += "    .then(response => response.text().then(text => { if (!response.ok) { alert(text); } }))";
+  content += "    .then(() => updateStatus())";
   content += "    .catch(error => console.error('Error:', error));";
   content += "}";
+  // The replay task reports its progress and how late the frames went out
+  content += "function updateStatus() {";
+  content += "  fetch('/replayStatus').then(response => response.json()).then(s => {";
+  content += "    const indicator = document.getElementById('statusIndicator');";
+  content += "    indicator.innerText = s.running ? 'Running...' : (s.sent > 0 ? 'Completed' : 'Stopped');";
+  content += "    indicator.style.color = s.running ? 'green' : 'white';";
+  content += "    document.getElementById('replayStats').innerText = s.loaded + ' frames loaded, ' +";
+  content += "      s.sent + ' sent, ' + s.loops + ' loops. Timing error: mean ' + s.mean_error_us + ' us, ' +";
+  content += "      'max ' + s.max_error_us + ' us, ' + s.late + ' frames over 1 ms late';";
+  content += "  }).catch(error => console.error('Error:', error));";
+  content += "}";
+  content += "updateStatus(); setInterval(updateStatus, 1000);";
   content += "function stopReplay() {";
   content += "  fetch('/stopReplay', { method: 'GET' })";
   content += "    .then(response => response.text())";
@@ -0,0 +1,158 @@
+#include "can_statistics_html.h"
+#include <Arduino.h>
+#include "../../communication/can/CanFlightRecorder.h"
+#include "../../communication/can/CanSupervisor.h"
+#include "../../communication/usb/comm_usb.h"
+#include "../../datalayer/datalayer.h"
+#include "../utils/events.h"
+#include "../utils/types.h"
+#include "webserver.h"
+
+String can_statistics_processor(const String& var) {
+  if (var == "X") {
+    const DataLayer& snapshot = refresh_web_snapshot();
+    String content = "";
+    content.reserve(4000);
+    // Page format
+    content += "<style>";
+    content += "body { background-color: black; color: white; }";
+    content +=
+        "button { background-color: #505E67; color: white; border: none; padding: 10px 20px; margin-bottom: 20px; "
+        "cursor: pointer; border-radius: 10px; }";
+    content += "button:hover { background-color: #3A4A52; }";
+    content += "table { border-collapse: collapse; } td, th { border: 1px solid white; padding: 4px 10px; }";
+    content += "</style>";
+    content += "<button onclick='home()'>Back to main page</button>";
+
+    bool any_active = false;
+    for (int i = 0; i < NO_CAN_INTERFACE; i++) {
+      const auto& stats = snapshot.system.status.can_bus_stats[i];
+      if (!stats.active) {
+        continue;
+      }
+      any_active = true;
+
+      content += "<div style='background-color: #303E47; padding: 10px; margin-bottom: 10px; border-radius: 50px'>";
+      content += "<h4>" + String(getCANInterfaceName((CAN_Interface)i)) + ", " + String(stats.bitrate / 1000) +
+                 " kbit/s</h4>";
+      content += "<h4>Bus load: " + String(stats.utilization_dpct / 10) + "." + String(stats.utilization_dpct % 10) +
+                 " % (" + String(stats.bits_per_second) + " bit/s, " + String(stats.frames_per_second) +
+                 " frames/s)</h4>";
+      content += "<h4>Controller: ";
+      if (stats.bus_off) {
+        content += "<span style='color: red;'>bus-off</span>";
+      } else if (stats.error_passive) {
+        content += "<span style='color: orange;'>error passive</span>";
+      } else {
+        content += "error active";
+      }
+      content += ", TEC " + String(stats.tx_error_counter) + ", REC " + String(stats.rx_error_counter) +
+                 ", flags 0x" + String(stats.error_flags, HEX) + "</h4>";
+
+      content += "<h4>" + String(stats.id_count) + " IDs seen, busiest:</h4>";
+      content += "<table><tr><th>ID</th><th>RX/s</th><th>TX/s</th></tr>";
+      for (int j = 0; j < CAN_ID_RATE_TABLE_SIZE; j++) {
+        const auto& rate = stats.id_rates[j];
+        if (rate.rx_per_second == 0 && rate.tx_per_second == 0) {
+          break;
+        }
+        content += "<tr><td>0x" + String(rate.id, HEX) + (rate.ext_ID ? " (ext)" : "") + "</td><td>" +
+                   String(rate.rx_per_second) + "</td><td>" + String(rate.tx_per_second) + "</td></tr>";
+      }
+      content += "</table>";
+      content += "</div>";
+    }
+
+    if (!any_active) {
+      content += "<h4>No CAN interface in use</h4>";
+    }
+
+    const DATALAYER_SD_LOG_STATS_TYPE* sd_logs[] = {&snapshot.system.status.sd_can_log_stats,
+                                                     &snapshot.system.status.sd_log_stats};
+    const char* sd_log_names[] = {"CAN log", "General log"};
+    for (int i = 0; i < 2; i++) {
+      const auto& stats = *sd_logs[i];
+      if (!stats.active) {
+        continue;
+      }
+      content += "<div style='background-color: #303E47; padding: 10px; margin-bottom: 10px; border-radius: 50px'>";
+      content += "<h4>SD card " + String(sd_log_names[i]) + "</h4>";
+      content += "<h4>Writing: " + String(stats.bytes_per_second) + " bytes/s, " +
+                 String((uint32_t)(stats.bytes_written / 1024)) + " kB since boot</h4>";
+      content += "<h4>Slowest write: " + String(stats.write_latency_max_us) + " us</h4>";
+      content += "<h4>Dropped: " + String(stats.dropped_bytes) + " bytes, write errors: " +
+                 String(stats.write_errors) + ", new files: " + String(stats.files_rotated) + "</h4>";
+      content += "</div>";
+    }
+
+    const auto& usb = snapshot.system.status.usb_output_stats;
+    if (usb.active) {
+      content += "<div style='background-color: #303E47; padding: 10px; margin-bottom: 10px; border-radius: 50px'>";
+      content += "<h4>USB serial output</h4>";
+      content += "<h4>Host: " + String(usb.host_connected ? "receiving" : "not connected") + ", " +
+                 String((uint32_t)(usb.bytes_sent / 1024)) + " kB sent since boot</h4>";
+      content += "<h4>Buffer peak: " + String(usb.buffer_peak_bytes) + " of " + String(USB_OUTPUT_BUFFER_SIZE) +
+                 " bytes</h4>";
+      content += "<h4>Dropped: " + String(usb.dropped_frames) + " CAN frames, " + String(usb.dropped_bytes) +
+                 " bytes</h4>";
+      content += "</div>";
+    }
+
+    const CanFlightState flight_state = can_flight_recorder.state();
+    if (flight_state != CanFlightState::Off) {
+      static const char* const flight_state_names[] = {"off", "recording", "triggered, recording on", "frozen"};
+      content += "<div style='background-color: #303E47; padding: 10px; margin-bottom: 10px; border-radius: 50px'>";
+      content += "<h4>CAN flight recorder: " + String(flight_state_names[(int)flight_state]) + "</h4>";
+      content += "<h4>" + String((uint32_t)(can_flight_recorder.capacity_blocks() * CAN_LOG_BLOCK_SIZE / 1024)) +
+                 " kB, " + String(can_flight_recorder.frames()) + " frames recorded since boot</h4>";
+      if (flight_state == CanFlightState::Triggered || flight_state == CanFlightState::Frozen) {
+        content += "<h4>Triggered by " +
+                   String(get_event_enum_string((EVENTS_ENUM_TYPE)can_flight_recorder.trigger_reason())) + " at " +
+                   String((uint32_t)(can_flight_recorder.trigger_time_us() / 1000000)) + " s</h4>";
+      }
+      content += "<h4><a href='/export_can_flight' style='color: white;'>Last recording as text</a>, ";
+      content += "<a href='/export_can_flight?format=bin' style='color: white;'>binary</a>";
+      if (flight_state == CanFlightState::Frozen) {
+        content += ", <a href='/rearm_can_flight' style='color: white;'>rearm</a>";
+      }
+      content += "</h4>";
+      content += "</div>";
+    }
+
+    // Freshness of the CAN IDs the protocols expect periodically
+    const auto& supervised = can_supervisor.get_entries();
+    if (!supervised.empty()) {
+      const unsigned long now = millis();
+      content += "<div style='background-color: #303E47; padding: 10px; margin-bottom: 10px; border-radius: 50px'>";
+      content += "<h4>Supervised CAN IDs</h4>";
+      content += "<table><tr><th>Interface</th><th>ID</th><th>Period</th><th>Last seen</th><th>State</th>"
+                 "<th>Timeouts</th></tr>";
+      for (const auto& entry : supervised) {
+        content += "<tr><td>" + String(getCANInterfaceName(entry.interface)) + "</td><td>0x" + String(entry.id, HEX) +
+                   (entry.critical ? " (critical)" : "") + "</td><td>";
+        content += entry.period_ms > 0 ? String(entry.period_ms) + " ms" : String("-");
+        content += "</td><td>";
+        content += entry.seen ? String(now - entry.last_seen_ms) + " ms ago" : String("never");
+        content += "</td><td>";
+        if (entry.missing) {
+          content += "<span style='color: red;'>missing</span>";
+        } else if (entry.seen) {
+          content += "fresh";
+        } else {
+          content += "waiting";
+        }
+        content += "</td><td>" + String(entry.timeouts) + "</td></tr>";
+      }
+      content += "</table>";
+      content += "</div>";
+    }
+
+    content += "<script>";
+    content += "function home() { window.location.href = '/'; }";
+    // The counters are sampled once per second
+    content += "setTimeout(function(){ location.reload(); }, 2000);";
+    content += "</script>";
+    return content;
+  }
+  return String();
+}
@@ -0,0 +1,15 @@
+#ifndef CANSTATISTICS_H
+#define CANSTATISTICS_H
+
+#include <WString.h>
+
+/**
+ * @brief Replaces placeholder with content section in web page
+ *
+ * @param[in] var
+ *
+ * @return String
+ */
+String can_statistics_processor(const String& var);
+
+#endif
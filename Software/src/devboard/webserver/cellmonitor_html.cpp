@@ -2,9 +2,11 @@
 #include <Arduino.h>
 #include "../../battery/BATTERIES.h"
 #include "../../datalayer/datalayer.h"
+#include "webserver.h"
 
 String cellmonitor_processor(const String& var) {
   if (var == "X") {
+    const DataLayer& snapshot = refresh_web_snapshot();
     String content = "";
     // Page formatH
     content += "<style>";
@@ -63,8 +65,8 @@ String cellmonitor_processor(const String& var) {
         "margin-right: 15px;'>Idle</span>";
     bool battery_balancing = false;
     // Check per-cell balancing status
-    for (uint8_t i = 0u; i < datalayer.battery.info.number_of_cells; i++) {
-      battery_balancing = datalayer.battery.status.cell_balancing_status[i];
+    for (uint8_t i = 0u; i < snapshot.battery.info.number_of_cells; i++) {
+      battery_balancing = snapshot.battery.status.cell_balancing_status[i];
       if (battery_balancing)
         break;
     }
@@ -74,7 +76,7 @@ String cellmonitor_processor(const String& var) {
           "4px; margin-right: 15px;'>Balancing</span>";
     }
     // Also check overall balancing status enum (for batteries without per-cell data)
-    else if (datalayer.battery.status.balancing_status == BALANCING_STATUS_ACTIVE) {
+    else if (snapshot.battery.status.balancing_status == BALANCING_STATUS_ACTIVE) {
       content +=
           "<span style='color: black; background-color: #ff9900ff; font-weight: bold; padding: 2px 8px; border-radius: "
           "4px; margin-right: 15px;'>Balancing is active now!</span>";
@@ -104,8 +106,8 @@ String cellmonitor_processor(const String& var) {
           "margin-right: 15px;'>Idle</span>";
 
       bool battery2_balancing = false;
-      for (uint8_t i = 0u; i < datalayer.battery2.info.number_of_cells; i++) {
-        battery2_balancing = datalayer.battery2.status.cell_balancing_status[i];
+      for (uint8_t i = 0u; i < snapshot.battery2.info.number_of_cells; i++) {
+        battery2_balancing = snapshot.battery2.status.cell_balancing_status[i];
         if (battery2_balancing)
           break;
       }
@@ -140,8 +142,8 @@ String cellmonitor_processor(const String& var) {
           "margin-right: 15px;'>Idle</span>";
 
       bool battery3_balancing = false;
-      for (uint8_t i = 0u; i < datalayer.battery3.info.number_of_cells; i++) {
-        battery3_balancing = datalayer.battery3.status.cell_balancing_status[i];
+      for (uint8_t i = 0u; i < snapshot.battery3.info.number_of_cells; i++) {
+        battery3_balancing = snapshot.battery3.status.cell_balancing_status[i];
         if (battery3_balancing)
           break;
       }
@@ -163,20 +165,20 @@ String cellmonitor_processor(const String& var) {
     content += "<script>";
     // Populate cell data
     content += "const data = [";
-    for (uint8_t i = 0u; i < datalayer.battery.info.number_of_cells; i++) {
-      if (datalayer.battery.status.cell_voltages_mV[i] == 0) {
+    for (uint8_t i = 0u; i < snapshot.battery.info.number_of_cells; i++) {
+      if (snapshot.battery.status.cell_voltages_mV[i] == 0) {
         continue;
       }
-      content += String(datalayer.battery.status.cell_voltages_mV[i]) + ",";
+      content += String(snapshot.battery.status.cell_voltages_mV[i]) + ",";
     }
     content += "];";
 
     content += "const balancing = [";
-    for (uint8_t i = 0u; i < datalayer.battery.info.number_of_cells; i++) {
-      if (datalayer.battery.status.cell_voltages_mV[i] == 0) {
+    for (uint8_t i = 0u; i < snapshot.battery.info.number_of_cells; i++) {
+      if (snapshot.battery.status.cell_voltages_mV[i] == 0) {
         continue;
       }
-      content += datalayer.battery.status.cell_balancing_status[i] ? "true," : "false,";
+      content += snapshot.battery.status.cell_balancing_status[i] ? "true," : "false,";
     }
     content += "];";
 
@@ -276,7 +278,7 @@ String cellmonitor_processor(const String& var) {
         "const cell_dev = max_mv - min_mv;"
         "const voltVal = document.getElementById('voltageValues');"
         "voltVal.innerHTML = `Max Voltage : ${max_mv} mV<br>Min Voltage: ${min_mv} mV<br>Voltage Deviation: ";
-    if (datalayer.battery.status.balancing_status == BALANCING_STATUS_ACTIVE) {
+    if (snapshot.battery.status.balancing_status == BALANCING_STATUS_ACTIVE) {
       content += "${cell_dev} mV (Battery is balancing now!)`}";
     } else {
       content += "${cell_dev} mV`}";
@@ -289,9 +291,9 @@ String cellmonitor_processor(const String& var) {
     content += "updateVoltageValues(data);";
     content += "}";
     content += "else {";
-    if (datalayer.battery.info.number_of_cells > 0) {
+    if (snapshot.battery.info.number_of_cells > 0) {
       content += "document.getElementById('voltageValues').textContent = '" +
-                 String(datalayer.battery.info.number_of_cells) + " cells configured, but cellvoltages not yet read';";
+                 String(snapshot.battery.info.number_of_cells) + " cells configured, but cellvoltages not yet read';";
     } else {
       content +=
           "document.getElementById('voltageValues').textContent = 'Amount of cells unknown. Cellvoltages not yet "
@@ -302,20 +304,20 @@ String cellmonitor_processor(const String& var) {
     if (battery2) {
       // Populate cell data
       content += "const data2 = [";
-      for (uint8_t i = 0u; i < datalayer.battery2.info.number_of_cells; i++) {
-        if (datalayer.battery2.status.cell_voltages_mV[i] == 0) {
+      for (uint8_t i = 0u; i < snapshot.battery2.info.number_of_cells; i++) {
+        if (snapshot.battery2.status.cell_voltages_mV[i] == 0) {
           continue;
         }
-        content += String(datalayer.battery2.status.cell_voltages_mV[i]) + ",";
+        content += String(snapshot.battery2.status.cell_voltages_mV[i]) + ",";
       }
       content += "];";
 
       content += "const balancing2 = [";
-      for (uint8_t i = 0u; i < datalayer.battery2.info.number_of_cells; i++) {
-        if (datalayer.battery2.status.cell_voltages_mV[i] == 0) {
+      for (uint8_t i = 0u; i < snapshot.battery2.info.number_of_cells; i++) {
+        if (snapshot.battery2.status.cell_voltages_mV[i] == 0) {
           continue;
         }
-        content += datalayer.battery2.status.cell_balancing_status[i] ? "true," : "false,";
+        content += snapshot.battery2.status.cell_balancing_status[i] ? "true," : "false,";
       }
       content += "];";
 
@@ -423,9 +425,9 @@ String cellmonitor_processor(const String& var) {
       content += "updateVoltageValues2(data2);";
       content += "}";
       content += "else {";
-      if (datalayer.battery2.info.number_of_cells > 0) {
+      if (snapshot.battery2.info.number_of_cells > 0) {
         content += "document.getElementById('voltageValues2').textContent = '" +
-                   String(datalayer.battery2.info.number_of_cells) +
+                   String(snapshot.battery2.info.number_of_cells) +
                    " cells configured, but cellvoltages not yet read';";
       } else {
         content +=
@@ -438,20 +440,20 @@ String cellmonitor_processor(const String& var) {
     if (battery3) {
       // Populate cell data
       content += "const data3 = [";
-      for (uint8_t i = 0u; i < datalayer.battery3.info.number_of_cells; i++) {
-        if (datalayer.battery3.status.cell_voltages_mV[i] == 0) {
+      for (uint8_t i = 0u; i < snapshot.battery3.info.number_of_cells; i++) {
+        if (snapshot.battery3.status.cell_voltages_mV[i] == 0) {
           continue;
         }
-        content += String(datalayer.battery3.status.cell_voltages_mV[i]) + ",";
+        content += String(snapshot.battery3.status.cell_voltages_mV[i]) + ",";
       }
       content += "];";
 
       content += "const balancing3 = [";
-      for (uint8_t i = 0u; i < datalayer.battery3.info.number_of_cells; i++) {
-        if (datalayer.battery3.status.cell_voltages_mV[i] == 0) {
+      for (uint8_t i = 0u; i < snapshot.battery3.info.number_of_cells; i++) {
+        if (snapshot.battery3.status.cell_voltages_mV[i] == 0) {
           continue;
         }
-        content += datalayer.battery3.status.cell_balancing_status[i] ? "true," : "false,";
+        content += snapshot.battery3.status.cell_balancing_status[i] ? "true," : "false,";
       }
       content += "];";
 
@@ -559,9 +561,9 @@ String cellmonitor_processor(const String& var) {
       content += "updateVoltageValues3(data3);";
       content += "}";
       content += "else {";
-      if (datalayer.battery3.info.number_of_cells > 0) {
+      if (snapshot.battery3.info.number_of_cells > 0) {
         content += "document.getElementById('voltageValues3').textContent = '" +
-                   String(datalayer.battery3.info.number_of_cells) +
+                   String(snapshot.battery3.info.number_of_cells) +
                    " cells configured, but cellvoltages not yet read';";
       } else {
         content +=
@@ -3,45 +3,11 @@
 #include "../../datalayer/datalayer.h"
 #include "index_html.h"
 
-char* strnchr(const char* s, int c, size_t n) {
-  // Like strchr, but only searches the first 'n' bytes of the string.
-
-  if (s == NULL) {
-    return NULL;
-  }
-
-  // Iterate through the string up to 'n' characters or until a null terminator is found.
-  for (size_t i = 0; i < n && s[i] != '\0'; ++i) {
-    if (s[i] == c) {
-      // Character found, return a pointer to it.
-      return (char*)&s[i];
-    }
-  }
-
-  // If the character to be found is the null terminator, and we haven't exceeded
-  // 'n' bytes, check if the null terminator is at the current position.
-  if (c == '\0') {
-    for (size_t i = 0; i < n; ++i) {
-      if (s[i] == '\0') {
-        return (char*)&s[i];
-      }
-    }
-  }
-
-  // Character not found within the first 'n' bytes.
-  return NULL;
-}
+// Characters of the log the page keeps, older ones are removed as new ones come in
+#define DEBUG_LOG_PAGE_CHARACTERS 30000
 
 String debug_logger_processor(void) {
-  String content = String();
-  // Reserve enough space for the content to avoid reallocations.
-  if (!content.reserve(1000 + sizeof(datalayer.system.info.logged_can_messages))) {
-    if (content.reserve(15)) {
-      content += "Out of memory.";
-    }
-    return content;
-  }
-  content += index_html_header;
+  String content = index_html_header;
   // Page format
   content += "<style>";
   content += "body { background-color: black; color: white; font-family: Arial, sans-serif; }";
@@ -53,50 +19,37 @@ String debug_logger_processor(void) {
       ".can-message { background-color: #404E57; margin-bottom: 5px; padding: 10px; border-radius: 5px; font-family: "
       "monospace; }";
   content += "</style>";
-  if (datalayer.system.info.web_logging_active) {
-    content += "<button onclick='refreshPage()'>Refresh data</button> ";
-  }
   content += "<button onclick='exportLog()'>Export to .txt</button> ";
   if (datalayer.system.info.SD_logging_active) {
     content += "<button onclick='deleteLog()'>Delete log file</button> ";
   }
   content += "<button onclick='goToMainPage()'>Back to main page</button>";
 
-  // Start a new block for the debug log messages
-  content += "<PRE style='text-align: left'>";
-  size_t offset = datalayer.system.info.logged_can_messages_offset;
-  // If we're mid-buffer, print the older part first.
-  if (offset > 0 && offset < (sizeof(datalayer.system.info.logged_can_messages) - 1)) {
-    // Find the next newline after the current offset. The offset will always be
-    // before the penultimate character, so (offset + 1) will be the final '\0'
-    // or earlier.
-
-    char* next_newline = strnchr(&datalayer.system.info.logged_can_messages[offset + 1], '\n',
-                                 sizeof(datalayer.system.info.logged_can_messages) - offset - 1);
-
-    if (next_newline != NULL) {
-      // We found a newline, so append from the character after that. We check
-      // the string length to ensure we don't add any intermediate '\0'
-      // characters.
-      content.concat(next_newline + 1,
-                     strnlen(next_newline + 1, sizeof(datalayer.system.info.logged_can_messages) - offset - 2));
-    } else {
-      // No newline found, so append from the next character after the offset to
-      // the end of the buffer. We check the string length to ensure we don't
-      // add any intermediate '\0' characters.
-      content.concat(&datalayer.system.info.logged_can_messages[offset + 1],
-                     strnlen(&datalayer.system.info.logged_can_messages[offset + 1],
-                             sizeof(datalayer.system.info.logged_can_messages) - offset - 1));
-    }
-  }
-  // Append the first part of the buffer up to the current write offset (which
-  // points to the first \0).
-  content.concat(datalayer.system.info.logged_can_messages, offset);
-  content += "</PRE>";
+  // Block for the debug log messages, filled by the script below
+  content += "<PRE id='log' style='text-align: left'></PRE>";
 
   // Add JavaScript for navigation
   content += "<script>";
-  content += "function refreshPage(){ location.reload(true); }";
+  if (datalayer.system.info.web_logging_active) {
+    // New messages are fetched from the history by sequence number
+    content += "var next = 0;";
+    content += "function poll() {";
+    content += "  fetch('/debug_log_entries?since=' + next).then(function(response) {";
+    content += "    next = response.headers.get('X-Log-Next');";
+    content += "    var lost = Number(response.headers.get('X-Log-Lost'));";
+    content += "    var more = response.headers.get('X-Log-More') == '1';";
+    content += "    return response.text().then(function(text) {";
+    content += "      var log = document.getElementById('log');";
+    content += "      if (lost > 0) {";
+    content += "        text = '\\n[' + lost + ' log entries were overwritten before they could be shown]\\n' + text;";
+    content += "      }";
+    content += "      log.textContent = (log.textContent + text).slice(-" + String(DEBUG_LOG_PAGE_CHARACTERS) + ");";
+    content += "      setTimeout(poll, more ? 0 : 1000);";
+    content += "    });";
+    content += "  }).catch(function() { setTimeout(poll, 2000); });";
+    content += "}";
+    content += "poll();";
+  }
   content += "function exportLog() { window.location.href = '/export_log'; }";
   if (datalayer.system.info.SD_logging_active) {
     content += "function deleteLog() { window.location.href = '/delete_log'; }";
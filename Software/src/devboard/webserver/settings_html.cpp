@@ -5,7 +5,10 @@
 #include "../../charger/CHARGERS.h"
 #include "../../communication/can/comm_can.h"
 #include "../../communication/nvm/comm_nvm.h"
+#include "../../communication/usb/comm_usb.h"
 #include "../../datalayer/datalayer.h"
+#include "../sdcard/sdcard.h"
+#include "../utils/log_levels.h"
 #include "html_escape.h"
 #include "index_html.h"
 #include "src/battery/BATTERIES.h"
@@ -100,6 +103,17 @@ String options_from_map(int selected, const TMap& value_name_map) {
 
 static const std::map<int, String> led_modes = {{0, "Classic"}, {1, "Energy Flow"}, {2, "Heartbeat"}};
 
+static const std::map<int, String> can_usb_modes = {
+    {(int)CanUsbMode::Text, "Text"}, {(int)CanUsbMode::Gvret, "GVRET (SavvyCAN)"}, {(int)CanUsbMode::Slcan, "SLCAN"}};
+
+static const std::map<int, String> can_flight_triggers = {{(int)CanFlightTrigger::Listed, "Critical events"},
+                                                          {(int)CanFlightTrigger::Errors, "Critical events and errors"},
+                                                          {(int)CanFlightTrigger::Warnings, "Any warning or error"}};
+
+static const std::map<int, String> log_levels = {{LOG_LEVEL_NONE, "Off"},       {LOG_LEVEL_ERROR, "Error"},
+                                                 {LOG_LEVEL_WARNING, "Warning"}, {LOG_LEVEL_INFO, "Info"},
+                                                 {LOG_LEVEL_DEBUG, "Debug"},     {LOG_LEVEL_VERBOSE, "Verbose"}};
+
 static const std::map<int, String> tesla_countries = {
     {21843, "US (USA)"},     {17217, "CA (Canada)"},  {18242, "GB (UK & N Ireland)"},
     {17483, "DK (Denmark)"}, {17477, "DE (Germany)"}, {16725, "AU (Australia)"}};
@@ -251,6 +265,23 @@ String settings_processor(const String& var, BatteryEmulatorSettingsStore& setti
     return options_from_map(settings.getUInt("LEDMODE", 0), led_modes);
   }
 
+  if (var == "CANUSBMODE") {
+    return options_from_map(settings.getUInt("CANUSBMODE", (int)CanUsbMode::Text), can_usb_modes);
+  }
+
+  if (var == "LOGLEVELS") {
+    // One select per log module, named after its setting
+    String html;
+    for (int module = 0; module < LOG_MODULE_COUNT; module++) {
+      const String name = log_module_setting((LogModule)module);
+      html += "<label for='" + name + "'>Log level " + log_module_name((LogModule)module) + ": </label>";
+      html += "<select name='" + name + "' id='" + name + "'>";
+      html += options_from_map(settings.getUInt(name.c_str(), LOG_LEVEL_INFO), log_levels);
+      html += "</select>";
+    }
+    return html;
+  }
+
   if (var == "SUNGROW_MODEL") {
     return options_from_map(settings.getUInt("INVBTYPE", 1), sungrow_models);  // Default: SBR096
   }
@@ -417,6 +448,19 @@ String raw_settings_processor(const String& var, BatteryEmulatorSettingsStore& s
     return settings.getBool("CANFDASCAN") ? "checked" : "";
   }
 
+  if (var == "CANHWFILTER") {
+    return settings.getBool("CANHWFILTER") ? "checked" : "";
+  }
+
+  if (var == "CANHWFILTERNOTE") {
+    // The same exceptions as accepted_can_ids() in comm_can.cpp, which need the whole bus
+    if (settings.getBool("CANHWFILTER") && (settings.getBool("CANLOGSD") || settings.getBool("CANLOGUSB") ||
+                                            settings.getUInt("CANFLIGHTKB", CAN_FLIGHT_DEFAULT_KB) > 0)) {
+      return " (inactive: CAN logging or flight recorder on)";
+    }
+    return "";
+  }
+
   if (var == "WIFIAPENABLED") {
     return settings.getBool("WIFIAPENABLED", wifiap_enabled) ? "checked" : "";
   }
@@ -802,6 +846,58 @@ String raw_settings_processor(const String& var, BatteryEmulatorSettingsStore& s
     return String(settings.getUInt("CANFDFREQ", 40));
   }
 
+  if (var == "CANRXBUDNAT") {
+    return String(settings.getUInt("CANRXBUDNAT", CAN_RX_BUDGET_PER_TICK));
+  }
+
+  if (var == "CANRXBUD2515") {
+    return String(settings.getUInt("CANRXBUD2515", CAN_RX_BUDGET_PER_TICK));
+  }
+
+  if (var == "CANRXBUDFD") {
+    return String(settings.getUInt("CANRXBUDFD", CAN_RX_BUDGET_PER_TICK));
+  }
+
+  if (var == "CANBUF2515") {
+    return String(settings.getUInt("CANBUF2515", CAN_ADDON_RX_BUFFER_SIZE));
+  }
+
+  if (var == "CANFLIGHTKB") {
+    return String(settings.getUInt("CANFLIGHTKB", CAN_FLIGHT_DEFAULT_KB));
+  }
+
+  if (var == "CANFLIGHTPRE") {
+    return String(settings.getUInt("CANFLIGHTPRE", CAN_FLIGHT_DEFAULT_PRE_S));
+  }
+
+  if (var == "CANFLIGHTPOST") {
+    return String(settings.getUInt("CANFLIGHTPOST", CAN_FLIGHT_DEFAULT_POST_S));
+  }
+
+  if (var == "CANFLIGHTTRIG") {
+    return options_from_map(settings.getUInt("CANFLIGHTTRIG", (int)CanFlightTrigger::Listed), can_flight_triggers);
+  }
+
+  if (var == "SDBLOCKKB") {
+    return String(settings.getUInt("SDBLOCKKB", SD_BLOCK_SIZE_KB));
+  }
+
+  if (var == "SDFLUSHS") {
+    return String(settings.getUInt("SDFLUSHS", SD_FLUSH_INTERVAL_S));
+  }
+
+  if (var == "SDROTATEMB") {
+    return String(settings.getUInt("SDROTATEMB", SD_ROTATE_SIZE_MB));
+  }
+
+  if (var == "SDROTATEH") {
+    return String(settings.getUInt("SDROTATEH", 0));
+  }
+
+  if (var == "SDKEEPFILES") {
+    return String(settings.getUInt("SDKEEPFILES", SD_RETAINED_FILES));
+  }
+
   if (var == "PRECHGMS") {
     return String(settings.getUInt("PRECHGMS", 100));
   }
@@ -1434,6 +1530,10 @@ const char* getCANInterfaceName(CAN_Interface interface) {
         <input type='checkbox' name='CANFDASCAN' value='on' %CANFDASCAN% 
         title="When enabled, CAN-FD channel will operate as normal 500kbps CAN" />
 
+        <label>Filter CAN frames in hardware%CANHWFILTERNOTE%: </label>
+        <input type='checkbox' name='CANHWFILTER' value='on' %CANHWFILTER% 
+        title="Drops frames the battery and inverter do not use in the CAN controllers, saving CPU time on busy buses. They are then missing from the web CAN log, bus load and per-ID statistics. Not applied while logging CAN to SD or USB, or with the flight recorder on. Takes effect after reboot" />
+
         <label>CAN addon crystal (Mhz): </label>
         <input type='number' name='CANFREQ' value="%CANFREQ%" 
         min="0" max="1000" step="1"
@@ -1443,6 +1543,44 @@ const char* getCANInterfaceName(CAN_Interface interface) {
         <input type='number' name='CANFDFREQ' value="%CANFDFREQ%" 
         min="0" max="1000" step="1"
         title="Configure this if you are using a custom add-on CAN board. Integers only" />
+
+        <label>Native CAN RX frames per tick: </label>
+        <input type='number' name='CANRXBUDNAT' value="%CANRXBUDNAT%" 
+        min="1" max="64" step="1"
+        title="Max CAN frames handled from this interface each millisecond. Raise if overruns are reported on busy buses" />
+
+        <label>CAN addon RX frames per tick: </label>
+        <input type='number' name='CANRXBUD2515' value="%CANRXBUD2515%" 
+        min="1" max="64" step="1"
+        title="Max CAN frames handled from this interface each millisecond. Raise if overruns are reported on busy buses" />
+
+        <label>CAN-FD addon RX frames per tick: </label>
+        <input type='number' name='CANRXBUDFD' value="%CANRXBUDFD%" 
+        min="1" max="64" step="1"
+        title="Max CAN frames handled from this interface each millisecond. Raise if overruns are reported on busy buses" />
+
+        <label>CAN addon RX driver buffer (frames): </label>
+        <input type='number' name='CANBUF2515' value="%CANBUF2515%" 
+        min="8" max="256" step="1"
+        title="Frames the CAN addon driver holds until they are processed. Raise if the addon reports driver buffer overflows. Takes effect after reboot" />
+
+        <label>CAN flight recorder memory (kB): </label>
+        <input type='number' name='CANFLIGHTKB' value="%CANFLIGHTKB%" 
+        min="0" max="4096" step="1"
+        title="Keeps the latest CAN traffic of all interfaces in RAM, frozen when an event triggers it. Saved to the SD card while SD logging is on, else downloaded from CAN statistics. Records again once the recording is saved or downloaded. 0 disables it. Above 64 kB only with PSRAM. Takes effect after reboot" />
+
+        <label>CAN flight recorder seconds before/after event: </label>
+        <div>
+        <input type='number' name='CANFLIGHTPRE' value="%CANFLIGHTPRE%" min="1" max="600" step="1"
+        title="Seconds of traffic kept from before the event, as far as the memory holds them" />
+        <input type='number' name='CANFLIGHTPOST' value="%CANFLIGHTPOST%" min="0" max="600" step="1"
+        title="Seconds recorded after the event" />
+        </div>
+
+        <label for='CANFLIGHTTRIG'>CAN flight recorder trigger: </label><select name='CANFLIGHTTRIG' id='CANFLIGHTTRIG'
+        title="Critical events: overheat, thermal runaway, welded contactor, missing battery or inverter, task overrun">
+        %CANFLIGHTTRIG%
+        </select>
         
         <label>Equipment stop button: </label><select name='EQSTOP'>
         %EQSTOP%  
@@ -1631,7 +1769,12 @@ const char* getCANInterfaceName(CAN_Interface interface) {
 
         <label>Enable CAN message logging via USB serial: </label>
         <input type='checkbox' name='CANLOGUSB' value='on' %CANLOGUSB%  
-              title="WARNING: Causes performance issues. Enable this to get incoming/outgoing CAN messages logged via USB cable. Avoid if possible" />
+              title="Enable this to get incoming/outgoing CAN messages logged via USB cable. Frames are dropped when the host does not keep up, see CAN statistics" />
+
+        <label for='CANUSBMODE'>USB CAN log format: </label><select name='CANUSBMODE' id='CANUSBMODE'
+              title="Text: readable candump style lines. GVRET and SLCAN: connect SavvyCAN or slcand directly to the USB port. General logging via USB is not sent in GVRET and SLCAN mode">
+        %CANUSBMODE%
+        </select>
         <script> //Make sure user only uses one general logging method, improves performance
         function handleCheckboxSelection(clickedCheckbox) { 
             const usbCheckbox = document.querySelector('input[name="USBENABLED"]');
@@ -1659,6 +1802,8 @@ const char* getCANInterfaceName(CAN_Interface interface) {
               onclick="handleCheckboxSelection(this)"         
               title="Enable this if you want general logging available in the Webserver" />
 
+        %LOGLEVELS%
+
         <label>Enable CAN message logging via SD card: </label>
         <input type='checkbox' name='CANLOGSD' value='on' %CANLOGSD% 
         title="Enable this if you want incoming/outgoing CAN messages to be stored to an SD card. Only works on select hardware with SD-card slot" />
@@ -1667,6 +1812,31 @@ const char* getCANInterfaceName(CAN_Interface interface) {
         <input type='checkbox' name='SDLOGENABLED' value='on' %SDLOGENABLED% 
         title="Enable this if you want general logging to be stored to an SD card. Only works on select hardware with SD-card slot" />
 
+        <label>SD card write block (kB): </label>
+        <input type='number' name='SDBLOCKKB' value="%SDBLOCKKB%" 
+        min="4" max="32" step="4"
+        title="CAN log data is gathered in memory and written to the SD card in blocks of this size. Larger blocks mean fewer writes but use more memory" />
+
+        <label>SD card flush interval (s): </label>
+        <input type='number' name='SDFLUSHS' value="%SDFLUSHS%" 
+        min="1" max="60" step="1"
+        title="Longest time logged data stays in memory before it is written to the SD card. Data still in memory is lost on power loss" />
+
+        <label>SD card new file after (MB): </label>
+        <input type='number' name='SDROTATEMB' value="%SDROTATEMB%" 
+        min="0" max="4000" step="1"
+        title="Start a new log file when the current one reaches this size. 0 to never start a new file on size" />
+
+        <label>SD card new file after (hours): </label>
+        <input type='number' name='SDROTATEH' value="%SDROTATEH%" 
+        min="0" max="720" step="1"
+        title="Start a new log file when the current one is this old. 0 to never start a new file on age" />
+
+        <label>SD card older files kept: </label>
+        <input type='number' name='SDKEEPFILES' value="%SDKEEPFILES%" 
+        min="0" max="20" step="1"
+        title="Amount of older log files kept next to the current one, the oldest is deleted when a new file is started" />
+
         </div>
          </div>
 
@@ -1,11 +1,13 @@
 #include "webserver.h"
 #include <Preferences.h>
 #include <ctime>
+#include <memory>
 #include <vector>
 #include "../../battery/BATTERIES.h"
 #include "../../battery/Battery.h"
 #include "../../battery/Shunt.h"
 #include "../../charger/CHARGERS.h"
+#include "../../communication/can/CanReplay.h"
 #include "../../communication/can/comm_can.h"
 #include "../../communication/contactorcontrol/comm_contactorcontrol.h"
 #include "../../communication/equipmentstopbutton/comm_equipmentstopbutton.h"
@@ -15,11 +17,17 @@
 #include "../../devboard/safety/safety.h"
 #include "../../inverter/INVERTERS.h"
 #include "../../lib/bblanchon-ArduinoJson/ArduinoJson.h"
+#include "../sdcard/can_log_index.h"
+#include "../sdcard/sd_block_writer.h"
 #include "../sdcard/sdcard.h"
 #include "../utils/events.h"
+#include "../utils/log_levels.h"
+#include "../utils/log_ring.h"
 #include "../utils/led_handler.h"
+#include "../utils/snapshot_buffer.h"
 #include "../utils/timer.h"
 #include "esp_task_wdt.h"
+#include "esp_timer.h"
 #include "html_escape.h"
 
 #include <string>
@@ -37,6 +45,7 @@ unsigned long ota_progress_millis = 0;
 #include "advanced_battery_html.h"
 #include "can_logging_html.h"
 #include "can_replay_html.h"
+#include "can_statistics_html.h"
 #include "cellmonitor_html.h"
 #include "debug_logging_html.h"
 #include "events_html.h"
@@ -48,125 +57,233 @@ bool ota_active = false;
 
 const char get_firmware_info_html[] = R"rawliteral(%X%)rawliteral";
 
-String importedLogs = "";      // Store the uploaded logfile contents in RAM
+// Frames of the uploaded CAN log as binary records, loaded once while the upload arrives
+std::vector<uint8_t> replay_records;
+CanReplayLoader replay_loader(replay_records);
+static bool replay_upload_rejected = false;
+
 bool isReplayRunning = false;  // Global flag to track replay state
+static volatile bool replay_stop_requested = false;
+// Binary log on the SD card to replay instead of the upload, empty for the upload
+static char replay_file[32] = "";
+static uint16_t replay_speed = 100;
+// Feed the frames to the local receivers with inject_can_frame() instead of transmitting them
+static bool replay_loopback = false;
+// Published by the replay task for the status page
+static SnapshotBuffer<CanReplayStats> replay_stats;
+// The running replay task, for /stopReplay to wake it. Cleared by the task under the mutex before it ends
+static TaskHandle_t replay_task = nullptr;
+static SemaphoreHandle_t replay_task_mutex = nullptr;
 
 // True when user has updated settings that need a reboot to be effective.
 bool settingsUpdated = false;
 
-CAN_frame currentFrame = {.FD = true, .ext_ID = false, .DLC = 64, .ID = 0x12F, .data = {0}};
-
 void handleFileUpload(AsyncWebServerRequest* request, String filename, size_t index, uint8_t* data, size_t len,
                       bool final) {
   if (!index) {
-    importedLogs = "";  // Clear previous logs
+    // The replay task reads the frames, they are not replaced under it
+    replay_upload_rejected = isReplayRunning;
+    if (!replay_upload_rejected) {
+      replay_loader.begin(filename.endsWith(".bin"));
+    }
     logging.printf("Receiving file: %s\n", filename.c_str());
   }
 
-  // Append received data to the string (RAM storage)
-  importedLogs += String((char*)data).substring(0, len);
+  if (!replay_upload_rejected) {
+    replay_loader.append(data, len);
+  }
 
   if (final) {
-    logging.println("Upload Complete!");
+    if (replay_upload_rejected) {
+      request->send(409, "text/plain", "Stop the replay before uploading a new log");
+      return;
+    }
+    replay_loader.end();
+    logging.printf("Upload Complete! %u frames, %u lines skipped\n", (unsigned)replay_loader.frames(),
+                   (unsigned)replay_loader.skipped_lines());
     request->send(200, "text/plain", "File uploaded successfully");
   }
 }
 
-void canReplayTask(void* param) {
-  std::vector<String> messages;
-  messages.reserve(1000);  // Pre-allocate memory to reduce fragmentation
-
-  if (!importedLogs.isEmpty()) {
-    int lastIndex = 0;
-
-    while (true) {
-      int nextIndex = importedLogs.indexOf("\n", lastIndex);
-      if (nextIndex == -1) {
-        messages.push_back(importedLogs.substring(lastIndex));
-        break;
-      }
-      messages.push_back(importedLogs.substring(lastIndex, nextIndex));
-      lastIndex = nextIndex + 1;
-    }
-
-    do {
-      float firstTimestamp = -1.0f;
-      float lastTimestamp = 0.0f;
-      bool firstMessageSent = false;  // Track first message
-
-      for (size_t i = 0; i < messages.size(); i++) {
-        String line = messages[i];
-        line.trim();
-        if (line.length() == 0)
-          continue;
-
-        int timeStart = line.indexOf("(") + 1;
-        int timeEnd = line.indexOf(")");
-        if (timeStart == 0 || timeEnd == -1)
-          continue;
+static uint64_t replay_clock_us() {
+  return esp_timer_get_time();
+}
 
-        float currentTimestamp = line.substring(timeStart, timeEnd).toFloat();
+static void wake_replay_task(void* task) {
+  xTaskNotifyGive((TaskHandle_t)task);
+}
 
-        if (firstTimestamp < 0) {
-          firstTimestamp = currentTimestamp;
-        }
+void canReplayTask(void* param) {
+  // The log is read piece by piece, from the SD card or from the loaded upload
+  File file;
+  size_t position = 0;
+  CanReplayEngine::Reader reader;
+  CanReplayEngine::Rewinder rewinder;
+  if (replay_file[0] != '\0') {
+    file = SD_MMC.open(replay_file, FILE_READ);
+    reader = [&file](uint8_t* buffer, size_t size) -> size_t { return file ? file.read(buffer, size) : 0; };
+    rewinder = [&file]() { return file && file.seek(0); };
+  } else {
+    reader = [&position](uint8_t* buffer, size_t size) {
+      const size_t count = std::min(size, replay_records.size() - position);
+      memcpy(buffer, replay_records.data() + position, count);
+      position += count;
+      return count;
+    };
+    rewinder = [&position]() {
+      position = 0;
+      return true;
+    };
+  }
 
-        // Send first message immediately
-        if (!firstMessageSent) {
-          firstMessageSent = true;
-          firstTimestamp = currentTimestamp;  // Adjust reference time
-        } else {
-          // Delay only if this isn't the first message
-          float deltaT = (currentTimestamp - lastTimestamp) * 1000;
-          vTaskDelay((int)deltaT / portTICK_PERIOD_MS);
+  const CAN_Interface replay_interface = (CAN_Interface)datalayer.system.info.can_replay_interface;
+  const bool fd_interface = replay_interface == CANFD_NATIVE || replay_interface == CANFD_ADDON_MCP2518;
+  CanReplayEngine engine(
+      reader, rewinder,
+      [replay_interface, fd_interface](const CAN_frame& frame, CAN_Interface, frameDirection direction) {
+        CAN_frame tx_frame = frame;
+        tx_frame.FD = fd_interface;
+        tx_frame.timestamp_us = 0;
+        if (replay_loopback) {
+          // What the recording device sent itself is not fed back to the receivers
+          return direction == MSG_TX || inject_can_frame(tx_frame, replay_interface);
         }
+        transmit_can_frame_to_interface(&tx_frame, replay_interface);
+        return true;
+      },
+      replay_clock_us);
+
+  // Frames are sent when an esp_timer wakes the task at their due time, instead of waiting whole ticks
+  esp_timer_handle_t timer = nullptr;
+  const esp_timer_create_args_t timer_args = {.callback = wake_replay_task,
+                                              .arg = xTaskGetCurrentTaskHandle(),
+                                              .dispatch_method = ESP_TIMER_TASK,
+                                              .name = "can_replay"};
+  esp_timer_create(&timer_args, &timer);
+
+  engine.start(replay_speed, datalayer.system.info.loop_playback);
+  while (!replay_stop_requested) {
+    const uint64_t next_us = engine.poll();
+    replay_stats.publish(engine.stats());
+    if (next_us == CAN_REPLAY_DONE) {
+      break;
+    }
+    if (engine.speed() == CAN_REPLAY_AS_FAST_AS_POSSIBLE) {
+      vTaskDelay(1);  // Let the transmit queue or the core task catch up
+      continue;
+    }
+    const int64_t wait_us = (int64_t)(next_us - esp_timer_get_time());
+    if (wait_us > 0 && esp_timer_start_once(timer, wait_us) == ESP_OK) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+  }
 
-        lastTimestamp = currentTimestamp;
-
-        int interfaceStart = timeEnd + 2;
-        int interfaceEnd = line.indexOf(" ", interfaceStart);
-        if (interfaceEnd == -1)
-          continue;
-
-        int idStart = interfaceEnd + 1;
-        int idEnd = line.indexOf(" [", idStart);
-        if (idStart == -1 || idEnd == -1)
-          continue;
-
-        String messageID = line.substring(idStart, idEnd);
-        int dlcStart = idEnd + 2;
-        int dlcEnd = line.indexOf("]", dlcStart);
-        if (dlcEnd == -1)
-          continue;
-
-        String dlc = line.substring(dlcStart, dlcEnd);
-        int dataStart = dlcEnd + 2;
-        String dataBytes = line.substring(dataStart);
-
-        currentFrame.ID = strtol(messageID.c_str(), NULL, 16);
-        currentFrame.DLC = dlc.toInt();
-
-        int byteIndex = 0;
-        char* token = strtok((char*)dataBytes.c_str(), " ");
-        while (token != NULL && byteIndex < currentFrame.DLC) {
-          currentFrame.data.u8[byteIndex++] = strtol(token, NULL, 16);
-          token = strtok(NULL, " ");
-        }
+  esp_timer_stop(timer);
+  esp_timer_delete(timer);
+  if (file) {
+    file.close();
+  }
+  xSemaphoreTake(replay_task_mutex, portMAX_DELAY);
+  replay_task = nullptr;
+  isReplayRunning = false;  // Mark replay as stopped
+  xSemaphoreGive(replay_task_mutex);
+  vTaskDelete(NULL);
+}
 
-        currentFrame.FD = (datalayer.system.info.can_replay_interface == CANFD_NATIVE) ||
-                          (datalayer.system.info.can_replay_interface == CANFD_ADDON_MCP2518);
-        currentFrame.ext_ID = (currentFrame.ID > 0x7F0);
+// Characters of log text sent per response, or per chunk of an export
+#define WEB_LOG_RESPONSE_SIZE 8192
+
+// Formats the web log entries of one kind from sequence since on into out, until out holds about max_length
+// characters. Returns the sequence to continue from, sets more if entries were left for the next call
+static uint32_t format_web_log(LogRingKind kind, uint32_t since, uint32_t& lost, String& out, size_t max_length,
+                               bool& more) {
+  char line[CAN_LOG_MAX_LINE_LENGTH];
+  more = false;
+  return web_log.read(since, lost, [&](LogRingKind entry_kind, const uint8_t* data, size_t size) {
+    if (entry_kind != kind) {
+      return true;
+    }
+    if (out.length() + CAN_LOG_MAX_LINE_LENGTH > max_length) {
+      more = true;
+      return false;
+    }
+    if (kind == LOG_RING_CAN) {
+      out.concat(line, can_log_format_text(data, line));
+    } else {
+      out.concat((const char*)data, size);
+    }
+    return true;
+  });
+}
 
-        transmit_can_frame_to_interface(&currentFrame, (CAN_Interface)datalayer.system.info.can_replay_interface);
-      }
-    } while (datalayer.system.info.loop_playback);
+// Sends the entries after ?since=<sequence>, the next sequence to ask for is in the X-Log-Next header
+static void send_web_log_entries(AsyncWebServerRequest* request, LogRingKind kind) {
+  const uint32_t since = request->hasParam("since") ? strtoul(request->getParam("since")->value().c_str(), NULL, 10) : 0;
+  uint32_t lost = 0;
+  bool more;
+  String text;
+  text.reserve(WEB_LOG_RESPONSE_SIZE);
+  const uint32_t next = format_web_log(kind, since, lost, text, WEB_LOG_RESPONSE_SIZE, more);
+
+  AsyncWebServerResponse* response = request->beginResponse(200, "text/plain", text);
+  response->addHeader("X-Log-Next", String(next));
+  response->addHeader("X-Log-Lost", String(lost));
+  response->addHeader("X-Log-More", more ? "1" : "0");
+  request->send(response);
+}
 
-    messages.clear();          // Free vector memory
-    messages.shrink_to_fit();  // Release excess memory
+// Sends the whole web log history of one kind as a text file
+static void send_web_log_export(AsyncWebServerRequest* request, LogRingKind kind, const char* name_format,
+                                const char* fallback_name) {
+  // Get the current time
+  time_t now = time(nullptr);
+  struct tm timeinfo;
+  localtime_r(&now, &timeinfo);
+
+  // Ensure time retrieval was successful
+  char filename[32];
+  if (strftime(filename, sizeof(filename), name_format, &timeinfo)) {
+    // Valid filename created
+  } else {
+    // Fallback filename if automatic timestamping failed
+    strcpy(filename, fallback_name);
   }
 
-  isReplayRunning = false;  // Mark replay as stopped
-  vTaskDelete(NULL);
+  // Formatted piece by piece while it is sent, entries added meanwhile are included
+  struct ExportState {
+    uint32_t next = 0;
+    String pending;
+    size_t pending_position = 0;
+    bool done = false;
+  };
+  auto state = std::make_shared<ExportState>();
+  AsyncWebServerResponse* response = request->beginChunkedResponse(
+      "text/plain", [state, kind](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+        if (state->pending_position == state->pending.length()) {
+          if (state->done) {
+            return 0;
+          }
+          uint32_t lost = 0;
+          bool more;
+          state->pending = "";
+          state->pending_position = 0;
+          state->next = format_web_log(kind, state->next, lost, state->pending, WEB_LOG_RESPONSE_SIZE, more);
+          state->done = !more;
+          if (state->pending.length() == 0) {
+            if (index == 0) {
+              state->pending = "No logs available.";
+            } else {
+              return 0;
+            }
+          }
+        }
+        const size_t length = std::min(maxLen, (size_t)(state->pending.length() - state->pending_position));
+        memcpy(buffer, state->pending.c_str() + state->pending_position, length);
+        state->pending_position += length;
+        return length;
+      });
+  response->addHeader("Content-Disposition", String("attachment; filename=\"") + String(filename) + "\"");
+  request->send(response);
 }
 
 void def_route_with_auth(const char* uri, AsyncWebServer& serv, WebRequestMethodComposite method,
@@ -180,6 +297,7 @@ void def_route_with_auth(const char* uri, AsyncWebServer& serv, WebRequestMethod
 }
 
 void init_webserver() {
+  replay_task_mutex = xSemaphoreCreateMutex();
 
   server.on("/logout", HTTP_GET, [](AsyncWebServerRequest* request) { request->send(401); });
 
@@ -226,10 +344,31 @@ void init_webserver() {
       return;
     }
 
+    // speed in percent of the recorded pace, 0 for as fast as possible. file replays a binary log of the SD card,
+    // target=loopback feeds the frames to the receivers of this device instead of sending them
+    replay_file[0] = '\0';
+    if (request->hasParam("file")) {
+      const String file = request->getParam("file")->value();
+      if (!sd_card_active || !file.startsWith("/") || file.length() >= sizeof(replay_file) ||
+          !SD_MMC.exists(file)) {
+        request->send(404, "text/plain", "No such log file");
+        return;
+      }
+      strcpy(replay_file, file.c_str());
+    } else if (replay_records.empty()) {
+      request->send(400, "text/plain", "Upload a log first");
+      return;
+    }
+    replay_speed = request->hasParam("speed") ? request->getParam("speed")->value().toInt() : 100;
+    replay_loopback = request->hasParam("target") && request->getParam("target")->value() == "loopback";
     datalayer.system.info.loop_playback = request->hasParam("loop") && request->getParam("loop")->value().toInt() == 1;
+    replay_stop_requested = false;
     isReplayRunning = true;  // Set flag before starting task
 
-    xTaskCreatePinnedToCore(canReplayTask, "CAN_Replay", 8192, NULL, 1, NULL, 1);
+    // The task waits for the mutex before it ends, so the handle is never left behind
+    xSemaphoreTake(replay_task_mutex, portMAX_DELAY);
+    xTaskCreatePinnedToCore(canReplayTask, "CAN_Replay", 8192, NULL, TASK_CAN_REPLAY_PRIO, &replay_task, 1);
+    xSemaphoreGive(replay_task_mutex);
 
     request->send(200, "text/plain", "CAN replay started!");
   });
@@ -237,10 +376,31 @@ void init_webserver() {
   // Route for stopping the CAN replay
   def_route_with_auth("/stopReplay", server, HTTP_GET, [](AsyncWebServerRequest* request) {
     datalayer.system.info.loop_playback = false;
+    replay_stop_requested = true;
+    // Wakes the task now instead of at the due time of the next frame, which can be minutes away
+    xSemaphoreTake(replay_task_mutex, portMAX_DELAY);
+    if (replay_task != nullptr) {
+      xTaskNotifyGive(replay_task);
+    }
+    xSemaphoreGive(replay_task_mutex);
 
     request->send(200, "text/plain", "CAN replay stopped!");
   });
 
+  // Progress and timing of the CAN replay, as JSON for the replay page
+  def_route_with_auth("/replayStatus", server, HTTP_GET, [](AsyncWebServerRequest* request) {
+    CanReplayStats stats;
+    replay_stats.read(stats);
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"running\":%s,\"loaded\":%u,\"sent\":%u,\"loops\":%u,\"mean_error_us\":%u,\"max_error_us\":%u,"
+             "\"late\":%u}",
+             isReplayRunning ? "true" : "false", (unsigned)replay_loader.frames(), (unsigned)stats.frames_sent,
+             (unsigned)stats.loops, (unsigned)stats.error_mean_us(), (unsigned)stats.error_max_us,
+             (unsigned)stats.late_frames);
+    request->send(200, "application/json", json);
+  });
+
   // Route to handle setting the CAN interface for CAN replay
   def_route_with_auth("/setCANInterface", server, HTTP_GET, [](AsyncWebServerRequest* request) {
     if (request->hasParam("interface")) {
@@ -259,7 +419,15 @@ void init_webserver() {
     }
   });
 
+  // New entries for the CAN logging web page
+  def_route_with_auth("/can_log_entries", server, HTTP_GET,
+                      [](AsyncWebServerRequest* request) { send_web_log_entries(request, LOG_RING_CAN); });
+
   if (datalayer.system.info.web_logging_active || datalayer.system.info.SD_logging_active) {
+    // New entries for the debug logging web page
+    server.on("/debug_log_entries", HTTP_GET,
+              [](AsyncWebServerRequest* request) { send_web_log_entries(request, LOG_RING_TEXT); });
+
     // Route for going to debug logging web page
     server.on("/log", HTTP_GET, [](AsyncWebServerRequest* request) {
       AsyncWebServerResponse* response = request->beginResponse(200, "text/html", debug_logger_processor());
@@ -284,9 +452,93 @@ void init_webserver() {
   if (datalayer.system.info.CAN_SD_logging_active) {
     // Define the handler to export can log
     server.on("/export_can_log", HTTP_GET, [](AsyncWebServerRequest* request) {
+      // The log is stored as binary records, convert it to text while it is sent
+      struct ExportState {
+        File file;
+        CanLogTextStream stream;
+        ExportState() : stream([this](uint8_t* buffer, size_t size) { return file.read(buffer, size); }) {}
+      };
+
       pause_can_writing();
-      request->send(SD_MMC, CAN_LOG_FILE, String(), true);
+      auto state = std::make_shared<ExportState>();
+      state->file = SD_MMC.open(CAN_LOG_FILE, FILE_READ);
       resume_can_writing();
+
+      AsyncWebServerResponse* response = request->beginChunkedResponse(
+          "text/plain", [state](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            if (!state->file) {
+              return 0;
+            }
+            return state->stream.fill(buffer, maxLen);
+          });
+      response->addHeader("Content-Disposition", "attachment; filename=\"canlog.txt\"");
+      request->send(response);
+    });
+
+    // Define the handler to export a time window of the can log, e.g. /export_can_log_range?from=120&to=180&ids=7BB
+    // from and to are in seconds since boot as in the log, ids a comma separated hex list, file=1 ... reads the older
+    // rotated logs. The writer keeps going, so the newest data can be up to the flush interval behind
+    server.on("/export_can_log_range", HTTP_GET, [](AsyncWebServerRequest* request) {
+      const int file_number = request->hasParam("file") ? request->getParam("file")->value().toInt() : 0;
+      const uint64_t from_us =
+          request->hasParam("from") ? (uint64_t)(request->getParam("from")->value().toDouble() * 1000000) : 0;
+      const uint64_t to_us =
+          request->hasParam("to") ? (uint64_t)(request->getParam("to")->value().toDouble() * 1000000) : UINT64_MAX;
+      std::vector<uint32_t> ids;
+      if (request->hasParam("ids")) {
+        const String list = request->getParam("ids")->value();
+        const char* next = list.c_str();
+        while (*next != '\0') {
+          char* end;
+          const uint32_t id = strtoul(next, &end, 16);
+          if (end == next) {
+            break;
+          }
+          ids.push_back(id > 0x7FF ? (id | CAN_LOG_EXTENDED) : id);
+          next = *end == ',' ? end + 1 : end;
+        }
+      }
+
+      struct RangeState {
+        File log;
+        File index;
+        CanLogRangeReader reader;
+        CanLogTextStream stream;
+        RangeState(uint64_t from_us, uint64_t to_us, const std::vector<uint32_t>& ids)
+            : reader([this](uint64_t at, uint8_t* buffer, size_t size) { return read_at(log, at, buffer, size); },
+                     [this](uint64_t at, uint8_t* buffer, size_t size) { return read_at(index, at, buffer, size); },
+                     from_us, to_us, ids),
+              stream([this](uint8_t* buffer, size_t size) { return reader.read(buffer, size); }) {}
+        static size_t read_at(File& file, uint64_t offset, uint8_t* buffer, size_t size) {
+          if (!file || !file.seek(offset)) {
+            return 0;
+          }
+          return file.read(buffer, size);
+        }
+      };
+
+      char log_name[32] = CAN_LOG_FILE;
+      char index_name[32] = CAN_LOG_INDEX_FILE;
+      if (file_number > 0) {
+        SdBlockWriter::rotated_name(CAN_LOG_FILE, file_number, log_name, sizeof(log_name));
+        SdBlockWriter::rotated_name(CAN_LOG_INDEX_FILE, file_number, index_name, sizeof(index_name));
+      }
+      auto state = std::make_shared<RangeState>(from_us, to_us, ids);
+      state->log = SD_MMC.open(log_name, FILE_READ);
+      if (!state->log) {
+        request->send(404, "text/plain", "No such log file");
+        return;
+      }
+      if (SD_MMC.exists(index_name)) {
+        state->index = SD_MMC.open(index_name, FILE_READ);
+      }
+
+      AsyncWebServerResponse* response = request->beginChunkedResponse(
+          "text/plain", [state](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            return state->stream.fill(buffer, maxLen);
+          });
+      response->addHeader("Content-Disposition", "attachment; filename=\"canlog_range.txt\"");
+      request->send(response);
     });
 
     // Define the handler to delete can log
@@ -297,31 +549,63 @@ void init_webserver() {
   } else {
     // Define the handler to export can log
     server.on("/export_can_log", HTTP_GET, [](AsyncWebServerRequest* request) {
-      String logs = String(datalayer.system.info.logged_can_messages);
-      if (logs.length() == 0) {
-        logs = "No logs available.";
-      }
-
-      // Get the current time
-      time_t now = time(nullptr);
-      struct tm timeinfo;
-      localtime_r(&now, &timeinfo);
+      send_web_log_export(request, LOG_RING_CAN, "canlog_%H-%M-%S.txt", "battery_emulator_can_log.txt");
+    });
+  }
 
-      // Ensure time retrieval was successful
-      char filename[32];
-      if (strftime(filename, sizeof(filename), "canlog_%H-%M-%S.txt", &timeinfo)) {
-        // Valid filename created
-      } else {
-        // Fallback filename if automatic timestamping failed
-        strcpy(filename, "battery_emulator_can_log.txt");
+  // Define the handler to export the CAN flight recording, as text or with format=bin in the binary CAN log format.
+  // Sends the frozen recording while it is in memory, else the last one saved to the SD card (file=1 ... the older).
+  // A recording sent from memory is dropped once it was sent completely and the recorder records again
+  server.on("/export_can_flight", HTTP_GET, [](AsyncWebServerRequest* request) {
+    const bool binary = request->hasParam("format") && request->getParam("format")->value() == "bin";
+    const int file_number = request->hasParam("file") ? request->getParam("file")->value().toInt() : 0;
+
+    struct FlightState {
+      File file;
+      CanFlightSnapshotStream snapshot;
+      CanLogTextStream stream;
+      FlightState()
+          : snapshot(can_flight_recorder),
+            stream([this](uint8_t* buffer, size_t size) { return read(buffer, size); }) {}
+      size_t read(uint8_t* buffer, size_t size) { return file ? file.read(buffer, size) : snapshot.read(buffer, size); }
+    };
+
+    auto state = std::make_shared<FlightState>();
+    if (file_number > 0 || can_flight_recorder.state() != CanFlightState::Frozen) {
+      char name[32] = CAN_FLIGHT_FILE;
+      if (file_number > 0) {
+        SdBlockWriter::rotated_name(CAN_FLIGHT_FILE, file_number, name, sizeof(name));
+      }
+      if (sd_card_active && SD_MMC.exists(name)) {
+        state->file = SD_MMC.open(name, FILE_READ);
       }
+      if (!state->file) {
+        request->send(404, "text/plain", "No CAN flight recording");
+        return;
+      }
+    }
 
-      // Use request->send with dynamic headers
-      AsyncWebServerResponse* response = request->beginResponse(200, "text/plain", logs);
-      response->addHeader("Content-Disposition", String("attachment; filename=\"") + String(filename) + "\"");
-      request->send(response);
-    });
-  }
+    AsyncWebServerResponse* response = request->beginChunkedResponse(
+        binary ? "application/octet-stream" : "text/plain",
+        [state, binary](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+          const size_t length = binary ? state->read(buffer, maxLen) : state->stream.fill(buffer, maxLen);
+          if (length == 0 && !state->file && can_flight_recorder.state() == CanFlightState::Frozen) {
+            can_flight_recorder.rearm();
+          }
+          return length;
+        });
+    response->addHeader("Content-Disposition", binary ? "attachment; filename=\"canflight.bin\""
+                                                      : "attachment; filename=\"canflight.txt\"");
+    request->send(response);
+  });
+
+  // Define the handler to drop a frozen CAN flight recording and record again
+  server.on("/rearm_can_flight", HTTP_GET, [](AsyncWebServerRequest* request) {
+    if (can_flight_recorder.state() == CanFlightState::Frozen) {
+      can_flight_recorder.rearm();
+    }
+    request->send(200, "text/plain", "CAN flight recorder rearmed");
+  });
 
   if (datalayer.system.info.SD_logging_active) {
     // Define the handler to delete log file
@@ -339,29 +623,7 @@ void init_webserver() {
   } else {
     // Define the handler to export debug log
     server.on("/export_log", HTTP_GET, [](AsyncWebServerRequest* request) {
-      String logs = String(datalayer.system.info.logged_can_messages);
-      if (logs.length() == 0) {
-        logs = "No logs available.";
-      }
-
-      // Get the current time
-      time_t now = time(nullptr);
-      struct tm timeinfo;
-      localtime_r(&now, &timeinfo);
-
-      // Ensure time retrieval was successful
-      char filename[32];
-      if (strftime(filename, sizeof(filename), "log_%H-%M-%S.txt", &timeinfo)) {
-        // Valid filename created
-      } else {
-        // Fallback filename if automatic timestamping failed
-        strcpy(filename, "battery_emulator_log.txt");
-      }
-
-      // Use request->send with dynamic headers
-      AsyncWebServerResponse* response = request->beginResponse(200, "text/plain", logs);
-      response->addHeader("Content-Disposition", String("attachment; filename=\"") + String(filename) + "\"");
-      request->send(response);
+      send_web_log_export(request, LOG_RING_TEXT, "log_%H-%M-%S.txt", "battery_emulator_log.txt");
     });
   }
 
@@ -370,6 +632,11 @@ void init_webserver() {
     request->send(200, "text/html", index_html, cellmonitor_processor);
   });
 
+  // Route for going to CAN bus statistics web page
+  def_route_with_auth("/canstats", server, HTTP_GET, [](AsyncWebServerRequest* request) {
+    request->send(200, "text/html", index_html, can_statistics_processor);
+  });
+
   // Route for going to event log web page
   def_route_with_auth("/events", server, HTTP_GET, [](AsyncWebServerRequest* request) {
     request->send(200, "text/html", index_html, events_processor);
@@ -398,16 +665,20 @@ void init_webserver() {
       "REMBMSRESET",   "EXTPRECHARGE", "USBENABLED",  "CANLOGUSB",    "WEBENABLED",   "CANFDASCAN",   "CANLOGSD",
       "WIFIAPENABLED", "MQTTENABLED",  "NOINVDISC",   "HADISC",       "MQTTTOPICS",   "MQTTCELLV",    "INVICNT",
       "GTWRHD",        "DIGITALHVIL",  "PERFPROFILE", "INTERLOCKREQ", "SOCESTIMATED", "PYLONOFFSET",  "PYLONORDER",
-      "DEYEBYD",       "NCCONTACTOR",  "TRIBTR",      "CNTCTRLTRI",
+      "DEYEBYD",       "NCCONTACTOR",  "TRIBTR",      "CNTCTRLTRI",   "CANHWFILTER",
   };
 
   const char* uintSettingNames[] = {
-      "BATTCVMAX", "BATTCVMIN",  "MAXPRETIME", "MAXPREFREQ", "WIFICHANNEL", "DCHGPOWER", "CHGPOWER",
-      "LOCALIP1",  "LOCALIP2",   "LOCALIP3",   "LOCALIP4",   "GATEWAY1",    "GATEWAY2",  "GATEWAY3",
-      "GATEWAY4",  "SUBNET1",    "SUBNET2",    "SUBNET3",    "SUBNET4",     "MQTTPORT",  "MQTTTIMEOUT",
-      "SOFAR_ID",  "PYLONSEND",  "INVCELLS",   "INVMODULES", "INVCELLSPER", "INVVLEVEL", "INVCAPACITY",
-      "INVBTYPE",  "CANFREQ",    "CANFDFREQ",  "PRECHGMS",   "PWMFREQ",     "PWMHOLD",   "GTWCOUNTRY",
-      "GTWMAPREG", "GTWCHASSIS", "GTWPACK",    "LEDMODE",    "GPIOOPT1",    "GPIOOPT2",  "GPIOOPT3",
+      "BATTCVMAX",   "BATTCVMIN",    "MAXPRETIME", "MAXPREFREQ", "WIFICHANNEL", "DCHGPOWER", "CHGPOWER",
+      "LOCALIP1",    "LOCALIP2",     "LOCALIP3",   "LOCALIP4",   "GATEWAY1",    "GATEWAY2",  "GATEWAY3",
+      "GATEWAY4",    "SUBNET1",      "SUBNET2",    "SUBNET3",    "SUBNET4",     "MQTTPORT",  "MQTTTIMEOUT",
+      "SOFAR_ID",    "PYLONSEND",    "INVCELLS",   "INVMODULES", "INVCELLSPER", "INVVLEVEL", "INVCAPACITY",
+      "INVBTYPE",    "CANFREQ",      "CANFDFREQ",  "PRECHGMS",   "PWMFREQ",     "PWMHOLD",   "GTWCOUNTRY",
+      "GTWMAPREG",   "GTWCHASSIS",   "GTWPACK",    "LEDMODE",    "GPIOOPT1",    "GPIOOPT2",  "GPIOOPT3",
+      "CANRXBUDNAT", "CANRXBUD2515", "CANRXBUDFD", "CANBUF2515",
+      "SDBLOCKKB",   "SDFLUSHS",     "SDROTATEMB", "SDROTATEH",  "SDKEEPFILES", "CANUSBMODE",  "LOGGENERAL",
+      "LOGBATTERY",  "LOGINVERTER",  "LOGCAN",     "LOGCONTACTOR", "LOGNETWORK", "LOGSD",
+      "CANFLIGHTKB", "CANFLIGHTPRE", "CANFLIGHTPOST", "CANFLIGHTTRIG",
   };
 
   const char* stringSettingNames[] = {"APNAME",       "APPASSWORD", "HOSTNAME",        "MQTTSERVER",     "MQTTUSER",
@@ -504,6 +775,12 @@ void init_webserver() {
                 }
               }
 
+              // Log levels take effect right away, without a reboot
+              for (int module = 0; module < LOG_MODULE_COUNT; module++) {
+                set_log_level((LogModule)module,
+                              (LogLevel)settings.getUInt(log_module_setting((LogModule)module), LOG_LEVEL_INFO));
+              }
+
               settingsUpdated = settings.were_settings_updated();
               request->redirect("/settings");
             });
@@ -794,8 +1071,15 @@ String get_uptime() {
          " minutes, " + (String)remaining_seconds + " seconds";
 }
 
+const DataLayer& refresh_web_snapshot() {
+  static DataLayer snapshot;
+  datalayer_snapshot.read(snapshot);
+  return snapshot;
+}
+
 String processor(const String& var) {
   if (var == "X") {
+    const DataLayer& snapshot = refresh_web_snapshot();
     String content = "";
     content += "<style>";
     content += "body { background-color: black; color: white; }";
@@ -847,9 +1131,9 @@ String processor(const String& var) {
 #ifdef HW_STARK
     content += " Hardware: Stark CMR Module";
 #endif  // HW_STARK
-    content += " @ " + String(datalayer.system.info.CPU_temperature, 1) + " &deg;C</h4>";
+    content += " @ " + String(snapshot.system.info.CPU_temperature, 1) + " &deg;C</h4>";
     content += "<h4>Uptime: " + get_uptime() + "</h4>";
-    if (datalayer.system.info.performance_measurement_active) {
+    if (snapshot.system.info.performance_measurement_active) {
       content +=
           "<h4>Free heap: " + String(ESP.getFreeHeap()) + ", max alloc: " + String(ESP.getMaxAllocHeap()) + "</h4>";
       FlashMode_t mode = ESP.getFlashChipMode();
@@ -861,21 +1145,40 @@ String processor(const String& var) {
                                           : /*mode == FM_UNKNOWN*/ "Unknown") +
                  ", size: " + String(ESP.getFlashChipSize() / (1024 * 1024)) + " MB</h4>";
       // Load information
-      content += "<h4>Core task max load: " + String(datalayer.system.status.core_task_max_us) + " us</h4>";
+      content += "<h4>Core task max load: " + String(snapshot.system.status.core_task_max_us) + " us</h4>";
       content +=
-          "<h4>Core task max load last 10 s: " + String(datalayer.system.status.core_task_10s_max_us) + " us</h4>";
+          "<h4>Core task max load last 10 s: " + String(snapshot.system.status.core_task_10s_max_us) + " us</h4>";
       content +=
-          "<h4>MQTT function (MQTT task) max load last 10 s: " + String(datalayer.system.status.mqtt_task_10s_max_us) +
+          "<h4>MQTT function (MQTT task) max load last 10 s: " + String(snapshot.system.status.mqtt_task_10s_max_us) +
           " us</h4>";
       content +=
-          "<h4>WIFI function (MQTT task) max load last 10 s: " + String(datalayer.system.status.wifi_task_10s_max_us) +
+          "<h4>WIFI function (MQTT task) max load last 10 s: " + String(snapshot.system.status.wifi_task_10s_max_us) +
           " us</h4>";
       content += "<h4>Max load @ worst case execution of core task:</h4>";
-      content += "<h4>10ms function timing: " + String(datalayer.system.status.time_snap_10ms_us) + " us</h4>";
-      content += "<h4>Values function timing: " + String(datalayer.system.status.time_snap_values_us) + " us</h4>";
-      content += "<h4>CAN/serial RX function timing: " + String(datalayer.system.status.time_snap_comm_us) + " us</h4>";
-      content += "<h4>CAN TX function timing: " + String(datalayer.system.status.time_snap_cantx_us) + " us</h4>";
-      content += "<h4>OTA function timing: " + String(datalayer.system.status.time_snap_ota_us) + " us</h4>";
+      content += "<h4>10ms function timing: " + String(snapshot.system.status.time_snap_10ms_us) + " us</h4>";
+      content += "<h4>Values function timing: " + String(snapshot.system.status.time_snap_values_us) + " us</h4>";
+      content += "<h4>CAN/serial RX function timing: " + String(snapshot.system.status.time_snap_comm_us) + " us</h4>";
+      content += "<h4>CAN TX function timing: " + String(snapshot.system.status.time_snap_cantx_us) + " us</h4>";
+      content += "<h4>OTA function timing: " + String(snapshot.system.status.time_snap_ota_us) + " us</h4>";
+      content += "<h4>Datalayer snapshot publish max last 10 s: " + String(snapshot.system.status.time_snapshot_us) +
+                 " us</h4>";
+      // CAN receive and transmit statistics, only for interfaces that are in use
+      for (int i = 0; i < NO_CAN_INTERFACE; i++) {
+        const auto& rx_stats = snapshot.system.status.can_rx_stats[i];
+        if (!rx_stats.active) {
+          continue;
+        }
+        content += "<h4>" + String(getCANInterfaceName((CAN_Interface)i)) + " RX: " +
+                   String(rx_stats.frames_per_second) + " frames/s, max " + String(rx_stats.max_frames_per_tick) +
+                   " frames/tick, buffer peak " + String(rx_stats.buffer_high_water) + "/" +
+                   String(rx_stats.buffer_size) + ", overruns: " + String(rx_stats.overruns) + "</h4>";
+        const auto& tx_stats = snapshot.system.status.can_tx_stats[i];
+        content += "<h4>" + String(getCANInterfaceName((CAN_Interface)i)) + " TX: " +
+                   String(tx_stats.frames_per_second) + " frames/s, queue peak " + String(tx_stats.queue_high_water) +
+                   "/" + String(tx_stats.queue_size) + ", latency avg " + String(tx_stats.latency_avg_us) +
+                   " us, max " + String(tx_stats.latency_max_us) + " us, retries: " + String(tx_stats.retries) +
+                   ", dropped: " + String(tx_stats.dropped) + ", expired: " + String(tx_stats.expired) + "</h4>";
+      }
     }
 
     wl_status_t status = WiFi.status();
@@ -904,19 +1207,19 @@ String processor(const String& var) {
         content += "<h4 style='color: white;'>Inverter protocol: ";
         content += inverter->name();
         content += " ";
-        content += datalayer.system.info.inverter_brand;
+        content += snapshot.system.info.inverter_brand;
         content += "</h4>";
       }
 
       if (battery) {
         content += "<h4 style='color: white;'>Battery protocol: ";
-        content += datalayer.system.info.battery_protocol;
+        content += snapshot.system.info.battery_protocol;
         if (battery3) {
           content += " (Triple battery)";
         } else if (battery2) {
           content += " (Double battery)";
         }
-        if (datalayer.battery.info.chemistry == battery_chemistry_enum::LFP) {
+        if (snapshot.battery.info.chemistry == battery_chemistry_enum::LFP) {
           content += " (LFP)";
         }
         content += "</h4>";
@@ -924,7 +1227,7 @@ String processor(const String& var) {
 
       if (user_selected_shunt_type != ShuntType::None) {
         content += "<h4 style='color: white;'>Shunt protocol: ";
-        content += datalayer.system.info.shunt_protocol;
+        content += snapshot.system.info.shunt_protocol;
         content += "</h4>";
       }
 
@@ -968,26 +1271,26 @@ String processor(const String& var) {
 
       // Display battery statistics within this block
       float socRealFloat =
-          static_cast<float>(datalayer.battery.status.real_soc) / 100.0f;  // Convert to float and divide by 100
+          static_cast<float>(snapshot.battery.status.real_soc) / 100.0f;  // Convert to float and divide by 100
       float socScaledFloat =
-          static_cast<float>(datalayer.battery.status.reported_soc) / 100.0f;  // Convert to float and divide by 100
+          static_cast<float>(snapshot.battery.status.reported_soc) / 100.0f;  // Convert to float and divide by 100
       float sohFloat =
-          static_cast<float>(datalayer.battery.status.soh_pptt) / 100.0f;  // Convert to float and divide by 100
+          static_cast<float>(snapshot.battery.status.soh_pptt) / 100.0f;  // Convert to float and divide by 100
       float voltageFloat =
-          static_cast<float>(datalayer.battery.status.voltage_dV) / 10.0f;  // Convert to float and divide by 10
+          static_cast<float>(snapshot.battery.status.voltage_dV) / 10.0f;  // Convert to float and divide by 10
       float currentFloat =
-          static_cast<float>(datalayer.battery.status.current_dA) / 10.0f;  // Convert to float and divide by 10
-      float powerFloat = static_cast<float>(datalayer.battery.status.active_power_W);                // Convert to float
-      float tempMaxFloat = static_cast<float>(datalayer.battery.status.temperature_max_dC) / 10.0f;  // Convert to float
-      float tempMinFloat = static_cast<float>(datalayer.battery.status.temperature_min_dC) / 10.0f;  // Convert to float
+          static_cast<float>(snapshot.battery.status.current_dA) / 10.0f;  // Convert to float and divide by 10
+      float powerFloat = static_cast<float>(snapshot.battery.status.active_power_W);                // Convert to float
+      float tempMaxFloat = static_cast<float>(snapshot.battery.status.temperature_max_dC) / 10.0f;  // Convert to float
+      float tempMinFloat = static_cast<float>(snapshot.battery.status.temperature_min_dC) / 10.0f;  // Convert to float
       float maxCurrentChargeFloat =
-          static_cast<float>(datalayer.battery.status.max_charge_current_dA) / 10.0f;  // Convert to float
+          static_cast<float>(snapshot.battery.status.max_charge_current_dA) / 10.0f;  // Convert to float
       float maxCurrentDischargeFloat =
-          static_cast<float>(datalayer.battery.status.max_discharge_current_dA) / 10.0f;  // Convert to float
+          static_cast<float>(snapshot.battery.status.max_discharge_current_dA) / 10.0f;  // Convert to float
       uint16_t cell_delta_mv =
-          datalayer.battery.status.cell_max_voltage_mV - datalayer.battery.status.cell_min_voltage_mV;
+          snapshot.battery.status.cell_max_voltage_mV - snapshot.battery.status.cell_min_voltage_mV;
 
-      if (datalayer.battery.settings.soc_scaling_active)
+      if (snapshot.battery.settings.soc_scaling_active)
         content += "<h4 style='color: white;'>Scaled SOC: " + String(socScaledFloat, 2) +
                    "&percnt; (real: " + String(socRealFloat, 2) + "&percnt;)</h4>";
       else
@@ -998,50 +1301,50 @@ String processor(const String& var) {
                  " V &nbsp; Current: " + String(currentFloat, 1) + " A</h4>";
       content += formatPowerValue("Power", powerFloat, "", 1);
 
-      if (datalayer.battery.settings.soc_scaling_active)
+      if (snapshot.battery.settings.soc_scaling_active)
         content += "<h4 style='color: white;'>Scaled total capacity: " +
-                   formatPowerValue(datalayer.battery.info.reported_total_capacity_Wh, "h", 1) +
-                   " (real: " + formatPowerValue(datalayer.battery.info.total_capacity_Wh, "h", 1) + ")</h4>";
+                   formatPowerValue(snapshot.battery.info.reported_total_capacity_Wh, "h", 1) +
+                   " (real: " + formatPowerValue(snapshot.battery.info.total_capacity_Wh, "h", 1) + ")</h4>";
       else
-        content += formatPowerValue("Total capacity", datalayer.battery.info.total_capacity_Wh, "h", 1);
+        content += formatPowerValue("Total capacity", snapshot.battery.info.total_capacity_Wh, "h", 1);
 
-      if (datalayer.battery.settings.soc_scaling_active)
+      if (snapshot.battery.settings.soc_scaling_active)
         content += "<h4 style='color: white;'>Scaled remaining capacity: " +
-                   formatPowerValue(datalayer.battery.status.reported_remaining_capacity_Wh, "h", 1) +
-                   " (real: " + formatPowerValue(datalayer.battery.status.remaining_capacity_Wh, "h", 1) + ")</h4>";
+                   formatPowerValue(snapshot.battery.status.reported_remaining_capacity_Wh, "h", 1) +
+                   " (real: " + formatPowerValue(snapshot.battery.status.remaining_capacity_Wh, "h", 1) + ")</h4>";
       else
-        content += formatPowerValue("Remaining capacity", datalayer.battery.status.remaining_capacity_Wh, "h", 1);
+        content += formatPowerValue("Remaining capacity", snapshot.battery.status.remaining_capacity_Wh, "h", 1);
 
-      if (datalayer.system.info.equipment_stop_active) {
+      if (snapshot.system.info.equipment_stop_active) {
         content +=
-            formatPowerValue("Max discharge power", datalayer.battery.status.max_discharge_power_W, "", 1, "red");
-        content += formatPowerValue("Max charge power", datalayer.battery.status.max_charge_power_W, "", 1, "red");
+            formatPowerValue("Max discharge power", snapshot.battery.status.max_discharge_power_W, "", 1, "red");
+        content += formatPowerValue("Max charge power", snapshot.battery.status.max_charge_power_W, "", 1, "red");
         content += "<h4 style='color: red;'>Max discharge current: " + String(maxCurrentDischargeFloat, 1) + " A</h4>";
         content += "<h4 style='color: red;'>Max charge current: " + String(maxCurrentChargeFloat, 1) + " A</h4>";
       } else {
-        content += formatPowerValue("Max discharge power", datalayer.battery.status.max_discharge_power_W, "", 1);
-        content += formatPowerValue("Max charge power", datalayer.battery.status.max_charge_power_W, "", 1);
+        content += formatPowerValue("Max discharge power", snapshot.battery.status.max_discharge_power_W, "", 1);
+        content += formatPowerValue("Max charge power", snapshot.battery.status.max_charge_power_W, "", 1);
         content += "<h4 style='color: white;'>Max discharge current: " + String(maxCurrentDischargeFloat, 1) + " A";
-        if (datalayer.battery.settings.remote_settings_limit_discharge) {
+        if (snapshot.battery.settings.remote_settings_limit_discharge) {
           content += " (Remote)</h4>";
-        } else if (datalayer.battery.settings.user_settings_limit_discharge) {
+        } else if (snapshot.battery.settings.user_settings_limit_discharge) {
           content += " (Manual)</h4>";
         } else {
           content += " (BMS)</h4>";
         }
         content += "<h4 style='color: white;'>Max charge current: " + String(maxCurrentChargeFloat, 1) + " A";
-        if (datalayer.battery.settings.remote_settings_limit_charge) {
+        if (snapshot.battery.settings.remote_settings_limit_charge) {
           content += " (Remote)</h4>";
-        } else if (datalayer.battery.settings.user_settings_limit_charge) {
+        } else if (snapshot.battery.settings.user_settings_limit_charge) {
           content += " (Manual)</h4>";
         } else {
           content += " (BMS)</h4>";
         }
       }
 
-      content += "<h4>Cell min/max: " + String(datalayer.battery.status.cell_min_voltage_mV) + " mV / " +
-                 String(datalayer.battery.status.cell_max_voltage_mV) + " mV</h4>";
-      if (cell_delta_mv > datalayer.battery.info.max_cell_voltage_deviation_mV) {
+      content += "<h4>Cell min/max: " + String(snapshot.battery.status.cell_min_voltage_mV) + " mV / " +
+                 String(snapshot.battery.status.cell_max_voltage_mV) + " mV</h4>";
+      if (cell_delta_mv > snapshot.battery.info.max_cell_voltage_deviation_mV) {
         content += "<h4 style='color: red;'>Cell delta: " + String(cell_delta_mv) + " mV</h4>";
       } else {
         content += "<h4>Cell delta: " + String(cell_delta_mv) + " mV</h4>";
@@ -1050,7 +1353,7 @@ String processor(const String& var) {
                  " &deg;C</h4>";
 
       content += "<h4>System status: ";
-      switch (datalayer.battery.status.bms_status) {
+      switch (snapshot.battery.status.bms_status) {
         case ACTIVE:
           content += String("OK");
           break;
@@ -1074,7 +1377,7 @@ String processor(const String& var) {
 
       if (battery && battery->supports_real_BMS_status()) {
         content += "<h4>Battery BMS status: ";
-        switch (datalayer.battery.status.real_bms_status) {
+        switch (snapshot.battery.status.real_bms_status) {
           case BMS_ACTIVE:
             content += String("OK");
             break;
@@ -1094,14 +1397,14 @@ String processor(const String& var) {
         content += "</h4>";
       }
 
-      if (datalayer.battery.status.current_dA == 0) {
+      if (snapshot.battery.status.current_dA == 0) {
         content += "<h4>Battery idle</h4>";
-      } else if (datalayer.battery.status.current_dA < 0) {
+      } else if (snapshot.battery.status.current_dA < 0) {
         content += "<h4>Battery discharging!";
-        if (datalayer.battery.settings.inverter_limits_discharge) {
+        if (snapshot.battery.settings.inverter_limits_discharge) {
           content += " (Inverter limiting)</h4>";
         } else {
-          if (datalayer.battery.settings.user_settings_limit_discharge) {
+          if (snapshot.battery.settings.user_settings_limit_discharge) {
             content += " (Settings limiting)</h4>";
           } else {
             content += " (Battery limiting)</h4>";
@@ -1110,10 +1413,10 @@ String processor(const String& var) {
         content += "</h4>";
       } else {  // > 0 , positive current
         content += "<h4>Battery charging!";
-        if (datalayer.battery.settings.inverter_limits_charge) {
+        if (snapshot.battery.settings.inverter_limits_charge) {
           content += " (Inverter limiting)</h4>";
         } else {
-          if (datalayer.battery.settings.user_settings_limit_charge) {
+          if (snapshot.battery.settings.user_settings_limit_charge) {
             content += " (Settings limiting)</h4>";
           } else {
             content += " (Battery limiting)</h4>";
@@ -1126,7 +1429,7 @@ String processor(const String& var) {
 
       if (battery2) {
         content += "<div style='flex: 1; background-color: ";
-        switch (datalayer.battery.status.bms_status) {
+        switch (snapshot.battery.status.bms_status) {
           case ACTIVE:
             content += "#2D3F2F;";
             break;
@@ -1142,20 +1445,20 @@ String processor(const String& var) {
 
         // Display battery statistics within this block
         socRealFloat =
-            static_cast<float>(datalayer.battery2.status.real_soc) / 100.0f;  // Convert to float and divide by 100
+            static_cast<float>(snapshot.battery2.status.real_soc) / 100.0f;  // Convert to float and divide by 100
         //socScaledFloat; // Same value used for bat2
         sohFloat =
-            static_cast<float>(datalayer.battery2.status.soh_pptt) / 100.0f;  // Convert to float and divide by 100
+            static_cast<float>(snapshot.battery2.status.soh_pptt) / 100.0f;  // Convert to float and divide by 100
         voltageFloat =
-            static_cast<float>(datalayer.battery2.status.voltage_dV) / 10.0f;  // Convert to float and divide by 10
+            static_cast<float>(snapshot.battery2.status.voltage_dV) / 10.0f;  // Convert to float and divide by 10
         currentFloat =
-            static_cast<float>(datalayer.battery2.status.current_dA) / 10.0f;       // Convert to float and divide by 10
-        powerFloat = static_cast<float>(datalayer.battery2.status.active_power_W);  // Convert to float
-        tempMaxFloat = static_cast<float>(datalayer.battery2.status.temperature_max_dC) / 10.0f;  // Convert to float
-        tempMinFloat = static_cast<float>(datalayer.battery2.status.temperature_min_dC) / 10.0f;  // Convert to float
-        cell_delta_mv = datalayer.battery2.status.cell_max_voltage_mV - datalayer.battery2.status.cell_min_voltage_mV;
+            static_cast<float>(snapshot.battery2.status.current_dA) / 10.0f;       // Convert to float and divide by 10
+        powerFloat = static_cast<float>(snapshot.battery2.status.active_power_W);  // Convert to float
+        tempMaxFloat = static_cast<float>(snapshot.battery2.status.temperature_max_dC) / 10.0f;  // Convert to float
+        tempMinFloat = static_cast<float>(snapshot.battery2.status.temperature_min_dC) / 10.0f;  // Convert to float
+        cell_delta_mv = snapshot.battery2.status.cell_max_voltage_mV - snapshot.battery2.status.cell_min_voltage_mV;
 
-        if (datalayer.battery.settings.soc_scaling_active)
+        if (snapshot.battery.settings.soc_scaling_active)
           content += "<h4 style='color: white;'>Scaled SOC: " + String(socScaledFloat, 2) +
                      "&percnt; (real: " + String(socRealFloat, 2) + "&percnt;)</h4>";
         else
@@ -1166,54 +1469,54 @@ String processor(const String& var) {
                    " V &nbsp; Current: " + String(currentFloat, 1) + " A</h4>";
         content += formatPowerValue("Power", powerFloat, "", 1);
 
-        if (datalayer.battery.settings.soc_scaling_active)
+        if (snapshot.battery.settings.soc_scaling_active)
           content += "<h4 style='color: white;'>Scaled total capacity: " +
-                     formatPowerValue(datalayer.battery2.info.reported_total_capacity_Wh, "h", 1) +
-                     " (real: " + formatPowerValue(datalayer.battery2.info.total_capacity_Wh, "h", 1) + ")</h4>";
+                     formatPowerValue(snapshot.battery2.info.reported_total_capacity_Wh, "h", 1) +
+                     " (real: " + formatPowerValue(snapshot.battery2.info.total_capacity_Wh, "h", 1) + ")</h4>";
         else
-          content += formatPowerValue("Total capacity", datalayer.battery2.info.total_capacity_Wh, "h", 1);
+          content += formatPowerValue("Total capacity", snapshot.battery2.info.total_capacity_Wh, "h", 1);
 
-        if (datalayer.battery.settings.soc_scaling_active)
+        if (snapshot.battery.settings.soc_scaling_active)
           content += "<h4 style='color: white;'>Scaled remaining capacity: " +
-                     formatPowerValue(datalayer.battery2.status.reported_remaining_capacity_Wh, "h", 1) +
-                     " (real: " + formatPowerValue(datalayer.battery2.status.remaining_capacity_Wh, "h", 1) + ")</h4>";
+                     formatPowerValue(snapshot.battery2.status.reported_remaining_capacity_Wh, "h", 1) +
+                     " (real: " + formatPowerValue(snapshot.battery2.status.remaining_capacity_Wh, "h", 1) + ")</h4>";
         else
-          content += formatPowerValue("Remaining capacity", datalayer.battery2.status.remaining_capacity_Wh, "h", 1);
+          content += formatPowerValue("Remaining capacity", snapshot.battery2.status.remaining_capacity_Wh, "h", 1);
 
-        if (datalayer.system.info.equipment_stop_active) {
+        if (snapshot.system.info.equipment_stop_active) {
           content +=
-              formatPowerValue("Max discharge power", datalayer.battery2.status.max_discharge_power_W, "", 1, "red");
-          content += formatPowerValue("Max charge power", datalayer.battery2.status.max_charge_power_W, "", 1, "red");
+              formatPowerValue("Max discharge power", snapshot.battery2.status.max_discharge_power_W, "", 1, "red");
+          content += formatPowerValue("Max charge power", snapshot.battery2.status.max_charge_power_W, "", 1, "red");
           content +=
               "<h4 style='color: red;'>Max discharge current: " + String(maxCurrentDischargeFloat, 1) + " A</h4>";
           content += "<h4 style='color: red;'>Max charge current: " + String(maxCurrentChargeFloat, 1) + " A</h4>";
         } else {
-          content += formatPowerValue("Max discharge power", datalayer.battery2.status.max_discharge_power_W, "", 1);
-          content += formatPowerValue("Max charge power", datalayer.battery2.status.max_charge_power_W, "", 1);
+          content += formatPowerValue("Max discharge power", snapshot.battery2.status.max_discharge_power_W, "", 1);
+          content += formatPowerValue("Max charge power", snapshot.battery2.status.max_charge_power_W, "", 1);
           content +=
               "<h4 style='color: white;'>Max discharge current: " + String(maxCurrentDischargeFloat, 1) + " A</h4>";
           content += "<h4 style='color: white;'>Max charge current: " + String(maxCurrentChargeFloat, 1) + " A</h4>";
         }
 
-        content += "<h4>Cell min/max: " + String(datalayer.battery2.status.cell_min_voltage_mV) + " mV / " +
-                   String(datalayer.battery2.status.cell_max_voltage_mV) + " mV</h4>";
-        if (cell_delta_mv > datalayer.battery2.info.max_cell_voltage_deviation_mV) {
+        content += "<h4>Cell min/max: " + String(snapshot.battery2.status.cell_min_voltage_mV) + " mV / " +
+                   String(snapshot.battery2.status.cell_max_voltage_mV) + " mV</h4>";
+        if (cell_delta_mv > snapshot.battery2.info.max_cell_voltage_deviation_mV) {
           content += "<h4 style='color: red;'>Cell delta: " + String(cell_delta_mv) + " mV</h4>";
         } else {
           content += "<h4>Cell delta: " + String(cell_delta_mv) + " mV</h4>";
         }
         content += "<h4>Temperature min/max: " + String(tempMinFloat, 1) + " &deg;C / " + String(tempMaxFloat, 1) +
                    " &deg;C</h4>";
-        if (datalayer.battery.status.bms_status == ACTIVE) {
+        if (snapshot.battery.status.bms_status == ACTIVE) {
           content += "<h4>System status: OK </h4>";
-        } else if (datalayer.battery.status.bms_status == UPDATING) {
+        } else if (snapshot.battery.status.bms_status == UPDATING) {
           content += "<h4>System status: UPDATING </h4>";
         } else {
           content += "<h4>System status: FAULT </h4>";
         }
-        if (datalayer.battery2.status.current_dA == 0) {
+        if (snapshot.battery2.status.current_dA == 0) {
           content += "<h4>Battery idle</h4>";
-        } else if (datalayer.battery2.status.current_dA < 0) {
+        } else if (snapshot.battery2.status.current_dA < 0) {
           content += "<h4>Battery discharging!</h4>";
         } else {  // > 0
           content += "<h4>Battery charging!</h4>";
@@ -1221,7 +1524,7 @@ String processor(const String& var) {
         content += "</div>";
         if (battery3) {
           content += "<div style='flex: 1; background-color: ";
-          switch (datalayer.battery.status.bms_status) {
+          switch (snapshot.battery.status.bms_status) {
             case ACTIVE:
               content += "#2D3F2F;";
               break;
@@ -1237,20 +1540,20 @@ String processor(const String& var) {
 
           // Display battery statistics within this block
           socRealFloat =
-              static_cast<float>(datalayer.battery3.status.real_soc) / 100.0f;  // Convert to float and divide by 100
+              static_cast<float>(snapshot.battery3.status.real_soc) / 100.0f;  // Convert to float and divide by 100
           //socScaledFloat; // Same value used for bat2
           sohFloat =
-              static_cast<float>(datalayer.battery3.status.soh_pptt) / 100.0f;  // Convert to float and divide by 100
+              static_cast<float>(snapshot.battery3.status.soh_pptt) / 100.0f;  // Convert to float and divide by 100
           voltageFloat =
-              static_cast<float>(datalayer.battery3.status.voltage_dV) / 10.0f;  // Convert to float and divide by 10
+              static_cast<float>(snapshot.battery3.status.voltage_dV) / 10.0f;  // Convert to float and divide by 10
           currentFloat =
-              static_cast<float>(datalayer.battery3.status.current_dA) / 10.0f;  // Convert to float and divide by 10
-          powerFloat = static_cast<float>(datalayer.battery3.status.active_power_W);                // Convert to float
-          tempMaxFloat = static_cast<float>(datalayer.battery3.status.temperature_max_dC) / 10.0f;  // Convert to float
-          tempMinFloat = static_cast<float>(datalayer.battery3.status.temperature_min_dC) / 10.0f;  // Convert to float
-          cell_delta_mv = datalayer.battery3.status.cell_max_voltage_mV - datalayer.battery3.status.cell_min_voltage_mV;
+              static_cast<float>(snapshot.battery3.status.current_dA) / 10.0f;  // Convert to float and divide by 10
+          powerFloat = static_cast<float>(snapshot.battery3.status.active_power_W);                // Convert to float
+          tempMaxFloat = static_cast<float>(snapshot.battery3.status.temperature_max_dC) / 10.0f;  // Convert to float
+          tempMinFloat = static_cast<float>(snapshot.battery3.status.temperature_min_dC) / 10.0f;  // Convert to float
+          cell_delta_mv = snapshot.battery3.status.cell_max_voltage_mV - snapshot.battery3.status.cell_min_voltage_mV;
 
-          if (datalayer.battery.settings.soc_scaling_active)
+          if (snapshot.battery.settings.soc_scaling_active)
             content += "<h4 style='color: white;'>Scaled SOC: " + String(socScaledFloat, 2) +
                        "&percnt; (real: " + String(socRealFloat, 2) + "&percnt;)</h4>";
           else
@@ -1261,55 +1564,55 @@ String processor(const String& var) {
                      " V &nbsp; Current: " + String(currentFloat, 1) + " A</h4>";
           content += formatPowerValue("Power", powerFloat, "", 1);
 
-          if (datalayer.battery.settings.soc_scaling_active)
+          if (snapshot.battery.settings.soc_scaling_active)
             content += "<h4 style='color: white;'>Scaled total capacity: " +
-                       formatPowerValue(datalayer.battery3.info.reported_total_capacity_Wh, "h", 1) +
-                       " (real: " + formatPowerValue(datalayer.battery3.info.total_capacity_Wh, "h", 1) + ")</h4>";
+                       formatPowerValue(snapshot.battery3.info.reported_total_capacity_Wh, "h", 1) +
+                       " (real: " + formatPowerValue(snapshot.battery3.info.total_capacity_Wh, "h", 1) + ")</h4>";
           else
-            content += formatPowerValue("Total capacity", datalayer.battery3.info.total_capacity_Wh, "h", 1);
+            content += formatPowerValue("Total capacity", snapshot.battery3.info.total_capacity_Wh, "h", 1);
 
-          if (datalayer.battery.settings.soc_scaling_active)
+          if (snapshot.battery.settings.soc_scaling_active)
             content += "<h4 style='color: white;'>Scaled remaining capacity: " +
-                       formatPowerValue(datalayer.battery3.status.reported_remaining_capacity_Wh, "h", 1) +
-                       " (real: " + formatPowerValue(datalayer.battery3.status.remaining_capacity_Wh, "h", 1) +
+                       formatPowerValue(snapshot.battery3.status.reported_remaining_capacity_Wh, "h", 1) +
+                       " (real: " + formatPowerValue(snapshot.battery3.status.remaining_capacity_Wh, "h", 1) +
                        ")</h4>";
           else
-            content += formatPowerValue("Remaining capacity", datalayer.battery3.status.remaining_capacity_Wh, "h", 1);
+            content += formatPowerValue("Remaining capacity", snapshot.battery3.status.remaining_capacity_Wh, "h", 1);
 
-          if (datalayer.system.info.equipment_stop_active) {
+          if (snapshot.system.info.equipment_stop_active) {
             content +=
-                formatPowerValue("Max discharge power", datalayer.battery3.status.max_discharge_power_W, "", 1, "red");
-            content += formatPowerValue("Max charge power", datalayer.battery3.status.max_charge_power_W, "", 1, "red");
+                formatPowerValue("Max discharge power", snapshot.battery3.status.max_discharge_power_W, "", 1, "red");
+            content += formatPowerValue("Max charge power", snapshot.battery3.status.max_charge_power_W, "", 1, "red");
             content +=
                 "<h4 style='color: red;'>Max discharge current: " + String(maxCurrentDischargeFloat, 1) + " A</h4>";
             content += "<h4 style='color: red;'>Max charge current: " + String(maxCurrentChargeFloat, 1) + " A</h4>";
           } else {
-            content += formatPowerValue("Max discharge power", datalayer.battery3.status.max_discharge_power_W, "", 1);
-            content += formatPowerValue("Max charge power", datalayer.battery3.status.max_charge_power_W, "", 1);
+            content += formatPowerValue("Max discharge power", snapshot.battery3.status.max_discharge_power_W, "", 1);
+            content += formatPowerValue("Max charge power", snapshot.battery3.status.max_charge_power_W, "", 1);
             content +=
                 "<h4 style='color: white;'>Max discharge current: " + String(maxCurrentDischargeFloat, 1) + " A</h4>";
             content += "<h4 style='color: white;'>Max charge current: " + String(maxCurrentChargeFloat, 1) + " A</h4>";
           }
 
-          content += "<h4>Cell min/max: " + String(datalayer.battery3.status.cell_min_voltage_mV) + " mV / " +
-                     String(datalayer.battery3.status.cell_max_voltage_mV) + " mV</h4>";
-          if (cell_delta_mv > datalayer.battery3.info.max_cell_voltage_deviation_mV) {
+          content += "<h4>Cell min/max: " + String(snapshot.battery3.status.cell_min_voltage_mV) + " mV / " +
+                     String(snapshot.battery3.status.cell_max_voltage_mV) + " mV</h4>";
+          if (cell_delta_mv > snapshot.battery3.info.max_cell_voltage_deviation_mV) {
             content += "<h4 style='color: red;'>Cell delta: " + String(cell_delta_mv) + " mV</h4>";
           } else {
             content += "<h4>Cell delta: " + String(cell_delta_mv) + " mV</h4>";
           }
           content += "<h4>Temperature min/max: " + String(tempMinFloat, 1) + " &deg;C / " + String(tempMaxFloat, 1) +
                      " &deg;C</h4>";
-          if (datalayer.battery.status.bms_status == ACTIVE) {
+          if (snapshot.battery.status.bms_status == ACTIVE) {
             content += "<h4>System status: OK </h4>";
-          } else if (datalayer.battery.status.bms_status == UPDATING) {
+          } else if (snapshot.battery.status.bms_status == UPDATING) {
             content += "<h4>System status: UPDATING </h4>";
           } else {
             content += "<h4>System status: FAULT </h4>";
           }
-          if (datalayer.battery3.status.current_dA == 0) {
+          if (snapshot.battery3.status.current_dA == 0) {
             content += "<h4>Battery idle</h4>";
-          } else if (datalayer.battery3.status.current_dA < 0) {
+          } else if (snapshot.battery3.status.current_dA < 0) {
             content += "<h4>Battery discharging!</h4>";
           } else {  // > 0
             content += "<h4>Battery charging!</h4>";
@@ -1331,20 +1634,20 @@ String processor(const String& var) {
     }
 
     content += "<h4>Emulator allows contactor closing: ";
-    if (datalayer.battery.status.bms_status == FAULT) {
+    if (snapshot.battery.status.bms_status == FAULT) {
       content += "<span style='color: red;'>&#10005;</span>";
     } else {
       content += "<span>&#10003;</span>";
     }
     content += " Inverter allows contactor closing: ";
-    if (datalayer.system.status.inverter_allows_contactor_closing == true) {
+    if (snapshot.system.status.inverter_allows_contactor_closing == true) {
       content += "<span>&#10003;</span></h4>";
     } else {
       content += "<span style='color: red;'>&#10005;</span></h4>";
     }
     if (battery2) {
       content += "<h4>Secondary battery allowed to join ";
-      if (datalayer.system.status.battery2_allowed_contactor_closing == true) {
+      if (snapshot.system.status.battery2_allowed_contactor_closing == true) {
         content += "<span>&#10003;</span>";
       } else {
         content += "<span style='color: red;'>&#10005; (voltage mismatch)</span>";
@@ -1360,24 +1663,24 @@ String processor(const String& var) {
       content += "</div>";
     } else {  //contactor_control_enabled TRUE
       content += "<div class=\"tooltip\"><h4>Contactors controlled by emulator, state: ";
-      if (datalayer.system.status.contactors_engaged == 0) {
+      if (snapshot.system.status.contactors_engaged == 0) {
         content += "<span style='color: red;'>OFF (DISCONNECTED)</span>";
-      } else if (datalayer.system.status.contactors_engaged == 1) {
+      } else if (snapshot.system.status.contactors_engaged == 1) {
         content += "<span style='color: green;'>ON</span>";
-      } else if (datalayer.system.status.contactors_engaged == 2) {
+      } else if (snapshot.system.status.contactors_engaged == 2) {
         content += "<span style='color: red;'>OFF (FAULT)</span>";
         content += "<span class=\"tooltip-icon\"> [!]</span>";
         content +=
             "<span class=\"tooltiptext\">Emulator spent too much time in critical FAULT event. Investigate event "
             "causing this via Events page. Reboot required to resume operation!</span>";
-      } else if (datalayer.system.status.contactors_engaged == 3) {
+      } else if (snapshot.system.status.contactors_engaged == 3) {
         content += "<span style='color: orange;'>PRECHARGE</span>";
       }
       content += "</h4></div>";
       if (contactor_control_enabled_double_battery && battery2) {
         content += "<h4>Secondary battery contactor, state: ";
         if (pwm_contactor_control) {
-          if (datalayer.system.status.contactors_battery2_engaged) {
+          if (snapshot.system.status.contactors_battery2_engaged) {
             content += "<span style='color: green;'>Economized</span>";
           } else {
             content += "<span style='color: red;'>OFF</span>";
@@ -1403,7 +1706,7 @@ String processor(const String& var) {
       content += "<div style='background-color: #FF6E00; padding: 10px; margin-bottom: 10px;border-radius: 50px'>";
 
       content += "<h4>Charger HV Enabled: ";
-      if (datalayer.charger.charger_HV_enabled) {
+      if (snapshot.charger.charger_HV_enabled) {
         content += "<span>&#10003;</span>";
       } else {
         content += "<span style='color: red;'>&#10005;</span>";
@@ -1411,7 +1714,7 @@ String processor(const String& var) {
       content += "</h4>";
 
       content += "<h4>Charger Aux12v Enabled: ";
-      if (datalayer.charger.charger_aux12V_enabled) {
+      if (snapshot.charger.charger_aux12V_enabled) {
         content += "<span>&#10003;</span>";
       } else {
         content += "<span style='color: red;'>&#10005;</span>";
@@ -1458,7 +1761,8 @@ String processor(const String& var) {
     content += "<button onclick='Advanced()'>More Battery Info</button> ";
     content += "<button onclick='CANlog()'>CAN logger</button> ";
     content += "<button onclick='CANreplay()'>CAN replay</button> ";
-    if (datalayer.system.info.web_logging_active || datalayer.system.info.SD_logging_active) {
+    content += "<button onclick='CANstats()'>CAN statistics</button> ";
+    if (snapshot.system.info.web_logging_active || snapshot.system.info.SD_logging_active) {
       content += "<button onclick='Log()'>Log</button> ";
     }
     content += "<button onclick='Cellmon()'>Cellmonitor</button> ";
@@ -1466,7 +1770,7 @@ String processor(const String& var) {
     content += "<button onclick='askReboot()'>Reboot Emulator</button>";
     if (webserver_auth)
       content += "<button onclick='logout()'>Logout</button>";
-    if (!datalayer.system.info.equipment_stop_active)
+    if (!snapshot.system.info.equipment_stop_active)
       content +=
           "<br/><button style=\"background:red;color:white;cursor:pointer;\""
           " onclick=\""
@@ -1488,6 +1792,7 @@ String processor(const String& var) {
     content += "function Advanced() { window.location.href = '/advanced'; }";
     content += "function CANlog() { window.location.href = '/canlog'; }";
     content += "function CANreplay() { window.location.href = '/canreplay'; }";
+    content += "function CANstats() { window.location.href = '/canstats'; }";
     content += "function Log() { window.location.href = '/log'; }";
     content += "function Events() { window.location.href = '/events'; }";
     if (webserver_auth) {
@@ -7,6 +7,8 @@
 #include "../../lib/ayushsharma82-ElegantOTA/src/ElegantOTA.h"
 #include "../../lib/mathieucarbou-AsyncTCPSock/src/AsyncTCP.h"
 
+class DataLayer;
+
 extern const char* version_number;  // The current software version, shown on webserver
 
 // Common charger parameters
@@ -60,6 +62,17 @@ void init_ElegantOTA();
 String processor(const String& var);
 String get_firmware_info_processor(const String& var);
 
+/**
+ * @brief Copies the latest datalayer snapshot for a page being built
+ *
+ * The pages are all built in the AsyncTCP task, so they share one copy.
+ *
+ * @param[in] void
+ *
+ * @return const DataLayer& The copy, valid until the next call
+ */
+const DataLayer& refresh_web_snapshot();
+
 /**
  * @brief Executes on OTA start 
  *
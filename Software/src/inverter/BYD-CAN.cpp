@@ -95,11 +95,25 @@ void BydCanInverter::
   BYD_250.data.u8[5] = (uint8_t)(datalayer.battery.info.reported_total_capacity_Wh / 100);
 }
 
-void BydCanInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
+void BydCanInverter::declare_can_ids(CanIdSet& ids) {
+  ids.add_id(0x091);
+  ids.add_id(0x0D1);
+  ids.add_id(0x111);
+  ids.add_id(0x151);
+}
+
+void BydCanInverter::declare_supervised_can_ids(CanSupervisionSet& ids) {
+  ids.renew(&datalayer.system.status.CAN_inverter_still_alive);
+  ids.expect(0x151, 0);  // Identification requests, only sent when the inverter starts up
+  ids.expect(0x091, 10000);
+  ids.expect(0x0D1, 10000);
+  ids.expect(0x111, 10000);
+}
+
+void BydCanInverter::map_can_frame_to_variable(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x151:  //Message originating from BYD HVS compatible inverter. Reply with CAN identifier!
       inverterStartedUp = true;
-      datalayer.system.status.CAN_inverter_still_alive = CAN_STILL_ALIVE;
       if (rx_frame.data.u8[0] & 0x01) {  //Battery requests identification
         send_initial_data();
       } else {  // We can identify what inverter type we are connected to
@@ -111,7 +125,6 @@ void BydCanInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
       break;
     case 0x091:
       inverterStartedUp = true;
-      datalayer.system.status.CAN_inverter_still_alive = CAN_STILL_ALIVE;
       inverter_voltage = ((rx_frame.data.u8[0] << 8) | rx_frame.data.u8[1]) * 0.1;
       inverter_current = (int16_t)((rx_frame.data.u8[2] << 8) | rx_frame.data.u8[3]);
       inverter_temperature = ((rx_frame.data.u8[4] << 8) | rx_frame.data.u8[5]) * 0.1;
@@ -128,12 +141,10 @@ void BydCanInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
       break;
     case 0x0D1:
       inverterStartedUp = true;
-      datalayer.system.status.CAN_inverter_still_alive = CAN_STILL_ALIVE;
       inverter_SOC = ((rx_frame.data.u8[0] << 8) | rx_frame.data.u8[1]) * 0.1;
       break;
     case 0x111:
       inverterStartedUp = true;
-      datalayer.system.status.CAN_inverter_still_alive = CAN_STILL_ALIVE;
       inverter_timestamp = ((rx_frame.data.u8[0] << 24) | (rx_frame.data.u8[1] << 16) | (rx_frame.data.u8[2] << 8) |
                             rx_frame.data.u8[3]);
       break;
@@ -142,39 +153,48 @@ void BydCanInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
   }
 }
 
-void BydCanInverter::transmit_can(unsigned long currentMillis) {
+bool BydCanInverter::setup() {
+  // Nothing is sent towards the inverter until it has woken up and the initial data went out
+  schedule_can(INTERVAL_2_S, 1, [this](unsigned long) {
+    if (initialDataSent) {
+      transmit_can_frame(&BYD_110, CanTxPriority::Safety);  //Send Limits
+    }
+  });
+  schedule_can(INTERVAL_10_S, 1, [this](unsigned long) {
+    if (initialDataSent) {
+      transmit_can_frame(&BYD_150);  //Send States
+    }
+  });
+  schedule_can(INTERVAL_10_S, 1, [this](unsigned long) {
+    if (initialDataSent) {
+      transmit_can_frame(&BYD_1D0);  //Send Battery Info
+    }
+  });
+  schedule_can(INTERVAL_10_S, 1, [this](unsigned long) {
+    if (initialDataSent) {
+      transmit_can_frame(&BYD_210);  //Send Cell Info
+    }
+  });
+  schedule_can(INTERVAL_60_S, 1, [this](unsigned long) {
+    if (initialDataSent) {
+      transmit_can_frame(&BYD_190);  //Send Alarm
+    }
+  });
+  return true;
+}
+
+void BydCanInverter::transmit_can(unsigned long /*currentMillis*/) {
 
   if (!inverterStartedUp) {
     //Avoid sending messages towards inverter, unless it has woken up and sent something to us first
     return;
   }
 
-  // Send initial CAN data once on bootup
+  // Send initial CAN data once on bootup, the periodic messages are sent by the CAN scheduler
   if (!initialDataSent) {
     send_initial_data();
     initialDataSent = true;
   }
-
-  // Send 2s CAN Message
-  if (currentMillis - previousMillis2s >= INTERVAL_2_S) {
-    previousMillis2s = currentMillis;
-
-    transmit_can_frame(&BYD_110);  //Send Limits
-  }
-  // Send 10s CAN Message
-  if (currentMillis - previousMillis10s >= INTERVAL_10_S) {
-    previousMillis10s = currentMillis;
-
-    transmit_can_frame(&BYD_150);  //Send States
-    transmit_can_frame(&BYD_1D0);  //Send Battery Info
-    transmit_can_frame(&BYD_210);  //Send Cell Info
-  }
-  //Send 60s message
-  if (currentMillis - previousMillis60s >= INTERVAL_60_S) {
-    previousMillis60s = currentMillis;
-
-    transmit_can_frame(&BYD_190);  //Send Alarm
-  }
 }
 
 void BydCanInverter::send_initial_data() {
@@ -3,6 +3,7 @@
 
 #include "../communication/Transmitter.h"
 #include "../communication/can/CanReceiver.h"
+#include "../communication/can/CanScheduler.h"
 #include "../communication/can/comm_can.h"
 #include "../devboard/safety/safety.h"
 #include "../devboard/utils/logging.h"
@@ -15,7 +16,7 @@ class CanInverterProtocol : public InverterProtocol, Transmitter, CanReceiver {
   InverterInterfaceType interface_type() { return InverterInterfaceType::Can; }
 
   virtual void transmit_can(unsigned long currentMillis) = 0;
-  virtual void map_can_frame_to_variable(CAN_frame rx_frame) = 0;
+  virtual void map_can_frame_to_variable(const CAN_frame& rx_frame) = 0;
 
   void transmit(unsigned long currentMillis) {
     if (allowed_to_send_CAN) {
@@ -23,7 +24,7 @@ class CanInverterProtocol : public InverterProtocol, Transmitter, CanReceiver {
     }
   }
 
-  void receive_can_frame(CAN_frame* frame) { map_can_frame_to_variable(*frame); }
+  void receive_can_frame(const CAN_frame& frame) { map_can_frame_to_variable(frame); }
 
  protected:
   CAN_Interface can_interface;
@@ -39,7 +40,31 @@ class CanInverterProtocol : public InverterProtocol, Transmitter, CanReceiver {
     logging.println(")");
   }
 
-  void transmit_can_frame(CAN_frame* frame) { transmit_can_frame_to_interface(frame, can_interface); }
+  void transmit_can_frame(const CAN_frame* frame, CanTxPriority priority = CanTxPriority::Normal) {
+    transmit_can_frame_to_interface(frame, can_interface, priority);
+  }
+  void transmit_can_frame(const CAN_classic_frame* frame, CanTxPriority priority = CanTxPriority::Normal) {
+    transmit_can_frame_to_interface(frame, can_interface, priority);
+  }
+
+  // Has the CAN scheduler send the frame unchanged every period_ms
+  void schedule_can_frame(const CAN_classic_frame* frame, uint16_t period_ms,
+                          int16_t phase_ms = CanScheduler::AUTO_PHASE) {
+    schedule_can(period_ms, 1, [this, frame](unsigned long) { transmit_can_frame(frame); }, phase_ms);
+  }
+  // Has the CAN scheduler run a generator sending about 'frames' frames every period_ms, returns its phase. Like
+  // transmit(), the generator is not run while sending is paused, so its counters and mux state stand still
+  uint16_t schedule_can(uint16_t period_ms, uint8_t frames, CanScheduler::Generator generator,
+                        int16_t phase_ms = CanScheduler::AUTO_PHASE) {
+    return can_scheduler.add(
+        this, period_ms, frames,
+        [generator](unsigned long currentMillis) {
+          if (allowed_to_send_CAN) {
+            generator(currentMillis);
+          }
+        },
+        phase_ms);
+  }
 };
 
 #endif
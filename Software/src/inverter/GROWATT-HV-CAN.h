@@ -8,7 +8,7 @@ class GrowattHvInverter : public CanInverterProtocol {
   const char* name() override { return Name; }
   void update_values();
   void transmit_can(unsigned long currentMillis);
-  void map_can_frame_to_variable(CAN_frame rx_frame);
+  void map_can_frame_to_variable(const CAN_frame& rx_frame);
   static constexpr const char* Name = "Growatt High Voltage protocol via CAN";
 
  private:
@@ -46,106 +46,106 @@ class GrowattHvInverter : public CanInverterProtocol {
   bool time_to_send_1s_data = false;
 
   //Actual content messages
-  CAN_frame GROWATT_3110 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3110,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3120 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3120,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3130 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3130,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3140 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3140,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3150 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3150,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3160 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3160,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3170 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3170,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3180 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3180,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3190 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3190,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3200 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3200,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3210 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3210,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3220 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3220,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3230 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3230,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3240 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3240,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3250 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3250,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3260 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3260,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3270 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3270,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3280 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3280,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3290 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3290,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame GROWATT_3F00 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x3F00,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3110 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3110,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3120 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3120,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3130 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3130,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3140 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3140,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3150 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3150,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3160 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3160,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3170 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3170,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3180 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3180,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3190 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3190,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3200 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3200,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3210 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3210,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3220 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3220,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3230 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3230,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3240 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3240,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3250 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3250,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3260 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3260,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3270 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3270,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3280 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3280,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3290 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3290,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_3F00 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x3F00,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 };
 
 #endif
@@ -177,7 +177,7 @@ void GrowattLvInverter::
   GROWATT_318.data.u8[7] = (datalayer.battery.status.cell_voltages_mV[15] & 0x00FF);
 }
 
-void GrowattLvInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
+void GrowattLvInverter::map_can_frame_to_variable(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x301:
       datalayer.system.status.CAN_inverter_still_alive = CAN_STILL_ALIVE;
@@ -578,7 +578,7 @@ void GrowattWitInverter::update_values() {
   // Will be sent in transmit_can when triggered
 }
 
-void GrowattWitInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
+void GrowattWitInverter::map_can_frame_to_variable(const CAN_frame& rx_frame) {
   // Validate extended frame (29-bit ID required for Growatt WIT protocol)
   if (!rx_frame.ext_ID) {
     return;  // Ignore standard 11-bit frames
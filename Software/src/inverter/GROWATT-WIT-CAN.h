@@ -38,7 +38,7 @@ class GrowattWitInverter : public CanInverterProtocol {
   const char* name() override { return Name; }
   void update_values();
   void transmit_can(unsigned long currentMillis);
-  void map_can_frame_to_variable(CAN_frame rx_frame);
+  void map_can_frame_to_variable(const CAN_frame& rx_frame);
   static constexpr const char* Name = "Growatt WIT compatible battery via CAN";
 
  private:
@@ -62,146 +62,146 @@ class GrowattWitInverter : public CanInverterProtocol {
   /* BMS -> PCS Messages (Basic Functions - Required) */
 
   // 1AC3: Current/Voltage Limits (100ms)
-  CAN_frame GROWATT_1AC3 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AC3FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AC3 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AC3FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AC4: CV Voltage (100ms)
-  CAN_frame GROWATT_1AC4 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AC4FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AC4 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AC4FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AC5: Working Status (100ms)
-  CAN_frame GROWATT_1AC5 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AC5FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AC5 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AC5FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AC6: SOC/SOH/Capacity (500ms)
-  CAN_frame GROWATT_1AC6 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AC6FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AC6 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AC6FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AC7: Voltage/Current (100ms)
-  CAN_frame GROWATT_1AC7 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AC7FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AC7 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AC7FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   /* BMS -> PCS Messages (Data Monitoring - Optional but recommended) */
 
   // 1AC0: System Composition (2000ms)
-  CAN_frame GROWATT_1AC0 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AC0FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AC0 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AC0FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AC2: Product Version (Event - triggered by PCS 1ABE)
-  CAN_frame GROWATT_1AC2 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AC2FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AC2 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AC2FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AC8: Software Version (500ms)
-  CAN_frame GROWATT_1AC8 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AC8FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AC8 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AC8FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AC9: Max Module Voltage (1000ms)
-  CAN_frame GROWATT_1AC9 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AC9FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AC9 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AC9FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1ACA: Min Module Voltage (1000ms)
-  CAN_frame GROWATT_1ACA = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1ACAFFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1ACA = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1ACAFFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1ACC: Max Cell Temperature (1000ms)
-  CAN_frame GROWATT_1ACC = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1ACCFFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1ACC = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1ACCFFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1ACD: Min Cell Temperature (1000ms)
-  CAN_frame GROWATT_1ACD = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1ACDFFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1ACD = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1ACDFFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1ACE: Max Cell Voltage (100ms)
-  CAN_frame GROWATT_1ACE = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1ACEFFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1ACE = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1ACEFFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1ACF: Min Cell Voltage (100ms)
-  CAN_frame GROWATT_1ACF = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1ACFFFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1ACF = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1ACFFFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AD0: Cluster SOC Info (1000ms)
-  CAN_frame GROWATT_1AD0 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AD0FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AD0 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AD0FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AD1: Cumulative Energy (1000ms)
-  CAN_frame GROWATT_1AD1 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AD1FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AD1 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AD1FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AD8: Fault Information 3 (100ms)
-  CAN_frame GROWATT_1AD8 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AD8FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AD8 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AD8FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1AD9: Fault Information 4 (100ms)
-  CAN_frame GROWATT_1AD9 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1AD9FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1AD9 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1AD9FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1A80: BMS Software Version (Event)
-  CAN_frame GROWATT_1A80 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1A80FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1A80 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1A80FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 
   // 1A82: Battery Serial Number (Event - multi-frame)
-  CAN_frame GROWATT_1A82 = {.FD = false,
-                            .ext_ID = true,
-                            .DLC = 8,
-                            .ID = 0x1A82FFF3,
-                            .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame GROWATT_1A82 = {.FD = false,
+                                    .ext_ID = true,
+                                    .DLC = 8,
+                                    .ID = 0x1A82FFF3,
+                                    .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
 };
 
 #endif
@@ -14,29 +14,20 @@ void KostalInverterProtocol::float2frame(uint8_t* arr, float value, uint8_t fram
   arr[framepointer + 3] = g.b[3];
 }
 
-static void dbg_timestamp(void) {
-  logging.printf("[");
-  logging.print(millis());
-  logging.printf(" ms] ");
-}
-
+// Frames sent and received, logged with the inverter log level at Debug
 static void dbg_frame(uint8_t* frame, int len, const char* prefix) {
-  dbg_timestamp();
-  logging.print(prefix);
-  logging.printf(": ");
-  for (uint8_t i = 0; i < len; i++) {
-    if (frame[i] < 0x10) {
-      logging.printf("0");
+  if (!LOG_ENABLED(LOG_LEVEL_DEBUG, INVERTER)) {
+    return;
+  }
+  // 16 bytes per line, short enough to be kept whole as a string argument
+  char hex[3 * 16 + 1];
+  for (int start = 0; start < len; start += 16) {
+    int length = 0;
+    for (int i = start; i < len && i < start + 16; i++) {
+      length += snprintf(hex + length, sizeof(hex) - length, "%02X ", frame[i]);
     }
-    logging.print(frame[i], HEX);
-    logging.print(" ");
+    LOG_D(INVERTER, "%s: %s\n", prefix, hex);
   }
-  logging.println("");
-}
-
-static void dbg_message(const char* msg) {
-  dbg_timestamp();
-  logging.println(msg);
 }
 
 void setInverterAllowsContactorClosing(bool state) {
@@ -72,7 +63,7 @@ static void send_kostal(uint8_t* frame, int len) {
 static uint8_t calculate_kostal_crc(byte* lfc, int len) {
   unsigned int sum = 0;
   if (lfc[0] != 0) {
-    logging.printf("WARNING: first byte should be 0, but is 0x%02x\n", lfc[0]);
+    LOG_W(INVERTER, "First byte should be 0, but is 0x%02x\n", lfc[0]);
   }
   for (int i = 1; i < len; i++) {
     sum += lfc[i];
@@ -154,7 +145,7 @@ void KostalInverterProtocol::update_values() {
     // Close contactors after 7 battery info frames requested
     if (f2_startup_count > 7) {
       setInverterAllowsContactorClosing(true);
-      dbg_message("inverter_allows_contactor_closing -> true (info frame)");
+      LOG_I(INVERTER, "inverter_allows_contactor_closing -> true (info frame)\n");
     }
 
     if (datalayer.system.status.inverter_allows_contactor_closing) {
@@ -207,14 +198,14 @@ void KostalInverterProtocol::receive()  // Runs as fast as possible to handle th
   // Auto-reset contactor_test_active after 5 seconds
   if (contactortestTimerActive && (millis() - contactortestTimerStart >= 5000)) {
     setInverterAllowsContactorClosing(true);
-    dbg_message("inverter_allows_contactor_closing -> true (Contactor test ended)");
+    LOG_I(INVERTER, "inverter_allows_contactor_closing -> true (Contactor test ended)\n");
     contactortestTimerActive = false;
   }
   if (datalayer.system.status.battery_allows_contactor_closing & !contactorMillis) {
     contactorMillis = currentMillis;
   }
   if ((currentMillis - contactorMillis >= INTERVAL_2_S) && !RX_allow) {
-    dbg_message("RX_allow -> true");
+    LOG_D(INVERTER, "RX_allow -> true\n");
     RX_allow = true;
   }
 
@@ -238,12 +229,12 @@ void KostalInverterProtocol::receive()  // Runs as fast as possible to handle th
                 if (RS485_RXFRAME[7] == 0x00) {
                   // Allow contactor closing
                   setInverterAllowsContactorClosing(true);
-                  dbg_message("inverter_allows_contactor_closing -> true (5E 02)");
+                  LOG_I(INVERTER, "inverter_allows_contactor_closing -> true (5E 02)\n");
                   send_kostal(ACK_FRAME, 8);  // ACK
                 } else if (RS485_RXFRAME[7] == 0x04) {
                   // contactor test STATE, ACK sent
                   setInverterAllowsContactorClosing(false);
-                  dbg_message("inverter_allows_contactor_closing -> false (Contactor test start)");
+                  LOG_I(INVERTER, "inverter_allows_contactor_closing -> false (Contactor test start)\n");
                   send_kostal(ACK_FRAME, 8);  // ACK
                   contactortestTimerStart = currentMillis;
                   contactortestTimerActive = true;
@@ -284,7 +275,7 @@ void KostalInverterProtocol::receive()  // Runs as fast as possible to handle th
                   null_stuffer(tmpframe, 40);
                   send_kostal(tmpframe, 40);
                   setInverterAllowsContactorClosing(false);
-                  dbg_message("inverter_allows_contactor_closing -> false (battery info sent)");
+                  LOG_I(INVERTER, "inverter_allows_contactor_closing -> false (battery info sent)\n");
                   info_sent = true;
                   if (!startupMillis) {
                     startupMillis = currentMillis;
@@ -314,7 +305,7 @@ void KostalInverterProtocol::receive()  // Runs as fast as possible to handle th
 
 bool KostalInverterProtocol::setup(void) {  // Performs one time setup at startup
   setInverterAllowsContactorClosing(false);
-  dbg_message("inverter_allows_contactor_closing -> false");
+  LOG_I(INVERTER, "inverter_allows_contactor_closing -> false\n");
 
   auto rx_pin = esp32hal->RS485_RX_PIN();
   auto tx_pin = esp32hal->RS485_TX_PIN();
@@ -132,7 +132,11 @@ void PylonInverter::
   }
 }
 
-void PylonInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
+void PylonInverter::declare_can_ids(CanIdSet& ids) {
+  ids.add_id(0x4200);
+}
+
+void PylonInverter::map_can_frame_to_variable(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x4200:  //Message originating from inverter. Depending on which data is required, act accordingly
       datalayer.system.status.CAN_inverter_still_alive = CAN_STILL_ALIVE;
@@ -8,7 +8,7 @@ class PylonLvInverter : public CanInverterProtocol {
   const char* name() override { return Name; }
   void update_values();
   void transmit_can(unsigned long currentMillis);
-  void map_can_frame_to_variable(CAN_frame rx_frame);
+  void map_can_frame_to_variable(const CAN_frame& rx_frame);
   static constexpr const char* Name = "Pylontech LV battery over CAN bus";
 
  private:
@@ -25,37 +25,37 @@ class PylonLvInverter : public CanInverterProtocol {
 
   unsigned long previousMillis1000ms = 0;
 
-  CAN_frame PYLON_351 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 6,
-                         .ID = 0x351,
-                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame PYLON_355 = {.FD = false, .ext_ID = false, .DLC = 4, .ID = 0x355, .data = {0x00, 0x00, 0x00, 0x00}};
-  CAN_frame PYLON_356 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 6,
-                         .ID = 0x356,
-                         .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame PYLON_359 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 7,
-                         .ID = 0x359,
-                         .data = {0x00, 0x00, 0x00, 0x00, PACK_NUMBER, 'P', 'N'}};
-  CAN_frame PYLON_35C = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x35C, .data = {0x00, 0x00}};
-  CAN_frame PYLON_35E = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x35E,
-                         .data = {
-                             MANUFACTURER_NAME[0],
-                             MANUFACTURER_NAME[1],
-                             MANUFACTURER_NAME[2],
-                             MANUFACTURER_NAME[3],
-                             MANUFACTURER_NAME[4],
-                             MANUFACTURER_NAME[5],
-                             MANUFACTURER_NAME[6],
-                             MANUFACTURER_NAME[7],
-                         }};
+  CAN_classic_frame PYLON_351 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 6,
+                                 .ID = 0x351,
+                                 .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PYLON_355 = {.FD = false, .ext_ID = false, .DLC = 4, .ID = 0x355, .data = {0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PYLON_356 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 6,
+                                 .ID = 0x356,
+                                 .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame PYLON_359 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 7,
+                                 .ID = 0x359,
+                                 .data = {0x00, 0x00, 0x00, 0x00, PACK_NUMBER, 'P', 'N'}};
+  CAN_classic_frame PYLON_35C = {.FD = false, .ext_ID = false, .DLC = 2, .ID = 0x35C, .data = {0x00, 0x00}};
+  CAN_classic_frame PYLON_35E = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x35E,
+                                 .data = {
+                                     MANUFACTURER_NAME[0],
+                                     MANUFACTURER_NAME[1],
+                                     MANUFACTURER_NAME[2],
+                                     MANUFACTURER_NAME[3],
+                                     MANUFACTURER_NAME[4],
+                                     MANUFACTURER_NAME[5],
+                                     MANUFACTURER_NAME[6],
+                                     MANUFACTURER_NAME[7],
+                                 }};
 };
 
 #endif
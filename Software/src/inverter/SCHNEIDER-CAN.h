@@ -8,7 +8,7 @@ class SchneiderInverter : public CanInverterProtocol {
   const char* name() override { return Name; }
   void update_values();
   void transmit_can(unsigned long currentMillis);
-  void map_can_frame_to_variable(CAN_frame rx_frame);
+  void map_can_frame_to_variable(const CAN_frame& rx_frame);
   static constexpr const char* Name = "Schneider V2 SE BMS CAN";
 
  private:
@@ -39,63 +39,67 @@ class SchneiderInverter : public CanInverterProtocol {
   unsigned long previousMillis2s = 0;     // will store last time a 2s CAN Message was send
   unsigned long previousMillis500ms = 0;  // will store last time a 500ms CAN Message was send
 
-  CAN_frame SE_320 = {.FD = false,  //SE BMS Protocol Version
-                      .ext_ID = true,
-                      .DLC = 2,
-                      .ID = 0x320,
-                      .data = {0x00, 0x02}};  //TODO: How do we reply with Protocol Version: 0x0002 ?
-  CAN_frame SE_321 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x321,
-                      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_322 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x322,
-                      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_323 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x323,
-                      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_324 = {.FD = false, .ext_ID = true, .DLC = 4, .ID = 0x324, .data = {0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_325 = {.FD = false, .ext_ID = true, .DLC = 6, .ID = 0x325, .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_326 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x326,
-                      .data = {0x00, STATE_STARTING, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_327 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x327,
-                      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_328 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x328,
-                      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_330 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x330,
-                      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_331 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x331,
-                      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_332 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x332,
-                      .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SE_333 = {.FD = false,
-                      .ext_ID = true,
-                      .DLC = 8,
-                      .ID = 0x333,
-                      .data = {0x53, 0x45, 0x42, 0x4D, 0x53, 0x00, 0x00, 0x00}};  //SEBMS
+  CAN_classic_frame SE_320 = {.FD = false,  //SE BMS Protocol Version
+                              .ext_ID = true,
+                              .DLC = 2,
+                              .ID = 0x320,
+                              .data = {0x00, 0x02}};  //TODO: How do we reply with Protocol Version: 0x0002 ?
+  CAN_classic_frame SE_321 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x321,
+                              .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_322 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x322,
+                              .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_323 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x323,
+                              .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_324 = {.FD = false, .ext_ID = true, .DLC = 4, .ID = 0x324, .data = {0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_325 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 6,
+                              .ID = 0x325,
+                              .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_326 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x326,
+                              .data = {0x00, STATE_STARTING, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_327 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x327,
+                              .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_328 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x328,
+                              .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_330 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x330,
+                              .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_331 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x331,
+                              .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_332 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x332,
+                              .data = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SE_333 = {.FD = false,
+                              .ext_ID = true,
+                              .DLC = 8,
+                              .ID = 0x333,
+                              .data = {0x53, 0x45, 0x42, 0x4D, 0x53, 0x00, 0x00, 0x00}};  //SEBMS
 
   int16_t temperature_average = 0;
   uint16_t remaining_capacity_ah = 0;
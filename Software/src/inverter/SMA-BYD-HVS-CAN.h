@@ -11,7 +11,7 @@ class SmaBydHvsInverter : public SmaInverterBase {
   const char* name() override { return Name; }
   void update_values();
   void transmit_can(unsigned long currentMillis);
-  void map_can_frame_to_variable(CAN_frame rx_frame);
+  void map_can_frame_to_variable(const CAN_frame& rx_frame);
   static constexpr const char* Name = "SMA compatible BYD Battery-Box HVS";
 
   virtual bool controls_contactor() { return true; }
@@ -22,7 +22,7 @@ class SmaBydHvsInverter : public SmaInverterBase {
   const int THIRTY_MINUTES = 1200;
 
   void transmit_can_init();
-  void pushFrame(CAN_frame* frame, std::function<void(void)> callback = []() {});
+  void pushFrame(CAN_classic_frame* frame, std::function<void(void)> callback = []() {});
   void completePairing();
 
   unsigned long previousMillis250ms = 0;  // will store last time a 250ms CAN Message was send
@@ -32,7 +32,7 @@ class SmaBydHvsInverter : public SmaInverterBase {
   unsigned long previousMillis60s = 0;    // will store last time a 60s CAN Message was send
 
   typedef struct {
-    CAN_frame* frame;
+    CAN_classic_frame* frame;
     std::function<void(void)> callback;
   } Frame;
 
@@ -49,36 +49,36 @@ class SmaBydHvsInverter : public SmaInverterBase {
   uint16_t timeWithoutInverterAllowsContactorClosing = 0;
 
   //Actual content messages
-  CAN_frame SMA_358 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x358,
-                       .data = {0x12, 0x40, 0x0C, 0x80, 0x01, 0x00, 0x01, 0x00}};
-  CAN_frame SMA_3D8 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x3D8,
-                       .data = {0x04, 0x06, 0x27, 0x10, 0x00, 0x19, 0x00, 0xFA}};
-  CAN_frame SMA_458 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x458,
-                       .data = {0x00, 0x00, 0x73, 0xAE, 0x00, 0x00, 0x64, 0x64}};
-  CAN_frame SMA_4D8 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x4D8,
-                       .data = {0x10, 0x62, 0x00, 0x00, 0x00, 0x78, 0x02, 0x08}};
-  CAN_frame SMA_518 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x518,
-                       .data = {0x00, 0x96, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00}};
-  CAN_frame SMA_558 = {.FD = false,  //Pairing first message
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x558,  // BYD HVS 10.2 kWh (0x66 might be kWh)
-                       .data = {0x03, 0x24, 0x00, 0x04, 0x00, 0x66, 0x04, 0x09}};
+  CAN_classic_frame SMA_358 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x358,
+                               .data = {0x12, 0x40, 0x0C, 0x80, 0x01, 0x00, 0x01, 0x00}};
+  CAN_classic_frame SMA_3D8 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x3D8,
+                               .data = {0x04, 0x06, 0x27, 0x10, 0x00, 0x19, 0x00, 0xFA}};
+  CAN_classic_frame SMA_458 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x458,
+                               .data = {0x00, 0x00, 0x73, 0xAE, 0x00, 0x00, 0x64, 0x64}};
+  CAN_classic_frame SMA_4D8 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x4D8,
+                               .data = {0x10, 0x62, 0x00, 0x00, 0x00, 0x78, 0x02, 0x08}};
+  CAN_classic_frame SMA_518 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x518,
+                               .data = {0x00, 0x96, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00}};
+  CAN_classic_frame SMA_558 = {.FD = false,  //Pairing first message
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x558,  // BYD HVS 10.2 kWh (0x66 might be kWh)
+                               .data = {0x03, 0x24, 0x00, 0x04, 0x00, 0x66, 0x04, 0x09}};
   // 0x03 |
   // 0x24 |
   // 0x00 |
@@ -87,36 +87,37 @@ class SmaBydHvsInverter : public SmaInverterBase {
   // 0x66 |
   // 0x04 |
   // 0x09 |
-  CAN_frame SMA_598 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x598,
-                       .data = {0x12, 0xD6, 0x43, 0xA4, 0x00, 0x00, 0x00, 0x00}};  //B0-4 Serial 301100932
-  CAN_frame SMA_5D8 = {.FD = false,
-                       .ext_ID = false,
-                       .DLC = 8,
-                       .ID = 0x5D8,
-                       .data = {0x00, 0x42, 0x59, 0x44, 0x00, 0x00, 0x00, 0x00}};  //(0) B Y D (0) (0) (0) (0)
-  CAN_frame SMA_618_0 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x618,
-                         .data = {0x00, 0x42, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79}};  //(0) B A T T E R Y
-  CAN_frame SMA_618_1 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x618,
-                         .data = {0x01, 0x2D, 0x42, 0x6F, 0x78, 0x20, 0x50, 0x72}};  //(1) - B o x P r
-  CAN_frame SMA_618_2 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x618,
-                         .data = {0x02, 0x65, 0x6D, 0x69, 0x75, 0x6D, 0x20, 0x48}};  //(2) e m i u m   H
-  CAN_frame SMA_618_3 = {.FD = false,
-                         .ext_ID = false,
-                         .DLC = 8,
-                         .ID = 0x618,
-                         .data = {0x03, 0x56, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00}};  //(3) V S (0) (0) (0) (0) (0)
+  CAN_classic_frame SMA_598 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x598,
+                               .data = {0x12, 0xD6, 0x43, 0xA4, 0x00, 0x00, 0x00, 0x00}};  //B0-4 Serial 301100932
+  CAN_classic_frame SMA_5D8 = {.FD = false,
+                               .ext_ID = false,
+                               .DLC = 8,
+                               .ID = 0x5D8,
+                               .data = {0x00, 0x42, 0x59, 0x44, 0x00, 0x00, 0x00, 0x00}};  //(0) B Y D (0) (0) (0) (0)
+  CAN_classic_frame SMA_618_0 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x618,
+                                 .data = {0x00, 0x42, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79}};  //(0) B A T T E R Y
+  CAN_classic_frame SMA_618_1 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x618,
+                                 .data = {0x01, 0x2D, 0x42, 0x6F, 0x78, 0x20, 0x50, 0x72}};  //(1) - B o x P r
+  CAN_classic_frame SMA_618_2 = {.FD = false,
+                                 .ext_ID = false,
+                                 .DLC = 8,
+                                 .ID = 0x618,
+                                 .data = {0x02, 0x65, 0x6D, 0x69, 0x75, 0x6D, 0x20, 0x48}};  //(2) e m i u m   H
+  CAN_classic_frame SMA_618_3 = {
+      .FD = false,
+      .ext_ID = false,
+      .DLC = 8,
+      .ID = 0x618,
+      .data = {0x03, 0x56, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00}};  //(3) V S (0) (0) (0) (0) (0)
 };
 
 #endif
@@ -87,7 +87,7 @@ void SofarInverter::
   SOFAR_30F.data.u8[1] = enable_flags;
 }
 
-void SofarInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
+void SofarInverter::map_can_frame_to_variable(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x605:
     case 0x705: {
@@ -107,7 +107,7 @@ void SofarInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
       }
 
       // Helper to stamp identifiers into payload (m/k/n) – easy to replace with real fields later
-      auto stamp_ids = [&](CAN_frame& f) {
+      auto stamp_ids = [&](CAN_classic_frame& f) {
         memset(f.data.u8, 0, 8);
         f.data.u8[0] = datalayer.battery.settings.sofar_user_specified_battery_id;  // PACK ID
         f.data.u8[1] = sub_k;                                                       // Module/Sub-target (k) if applies
@@ -247,7 +247,7 @@ bool SofarInverter::setup() {  // Performs one time setup at startup over CAN bu
   // Dynamically set CAN ID according to which battery index we are on
   uint16_t base_offset = (datalayer.battery.settings.sofar_user_specified_battery_id << 12);
 
-  auto init_frame = [&](CAN_frame& frame, uint16_t base_id) {
+  auto init_frame = [&](CAN_classic_frame& frame, uint16_t base_id) {
     frame.FD = false;
     frame.ext_ID = true;
     frame.DLC = 8;
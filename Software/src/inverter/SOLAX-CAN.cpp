@@ -117,7 +117,7 @@ void SolaxInverter::transmit_can(unsigned long currentMillis) {
   // No periodic sending used on this protocol, we react only on incoming CAN messages!
 }
 
-void SolaxInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
+void SolaxInverter::map_can_frame_to_variable(const CAN_frame& rx_frame) {
 
   if (rx_frame.ID == 0x1871) {
     datalayer.system.status.CAN_inverter_still_alive = CAN_STILL_ALIVE;
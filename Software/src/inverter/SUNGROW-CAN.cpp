@@ -82,7 +82,7 @@ bool SungrowInverter::setup() {
   // Production date for active modules
   // 0x71B: modules 1+2, 0x71C: modules 3+4, 0x71D: modules 5+6, 0x71E: modules 7+8
   const uint8_t prod_date[4] = {0x3F, 0x7A, 0x6F, 0x01};
-  CAN_frame* prod_date_frames[4] = {&SUNGROW_71B, &SUNGROW_71C, &SUNGROW_71D, &SUNGROW_71E};
+  CAN_classic_frame* prod_date_frames[4] = {&SUNGROW_71B, &SUNGROW_71C, &SUNGROW_71D, &SUNGROW_71E};
   for (uint8_t m = 0; m < battery_config.module_count && m < 8; m++) {
     uint8_t frame_idx = m / 2;     // 0-1->0, 2-3->1, 4-5->2, 6-7->3
     uint8_t offset = (m % 2) * 4;  // even->0, odd->4
@@ -92,14 +92,14 @@ bool SungrowInverter::setup() {
   // Serial numbers: base serial with incrementing module number
   // Format: "EM03XY" + "231012" + "346NDF" where X=cell type, N=module number
   // Fragment 1 byte 7 = cell type (same as 0x71A value)
-  CAN_frame* serial_frames[8][3] = {{&SUNGROW_71F_01_01, &SUNGROW_71F_01_02, &SUNGROW_71F_01_03},
-                                    {&SUNGROW_71F_02_01, &SUNGROW_71F_02_02, &SUNGROW_71F_02_03},
-                                    {&SUNGROW_71F_03_01, &SUNGROW_71F_03_02, &SUNGROW_71F_03_03},
-                                    {&SUNGROW_71F_04_01, &SUNGROW_71F_04_02, &SUNGROW_71F_04_03},
-                                    {&SUNGROW_71F_05_01, &SUNGROW_71F_05_02, &SUNGROW_71F_05_03},
-                                    {&SUNGROW_71F_06_01, &SUNGROW_71F_06_02, &SUNGROW_71F_06_03},
-                                    {&SUNGROW_71F_07_01, &SUNGROW_71F_07_02, &SUNGROW_71F_07_03},
-                                    {&SUNGROW_71F_08_01, &SUNGROW_71F_08_02, &SUNGROW_71F_08_03}};
+  CAN_classic_frame* serial_frames[8][3] = {{&SUNGROW_71F_01_01, &SUNGROW_71F_01_02, &SUNGROW_71F_01_03},
+                                            {&SUNGROW_71F_02_01, &SUNGROW_71F_02_02, &SUNGROW_71F_02_03},
+                                            {&SUNGROW_71F_03_01, &SUNGROW_71F_03_02, &SUNGROW_71F_03_03},
+                                            {&SUNGROW_71F_04_01, &SUNGROW_71F_04_02, &SUNGROW_71F_04_03},
+                                            {&SUNGROW_71F_05_01, &SUNGROW_71F_05_02, &SUNGROW_71F_05_03},
+                                            {&SUNGROW_71F_06_01, &SUNGROW_71F_06_02, &SUNGROW_71F_06_03},
+                                            {&SUNGROW_71F_07_01, &SUNGROW_71F_07_02, &SUNGROW_71F_07_03},
+                                            {&SUNGROW_71F_08_01, &SUNGROW_71F_08_02, &SUNGROW_71F_08_03}};
 
   for (uint8_t m = 0; m < battery_config.module_count && m < 8; m++) {
     // Fragment 1: "EM032" + cell_type (byte 7 special)
@@ -127,6 +127,7 @@ bool SungrowInverter::setup() {
     serial_frames[m][2]->data.u8[7] = 0x46;     // 'F'
   }
 
+  schedule_can_frames();
   return true;
 }
 
@@ -265,7 +266,7 @@ void SungrowInverter::update_values() {
   // Populate 0x70F_05/06/07 with module SOC based on module_count
   // 0x70F_05: modules 1-3, 0x70F_06: modules 4-6, 0x70F_07: modules 7-8
   {
-    CAN_frame* soc_frames[3] = {&SUNGROW_70F_05, &SUNGROW_70F_06, &SUNGROW_70F_07};
+    CAN_classic_frame* soc_frames[3] = {&SUNGROW_70F_05, &SUNGROW_70F_06, &SUNGROW_70F_07};
     for (uint8_t m = 0; m < battery_config.module_count && m < 8; m++) {
       uint8_t frame_idx = m / 3;         // 0-2->0, 3-5->1, 6-7->2
       uint8_t offset = (m % 3) * 2 + 2;  // 0->2, 1->4, 2->6
@@ -308,7 +309,7 @@ void SungrowInverter::update_values() {
   {
     const uint16_t cell_min_01mV = datalayer.battery.status.cell_min_voltage_mV * 10;
     const uint16_t cell_max_01mV = datalayer.battery.status.cell_max_voltage_mV * 10;
-    CAN_frame* voltage_frames[4] = {&SUNGROW_715, &SUNGROW_716, &SUNGROW_717, &SUNGROW_718};
+    CAN_classic_frame* voltage_frames[4] = {&SUNGROW_715, &SUNGROW_716, &SUNGROW_717, &SUNGROW_718};
 
     for (uint8_t m = 0; m < battery_config.module_count && m < 8; m++) {
       uint8_t frame_idx = m / 2;     // 0-1->0, 2-3->1, 4-5->2, 6-7->3
@@ -377,7 +378,7 @@ void SungrowInverter::update_values() {
 #endif
 }
 
-void SungrowInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
+void SungrowInverter::map_can_frame_to_variable(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x100:
       // SH10RS RUN @ ~1,250ms (group with one message every 250ms)
@@ -629,60 +630,46 @@ void SungrowInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
   }
 }
 
-void SungrowInverter::transmit_can(unsigned long currentMillis) {
-
-  if (transmit_can_init) {
-
-    // ---- INIT ----
-    if ((int32_t)(currentMillis - previousMillis1s) >= INTERVAL_1_S) {
-      previousMillis1s = currentMillis;
-
-      // Head messages
-      transmit_can_frame(&SUNGROW_500);
-      transmit_can_frame(&SUNGROW_400);
-      transmit_can_frame(&SUNGROW_401);
-
-      // Init specific messages
-      transmit_can_frame(&SUNGROW_007);
-      transmit_can_frame(&SUNGROW_008_00);
-      transmit_can_frame(&SUNGROW_008_01);
-      transmit_can_frame(&SUNGROW_009);
-      transmit_can_frame(&SUNGROW_00A_00);
-      transmit_can_frame(&SUNGROW_00A_01);
-      transmit_can_frame(&SUNGROW_00B);
-      transmit_can_frame(&SUNGROW_00D);
-      transmit_can_frame(&SUNGROW_00E);
-
-      // Tail messages
-      transmit_can_frame(&SUNGROW_512);
-      transmit_can_frame(&SUNGROW_501);
-      transmit_can_frame(&SUNGROW_502);
-      transmit_can_frame(&SUNGROW_503);
-      transmit_can_frame(&SUNGROW_504);
-      transmit_can_frame(&SUNGROW_505);
-      transmit_can_frame(&SUNGROW_506);
-    }
-    return;
-  }
+void SungrowInverter::transmit_can(unsigned long /*currentMillis*/) {
+  // All frames are sent by the CAN scheduler, see schedule_can_frames()
+}
 
-  // ---- RUN ----
+void SungrowInverter::schedule_can_frames() {
   // ---- 1s group ----
-  if ((int32_t)(currentMillis - previousMillis1s) >= INTERVAL_1_S) {
-    if ((currentMillis - previousMillisBatch) < delay_between_batches_ms) {
+  // Head, run batches A-C and tail follow each other delay_between_batches_ms apart.
+  // During init the head, init and tail messages are all sent at once instead.
+  const uint16_t head_phase = schedule_can(INTERVAL_1_S, 3, [this](unsigned long) {
+    // Head messages
+    transmit_can_frame(&SUNGROW_500);
+    transmit_can_frame(&SUNGROW_400);
+    transmit_can_frame(&SUNGROW_401);
+
+    if (!transmit_can_init) {
+      batch_cycle_active = true;
       return;
     }
 
-    previousMillisBatch = currentMillis;
-
-    switch (batch_send_index) {
-      case 0:
-        // Head messages
-        transmit_can_frame(&SUNGROW_500);
-        transmit_can_frame(&SUNGROW_400);
-        transmit_can_frame(&SUNGROW_401);
-        break;
-
-      case 1:
+    // Init specific messages
+    transmit_can_frame(&SUNGROW_007);
+    transmit_can_frame(&SUNGROW_008_00);
+    transmit_can_frame(&SUNGROW_008_01);
+    transmit_can_frame(&SUNGROW_009);
+    transmit_can_frame(&SUNGROW_00A_00);
+    transmit_can_frame(&SUNGROW_00A_01);
+    transmit_can_frame(&SUNGROW_00B);
+    transmit_can_frame(&SUNGROW_00D);
+    transmit_can_frame(&SUNGROW_00E);
+
+    transmit_tail();
+    batch_cycle_active = false;
+  });
+
+  schedule_can(
+      INTERVAL_1_S, 19,
+      [this](unsigned long) {
+        if (!batch_cycle_active) {
+          return;
+        }
         // Run batch A
         transmit_can_frame(&SUNGROW_000);
         transmit_can_frame(&SUNGROW_001);
@@ -703,9 +690,15 @@ void SungrowInverter::transmit_can(unsigned long currentMillis) {
         transmit_can_frame(&SUNGROW_01C);
         transmit_can_frame(&SUNGROW_01D);
         transmit_can_frame(&SUNGROW_01E);
-        break;
+      },
+      head_phase + delay_between_batches_ms);
 
-      case 2:
+  schedule_can(
+      INTERVAL_1_S, 15,
+      [this](unsigned long) {
+        if (!batch_cycle_active) {
+          return;
+        }
         // Run batch B
         transmit_can_frame(&SUNGROW_700);
         transmit_can_frame(&SUNGROW_701);
@@ -721,9 +714,15 @@ void SungrowInverter::transmit_can(unsigned long currentMillis) {
         transmit_can_frame(&SUNGROW_717);
         transmit_can_frame(&SUNGROW_718);
         transmit_can_frame(&SUNGROW_719);
-        break;
+      },
+      head_phase + 2 * delay_between_batches_ms);
 
-      case 3:
+  schedule_can(
+      INTERVAL_1_S, 13,
+      [this](unsigned long) {
+        if (!batch_cycle_active) {
+          return;
+        }
         // Run batch C
         transmit_can_frame(&SUNGROW_70F_00);
         transmit_can_frame(&SUNGROW_70F_01);
@@ -738,83 +737,64 @@ void SungrowInverter::transmit_can(unsigned long currentMillis) {
         transmit_can_frame(&SUNGROW_71C);  // Modules 3+4 production date (zeros if unpopulated)
         transmit_can_frame(&SUNGROW_71D);  // Modules 5+6 production date (zeros if unpopulated)
         transmit_can_frame(&SUNGROW_71E);  // Modules 7+8 production date (zeros if unpopulated)
-        break;
-
-      case 4:
-        previousMillis1s = currentMillis;
-
-        // Tail messages
-        transmit_can_frame(&SUNGROW_512);
-        transmit_can_frame(&SUNGROW_501);
-        transmit_can_frame(&SUNGROW_502);
-        transmit_can_frame(&SUNGROW_503);
-        transmit_can_frame(&SUNGROW_504);
-        transmit_can_frame(&SUNGROW_505);
-        transmit_can_frame(&SUNGROW_506);
-        break;
-
-      default:
-        break;
-    }
+      },
+      head_phase + 3 * delay_between_batches_ms);
 
-    batch_send_index++;
-    if (batch_send_index > 4) {
-      batch_send_index = 0;
-    }
-  }
+  schedule_can(
+      INTERVAL_1_S, 7,
+      [this](unsigned long) {
+        if (!batch_cycle_active) {
+          return;
+        }
+        transmit_tail();
+        batch_cycle_active = false;
+      },
+      head_phase + 4 * delay_between_batches_ms);
 
   // ---- 10s group ----
-  if ((int32_t)(currentMillis - previousMillis10s) >= INTERVAL_10_S) {
-    previousMillis10s = currentMillis;
-    transmit_can_frame(&SUNGROW_707);
-    transmit_can_frame(&SUNGROW_708_00);
-    transmit_can_frame(&SUNGROW_708_01);
-    transmit_can_frame(&SUNGROW_709);
-    transmit_can_frame(&SUNGROW_70A_00);
-    transmit_can_frame(&SUNGROW_70A_01);
-    transmit_can_frame(&SUNGROW_70B);
-    transmit_can_frame(&SUNGROW_70D);
-    transmit_can_frame(&SUNGROW_70E);
-  }
+  schedule_run_frame(&SUNGROW_707, INTERVAL_10_S);
+  schedule_run_frame(&SUNGROW_708_00, INTERVAL_10_S);
+  schedule_run_frame(&SUNGROW_708_01, INTERVAL_10_S);
+  schedule_run_frame(&SUNGROW_709, INTERVAL_10_S);
+  schedule_run_frame(&SUNGROW_70A_00, INTERVAL_10_S);
+  schedule_run_frame(&SUNGROW_70A_01, INTERVAL_10_S);
+  schedule_run_frame(&SUNGROW_70B, INTERVAL_10_S);
+  schedule_run_frame(&SUNGROW_70D, INTERVAL_10_S);
+  schedule_run_frame(&SUNGROW_70E, INTERVAL_10_S);
 
   // ---- 60s group ----
-  if ((int32_t)(currentMillis - previousMillis60s) >= INTERVAL_60_S) {
-    previousMillis60s = currentMillis;
-    transmit_can_frame(&SUNGROW_71F_01_01);
-    transmit_can_frame(&SUNGROW_71F_01_02);
-    transmit_can_frame(&SUNGROW_71F_01_03);
-    transmit_can_frame(&SUNGROW_71F_02_01);
-    transmit_can_frame(&SUNGROW_71F_02_02);
-    transmit_can_frame(&SUNGROW_71F_02_03);
-    if (battery_config.module_count >= 3) {
-      transmit_can_frame(&SUNGROW_71F_03_01);
-      transmit_can_frame(&SUNGROW_71F_03_02);
-      transmit_can_frame(&SUNGROW_71F_03_03);
-    }
-    if (battery_config.module_count >= 4) {
-      transmit_can_frame(&SUNGROW_71F_04_01);
-      transmit_can_frame(&SUNGROW_71F_04_02);
-      transmit_can_frame(&SUNGROW_71F_04_03);
-    }
-    if (battery_config.module_count >= 5) {
-      transmit_can_frame(&SUNGROW_71F_05_01);
-      transmit_can_frame(&SUNGROW_71F_05_02);
-      transmit_can_frame(&SUNGROW_71F_05_03);
-    }
-    if (battery_config.module_count >= 6) {
-      transmit_can_frame(&SUNGROW_71F_06_01);
-      transmit_can_frame(&SUNGROW_71F_06_02);
-      transmit_can_frame(&SUNGROW_71F_06_03);
-    }
-    if (battery_config.module_count >= 7) {
-      transmit_can_frame(&SUNGROW_71F_07_01);
-      transmit_can_frame(&SUNGROW_71F_07_02);
-      transmit_can_frame(&SUNGROW_71F_07_03);
-    }
-    if (battery_config.module_count >= 8) {
-      transmit_can_frame(&SUNGROW_71F_08_01);
-      transmit_can_frame(&SUNGROW_71F_08_02);
-      transmit_can_frame(&SUNGROW_71F_08_03);
+  // Serial number of each populated module
+  CAN_classic_frame* serial_frames[8][3] = {{&SUNGROW_71F_01_01, &SUNGROW_71F_01_02, &SUNGROW_71F_01_03},
+                                            {&SUNGROW_71F_02_01, &SUNGROW_71F_02_02, &SUNGROW_71F_02_03},
+                                            {&SUNGROW_71F_03_01, &SUNGROW_71F_03_02, &SUNGROW_71F_03_03},
+                                            {&SUNGROW_71F_04_01, &SUNGROW_71F_04_02, &SUNGROW_71F_04_03},
+                                            {&SUNGROW_71F_05_01, &SUNGROW_71F_05_02, &SUNGROW_71F_05_03},
+                                            {&SUNGROW_71F_06_01, &SUNGROW_71F_06_02, &SUNGROW_71F_06_03},
+                                            {&SUNGROW_71F_07_01, &SUNGROW_71F_07_02, &SUNGROW_71F_07_03},
+                                            {&SUNGROW_71F_08_01, &SUNGROW_71F_08_02, &SUNGROW_71F_08_03}};
+  for (uint8_t m = 0; m < battery_config.module_count && m < 8; m++) {
+    for (auto frame : serial_frames[m]) {
+      schedule_run_frame(frame, INTERVAL_60_S);
     }
   }
 }
+
+// Sends the frame every period_ms once the inverter has left the init phase
+void SungrowInverter::schedule_run_frame(const CAN_classic_frame* frame, uint16_t period_ms) {
+  schedule_can(period_ms, 1, [this, frame](unsigned long) {
+    if (!transmit_can_init) {
+      transmit_can_frame(frame);
+    }
+  });
+}
+
+void SungrowInverter::transmit_tail() {
+  // Tail messages
+  transmit_can_frame(&SUNGROW_512);
+  transmit_can_frame(&SUNGROW_501);
+  transmit_can_frame(&SUNGROW_502);
+  transmit_can_frame(&SUNGROW_503);
+  transmit_can_frame(&SUNGROW_504);
+  transmit_can_frame(&SUNGROW_505);
+  transmit_can_frame(&SUNGROW_506);
+}
@@ -9,7 +9,7 @@
 - Add OBD2 responses for 79B /7BB polls
 -*/
 
-static uint8_t calculate_CRC_Nissan(CAN_frame* frame) {
+static uint8_t calculate_CRC_Nissan(CAN_classic_frame* frame) {
   uint8_t crc = 0;
   for (uint8_t j = 0; j < 7; j++) {
     crc = crctable_nissan_leaf[(crc ^ static_cast<uint8_t>(frame->data.u8[j])) % 256];
@@ -39,7 +39,7 @@ void VCUInverter::update_values() {  //Called every 1s
   LEAF_5BC.data.u8[4] = (datalayer.battery.status.soh_pptt / 100) << 1;
 }
 
-void VCUInverter::map_can_frame_to_variable(CAN_frame rx_frame) {
+void VCUInverter::map_can_frame_to_variable(const CAN_frame& rx_frame) {
   switch (rx_frame.ID) {
     case 0x1F2:
       datalayer.system.status.CAN_inverter_still_alive = CAN_STILL_ALIVE;
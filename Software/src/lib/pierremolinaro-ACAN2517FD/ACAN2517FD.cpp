@@ -7,6 +7,9 @@
 
 #include "ACAN2517FD.h"
 #include "../../system_settings.h" //Contains task priority
+#ifdef ARDUINO_ARCH_ESP32
+  #include <esp_timer.h>
+#endif
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -82,6 +85,13 @@ static const uint16_t TXQUA_REGISTER    = 0x058 ;
 
 static const uint16_t INT_REGISTER = 0x01C ;
 
+//······················································································································
+//   TIME BASE REGISTERS
+//······················································································································
+
+static const uint16_t TBC_REGISTER   = 0x010 ;
+static const uint16_t TSCON_REGISTER = 0x014 ;
+
 //······················································································································
 //   FIFO REGISTERS
 //······················································································································
@@ -215,6 +225,10 @@ mTXQBufferPayload (0),
 mReceiveFIFOPayload (0),
 mTXBWS_RequestedMode (0),
 mHardwareReceiveBufferOverflowCount (0),
+mReceiveFIFOAddress (0x400),
+mReceiveFIFOSize (0),
+mReceiveObjectSize (0),
+mReceiveTimestamps (false),
 mDriverReceiveBuffer (),
 mDriverTransmitBuffer ()
 #ifdef ARDUINO_ARCH_ESP32
@@ -446,8 +460,25 @@ uint32_t ACAN2517FD::begin (const ACAN2517FDSettings & inSettings,
     writeRegister8 (FIFOCON_REGISTER (RECEIVE_FIFO_INDEX) + 3, data8) ;
     data8  = 1 << 0 ; // Interrupt Enabled for FIFO not Empty (TFNRFNIE)
     data8 |= 1 << 3 ; // Interrupt Enabled for FIFO Overflow (RXOVIE)
+    mReceiveTimestamps = inSettings.mControllerReceiveFIFOTimestamps ;
+    if (mReceiveTimestamps) {
+      data8 |= 1 << 5 ; // Received Message Time Stamp Enable (RXTSEN)
+    }
     writeRegister8 (FIFOCON_REGISTER (RECEIVE_FIFO_INDEX), data8) ;
     mReceiveFIFOPayload = ACAN2517FDSettings::objectSizeForPayload (inSettings.mControllerReceiveFIFOPayload) ;
+  //--- RAM holds the TXQ (the TEF is not used), then FIFO #1, the receive FIFO (DS20005688B, page 97)
+    mReceiveFIFOSize = inSettings.mControllerReceiveFIFOSize ;
+    mReceiveObjectSize = mReceiveFIFOPayload + (mReceiveTimestamps ? 4 : 0) ;
+    mReceiveFIFOAddress = 0x400 ;
+    if (mUsesTXQ) {
+      mReceiveFIFOAddress += mTXQBufferPayload * inSettings.mControllerTXQSize ;
+    }
+  //----------------------------------- Time base counter, counting microseconds (TSCON, DS20005688B, page 31)
+    if (mReceiveTimestamps) {
+      uint32_t prescaler = inSettings.sysClock () / 1000000 ;
+      prescaler = (prescaler > 0) ? (prescaler - 1) : 0 ;
+      writeRegister32 (TSCON_REGISTER, (1UL << 16) | (prescaler & 0x3FF)) ; // TBCEN, TBCPRE
+    }
   //----------------------------------- Configure TX FIFO (FIFOCON, DS20005688B, page 52)
     data8 = inSettings.mControllerTransmitFIFORetransmissionAttempts ;
     data8 <<= 5 ;
@@ -891,12 +922,15 @@ void ACAN2517FD::isr_poll_core (void) {
       taskDISABLE_INTERRUPTS () ;
     #endif
       bool handled = true ;
+      bool received = false ;
         while (handled) {
         handled = false ;
         const uint16_t it = readRegister16Assume_SPI_transaction (INT_REGISTER) ; // DS20005688B, page 34
         if (mRxInterruptEnabled && ((it & (1 << 1)) != 0)) { // Receive FIFO interrupt
-          receiveInterrupt () ;
-          handled = true ;
+          if (receiveInterrupt ()) { // Nothing consumed: the interrupt is off or the FIFO is empty, do not loop on it
+            handled = true ;
+            received = true ;
+          }
         }
         if ((it & (1 << 10)) != 0) { // Transmit Attempt interrupt
         //--- Clear Pending Transmit Attempt interrupt bit
@@ -931,6 +965,11 @@ void ACAN2517FD::isr_poll_core (void) {
       taskENABLE_INTERRUPTS () ;
     #endif
   mSPI.endTransaction () ;
+  #ifdef ARDUINO_ARCH_ESP32
+    if (received && (mReceiveNotificationTask != nullptr)) {
+      xTaskNotifyGive (mReceiveNotificationTask) ;
+    }
+  #endif
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -950,60 +989,112 @@ void ACAN2517FD::transmitInterrupt (void) { // Generated if hardware transmit FI
 
 //----------------------------------------------------------------------------------------------------------------------
 
-void ACAN2517FD::receiveInterrupt (void) {
-  const uint16_t ramAddress = uint16_t (0x400 + readRegister32Assume_SPI_transaction (FIFOUA_REGISTER (RECEIVE_FIFO_INDEX))) ;
-  CANFDMessage message ;
-//--- Read word register via 6-byte buffer (speed enhancement, thanks to thomasfla)
-  uint8_t buffer [74] = {0} ;
-//--- Enter command
+bool ACAN2517FD::receiveInterrupt (void) {
+//--- Read FIFOSTA and FIFOUA in one transfer
+  uint8_t buffer [10] = {0} ;
+  const uint16_t statusCommand = (FIFOSTA_REGISTER (RECEIVE_FIFO_INDEX) & 0x0FFF) | (0b0011 << 12) ;
+  buffer [0] = statusCommand >> 8 ;
+  buffer [1] = statusCommand & 0xFF ;
+  assertCS () ;
+    mSPI.transfer (buffer, 10) ;
+  deassertCS () ;
+  const uint32_t status = u32FromBufferAtIndex (buffer, 2) ;
+  const uint16_t ramAddress = uint16_t (0x400 + u32FromBufferAtIndex (buffer, 6)) ;
+//--- Objects waiting: from the one at FIFOUA (tail) up to FIFOCI, where the next message will be saved (head)
+  const uint8_t tail = (ramAddress - mReceiveFIFOAddress) / mReceiveObjectSize ;
+  const uint8_t head = (status >> 8) & 0x1F ;
+  uint8_t pending = (head + mReceiveFIFOSize - tail) % mReceiveFIFOSize ;
+  if (pending == 0) {
+    pending = ((status & 1) != 0) ? mReceiveFIFOSize : 0 ; // TFNRFNIF set and head = tail: FIFO is full
+  }
+//--- Read as many as are consecutive in RAM, fit the burst buffer and the driver receive buffer
+  uint32_t count = pending ;
+  count = min (count, uint32_t (mReceiveFIFOSize - tail)) ;
+  count = min (count, uint32_t (RECEIVE_BURST_SIZE / mReceiveObjectSize)) ;
+  count = min (count, mDriverReceiveBuffer.size () - mDriverReceiveBuffer.count ()) ;
+  if (count == 0) {
+    if (mDriverReceiveBuffer.isFull ()) {
+      disableReceiveInterrupt () ;
+      return false ;
+    }else if ((status & 1) == 0) { // TFNRFNIF clear: the FIFO is empty, RFIF goes away by itself
+      return false ;
+    }
+    count = 1 ; // FIFOCI and FIFOUA out of step: read the object at FIFOUA, one at a time as before bursts
+  }
   const uint16_t readCommand = (ramAddress & 0x0FFF) | (0b0011 << 12) ;
-  buffer [0] = readCommand >> 8 ;
-  buffer [1] = readCommand & 0xFF ;
-//--- SPI transfer
+  mReceiveBurst [0] = readCommand >> 8 ;
+  mReceiveBurst [1] = readCommand & 0xFF ;
   assertCS () ;
-    mSPI.transfer (buffer, 74) ;
-  //--- Read identifier (see DS20005678A, page 42)
-    message.id = u32FromBufferAtIndex (buffer, 2) ;
-  //--- Read DLC, RTR, IDE bits, and match filter index
-    const uint32_t flags = u32FromBufferAtIndex (buffer, 6) ;
+    mSPI.transfer (mReceiveBurst, 2 + count * mReceiveObjectSize) ;
+  deassertCS () ;
+//--- Local time and controller time base, read together after the objects to convert their receive timestamps
+  #ifdef ARDUINO_ARCH_ESP32
+    const uint64_t now_us = esp_timer_get_time () ;
+  #else
+    const uint64_t now_us = micros () ;
+  #endif
+  const uint32_t timeBase = mReceiveTimestamps ? readRegister32Assume_SPI_transaction (TBC_REGISTER) : 0 ;
+//--- Free the objects, UINC moves FIFOUA by one object (DS20005688B, page 52)
+  for (uint32_t i = 0 ; i < count ; i++) {
+    writeRegister8Assume_SPI_transaction (FIFOCON_REGISTER (RECEIVE_FIFO_INDEX) + 1, 1 << 0) ;
+  }
+//--- Decode objects (see DS20005678A, page 42)
+  for (uint32_t i = 0 ; i < count ; i++) {
+    uint8_t * object = mReceiveBurst + 2 + i * mReceiveObjectSize ;
+    CANFDMessage message ;
+    message.id = u32FromBufferAtIndex (object, 0) ;
+  //--- DLC, RTR, IDE bits, and match filter index
+    const uint32_t flags = u32FromBufferAtIndex (object, 4) ;
     static const uint8_t kLength [16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64} ;
     message.len = kLength [flags & 0x0F] ;
-  //--- Write data (Swap data if processor is big endian)
+    uint8_t dataIndex = 8 ;
+    message.timestamp_us = now_us ;
+    if (mReceiveTimestamps) {
+    //--- Receive time relative to the time base counter read above
+      const uint32_t age = timeBase - u32FromBufferAtIndex (object, 8) ;
+      message.timestamp_us -= age ;
+      dataIndex = 12 ;
+    }
+  //--- Data (Swap data if processor is big endian)
     const uint32_t wordCount = (message.len + 3) / 4 ;
-    for (uint32_t i=0 ; i < wordCount ; i++) {
-      message.data32 [i] = u32FromBufferAtIndex (buffer, 10 + 4 * i) ;
+    for (uint32_t w = 0 ; w < wordCount ; w++) {
+      message.data32 [w] = u32FromBufferAtIndex (object, dataIndex + 4 * w) ;
     }
-  deassertCS () ;
-//--- Increment FIFO
-  const uint8_t data8 = 1 << 0 ; // Set UINC bit (DS20005688B, page 52)
-  writeRegister8Assume_SPI_transaction (FIFOCON_REGISTER (RECEIVE_FIFO_INDEX) + 1, data8) ;
-  message.idx = uint8_t ((flags >> 11) & 0x1F) ;
-//--- Message type (DS20005678B, page 42)
-  if ((flags & (1 << 5)) != 0 ) { // RTR bit
-    message.type = CANFDMessage::CAN_REMOTE ;
-  }else if ((flags & (1 << 7)) == 0) { // FDF bit
-    message.type = CANFDMessage::CAN_DATA ;
-  }else if ((flags & (1 << 6)) == 0) { // BRS bit
-    message.type = CANFDMessage::CANFD_NO_BIT_RATE_SWITCH ;
-  }else{
-    message.type = CANFDMessage::CANFD_WITH_BIT_RATE_SWITCH ;
-  }
-//--- If an extended frame is received, identifier bits should be reordered (see DS20005678B, page 42)
-  message.ext = (flags & (1 << 4)) != 0 ;
-  if (message.ext) {
-    const uint32_t tempID = message.id ;
-    message.id = ((tempID >> 11) & 0x3FFFF) | ((tempID & 0x7FF) << 18) ;
+    message.idx = uint8_t ((flags >> 11) & 0x1F) ;
+  //--- Message type (DS20005678B, page 42)
+    if ((flags & (1 << 5)) != 0 ) { // RTR bit
+      message.type = CANFDMessage::CAN_REMOTE ;
+    }else if ((flags & (1 << 7)) == 0) { // FDF bit
+      message.type = CANFDMessage::CAN_DATA ;
+    }else if ((flags & (1 << 6)) == 0) { // BRS bit
+      message.type = CANFDMessage::CANFD_NO_BIT_RATE_SWITCH ;
+    }else{
+      message.type = CANFDMessage::CANFD_WITH_BIT_RATE_SWITCH ;
+    }
+  //--- If an extended frame is received, identifier bits should be reordered (see DS20005678B, page 42)
+    message.ext = (flags & (1 << 4)) != 0 ;
+    if (message.ext) {
+      const uint32_t tempID = message.id ;
+      message.id = ((tempID >> 11) & 0x3FFFF) | ((tempID & 0x7FF) << 18) ;
+    }
+  //--- Append message to driver receive FIFO
+    mDriverReceiveBuffer.append (message) ;
   }
-//--- Append message to driver receive FIFO
-  mDriverReceiveBuffer.append (message) ;
 //--- If mDriverReceiveBuffer is full, disable receive interrupt (added in release 2.17)
   if (mDriverReceiveBuffer.isFull ()) {
-    mRxInterruptEnabled = false ;
-    if (mINT != 255) {
-      uint8_t data8 = readRegister8Assume_SPI_transaction (INT_REGISTER + 2) ;
-      data8 &= ~ (1 << 1) ; // Receive FIFO Interrupt disable
-      writeRegister8Assume_SPI_transaction (INT_REGISTER + 2, data8) ;
-    }
+    disableReceiveInterrupt () ;
+  }
+  return true ;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void ACAN2517FD::disableReceiveInterrupt (void) {
+  mRxInterruptEnabled = false ;
+  if (mINT != 255) {
+    uint8_t data8 = readRegister8Assume_SPI_transaction (INT_REGISTER + 2) ;
+    data8 &= ~ (1 << 1) ; // Receive FIFO Interrupt disable
+    writeRegister8Assume_SPI_transaction (INT_REGISTER + 2, data8) ;
   }
 }
 
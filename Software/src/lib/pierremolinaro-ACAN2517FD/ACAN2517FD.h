@@ -153,6 +153,14 @@ class ACAN2517FD {
   private: uint8_t mReceiveFIFOPayload ; // in byte count
   private: uint8_t mTXBWS_RequestedMode ;
   private: uint8_t mHardwareReceiveBufferOverflowCount ;
+  private: uint16_t mReceiveFIFOAddress ; // RAM address of the first receive FIFO object
+  private: uint8_t mReceiveFIFOSize ;
+  private: uint8_t mReceiveObjectSize ; // in byte count: header, timestamp and payload
+  private: bool mReceiveTimestamps ;
+
+//--- Receive FIFO objects are read in bursts of consecutive objects
+  private: static const uint16_t RECEIVE_BURST_SIZE = 4 * 76 ;
+  private: uint8_t mReceiveBurst [2 + RECEIVE_BURST_SIZE] ;
 
 //······················································································································
 //    Receive buffer
@@ -160,12 +168,22 @@ class ACAN2517FD {
 
   private: ACANFDBuffer mDriverReceiveBuffer ;
 
+  public: uint32_t driverReceiveBufferSize (void) const { return mDriverReceiveBuffer.size () ; }
+
   public: uint32_t driverReceiveBufferPeakCount (void) const { return mDriverReceiveBuffer.peakCount () ; }
 
+  public: uint32_t driverReceiveBufferOverflowCount (void) const { return mDriverReceiveBuffer.overflowCount () ; }
+
   public: uint8_t hardwareReceiveBufferOverflowCount (void) const { return mHardwareReceiveBufferOverflowCount ; }
 
   public: void resetHardwareReceiveBufferOverflowCount (void) { mHardwareReceiveBufferOverflowCount = 0 ; }
 
+  #ifdef ARDUINO_ARCH_ESP32
+    // Task notified (xTaskNotifyGive) each time received messages were entered in the driver receive buffer
+    public: void setReceiveNotificationTask (TaskHandle_t inTask) { mReceiveNotificationTask = inTask ; }
+    private: TaskHandle_t mReceiveNotificationTask = nullptr ;
+  #endif
+
 //······················································································································
 //    Transmit buffer
 //······················································································································
@@ -214,7 +232,8 @@ class ACAN2517FD {
 
   public: void isr (void) ;
   public: void isr_poll_core (void) ;
-  private: void receiveInterrupt (void) ;
+  private: bool receiveInterrupt (void) ; // Returns false if no object was consumed
+  private: void disableReceiveInterrupt (void) ;
   private: void transmitInterrupt (void) ;
   #ifdef ARDUINO_ARCH_ESP32
     public: SemaphoreHandle_t mISRSemaphore ;
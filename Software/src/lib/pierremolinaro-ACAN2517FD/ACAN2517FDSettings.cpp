@@ -339,6 +339,9 @@ uint32_t ACAN2517FDSettings::ramUsage (void) const {
   result += objectSizeForPayload (mControllerTXQBufferPayload) * mControllerTXQSize ;
 //--- Receive FIFO (FIFO #1)
   result += objectSizeForPayload (mControllerReceiveFIFOPayload) * mControllerReceiveFIFOSize ;
+  if (mControllerReceiveFIFOTimestamps) {
+    result += 4 * mControllerReceiveFIFOSize ;
+  }
 //--- Send FIFO (FIFO #2)
   result += objectSizeForPayload (mControllerTransmitFIFOPayload) * mControllerTransmitFIFOSize ;
 //---
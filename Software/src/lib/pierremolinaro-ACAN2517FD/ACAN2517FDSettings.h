@@ -204,6 +204,9 @@ class ACAN2517FDSettings {
 //--- Controller receive FIFO size
   public: uint8_t mControllerReceiveFIFOSize = 27 ; // 1 ... 32
 
+//--- Receive timestamps from the controller time base (1 µs resolution), each object takes 4 more bytes
+  public: bool mControllerReceiveFIFOTimestamps = false ;
+
 //······················································································································
 //    SYSCLOCK frequency computation
 //······················································································································
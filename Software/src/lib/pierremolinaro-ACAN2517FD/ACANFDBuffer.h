@@ -25,7 +25,8 @@ class ACANFDBuffer {
   mSize (0),
   mReadIndex (0),
   mCount (0),
-  mPeakCount (0) {
+  mPeakCount (0),
+  mOverflowCount (0) {
   }
 
 //······················································································································
@@ -45,6 +46,7 @@ class ACANFDBuffer {
   private: uint32_t mReadIndex ;
   private: uint32_t mCount ;
   private: uint32_t mPeakCount ; // > mSize if overflow did occur
+  private: uint32_t mOverflowCount ; // Number of messages dropped because the buffer was full
 
 //······················································································································
 // Accessors
@@ -54,6 +56,7 @@ class ACANFDBuffer {
   public: inline uint32_t count (void) const { return mCount ; }
   public: inline bool isFull (void) const { return mCount == mSize ; } // Added in release 2.17 (thanks to Flole998)
   public: inline uint32_t peakCount (void) const { return mPeakCount ; }
+  public: inline uint32_t overflowCount (void) const { return mOverflowCount ; }
 
 //······················································································································
 // initWithSize
@@ -85,6 +88,7 @@ class ACANFDBuffer {
       }
     }else{
       mPeakCount = mSize + 1 ;
+      mOverflowCount += 1 ;
     }
     return ok ;
   }
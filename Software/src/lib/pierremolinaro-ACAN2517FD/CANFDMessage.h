@@ -33,7 +33,8 @@ class CANFDMessage {
   type (CANFD_WITH_BIT_RATE_SWITCH),
   idx (0),  // This field is used by the driver
   len (0), // Length of data (0 ... 64)
-  data () {
+  data (),
+  timestamp_us (0) {
   }
 
 //·············································································
@@ -44,7 +45,8 @@ class CANFDMessage {
   type (inMessage.rtr ? CAN_REMOTE : CAN_DATA),
   idx (inMessage.idx),  // This field is used by the driver
   len (inMessage.len), // Length of data (0 ... 64)
-  data () {
+  data (),
+  timestamp_us (inMessage.timestamp_us) {
     data64 [0] = inMessage.data64 ;
   }
 
@@ -79,6 +81,7 @@ class CANFDMessage {
     int8_t   data_s8   [64] ;
     uint8_t  data      [64] ;
   } ;
+  public : uint64_t timestamp_us ; // Receive time (esp_timer_get_time), set by the driver
 
 //·············································································
 //   Methods
@@ -14,6 +14,7 @@
 #endif
 
 #include <hal/clk_gate_ll.h> // For ESP32 board manager
+#include <esp_timer.h>
 
 //------------------------------------------------------------------------------
 //   ESP32 Critical Section
@@ -348,7 +349,8 @@ void IRAM_ATTR ACAN_ESP32::isr (void * inUserArgument) {
 
   portENTER_CRITICAL (&portMux) ;
   const uint32_t interrupt = myDriver->TWAI_INT_RAW_REG () ;
-  if ((interrupt & TWAI_RX_INT_ST) != 0) {
+  const bool received = (interrupt & TWAI_RX_INT_ST) != 0 ;
+  if (received) {
      myDriver->handleRXInterrupt () ;
   }
   if ((interrupt & TWAI_TX_INT_ST) != 0) {
@@ -356,6 +358,10 @@ void IRAM_ATTR ACAN_ESP32::isr (void * inUserArgument) {
   }
   portEXIT_CRITICAL (&portMux) ;
 
+  if (received && (myDriver->mReceiveNotificationTask != nullptr)) {
+    vTaskNotifyGiveFromISR (myDriver->mReceiveNotificationTask, nullptr) ;
+  }
+
   portYIELD_FROM_ISR () ;
 }
 
@@ -375,6 +381,7 @@ void ACAN_ESP32::handleTXInterrupt (void) {
 
 void ACAN_ESP32::handleRXInterrupt (void) {
   CANMessage frame;
+  frame.timestamp_us = esp_timer_get_time () ; // Stamped as the frame leaves the controller
   getReceivedMessage (frame) ;
   switch (mAcceptedFrameFormat) {
   case ACAN_ESP32_Filter::standard :
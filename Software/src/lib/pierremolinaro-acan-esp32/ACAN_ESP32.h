@@ -85,9 +85,14 @@ class ACAN_ESP32 {
   public: inline uint16_t driverReceiveBufferSize (void) const { return mDriverReceiveBuffer.size () ;  }
   public: inline uint16_t driverReceiveBufferCount (void) const { return mDriverReceiveBuffer.count() ;  }
   public: inline uint16_t driverReceiveBufferPeakCount (void) const { return mDriverReceiveBuffer.peakCount () ; }
+  public: inline uint32_t driverReceiveBufferOverflowCount (void) const { return mDriverReceiveBuffer.overflowCount () ; }
 
   public: inline void resetDriverReceiveBufferPeakCount (void) { mDriverReceiveBuffer.resetPeakCount () ; }
 
+  // Task notified (vTaskNotifyGiveFromISR) each time a received message was entered in the driver receive buffer
+  public: inline void setReceiveNotificationTask (TaskHandle_t inTask) { mReceiveNotificationTask = inTask ; }
+  private: TaskHandle_t mReceiveNotificationTask = nullptr ;
+
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   //    Transmitting messages
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
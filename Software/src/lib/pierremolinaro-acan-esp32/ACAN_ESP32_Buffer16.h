@@ -19,7 +19,8 @@ class ACAN_ESP32_Buffer16 {
   mSize (0),
   mReadIndex (0),
   mCount (0),
-  mPeakCount (0) {
+  mPeakCount (0),
+  mOverflowCount (0) {
   }
 
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -39,6 +40,7 @@ class ACAN_ESP32_Buffer16 {
   private: uint16_t mReadIndex ;
   private: uint16_t mCount ;
   private: uint16_t mPeakCount ; // > mSize if overflow did occur
+  private: uint32_t mOverflowCount ; // Number of messages dropped because the buffer was full
 
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   // Accessors
@@ -48,6 +50,7 @@ class ACAN_ESP32_Buffer16 {
   public: inline uint16_t count (void) const { return mCount ; }
   public: inline uint16_t peakCount (void) const { return mPeakCount ; }
   public: inline uint16_t didOverflow (void) const { return mPeakCount > mSize ; }
+  public: inline uint32_t overflowCount (void) const { return mOverflowCount ; }
 
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   // initWithSize
@@ -82,6 +85,7 @@ class ACAN_ESP32_Buffer16 {
       }
     }else{
       mPeakCount = mSize + 1 ; // Overflow
+      mOverflowCount += 1 ;
     }
     return ok ;
   }
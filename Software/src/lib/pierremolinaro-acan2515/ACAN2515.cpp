@@ -6,6 +6,9 @@
 
 #include "ACAN2515.h"
 #include "../../system_settings.h" //Contains task priority
+#ifdef ARDUINO_ARCH_ESP32
+  #include <esp_timer.h>
+#endif
 
 //··································································································
 //   MCP2515 COMMANDS
@@ -101,6 +104,7 @@ mSPISettings (10UL * 1000UL * 1000UL, MSBFIRST, SPI_MODE0),  // 10 MHz, UL suffi
 mCS (inCS),
 mINT (inINT),
 mRolloverEnable (false),
+mReadFilterIndex (false),
 #ifdef ARDUINO_ARCH_ESP32
   mISRSemaphore (xSemaphoreCreateCounting (10, 0)),
 #endif
@@ -406,6 +410,10 @@ uint16_t ACAN2515::internalBeginOperation (const ACAN2515Settings & inSettings,
         idx += 1 ;
       }
     }
+    mReadFilterIndex = false ;
+    for (uint8_t idx = 0 ; idx < 6 ; idx++) {
+      mReadFilterIndex |= (mCallBackFunctionArray [idx] != NULL) ;
+    }
   //----------------------------------- Set TXBi priorities
     write2515Register (TXB0CTRL_REGISTER, inSettings.mTXBPriority & 3) ;
     write2515Register (TXB1CTRL_REGISTER, (inSettings.mTXBPriority >> 2) & 3) ;
@@ -562,6 +570,10 @@ uint16_t ACAN2515::internalSetFiltersOnTheFly (const ACAN2515Mask inRXM0,
         idx += 1 ;
       }
     }
+    mReadFilterIndex = false ;
+    for (uint8_t idx = 0 ; idx < 6 ; idx++) {
+      mReadFilterIndex |= (mCallBackFunctionArray [idx] != NULL) ;
+    }
   }
 //--- Restore saved mode
   if (errorCode == 0) {
@@ -644,94 +656,75 @@ void ACAN2515::end (void) {
 bool ACAN2515::isr_core (void) {
   bool handled = false ;
   mSPI.beginTransaction (mSPISettings) ;
-  uint8_t itStatus = read2515Register (CANSTAT_REGISTER) & 0x0E ;
-  while (itStatus != 0) {
+//--- All pending interrupts are taken from one CANINTF read (only RX and TX interrupts are enabled, see CANINTE)
+  uint8_t flags = read2515Register (CANINTF_REGISTER) & 0x1F ;
+  while (flags != 0) {
     handled = true ;
-    switch (itStatus) {
-    case 0 : // No interrupt
-      break ;
-    case 1 << 1 : // Error interrupt
-      bitModify2515Register (CANINTF_REGISTER, 0x20, 0) ; // Ack interrupt
-      break ;
-    case 2 << 1 : // Wake-up interrupt
-      bitModify2515Register (CANINTF_REGISTER, 0x40, 0) ; // Ack interrupt
-      break ;
-    case 3 << 1 : // TXB0 interrupt
-      handleTXBInterrupt (0) ;
-      break ;
-    case 4 << 1 : // TXB1 interrupt
-      handleTXBInterrupt (1) ;
-      break ;
-    case 5 << 1 : // TXB2 interrupt
-      handleTXBInterrupt (2) ;
-      break ;
-    case 6 << 1 : // RXB0 interrupt
-    case 7 << 1 : // RXB1 interrupt
-      handleRXBInterrupt () ;
-      break ;
+  //--- RXB0 first: a frame rolls over into RXB1 only while RXB0 is full, so RXB1 holds the newer one
+    if ((flags & 0x01) != 0) {
+      handleRXBInterrupt (0) ;
+    }
+    if ((flags & 0x02) != 0) {
+      handleRXBInterrupt (1) ;
     }
-    itStatus = read2515Register (CANSTAT_REGISTER) & 0x0E ;
+    for (uint8_t txb = 0 ; txb < 3 ; txb++) {
+      if ((flags & (0x04 << txb)) != 0) {
+        handleTXBInterrupt (txb) ;
+      }
+    }
+    flags = read2515Register (CANINTF_REGISTER) & 0x1F ;
   }
   mSPI.endTransaction () ;
   return handled ;
 }
 
 //··································································································
-// This function is called by ISR when a MCP2515 receive buffer becomes full
+// This function is called by ISR when a MCP2515 receive buffer becomes full. The frame is read with one
+// READ RX BUFFER command, which frees the buffer when CS goes high, so no CANINTF write is needed (writing
+// it afterwards could discard a frame received in the meantime).
 
-void ACAN2515::handleRXBInterrupt (void) {
-  const uint8_t rxStatus = read2515RxStatus () ; // Bit 6: message in RXB0, bit 7: message in RXB1
-  const bool received = (rxStatus & 0xC0) != 0 ;
-  if (received) { // Message in RXB0 and / or RXB1
-    const bool accessRXB0 = (rxStatus & 0x40) != 0 ;
-    CANMessage message ;
-  //--- Set idx field to matching receive filter
-    message.idx = rxStatus & 0x07 ;
+void ACAN2515::handleRXBInterrupt (const uint8_t inRXB) { // inRXB value is 0 or 1
+  CANMessage message ;
+  #ifdef ARDUINO_ARCH_ESP32
+    message.timestamp_us = esp_timer_get_time () ;
+  #endif
+//--- Set idx field to matching receive filter, only needed for the filter call backs
+  if (mReadFilterIndex) {
+    message.idx = read2515RxStatus () & 0x07 ;
     if (message.idx > 5) {
       message.idx -= 6 ;
     }
-  //---
-    select () ;
-    mSPI.transfer (accessRXB0 ? READ_FROM_RXB0SIDH_COMMAND : READ_FROM_RXB1SIDH_COMMAND) ;
-  //--- SIDH
-    message.id = mSPI.transfer (0) ;
-    message.id <<= 3 ;
-  //--- SIDL
-    const uint32_t sidl = mSPI.transfer (0) ;
-    message.id |= sidl >> 5 ;
-    message.rtr = (sidl & 0x10) != 0 ; // Only significant for standard frame
-    message.ext = (sidl & 0x08) != 0 ;
-  //--- EID8
-    const uint32_t eid8 = mSPI.transfer (0) ;
-    if (message.ext) {
-      message.id <<= 2 ;
-      message.id |= (sidl & 0x03) ;
-      message.id <<= 8 ;
-      message.id |= eid8 ;
-    }
-  //--- EID0
-    const uint32_t eid0 = mSPI.transfer (0) ;
-    if (message.ext) {
-      message.id <<= 8 ;
-      message.id |= eid0 ;
-    }
-  //--- DLC
-    const uint8_t dlc = mSPI.transfer (0) ;
-    message.len = dlc & 0x0F ;
-    if (message.ext) { // Added in 2.1.1 (thanks to Achilles)
-      message.rtr = (dlc & 0x40) != 0 ; // RTR bit in DLC is significant only for extended frame
-    }
-  //--- Read data
-    for (int i=0 ; i<message.len ; i++) {
-      message.data [i] = mSPI.transfer (0) ;
-    }
-  //---
-    unselect () ;
-  //--- Free receive buffer command
-    bitModify2515Register (CANINTF_REGISTER, accessRXB0 ? 0x01 : 0x02, 0) ;
-  //--- Enter received message in receive buffer (if not full)
-    mReceiveBuffer.append (message) ;
   }
+//--- Command, SIDH, SIDL, EID8, EID0 and DLC, then the data bytes
+  uint8_t header [6] ;
+  header [0] = (inRXB == 0) ? READ_FROM_RXB0SIDH_COMMAND : READ_FROM_RXB1SIDH_COMMAND ;
+  select () ;
+  mSPI.transfer (header, 6) ;
+  const uint8_t dlc = header [5] ;
+  message.len = dlc & 0x0F ;
+  if (message.len > 8) {
+    message.len = 8 ; // DLC values 9 ... 15 mean 8 data bytes
+  }
+  if (message.len > 0) {
+    mSPI.transfer (message.data, message.len) ;
+  }
+  unselect () ;
+//--- Decode identifier
+  const uint32_t sidl = header [2] ;
+  message.id = (uint32_t (header [1]) << 3) | (sidl >> 5) ;
+  message.rtr = (sidl & 0x10) != 0 ; // Only significant for standard frame
+  message.ext = (sidl & 0x08) != 0 ;
+  if (message.ext) {
+    message.id = (message.id << 18) | ((sidl & 0x03) << 16) | (uint32_t (header [3]) << 8) | header [4] ;
+    message.rtr = (dlc & 0x40) != 0 ; // RTR bit in DLC is significant only for extended frame
+  }
+//--- Enter received message in receive buffer (if not full)
+  mReceiveBuffer.append (message) ;
+  #ifdef ARDUINO_ARCH_ESP32
+    if (mReceiveNotificationTask != nullptr) {
+      xTaskNotifyGive (mReceiveNotificationTask) ;
+    }
+  #endif
 }
 
 //··································································································
@@ -116,7 +116,7 @@ class ACAN2515 {
   public: void isr (void) ;
   public: bool isr_core (void) ;
   private: void handleTXBInterrupt (const uint8_t inTXB) ;
-  private: void handleRXBInterrupt (void) ;
+  private: void handleRXBInterrupt (const uint8_t inRXB) ;
 
 
 //··································································································
@@ -128,6 +128,7 @@ class ACAN2515 {
   private: const uint8_t mCS ;
   private: const uint8_t mINT ;
   private: bool mRolloverEnable ;
+  private: bool mReadFilterIndex ; // Some acceptance filter has a call back, received messages need their idx
   #ifdef ARDUINO_ARCH_ESP32
     public: SemaphoreHandle_t mISRSemaphore ;
     private: void (* mInterruptServiceRoutine) (void) = nullptr ;
@@ -168,6 +169,28 @@ class ACAN2515 {
   }
 
 
+//··································································································
+//    Receive buffer overflow count
+//··································································································
+
+  public: inline uint32_t receiveBufferOverflowCount (void) const {
+    return mReceiveBuffer.overflowCount () ;
+  }
+
+
+//··································································································
+//    Receive notification (ESP32): task notified (xTaskNotifyGive) each time
+//    a received message is entered in the receive buffer
+//··································································································
+
+  #ifdef ARDUINO_ARCH_ESP32
+    public: inline void setReceiveNotificationTask (TaskHandle_t inTask) {
+      mReceiveNotificationTask = inTask ;
+    }
+    private: TaskHandle_t mReceiveNotificationTask = nullptr ;
+  #endif
+
+
 //··································································································
 //    Call back function array
 //··································································································
@@ -36,6 +36,7 @@ class CANMessage {
     int8_t   data_s8   [8] ;
     uint8_t  data      [8] = {0, 0, 0, 0, 0, 0, 0, 0} ;
   } ;
+  public : uint64_t timestamp_us = 0 ; // Receive time (esp_timer_get_time), set by the driver
 } ;
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -22,6 +22,25 @@
  * Parameter: TASK_ACAN2515_PRIORITY
  * Description:
  * Defines the priority of ACAN2517FD CAN-FD handling
+ *
+ * Parameter: TASK_CAN_RX_PRIO
+ * Description:
+ * Defines the priority of the task moving received CAN frames from the drivers to the core task.
+ * Must stay below the ACAN handler tasks, which notify it.
+ *
+ * Parameter: TASK_USB_OUTPUT_PRIO
+ * Description:
+ * Defines the priority of the task sending buffered CAN frames and log text over USB serial.
+ * Kept lowest, a slow host should only delay this task.
+ *
+ * Parameter: TASK_LOG_RENDER_PRIO
+ * Description:
+ * Defines the priority of the task turning the deferred log records of all tasks into text.
+ *
+ * Parameter: TASK_CAN_REPLAY_PRIO
+ * Description:
+ * Defines the priority of the task replaying a CAN log. As high as the connectivity task, so frames go out close to
+ * their due time, but below the core task.
 */
 #define TASK_CORE_PRIO 4
 #define TASK_CONNECTIVITY_PRIO 3
@@ -29,6 +48,10 @@
 #define TASK_MODBUS_PRIO 8
 #define TASK_ACAN2515_PRIORITY 10
 #define TASK_ACAN2517FD_PRIORITY 10
+#define TASK_CAN_RX_PRIO 9
+#define TASK_USB_OUTPUT_PRIO 1
+#define TASK_LOG_RENDER_PRIO 1
+#define TASK_CAN_REPLAY_PRIO 3
 
 /** MAX AMOUNT OF CELLS
  * 
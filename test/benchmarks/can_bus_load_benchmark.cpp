@@ -0,0 +1,67 @@
+// Histogram of the amount of CAN frames sent per millisecond by the protocols that register their periodic frames
+// with the CAN scheduler: Tesla Model 3/Y battery, Sungrow inverter and BYD CAN inverter.
+//
+// "unstaggered" gives every job phase 0, which is what the hand-rolled previousMillis timers did: all groups of the
+// same period fire on the same core tick. "staggered" lets the scheduler spread the jobs over the cycle.
+//
+// Build the test project and run ./can_bus_load_benchmark [seconds]
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "../../Software/src/battery/TESLA-BATTERY.h"
+#include "../../Software/src/communication/can/CanScheduler.h"
+#include "../../Software/src/inverter/BYD-CAN.h"
+#include "../../Software/src/inverter/SUNGROW-CAN.h"
+
+extern uint32_t emulated_can_tx_frames;
+
+// Stubbed by the tests as well, there is no NVM on the host
+void store_settings_equipment_stop(void) {}
+
+static CanLoadHistogram measure(bool staggering, unsigned long duration_ms) {
+  can_scheduler = CanScheduler();
+  can_scheduler.set_staggering(staggering);
+  datalayer = DataLayer();
+
+  TeslaModel3YBattery tesla(battery_chemistry_enum::NCA);
+  tesla.setup();
+  SungrowInverter sungrow;
+  sungrow.setup();
+  BydCanInverter byd;
+  byd.setup();
+
+  // Both inverters only send their periodic frames once the inverter has been heard from
+  CAN_frame sungrow_run = {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x108, .data = {}};
+  sungrow.map_can_frame_to_variable(sungrow_run);
+  CAN_frame byd_wakeup = {.FD = false, .ext_ID = false, .DLC = 8, .ID = 0x151, .data = {}};
+  byd.map_can_frame_to_variable(byd_wakeup);
+
+  CanLoadHistogram histogram;
+  for (unsigned long ms = 0; ms < duration_ms; ms++) {
+    const uint32_t before = emulated_can_tx_frames;
+    tesla.transmit(ms);
+    sungrow.transmit(ms);
+    byd.transmit(ms);
+    can_scheduler.run(ms);
+    histogram.record(emulated_can_tx_frames - before);
+  }
+  return histogram;
+}
+
+int main(int argc, char** argv) {
+  const unsigned long seconds = argc > 1 ? strtoul(argv[1], nullptr, 10) : 60;
+  const CanLoadHistogram before = measure(false, seconds * 1000);
+  const CanLoadHistogram after = measure(true, seconds * 1000);
+
+  printf("%lu s, %zu scheduled jobs, %u frames\n", seconds, can_scheduler.job_count(), after.frame_count());
+  printf("frames/ms  unstaggered   staggered   (ms with that many frames)\n");
+  for (uint8_t frames = 0; frames < CanLoadHistogram::BUCKETS; frames++) {
+    printf("%s%-7u  %11u %11u\n", frames == CanLoadHistogram::BUCKETS - 1 ? ">=" : "  ", frames,
+           before.ticks_with(frames), after.ticks_with(frames));
+  }
+  printf("peak       %11u %11u\n", before.peak_frames(), after.peak_frames());
+
+  // Staggering must not change what is sent, only when
+  return before.frame_count() == after.frame_count() ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+// Measures the per-frame cost of handing a received CAN frame to a receiver.
+//
+// "by value" is the old receiver interface: the frame pointer was dereferenced and the full CAN_frame copied into
+// handle_incoming_can_frame()/map_can_frame_to_variable(). "const ref" is the current interface, where the frame
+// is passed by reference all the way from the driver to the protocol class.
+//
+// Build the test project and run ./can_dispatch_benchmark [frames] [rounds]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "../../Software/src/communication/can/CanDispatchTable.h"
+#include "../../Software/src/communication/can/CanReceiver.h"
+
+// Decodes a handful of signals, roughly what a battery does for a frame it knows
+struct Decoded {
+  uint32_t frames = 0;
+  uint16_t voltage = 0;
+  int16_t current = 0;
+  uint16_t soc = 0;
+  uint8_t counter = 0;
+};
+
+static inline void decode(Decoded& out, const CAN_frame& rx_frame) {
+  out.frames++;
+  switch (rx_frame.ID) {
+    case 0x244:
+      out.voltage = (rx_frame.data.u8[1] << 8) | rx_frame.data.u8[0];
+      break;
+    case 0x245:
+      out.current = (int16_t)((rx_frame.data.u8[3] << 8) | rx_frame.data.u8[2]);
+      break;
+    case 0x286:
+      out.soc = rx_frame.data.u8[4];
+      break;
+    default:
+      out.counter = rx_frame.data.u8[7];
+      break;
+  }
+}
+
+// The receiver interface as it used to be, every frame is copied into the handler
+class ByValueBattery : public CanReceiver {
+ public:
+  void receive_can_frame(const CAN_frame& frame) override { handle_incoming_can_frame(frame); }
+  virtual void handle_incoming_can_frame(CAN_frame rx_frame) { decode(decoded, rx_frame); }
+  Decoded decoded;
+};
+
+// The current receiver interface
+class ConstRefBattery : public CanReceiver {
+ public:
+  void receive_can_frame(const CAN_frame& frame) override { handle_incoming_can_frame(frame); }
+  virtual void handle_incoming_can_frame(const CAN_frame& rx_frame) { decode(decoded, rx_frame); }
+  Decoded decoded;
+};
+
+static std::vector<CAN_frame> make_frames(size_t count) {
+  const uint32_t ids[] = {0x244, 0x245, 0x286, 0x334, 0x444, 0x445, 0x446, 0x447};
+  std::mt19937 rng(1234);
+  std::vector<CAN_frame> frames(count);
+  for (auto& frame : frames) {
+    frame = {};
+    frame.ID = ids[rng() % std::size(ids)];
+    frame.DLC = 8;
+    for (uint8_t i = 0; i < 8; i++) {
+      frame.data.u8[i] = rng();
+    }
+  }
+  return frames;
+}
+
+template <typename F>
+static double ns_per_frame(const std::vector<CAN_frame>& frames, int rounds, F&& deliver) {
+  double best = 1e9;
+  for (int round = 0; round < rounds; round++) {
+    auto start = std::chrono::steady_clock::now();
+    for (auto& frame : frames) {
+      deliver(frame);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    best = std::min(best, elapsed / frames.size());
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  size_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 20;
+  auto frames = make_frames(count);
+
+  // Both go through a dispatch table, so the calls stay virtual like in the firmware
+  ByValueBattery by_value;
+  CanDispatchTable by_value_table;
+  by_value_table.add_receiver(&by_value);
+
+  ConstRefBattery const_ref;
+  CanDispatchTable const_ref_table;
+  const_ref_table.add_receiver(&const_ref);
+
+  double by_value_ns = ns_per_frame(frames, rounds, [&](const CAN_frame& frame) { by_value_table.dispatch(frame); });
+  double const_ref_ns = ns_per_frame(frames, rounds, [&](const CAN_frame& frame) { const_ref_table.dispatch(frame); });
+
+  printf("CAN_frame size: %zu bytes, %zu frames, best of %d rounds\n", sizeof(CAN_frame), count, rounds);
+  printf("by value:  %6.2f ns/frame\n", by_value_ns);
+  printf("const ref: %6.2f ns/frame\n", const_ref_ns);
+
+  // Both receivers must have seen every frame, otherwise the compiler skipped work
+  return (by_value.decoded.frames == const_ref.decoded.frames) ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+// Measures what the hardware acceptance filters save the core task, for every battery type that declares its CAN IDs.
+//
+// The battery sits on a shared bus: [own] percent of the frames carry the IDs it declared, the rest IDs it does not
+// want, as when it shares the bus with other vehicle ECUs. The percentages are the frames let through by the filters
+// programmed from the declarations, on the native TWAI controller (two standard masks) and on the MCP2518FD (16
+// filter objects). "all ns" is the time per bus frame to dispatch every frame to the battery, as with the filters
+// open, the other two the same with only the frames each controller lets through. This is the software side of
+// time_comm_us only: the driver interrupt and receive ring work saved on the device for each dropped frame come on
+// top of it.
+//
+// Build the test project and run ./can_filter_benchmark [frames] [own percent] [rounds]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../../Software/src/battery/BATTERIES.h"
+#include "../../Software/src/communication/can/CanDispatchTable.h"
+#include "../../Software/src/datalayer/datalayer.h"
+#include "../../Software/src/devboard/hal/hal.h"
+
+// No NVM on the host
+void store_settings_equipment_stop(void) {}
+
+extern void (*emulated_register_can_receiver)(CanReceiver* receiver, CAN_Interface interface);
+static std::vector<CanReceiver*> registered;
+
+// The blocks native_can_filter() in comm_can.cpp programs into the TWAI controller
+static bool native_filter_accepts(const CanIdSet& ids, const CAN_frame& frame) {
+  const bool standard = ids.has_format(false);
+  const bool extended = ids.has_format(true);
+  if (ids.accepts_all() || (standard && extended)) {
+    return true;
+  }
+  if (frame.ext_ID != extended) {
+    return false;
+  }
+  for (auto& block : ids.reduce(extended, extended ? 1 : 2)) {
+    if (block.matches(frame.ID)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// The 16 filter objects per frame format begin_canfd_addon() in comm_can.cpp programs into the MCP2518FD
+static bool mcp2518_filter_accepts(const CanIdSet& ids, const CAN_frame& frame) {
+  if (ids.accepts_all()) {
+    return true;
+  }
+  for (auto& block : ids.reduce(frame.ext_ID, 16)) {
+    if (block.matches(frame.ID)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// own_percent of the frames with a declared standard ID, the others with a standard ID not declared
+static std::vector<CAN_frame> make_bus(const CanIdSet& ids, size_t count, int own_percent) {
+  std::vector<uint32_t> own, foreign;
+  for (uint32_t id = 0; id <= CAN_STD_ID_MASK; id++) {
+    (ids.contains(id, false) ? own : foreign).push_back(id);
+  }
+  std::mt19937 rng(1234);
+  std::vector<CAN_frame> frames(count);
+  for (auto& frame : frames) {
+    frame = {};
+    const bool is_own = !own.empty() && (int)(rng() % 100) < own_percent;
+    frame.ID = is_own ? own[rng() % own.size()] : foreign[rng() % foreign.size()];
+    frame.DLC = 8;
+    for (uint8_t i = 0; i < 8; i++) {
+      frame.data.u8[i] = rng();
+    }
+  }
+  return frames;
+}
+
+template <typename F>
+static double best_ns(int rounds, F&& work) {
+  double best = 1e18;
+  for (int round = 0; round < rounds; round++) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  const size_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+  const int own_percent = argc > 2 ? atoi(argv[2]) : 30;
+  const int rounds = argc > 3 ? atoi(argv[3]) : 20;
+  emulated_register_can_receiver = [](CanReceiver* receiver, CAN_Interface) { registered.push_back(receiver); };
+  init_hal();
+
+  printf("%zu bus frames, %d%% for the battery, best of %d rounds\n", count, own_percent, rounds);
+  printf("%-16s %10s %10s %8s %8s %8s\n", "battery", "native", "mcp2518", "all ns", "native", "mcp2518");
+  for (BatteryType type : supported_battery_types()) {
+    if (name_for_battery_type(type) == nullptr) {
+      continue;  // Not built into this firmware
+    }
+    datalayer = DataLayer();
+    registered.clear();
+    // Never deleted: the battery registered itself with global tables such as the CAN scheduler, and Battery has no
+    // virtual destructor to delete it through
+    Battery* battery = create_battery(type);
+    if (battery == nullptr) {
+      continue;
+    }
+    // The receivers register on construction, their declarations are known before setup()
+    CanDispatchTable table;
+    for (auto receiver : registered) {
+      table.add_receiver(receiver);
+    }
+    const CanIdSet& ids = table.accepted_ids();
+    if (table.receiver_count() == 0 || ids.accepts_all()) {
+      continue;
+    }
+    battery->setup();
+
+    const std::vector<CAN_frame> bus = make_bus(ids, count, own_percent);
+    std::vector<CAN_frame> native, mcp2518;
+    for (auto& frame : bus) {
+      if (native_filter_accepts(ids, frame)) {
+        native.push_back(frame);
+      }
+      if (mcp2518_filter_accepts(ids, frame)) {
+        mcp2518.push_back(frame);
+      }
+    }
+    auto dispatch_ns = [&](const std::vector<CAN_frame>& frames) {
+      return best_ns(rounds, [&] {
+               for (auto& frame : frames) {
+                 table.dispatch(frame);
+               }
+             }) /
+             bus.size();
+    };
+
+    printf("%-16s %9.1f%% %9.1f%% %8.1f %8.1f %8.1f\n", name_for_battery_type(type),
+           100.0 * native.size() / bus.size(), 100.0 * mcp2518.size() / bus.size(), dispatch_ns(bus),
+           dispatch_ns(native), dispatch_ns(mcp2518));
+  }
+  return 0;
+}
@@ -0,0 +1,103 @@
+// Measures the time the core task spends on each CAN frame kept by the CAN flight recorder.
+//
+// "record" is CanFlightRecorder::record() while recording, "copy" a plain copy of a 24 byte record into a circle of
+// records, the least an always-on capture can cost. "longest call" is the slowest single record() or poll() while the
+// memory is full and a trigger freezes it, the time comm_can.cpp holds the flight recorder spinlock: it must not grow
+// with the memory size.
+//
+// Build the test project and run ./can_flight_recorder_benchmark [frames] [rounds] [memory kB]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "../../Software/src/communication/can/CanFlightRecorder.h"
+
+static std::vector<CAN_frame> make_frames(size_t count) {
+  std::mt19937 rng(1234);
+  std::vector<CAN_frame> frames(count);
+  uint64_t timestamp_us = 1000000;
+  for (auto& frame : frames) {
+    frame = {};
+    frame.ID = 0x200 + rng() % 64;
+    frame.DLC = 8;
+    for (uint8_t i = 0; i < 8; i++) {
+      frame.data.u8[i] = rng();
+    }
+    timestamp_us += 100 + rng() % 1000;
+    frame.timestamp_us = timestamp_us;
+  }
+  return frames;
+}
+
+template <typename F>
+static double ns_per_frame(const std::vector<CAN_frame>& frames, int rounds, F&& log) {
+  double best = 1e9;
+  for (int round = 0; round < rounds; round++) {
+    auto start = std::chrono::steady_clock::now();
+    for (auto& frame : frames) {
+      log(frame);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    best = std::min(best, elapsed / frames.size());
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  size_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 20;
+  size_t memory_size = (argc > 3 ? strtoul(argv[3], nullptr, 10) : 64) * 1024;
+  auto frames = make_frames(count);
+  std::vector<uint8_t> memory(memory_size);
+
+  CanFlightRecorder recorder;
+  recorder.begin(memory.data(), memory.size(), CanFlightRecorderConfig());
+  double record_ns = ns_per_frame(frames, rounds, [&](const CAN_frame& frame) {
+    recorder.record(frame, CAN_NATIVE, MSG_RX, frame.timestamp_us);
+  });
+
+  // Again with a trigger in the middle, timing each call on its own. The best round leaves out the calls the host
+  // happened to preempt
+  double longest_ns = 1e18;
+  bool frozen = true;
+  for (int round = 0; round < rounds; round++) {
+    recorder.begin(memory.data(), memory.size(), CanFlightRecorderConfig());
+    double round_ns = 0;
+    for (size_t i = 0; i < frames.size(); i++) {
+      if (i == frames.size() / 2) {
+        recorder.trigger(1, frames[i].timestamp_us);
+      }
+      auto start = std::chrono::steady_clock::now();
+      recorder.record(frames[i], CAN_NATIVE, MSG_RX, frames[i].timestamp_us);
+      recorder.poll(frames[i].timestamp_us);
+      const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+      round_ns = std::max(round_ns, elapsed);
+    }
+    longest_ns = std::min(longest_ns, round_ns);
+    frozen = frozen && recorder.state() == CanFlightState::Frozen;
+  }
+
+  std::vector<CanLogRecord> circle(memory_size / sizeof(CanLogRecord));
+  size_t head = 0;
+  double copy_ns = ns_per_frame(frames, rounds, [&](const CAN_frame& frame) {
+    CanLogRecord record = {};
+    record.timestamp_us = frame.timestamp_us;
+    record.id_flags = frame.ID;
+    record.length = frame.DLC;
+    memcpy(record.data, frame.data.u8, 8);
+    circle[head++ % circle.size()] = record;
+  });
+
+  printf("%zu frames, best of %d rounds, %zu kB\n", count, rounds, memory_size / 1024);
+  printf("record: %6.1f ns/frame\n", record_ns);
+  printf("copy:   %6.1f ns/frame\n", copy_ns);
+  printf("longest call: %.0f ns%s\n", longest_ns, frozen ? "" : " (not frozen, too few frames)");
+
+  // Both must have kept the frames, otherwise the compiler skipped work
+  return (recorder.frames() > 0 && circle[0].id_flags != 0) ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+// Measures the time to format a CAN frame as a candump style log line.
+//
+// "snprintf" is how the USB, webserver and SD logs used to build the line: snprintf for the header fields and once
+// per data byte. "tables" is format_can_frame_text(), which writes the line in one pass with lookup tables.
+//
+// Build the test project and run ./can_frame_text_benchmark [frames] [rounds]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "../../Software/src/communication/can/CanFrameText.h"
+
+// The old formatting, as in dump_can_frame()
+static size_t format_snprintf(char* message_string, const CAN_frame& frame, CAN_Interface interface,
+                              frameDirection msgDir, uint64_t timestamp_us) {
+  const size_t message_string_size = CAN_FRAME_TEXT_MAX_LENGTH;
+  int offset = snprintf(message_string, message_string_size, "(%lu.%06lu) ", (unsigned long)(timestamp_us / 1000000),
+                        (unsigned long)(timestamp_us % 1000000));
+  offset += snprintf(message_string + offset, message_string_size - offset, "%s%d ", (msgDir == MSG_RX) ? "RX" : "TX",
+                     (int)(interface * 2) + (msgDir == MSG_RX ? 0 : 1));
+  offset += snprintf(message_string + offset, message_string_size - offset, "%lX [%u] ", (unsigned long)frame.ID,
+                     frame.DLC);
+  for (uint8_t i = 0; i < frame.DLC; i++) {
+    if (i < frame.DLC - 1) {
+      offset += snprintf(message_string + offset, message_string_size - offset, "%02X ", frame.data.u8[i]);
+    } else {
+      offset += snprintf(message_string + offset, message_string_size - offset, "%02X", frame.data.u8[i]);
+    }
+  }
+  offset += snprintf(message_string + offset, message_string_size - offset, "\n");
+  return offset;
+}
+
+static std::vector<CAN_frame> make_frames(size_t count, uint8_t length) {
+  const uint32_t ids[] = {0x244, 0x245, 0x286, 0x334, 0x444, 0x445, 0x18DAF110, 0x7BB};
+  std::mt19937 rng(1234);
+  std::vector<CAN_frame> frames(count);
+  uint64_t timestamp_us = 1000000;
+  for (auto& frame : frames) {
+    frame = {};
+    frame.ID = ids[rng() % std::size(ids)];
+    frame.ext_ID = frame.ID > 0x7FF;
+    frame.FD = length > 8;
+    frame.DLC = length;
+    for (uint8_t i = 0; i < length; i++) {
+      frame.data.u8[i] = rng();
+    }
+    timestamp_us += 100 + rng() % 1000;
+    frame.timestamp_us = timestamp_us;
+  }
+  return frames;
+}
+
+template <typename F>
+static double ns_per_frame(const std::vector<CAN_frame>& frames, int rounds, size_t& characters, F&& format) {
+  char line[CAN_FRAME_TEXT_MAX_LENGTH];
+  double best = 1e9;
+  for (int round = 0; round < rounds; round++) {
+    auto start = std::chrono::steady_clock::now();
+    for (auto& frame : frames) {
+      characters += format(line, frame);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    best = std::min(best, elapsed / frames.size());
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  size_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 20;
+
+  size_t snprintf_characters = 0;
+  size_t table_characters = 0;
+  printf("%zu frames, best of %d rounds\n", count, rounds);
+  for (uint8_t length : {8, 64}) {
+    auto frames = make_frames(count, length);
+    double snprintf_ns = ns_per_frame(frames, rounds, snprintf_characters, [](char* line, const CAN_frame& frame) {
+      return format_snprintf(line, frame, CAN_NATIVE, MSG_RX, frame.timestamp_us);
+    });
+    double table_ns = ns_per_frame(frames, rounds, table_characters, [](char* line, const CAN_frame& frame) {
+      return format_can_frame_text(line, frame, CAN_NATIVE, MSG_RX, frame.timestamp_us);
+    });
+    printf("%2u data bytes: snprintf %7.1f ns/frame, tables %6.1f ns/frame (%.1fx)\n", length, snprintf_ns, table_ns,
+           snprintf_ns / table_ns);
+  }
+
+  // Both must have produced the same amount of text, otherwise the compiler skipped work
+  return snprintf_characters == table_characters ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+// Measures what a tear-free datalayer snapshot costs the core task and the tasks reading it.
+//
+// "publish" is SnapshotBuffer<DataLayer>::publish() as done by the core task each values cycle, "read" a full copy
+// as done by the MQTT and webserver tasks, "copy" a plain copy of the datalayer, the least a snapshot can cost.
+// "publish, reading" publishes while another thread keeps reading, as when a page is built during the values cycle.
+//
+// Build the test project and run ./datalayer_snapshot_benchmark [copies] [rounds]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "../../Software/src/datalayer/datalayer.h"
+
+template <typename F>
+static double ns_per_copy(size_t count, int rounds, F&& copy) {
+  double best = 1e9;
+  for (int round = 0; round < rounds; round++) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++) {
+      copy(i);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    best = std::min(best, elapsed / count);
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  size_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 100000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 10;
+
+  static DataLayer live;
+  static DataLayer copy;
+  static SnapshotBuffer<DataLayer> buffer;
+
+  double publish_ns = ns_per_copy(count, rounds, [&](size_t i) {
+    live.battery.status.voltage_dV = i;
+    buffer.publish(live);
+  });
+  double read_ns = ns_per_copy(count, rounds, [&](size_t) { buffer.read(copy); });
+  double copy_ns = ns_per_copy(count, rounds, [&](size_t i) {
+    live.battery.status.voltage_dV = i;
+    copy = live;
+    std::atomic_signal_fence(std::memory_order_seq_cst);  // Keeps the compiler from dropping all but the last copy
+  });
+
+  std::atomic<bool> done{false};
+  std::thread reader([&] {
+    static DataLayer reader_copy;
+    while (!done) {
+      buffer.read(reader_copy);
+    }
+  });
+  double contended_ns = ns_per_copy(count, rounds, [&](size_t i) {
+    live.battery.status.voltage_dV = i;
+    buffer.publish(live);
+  });
+  done = true;
+  reader.join();
+
+  printf("DataLayer of %zu bytes, %zu copies, best of %d rounds\n", sizeof(DataLayer), count, rounds);
+  printf("publish:          %7.1f ns\n", publish_ns);
+  printf("read:             %7.1f ns\n", read_ns);
+  printf("copy:             %7.1f ns\n", copy_ns);
+  printf("publish, reading: %7.1f ns\n", contended_ns);
+  printf("reader retries:   %u\n", buffer.retries());
+
+  // The snapshot must hold the last value published, otherwise the compiler skipped work
+  buffer.read(copy);
+  return copy.battery.status.voltage_dV == (uint16_t)(count - 1) ? 0 : 1;
+}
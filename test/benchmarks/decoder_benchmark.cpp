@@ -0,0 +1,167 @@
+// CPU cost of the battery integrations: time and instructions per received frame in handle_incoming_can_frame(),
+// and per update_values() call, for every battery type with a log in can_log_based/can_logs.
+//
+// The logs of a battery type are parsed into memory up front and fed round and round until each round holds about
+// [frames] frames, the best of [rounds] rounds is reported. Instructions are counted with the Linux perf events where
+// the kernel allows it, else they are null. The results are printed as JSON, so runs of two commits can be compared.
+//
+// Build the test project and run ./decoder_benchmark [frames] [rounds] [log directory]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "../../Software/src/battery/BATTERIES.h"
+#include "../../Software/src/datalayer/datalayer.h"
+#include "../utils/utils.h"
+
+// No NVM on the host
+void store_settings_equipment_stop(void) {}
+
+// Instructions retired by this thread in user space, -1 where perf events are not available
+class InstructionCounter {
+ public:
+  InstructionCounter() {
+#ifdef __linux__
+    perf_event_attr attr = {};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+  }
+  ~InstructionCounter() {
+#ifdef __linux__
+    if (fd >= 0) {
+      close(fd);
+    }
+#endif
+  }
+
+  void start() {
+#ifdef __linux__
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  long long stop() {
+#ifdef __linux__
+    long long count;
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd, &count, sizeof(count)) == sizeof(count)) {
+        return count;
+      }
+    }
+#endif
+    return -1;
+  }
+
+ private:
+  int fd = -1;
+};
+
+struct Measurement {
+  double ns = 1e18;
+  long long instructions = -1;
+};
+
+// Best time of the rounds, instructions of the last one, for one call of work(). Each round calls it count times.
+template <typename F>
+static Measurement measure(InstructionCounter& counter, size_t count, int rounds, F&& work) {
+  Measurement result;
+  for (int round = 0; round < rounds; round++) {
+    counter.start();
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++) {
+      work(i);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    const long long instructions = counter.stop();
+    result.ns = std::min(result.ns, elapsed / count);
+    result.instructions = instructions < 0 ? -1 : instructions / (long long)count;
+  }
+  return result;
+}
+
+static std::string json_count(long long value) {
+  return value < 0 ? "null" : std::to_string(value);
+}
+
+int main(int argc, char** argv) {
+  const size_t frames_per_round = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+  const int rounds = argc > 2 ? atoi(argv[2]) : 10;
+  const std::string directory = argc > 3 ? argv[3] : TEST_CAN_LOG_DIR;
+
+  // The frames of all logs of each battery type, named <battery type>_<name>_<flags>.txt
+  std::map<int, std::vector<CAN_frame>> frames;
+  std::map<int, std::vector<std::string>> logs;
+  std::vector<fs::path> paths;
+  for (const auto& entry : fs::directory_iterator(directory)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".txt") {
+      paths.push_back(entry.path());
+    }
+  }
+  std::sort(paths.begin(), paths.end());
+  for (const auto& path : paths) {
+    const int type = std::stoi(path.filename().string());
+    const std::vector<CAN_frame> parsed = parse_can_log_file(path);
+    frames[type].insert(frames[type].end(), parsed.begin(), parsed.end());
+    logs[type].push_back(path.filename().string());
+  }
+
+  InstructionCounter counter;
+  printf("{\n  \"frames_per_round\": %zu,\n  \"rounds\": %d,\n  \"batteries\": [", frames_per_round, rounds);
+  bool first = true;
+  for (const auto& [type, log_frames] : frames) {
+    if (log_frames.empty()) {
+      continue;
+    }
+    datalayer = DataLayer();
+    // Left alive until exit, Battery has no virtual destructor
+    Battery* battery = create_battery((BatteryType)type);
+    CanBattery* can_battery = dynamic_cast<CanBattery*>(battery);
+    if (can_battery == nullptr) {
+      continue;
+    }
+    battery->setup();
+
+    const Measurement handle = measure(counter, frames_per_round, rounds, [&](size_t i) {
+      can_battery->handle_incoming_can_frame(log_frames[i % log_frames.size()]);
+    });
+    // Called once per second on the device, fewer calls make a round
+    const size_t updates = std::max<size_t>(frames_per_round / 100, 1);
+    const Measurement update = measure(counter, updates, rounds, [&](size_t) { battery->update_values(); });
+
+    printf("%s\n    {\"type\": %d, \"name\": \"%s\", \"logs\": [", first ? "" : ",", type,
+           name_for_battery_type((BatteryType)type));
+    for (size_t i = 0; i < logs[type].size(); i++) {
+      printf("%s\"%s\"", i > 0 ? ", " : "", logs[type][i].c_str());
+    }
+    printf("], \"log_frames\": %zu,\n", log_frames.size());
+    printf("     \"handle_ns_per_frame\": %.1f, \"frames_per_s\": %.0f, \"handle_instructions_per_frame\": %s,\n",
+           handle.ns, 1e9 / handle.ns, json_count(handle.instructions).c_str());
+    printf("     \"update_values_ns\": %.1f, \"update_values_instructions\": %s}", update.ns,
+           json_count(update.instructions).c_str());
+    first = false;
+  }
+  printf("\n  ],\n  \"instructions_available\": %s\n}\n", counter.stop() < 0 ? "false" : "true");
+  return 0;
+}
@@ -0,0 +1,108 @@
+// Measures the time a task spends on one DEBUG_PRINTF call.
+//
+// "formatted" is the old Logging::printf(): the timestamp and the message were formatted with snprintf and
+// vsnprintf by the task that logged, then copied to the output buffer. "deferred" is the current one: the task only
+// stores the format pointer and the arguments as a record in its own ring, the logging task renders them later
+// ("render" is what that costs it per call).
+//
+// Build the test project and run ./deferred_log_benchmark [calls] [rounds]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../../Software/src/devboard/utils/deferred_log.h"
+
+#define MAX_LINE_LENGTH_PRINTF 128
+#define MAX_LENGTH_TIME_STR 14
+
+// Stands in for the USB output buffer, emptied between calls
+static SpscByteRing<8192> output;
+static bool previous_message_was_newline = true;
+
+static void output_text(const char* text, size_t size) {
+  output.write((const uint8_t*)text, size);
+  output.pop(output.count());
+}
+
+// The old Logging::printf()
+static void printf_formatted(uint32_t now, const char* fmt, ...) {
+  if (previous_message_was_newline) {
+    static char timestr[MAX_LENGTH_TIME_STR];
+    const int length =
+        std::min(MAX_LENGTH_TIME_STR - 1, snprintf(timestr, MAX_LENGTH_TIME_STR, "%8lu.%03lu ",
+                                                   (unsigned long)now / 1000, (unsigned long)now % 1000));
+    output_text(timestr, length);
+  }
+
+  static char message_buffer[MAX_LINE_LENGTH_PRINTF];
+  va_list args;
+  va_start(args, fmt);
+  int size = std::min(MAX_LINE_LENGTH_PRINTF - 1, vsnprintf(message_buffer, MAX_LINE_LENGTH_PRINTF, fmt, args));
+  va_end(args);
+  output_text(message_buffer, size);
+  previous_message_was_newline = message_buffer[size - 1] == '\n';
+}
+
+static DeferredLogBuffers<4, 8192> deferred;
+
+template <typename F>
+static double ns_per_call(size_t calls, int rounds, F&& log) {
+  double best = 1e9;
+  for (int round = 0; round < rounds; round++) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < calls; i++) {
+      log((uint32_t)i);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    best = std::min(best, elapsed / calls);
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  size_t calls = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 20;
+  const float voltage = 371.25f;
+  const char* name = "NISSAN_LEAF";
+
+  double formatted_ns = ns_per_call(calls, rounds, [&](uint32_t i) {
+    printf_formatted(i, "%s: SOC %u.%02u%%, %.1f V, cell %d mV\n", name, i % 100, i % 7, voltage,
+                     3600 + (int)(i % 500));
+  });
+
+  // Written in batches that fit the ring, each followed by the logging task's turn
+  int task;
+  size_t characters = 0;
+  double deferred_ns = 1e9;
+  double render_ns = 1e9;
+  for (int round = 0; round < rounds; round++) {
+    std::chrono::duration<double, std::nano> writing{0};
+    std::chrono::duration<double, std::nano> rendering{0};
+    for (size_t batch = 0; batch < calls; batch += 32) {
+      auto start = std::chrono::steady_clock::now();
+      for (uint32_t i = batch; i < std::min(calls, batch + 32); i++) {
+        deferred.write(&task, DeferredLogRecord(i, "%s: SOC %u.%02u%%, %.1f V, cell %d mV\n", name, i % 100, i % 7,
+                                                voltage, 3600 + (int)(i % 500)));
+      }
+      auto written = std::chrono::steady_clock::now();
+      while (deferred.render_next([&](const char*, size_t length) { characters += length; })) {
+      }
+      writing += written - start;
+      rendering += std::chrono::steady_clock::now() - written;
+    }
+    deferred_ns = std::min(deferred_ns, writing.count() / calls);
+    render_ns = std::min(render_ns, rendering.count() / calls);
+  }
+
+  printf("%zu calls, best of %d rounds\n", calls, rounds);
+  printf("formatted: %7.1f ns/call in the task that logs\n", formatted_ns);
+  printf("deferred:  %7.1f ns/call in the task that logs\n", deferred_ns);
+  printf("render:    %7.1f ns/call in the logging task\n", render_ns);
+
+  // Both must have produced output, otherwise the compiler skipped work
+  return (characters > 0 && deferred.dropped() == 0) ? 0 : 1;
+}
@@ -0,0 +1,355 @@
+// Frames per second the MCP2515 add-on driver sustains before frames are lost, at 500 kbit/s.
+//
+// The ACAN2515 driver runs unchanged against an emulated MCP2515 on an emulated SPI bus. The emulation keeps a
+// clock that advances with every SPI byte, call, chip select change and bus transaction, using the cost model
+// below, and meanwhile lets frames arrive from the CAN bus into the two receive buffers. A frame is lost when it
+// arrives while both buffers are still full, like on the real chip. Frames must also come out in bus order.
+//
+// The cost model is a rough estimate for an ESP32 running the Arduino SPI driver, with the driver task sharing its
+// core. Change it to match measurements, the point is comparing driver variants.
+//
+// Build the test project and run ./mcp2515_rx_benchmark [seconds per load step]
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "../../Software/src/lib/pierremolinaro-acan2515/ACAN2515.h"
+
+// Cost model, in microseconds
+static const double TRANSACTION_US = 2.0;    // beginTransaction: bus mutex and configuration
+static const double TRANSFER_CALL_US = 1.0;  // Setting up one transfer() or transferBytes() call
+static const double CHIP_SELECT_US = 0.25;   // One digitalWrite of the chip select pin
+static const double WAKE_US = 15.0;          // INT pin interrupt until the driver task runs
+// Other work on the same core keeps the driver task off the CPU for this long every millisecond
+static const double BLOCKED_US = 250.0;
+static const double BLOCK_PERIOD_US = 1000.0;
+
+static const uint32_t BIT_RATE = 500000;
+// Standard frame with 8 bytes, including the interframe space, without stuff bits
+static const uint32_t FRAME_BITS = 111;
+
+static const uint8_t CS_PIN = 5;
+static const uint8_t INT_PIN = 4;
+
+static const uint8_t CANSTAT = 0x0E;
+static const uint8_t CANCTRL = 0x0F;
+static const uint8_t CANINTE = 0x2B;
+static const uint8_t CANINTF = 0x2C;
+static const uint8_t EFLG = 0x2D;
+static const uint8_t RXB0CTRL = 0x60;
+static const uint8_t RXB1CTRL = 0x70;
+
+class EmulatedMcp2515 : public SPIClass {
+ public:
+  double now_us = 0;
+  uint32_t transactions = 0;
+  uint32_t spi_bytes = 0;
+
+  void reset() {
+    *this = EmulatedMcp2515();
+    regs[CANSTAT] = 0x80;
+    regs[CANCTRL] = 0x87;
+  }
+
+  // Frames start arriving every period_us from now on
+  void start_traffic(double period_us) {
+    frame_period_us = period_us;
+    next_frame_us = now_us + period_us;
+    next_id = 0;
+  }
+  void stop_traffic() { frame_period_us = 0; }
+  uint32_t frames_sent() const { return next_id; }
+  double next_frame_at() const { return frame_period_us > 0 ? next_frame_us : 1e300; }
+
+  // Advances the clock of the driver task, which can not run while the core is blocked
+  void advance(double us) {
+    now_us += us;
+    const double in_period = now_us - (uint64_t)(now_us / BLOCK_PERIOD_US) * BLOCK_PERIOD_US;
+    if (in_period < BLOCKED_US) {
+      now_us += BLOCKED_US - in_period;
+    }
+  }
+
+  bool interrupt_pending() const { return (regs[CANINTF] & regs[CANINTE]) != 0; }
+
+  void deliver_frames() {
+    while (frame_period_us > 0 && next_frame_us <= now_us) {
+      load_frame(next_id++);
+      next_frame_us += frame_period_us;
+    }
+  }
+
+  void chip_select(bool selected) {
+    advance(CHIP_SELECT_US);
+    if (selected) {
+      state = State::Command;
+      return;
+    }
+    // READ RX BUFFER frees the buffer when the chip select goes high
+    if (state == State::ReadRxBuffer) {
+      regs[CANINTF] &= ~read_rx_flag;
+    }
+    state = State::Idle;
+  }
+
+  void beginTransaction(SPISettings settings) override {
+    clock_hz = settings.clock;
+    advance(TRANSACTION_US);
+    transactions++;
+  }
+
+  uint8_t transfer(uint8_t data) override {
+    advance(TRANSFER_CALL_US);
+    return exchange(data);
+  }
+
+  void transferBytes(const uint8_t* data, uint8_t* out, uint32_t size) override {
+    advance(TRANSFER_CALL_US);
+    for (uint32_t i = 0; i < size; i++) {
+      const uint8_t in = exchange(data ? data[i] : 0xFF);
+      if (out) {
+        out[i] = in;
+      }
+    }
+  }
+
+ private:
+  enum class State { Idle, Command, Address, Read, Write, ModifyAddress, ModifyMask, ModifyData, ReadRxBuffer, Status };
+
+  uint8_t exchange(uint8_t in) {
+    spi_bytes++;
+    advance(8e6 / clock_hz);
+    deliver_frames();
+
+    switch (state) {
+      case State::Command:
+        return command(in);
+      case State::Address:
+        address = in;
+        state = next_state;
+        return 0;
+      case State::Read:
+      case State::ReadRxBuffer:
+        return read_register(address++);
+      case State::Write:
+        write_register(address++, in);
+        return 0;
+      case State::ModifyAddress:
+        address = in;
+        state = State::ModifyMask;
+        return 0;
+      case State::ModifyMask:
+        mask = in;
+        state = State::ModifyData;
+        return 0;
+      case State::ModifyData:
+        write_register(address, (regs[address] & ~mask) | (in & mask));
+        state = State::Idle;
+        return 0;
+      case State::Status:
+        return status_byte;
+      default:
+        return 0;
+    }
+  }
+
+  uint8_t command(uint8_t in) {
+    if (in == 0xC0) {  // RESET
+      const double now = now_us;
+      const uint32_t t = transactions, b = spi_bytes;
+      reset();
+      now_us = now;
+      transactions = t;
+      spi_bytes = b;
+      state = State::Idle;
+    } else if (in == 0x03) {  // READ
+      state = State::Address;
+      next_state = State::Read;
+    } else if (in == 0x02) {  // WRITE
+      state = State::Address;
+      next_state = State::Write;
+    } else if (in == 0x05) {  // BIT MODIFY
+      state = State::ModifyAddress;
+    } else if ((in & 0xF9) == 0x90) {  // READ RX BUFFER
+      const bool rxb1 = (in & 0x04) != 0;
+      address = (rxb1 ? RXB1CTRL : RXB0CTRL) + ((in & 0x02) ? 6 : 1);
+      read_rx_flag = rxb1 ? 0x02 : 0x01;
+      state = State::ReadRxBuffer;
+    } else if (in == 0xB0) {  // RX STATUS
+      status_byte = (regs[CANINTF] & 0x03) << 6;
+      state = State::Status;
+    } else if (in == 0xA0) {  // READ STATUS
+      const uint8_t intf = regs[CANINTF];
+      status_byte = (intf & 0x03) | ((intf & 0x04) << 1) | ((intf & 0x08) << 2) | ((intf & 0x10) << 3);
+      state = State::Status;
+    } else {
+      state = State::Idle;
+    }
+    return 0;
+  }
+
+  uint8_t read_register(uint8_t reg) {
+    reg &= 0x7F;
+    if (reg == CANSTAT) {
+      return (regs[CANSTAT] & 0xE0) | (interrupt_code() << 1);
+    }
+    return regs[reg];
+  }
+
+  void write_register(uint8_t reg, uint8_t value) {
+    reg &= 0x7F;
+    regs[reg] = value;
+    if (reg == CANCTRL) {
+      regs[CANSTAT] = (regs[CANSTAT] & 0x1F) | (value & 0xE0);  // Mode changes right away
+    }
+  }
+
+  uint8_t interrupt_code() const {
+    const uint8_t pending = regs[CANINTF] & regs[CANINTE];
+    static const uint8_t priority[] = {0x20, 0x40, 0x04, 0x08, 0x10, 0x01, 0x02};
+    static const uint8_t code[] = {1, 2, 3, 4, 5, 6, 7};
+    for (int i = 0; i < 7; i++) {
+      if (pending & priority[i]) {
+        return code[i];
+      }
+    }
+    return 0;
+  }
+
+  void load_frame(uint32_t id) {
+    uint8_t buffer;
+    if (!(regs[CANINTF] & 0x01)) {
+      buffer = RXB0CTRL;
+      regs[CANINTF] |= 0x01;
+    } else if ((regs[RXB0CTRL] & 0x04) && !(regs[CANINTF] & 0x02)) {  // Rollover to RXB1
+      buffer = RXB1CTRL;
+      regs[CANINTF] |= 0x02;
+    } else {
+      regs[EFLG] |= 0x40;
+      return;
+    }
+    id &= 0x7FF;
+    regs[buffer + 1] = id >> 3;
+    regs[buffer + 2] = (id & 0x07) << 5;
+    regs[buffer + 3] = 0;
+    regs[buffer + 4] = 0;
+    regs[buffer + 5] = 8;
+    for (int i = 0; i < 8; i++) {
+      regs[buffer + 6 + i] = id + i;
+    }
+  }
+
+  uint8_t regs[128] = {0};
+  State state = State::Idle;
+  State next_state = State::Idle;
+  uint8_t address = 0;
+  uint8_t mask = 0;
+  uint8_t status_byte = 0;
+  uint8_t read_rx_flag = 0;
+  uint32_t clock_hz = 1000000;
+  double frame_period_us = 0;
+  double next_frame_us = 0;
+  uint32_t next_id = 0;
+};
+
+static EmulatedMcp2515 mcp;
+
+static void chip_select_changed(uint8_t pin, uint8_t level) {
+  if (pin == CS_PIN) {
+    mcp.chip_select(level == LOW);
+  }
+}
+
+struct Result {
+  uint32_t offered;
+  uint32_t received;
+  uint32_t lost;
+  uint32_t out_of_order;
+  double spi_bytes_per_frame;
+  double transactions_per_frame;
+  double busy_us_per_frame;
+};
+
+static ACAN2515* driver = nullptr;
+
+static Result run(double frames_per_second, double seconds) {
+  mcp.reset();
+  driver = new ACAN2515(CS_PIN, mcp, INT_PIN);
+  ACAN2515Settings settings(8UL * 1000UL * 1000UL, BIT_RATE);
+  settings.mRequestedMode = ACAN2515Settings::NormalMode;
+  if (driver->begin(settings, [] { driver->isr(); }) != 0) {
+    fprintf(stderr, "Driver did not start\n");
+    exit(1);
+  }
+
+  const uint32_t setup_transactions = mcp.transactions;
+  const uint32_t setup_bytes = mcp.spi_bytes;
+  double busy_us = 0;
+  Result result = {};
+  uint32_t expected_id = 0;
+
+  mcp.now_us = 0;
+  mcp.start_traffic(1e6 / frames_per_second);
+  const double end_us = seconds * 1e6;
+  bool draining = false;
+  while (true) {
+    if (!draining && mcp.now_us >= end_us) {
+      mcp.stop_traffic();
+      draining = true;
+    }
+    mcp.deliver_frames();
+    if (mcp.interrupt_pending()) {
+      const double start = mcp.now_us;
+      mcp.advance(WAKE_US);
+      while (driver->isr_core()) {
+      }
+      busy_us += mcp.now_us - start;
+
+      CANMessage frame;
+      while (driver->receive(frame)) {
+        if (frame.id != (expected_id & 0x7FF)) {
+          result.out_of_order++;
+        }
+        expected_id = frame.id + 1;
+        result.received++;
+      }
+    } else if (draining) {
+      break;
+    } else {
+      mcp.now_us = mcp.next_frame_at();
+    }
+  }
+
+  // Frames can also vanish without an overflow, if a driver clears the flag of a buffer that filled again
+  result.offered = mcp.frames_sent();
+  result.lost = result.offered - result.received;
+  result.spi_bytes_per_frame = (double)(mcp.spi_bytes - setup_bytes) / result.received;
+  result.transactions_per_frame = (double)(mcp.transactions - setup_transactions) / result.received;
+  result.busy_us_per_frame = busy_us / result.received;
+  delete driver;
+  driver = nullptr;
+  return result;
+}
+
+int main(int argc, char** argv) {
+  const double seconds = argc > 1 ? atof(argv[1]) : 1.0;
+  emulated_digital_write = chip_select_changed;
+
+  const double max_rate = (double)BIT_RATE / FRAME_BITS;
+  printf("MCP2515 at %u kbit/s, 8 byte standard frames, bus full at %.0f frames/s\n", BIT_RATE / 1000, max_rate);
+  printf("load  frames/s  received      lost  SPI bytes/frame  transactions/frame  driver us/frame\n");
+
+  double sustained = 0;
+  for (int load = 10; load <= 100; load += 10) {
+    const double rate = max_rate * load / 100;
+    const Result r = run(rate, seconds);
+    printf("%3d%%  %8.0f  %8u  %8u  %15.1f  %18.2f  %15.1f%s\n", load, rate, r.received, r.lost,
+           r.spi_bytes_per_frame, r.transactions_per_frame, r.busy_us_per_frame,
+           r.out_of_order ? "  OUT OF ORDER" : "");
+    if (r.lost == 0 && r.out_of_order == 0) {
+      sustained = rate;
+    }
+  }
+  printf("sustained without loss: %.0f frames/s\n", sustained);
+  return 0;
+}
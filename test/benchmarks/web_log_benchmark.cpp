@@ -0,0 +1,129 @@
+// Measures the time the core task spends on each CAN frame logged for the CAN log web page.
+//
+// "text" is the old dump_can_frame(): the frame was formatted with one snprintf per field and per data byte into the
+// 15000 character buffer in the datalayer. "binary" is the current one: a CanLogRecord is encoded and pushed to the
+// web log ring, and the text is only made by the webserver when the page asks for it ("format on request").
+//
+// Build the test project and run ./web_log_benchmark [frames] [rounds] [frames per second]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "../../Software/src/devboard/sdcard/can_log_record.h"
+#include "../../Software/src/devboard/utils/log_ring.h"
+
+WebLogRing web_log;
+
+static char logged_can_messages[15000];
+static size_t logged_can_messages_offset = 0;
+
+// The old dump_can_frame()
+static void dump_can_frame_text(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir) {
+  char* message_string = logged_can_messages;
+  int offset = logged_can_messages_offset;
+  size_t message_string_size = sizeof(logged_can_messages);
+
+  if (offset + 128 > (int)sizeof(logged_can_messages)) {
+    offset = 0;
+  }
+  const uint64_t timestamp_us = frame.timestamp_us;
+  offset += snprintf(message_string + offset, message_string_size - offset, "(%lu.%06lu) ",
+                     (unsigned long)(timestamp_us / 1000000), (unsigned long)(timestamp_us % 1000000));
+  offset += snprintf(message_string + offset, message_string_size - offset, "%s%d ", (msgDir == MSG_RX) ? "RX" : "TX",
+                     (int)(interface * 2) + (msgDir == MSG_RX ? 0 : 1));
+  offset += snprintf(message_string + offset, message_string_size - offset, "%lX [%u] ", (unsigned long)frame.ID,
+                     frame.DLC);
+  for (uint8_t i = 0; i < frame.DLC; i++) {
+    if (i < frame.DLC - 1) {
+      offset += snprintf(message_string + offset, message_string_size - offset, "%02X ", frame.data.u8[i]);
+    } else {
+      offset += snprintf(message_string + offset, message_string_size - offset, "%02X", frame.data.u8[i]);
+    }
+  }
+  offset += snprintf(message_string + offset, message_string_size - offset, "\n");
+  logged_can_messages_offset = offset;
+}
+
+// The current dump_can_frame()
+static void dump_can_frame_binary(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir) {
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  const size_t size = can_log_encode(frame, interface, msgDir, frame.timestamp_us, record);
+  web_log.push(LOG_RING_CAN, record, size);
+}
+
+static std::vector<CAN_frame> make_frames(size_t count) {
+  const uint32_t ids[] = {0x244, 0x245, 0x286, 0x334, 0x444, 0x445, 0x18DAF110, 0x7BB};
+  std::mt19937 rng(1234);
+  std::vector<CAN_frame> frames(count);
+  uint64_t timestamp_us = 1000000;
+  for (auto& frame : frames) {
+    frame = {};
+    frame.ID = ids[rng() % std::size(ids)];
+    frame.ext_ID = frame.ID > 0x7FF;
+    frame.DLC = 8;
+    for (uint8_t i = 0; i < 8; i++) {
+      frame.data.u8[i] = rng();
+    }
+    timestamp_us += 100 + rng() % 1000;
+    frame.timestamp_us = timestamp_us;
+  }
+  return frames;
+}
+
+template <typename F>
+static double ns_per_frame(const std::vector<CAN_frame>& frames, int rounds, F&& log) {
+  double best = 1e9;
+  for (int round = 0; round < rounds; round++) {
+    auto start = std::chrono::steady_clock::now();
+    for (auto& frame : frames) {
+      log(frame);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    best = std::min(best, elapsed / frames.size());
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  size_t count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 20;
+  double frames_per_second = argc > 3 ? atof(argv[3]) : 2000;
+  auto frames = make_frames(count);
+
+  double text_ns = ns_per_frame(frames, rounds, [](const CAN_frame& frame) {
+    dump_can_frame_text(frame, CAN_NATIVE, (frame.ID & 1) ? MSG_TX : MSG_RX);
+  });
+  double binary_ns = ns_per_frame(frames, rounds, [](const CAN_frame& frame) {
+    dump_can_frame_binary(frame, CAN_NATIVE, (frame.ID & 1) ? MSG_TX : MSG_RX);
+  });
+
+  // What the webserver now spends per frame when the page fetches the log
+  uint32_t since = web_log.next_sequence();
+  for (auto& frame : frames) {
+    dump_can_frame_binary(frame, CAN_NATIVE, MSG_RX);
+  }
+  size_t characters = 0;
+  double format_ns = ns_per_frame(frames, rounds, [&](const CAN_frame&) {
+    uint32_t lost = 0;
+    char line[CAN_LOG_MAX_LINE_LENGTH];
+    since = web_log.read(web_log.next_sequence() - 1, lost, [&](LogRingKind, const uint8_t* data, size_t) {
+      characters += can_log_format_text(data, line);
+      return true;
+    });
+  });
+
+  printf("%zu frames, best of %d rounds\n", count, rounds);
+  printf("text:   %7.1f ns/frame on the core task\n", text_ns);
+  printf("binary: %7.1f ns/frame on the core task\n", binary_ns);
+  printf("format on request: %7.1f ns/frame in the webserver\n", format_ns);
+  printf("core task time saved at %.0f frames/s: %.1f us per second\n", frames_per_second,
+         (text_ns - binary_ns) * frames_per_second / 1000);
+
+  // Both must have produced output, otherwise the compiler skipped work
+  return (logged_can_messages_offset > 0 && characters > 0) ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "../Software/src/devboard/sdcard/can_log_index.h"
+
+// One minute of log: 0x100 and 0x200 every 100 ms, 0x18DAF1DB once at 35 s, written in pieces that split records
+class CanLogIndexTests : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    CanLogIndexer indexer([this](const CanLogIndexEntry& entry) {
+      const uint8_t* bytes = (const uint8_t*)&entry;
+      index.insert(index.end(), bytes, bytes + sizeof(entry));
+    });
+
+    std::vector<uint8_t> pending;
+    for (uint64_t t = 0; t < 60000000; t += 100000) {
+      append(pending, 0x100, false, t);
+      append(pending, 0x200, false, t);
+      if (t == 35000000) {
+        append(pending, 0x18DAF1DB, true, t);
+      }
+      if (pending.size() > 100) {
+        indexer.add(pending.data(), 100, log.size());
+        log.insert(log.end(), pending.begin(), pending.begin() + 100);
+        pending.erase(pending.begin(), pending.begin() + 100);
+      }
+    }
+    indexer.add(pending.data(), pending.size(), log.size());
+    log.insert(log.end(), pending.begin(), pending.end());
+    // The last segment is still open, as while the log is being written
+  }
+
+  static void append(std::vector<uint8_t>& out, uint32_t id, bool ext, uint64_t t) {
+    CAN_frame frame = {};
+    frame.ID = id;
+    frame.ext_ID = ext;
+    frame.DLC = 2;
+    uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+    const size_t size = can_log_encode(frame, CAN_NATIVE, MSG_RX, t, record);
+    out.insert(out.end(), record, record + size);
+  }
+
+  static CanLogRangeReader::ReadAt reader_of(const std::vector<uint8_t>& file) {
+    return [&file](uint64_t offset, uint8_t* buffer, size_t size) -> size_t {
+      if (offset >= file.size()) {
+        return 0;
+      }
+      size = std::min<size_t>(size, file.size() - offset);
+      memcpy(buffer, file.data() + offset, size);
+      return size;
+    };
+  }
+
+  // Timestamps and IDs of the records in the window
+  std::vector<std::pair<uint64_t, uint32_t>> read(CanLogRangeReader& reader) {
+    std::vector<std::pair<uint64_t, uint32_t>> records;
+    CanLogRecord record;
+    while (reader.read((uint8_t*)&record, sizeof(record)) == sizeof(record)) {
+      records.push_back({record.timestamp_us, record.id_flags & ~CAN_LOG_EXTENDED});
+    }
+    return records;
+  }
+
+  std::vector<uint8_t> log;
+  std::vector<uint8_t> index;
+};
+
+TEST_F(CanLogIndexTests, SegmentsCoverTheLogInOrder) {
+  ASSERT_EQ(index.size(), 5 * sizeof(CanLogIndexEntry));
+  CanLogIndexEntry entries[5];
+  memcpy(entries, index.data(), index.size());
+
+  EXPECT_EQ(entries[0].offset, 0u);
+  EXPECT_EQ(entries[0].records, 200u);
+  EXPECT_EQ(entries[0].first_timestamp_us, 0u);
+  EXPECT_EQ(entries[0].last_timestamp_us, 9900000u);
+  for (int i = 1; i < 5; i++) {
+    EXPECT_EQ(entries[i].offset, entries[i - 1].offset + entries[i - 1].size);
+    EXPECT_EQ(entries[i].first_timestamp_us, i * CAN_LOG_INDEX_SEGMENT_US);
+  }
+  EXPECT_TRUE(can_log_index_may_contain(entries[3].id_bitmap, 0x18DAF1DB | CAN_LOG_EXTENDED));
+  EXPECT_TRUE(can_log_index_may_contain(entries[3].id_bitmap, 0x100));
+}
+
+TEST_F(CanLogIndexTests, TimeWindowReadsOnlyItsSegment) {
+  CanLogRangeReader reader(reader_of(log), reader_of(index), 21000000, 21200000, {});
+  auto records = read(reader);
+  std::vector<std::pair<uint64_t, uint32_t>> expected = {{21000000, 0x100}, {21000000, 0x200}, {21100000, 0x100},
+                                                         {21100000, 0x200}, {21200000, 0x100}, {21200000, 0x200}};
+  EXPECT_EQ(records, expected);
+  EXPECT_EQ(reader.segments_read(), 1u);
+  EXPECT_EQ(reader.segments_skipped(), 4u);
+}
+
+TEST_F(CanLogIndexTests, IdFilterSkipsSegmentsWithoutTheId) {
+  CanLogRangeReader reader(reader_of(log), reader_of(index), 0, UINT64_MAX, {0x18DAF1DB | CAN_LOG_EXTENDED});
+  auto records = read(reader);
+  ASSERT_EQ(records.size(), 1u);
+  EXPECT_EQ(records[0], std::make_pair(uint64_t(35000000), uint32_t(0x18DAF1DB)));
+  EXPECT_LE(reader.segments_read(), 2u);
+}
+
+TEST_F(CanLogIndexTests, RecordsAfterTheLastEntryAreScanned) {
+  CanLogRangeReader reader(reader_of(log), reader_of(index), 59900000, UINT64_MAX, {0x200});
+  auto records = read(reader);
+  ASSERT_EQ(records.size(), 1u);
+  EXPECT_EQ(records[0], std::make_pair(uint64_t(59900000), uint32_t(0x200)));
+
+  // Without an index the whole log is scanned
+  std::vector<uint8_t> no_index;
+  CanLogRangeReader unindexed(reader_of(log), reader_of(no_index), 59900000, UINT64_MAX, {0x200});
+  EXPECT_EQ(read(unindexed), records);
+}
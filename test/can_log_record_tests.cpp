@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include "../Software/src/devboard/sdcard/can_log_record.h"
+
+static std::string stream_all(const std::vector<uint8_t>& log) {
+  size_t position = 0;
+  CanLogTextStream stream([&](uint8_t* buffer, size_t size) {
+    size = std::min(size, log.size() - position);
+    memcpy(buffer, log.data() + position, size);
+    position += size;
+    return size;
+  });
+
+  // Small chunks, so lines are split over several calls
+  std::string text;
+  uint8_t chunk[7];
+  size_t length;
+  while ((length = stream.fill(chunk, sizeof(chunk))) > 0) {
+    text.append((const char*)chunk, length);
+  }
+  EXPECT_EQ(position, log.size());
+  return text + "|skipped " + std::to_string(stream.skipped_blocks());
+}
+
+static void append(std::vector<uint8_t>& log, const CAN_frame& frame, CAN_Interface interface, frameDirection dir,
+                   uint64_t timestamp_us) {
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  size_t size = can_log_encode(frame, interface, dir, timestamp_us, record);
+  log.insert(log.end(), record, record + size);
+}
+
+TEST(CanLogRecordTests, ClassicFrameIsOneRecordAndFormatsLikeTheWebserverLog) {
+  CAN_frame frame = {};
+  frame.ID = 0x7FF;
+  frame.DLC = 3;
+  frame.data.u8[0] = 0x01;
+  frame.data.u8[1] = 0xAB;
+  frame.data.u8[2] = 0xF0;
+
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  ASSERT_EQ(can_log_encode(frame, CAN_ADDON_MCP2515, MSG_TX, 12000345ULL, record), (size_t)CAN_LOG_BLOCK_SIZE);
+  EXPECT_EQ(can_log_record_size(record), (size_t)CAN_LOG_BLOCK_SIZE);
+
+  char line[CAN_LOG_MAX_LINE_LENGTH];
+  size_t length = can_log_format_text(record, line);
+  EXPECT_EQ(std::string(line, length), "(12.000345) TX5 7FF [3] 01 AB F0\n");
+}
+
+TEST(CanLogRecordTests, FdFrameContinuesInFollowingBlocks) {
+  CAN_frame frame = {};
+  frame.FD = true;
+  frame.ext_ID = true;
+  frame.ID = 0x18DAF1DB;
+  frame.DLC = 64;
+  for (int i = 0; i < 64; i++) {
+    frame.data.u8[i] = i;
+  }
+
+  std::vector<uint8_t> log;
+  append(log, frame, CANFD_ADDON_MCP2518, MSG_RX, 1);
+  ASSERT_EQ(log.size(), (size_t)CAN_LOG_MAX_RECORD_SIZE);
+  EXPECT_EQ(can_log_record_size(log.data()), (size_t)CAN_LOG_MAX_RECORD_SIZE);
+
+  CAN_frame decoded;
+  CAN_Interface interface;
+  frameDirection direction;
+  EXPECT_EQ(can_log_decode(log.data(), decoded, interface, direction), 1u);
+  EXPECT_TRUE(decoded.FD && decoded.ext_ID);
+  EXPECT_EQ(decoded.ID, frame.ID);
+  EXPECT_EQ(decoded.DLC, 64);
+  EXPECT_EQ(memcmp(decoded.data.u8, frame.data.u8, 64), 0);
+  EXPECT_EQ(interface, CANFD_ADDON_MCP2518);
+  EXPECT_EQ(direction, MSG_RX);
+
+  std::string expected = "(0.000001) RX6 18DAF1DB [64]";
+  char hex[4];
+  for (int i = 0; i < 64; i++) {
+    snprintf(hex, sizeof(hex), " %02X", i);
+    expected += hex;
+  }
+  EXPECT_EQ(stream_all(log), expected + "\n|skipped 0");
+}
+
+TEST(CanLogRecordTests, StreamSkipsBlocksThatDoNotStartARecord) {
+  CAN_frame frame = {};
+  frame.ID = 0x100;
+  frame.DLC = 1;
+  frame.data.u8[0] = 0x55;
+
+  std::vector<uint8_t> log;
+  append(log, frame, CAN_NATIVE, MSG_RX, 1000000);
+  log.insert(log.end(), CAN_LOG_BLOCK_SIZE, 0xFF);
+  append(log, frame, CAN_NATIVE, MSG_RX, 2000000);
+
+  EXPECT_EQ(stream_all(log), "(1.000000) RX0 100 [1] 55\n(2.000000) RX0 100 [1] 55\n|skipped 1");
+}
+
+TEST(CanLogRecordTests, TextLinesParseBackToTheSameRecord) {
+  std::vector<uint8_t> log;
+  CAN_frame classic = {};
+  classic.ID = 0x18DAF110;
+  classic.ext_ID = true;
+  classic.DLC = 8;
+  for (int i = 0; i < 8; i++) {
+    classic.data.u8[i] = 0x10 * i + 0x0F;
+  }
+  append(log, classic, CAN_ADDON_MCP2515, MSG_TX, 1700000000123456ULL);
+  CAN_frame fd = {};
+  fd.FD = true;
+  fd.ID = 0x12F;
+  fd.DLC = 64;
+  for (int i = 0; i < 64; i++) {
+    fd.data.u8[i] = 255 - i;
+  }
+  append(log, fd, CANFD_NATIVE, MSG_RX, 42000001);
+
+  size_t position = 0;
+  while (position < log.size()) {
+    char line[CAN_LOG_MAX_LINE_LENGTH];
+    const size_t length = can_log_format_text(log.data() + position, line);
+    uint8_t parsed[CAN_LOG_MAX_RECORD_SIZE];
+    const size_t size = can_log_parse_text(line, length, parsed);
+    ASSERT_EQ(size, can_log_record_size(log.data() + position));
+    EXPECT_EQ(memcmp(parsed, log.data() + position, size), 0);
+    position += size;
+  }
+}
+
+TEST(CanLogRecordTests, TextParsingIsLenientOnlyWhereItIsSafe) {
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  CanLogRecord parsed;
+
+  // Lower case, no RX/TX column, fewer fraction digits
+  ASSERT_EQ(can_log_parse_text("(12.5) 7bb [2] 0a ff\r", 21, record), (size_t)CAN_LOG_BLOCK_SIZE);
+  memcpy(&parsed, record, sizeof(parsed));
+  EXPECT_EQ(parsed.timestamp_us, 12500000u);
+  EXPECT_EQ(parsed.id_flags, 0x7BBu);
+  EXPECT_EQ(parsed.length, 2);
+  EXPECT_EQ(parsed.data[0], 0x0A);
+  EXPECT_EQ(parsed.data[1], 0xFF);
+
+  const char* broken[] = {"", "# comment", "(1.0) RX0 123 [8] 00 11", "(1.0) RX0 123 [65]", "1.0 RX0 123 [0]",
+                          "(1.0) RX0 [1] 00"};
+  for (const char* line : broken) {
+    EXPECT_EQ(can_log_parse_text(line, strlen(line), record), 0u) << line;
+  }
+}
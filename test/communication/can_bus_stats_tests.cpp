@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include "../../Software/src/communication/can/CanBusStats.h"
+
+static CAN_frame frame_with_id(uint32_t id, bool ext_ID = false) {
+  CAN_frame frame = {};
+  frame.ID = id;
+  frame.ext_ID = ext_ID;
+  frame.DLC = 8;
+  return frame;
+}
+
+TEST(CanBusStatsTests, ClassicFrameLengthIsWorstCaseWithStuffing) {
+  // Well known worst case lengths including 3 bits of interframe space
+  EXPECT_EQ(CanBusStats::frame_bit_times(false, false, 8, 1), 135);
+  EXPECT_EQ(CanBusStats::frame_bit_times(false, true, 8, 1), 160);
+  EXPECT_EQ(CanBusStats::frame_bit_times(false, false, 0, 1), 55);
+  // Classic frames never carry more than 8 bytes
+  EXPECT_EQ(CanBusStats::frame_bit_times(false, false, 64, 1), 135);
+}
+
+TEST(CanBusStatsTests, FdDataPhaseIsScaledByTheDataRate) {
+  const uint16_t slow = CanBusStats::frame_bit_times(true, false, 64, 1);
+  const uint16_t fast = CanBusStats::frame_bit_times(true, false, 64, 4);
+  EXPECT_GT(slow, 8 * 64);
+  EXPECT_LT(fast, slow / 3);
+  EXPECT_GT(CanBusStats::frame_bit_times(true, true, 64, 4), fast);
+}
+
+TEST(CanBusStatsTests, SampleGivesRatesAndBusiestIdsFirst) {
+  CanBusStats counters;
+  for (int i = 0; i < 10; i++) {
+    counters.count(frame_with_id(0x100), false);
+  }
+  for (int i = 0; i < 4; i++) {
+    counters.count(frame_with_id(0x200), true);
+  }
+  counters.count(frame_with_id(0x100, true), false);
+
+  DATALAYER_CAN_BUS_STATS_TYPE stats;
+  stats.bitrate = 500000;
+  counters.sample(stats, 500);
+
+  EXPECT_EQ(stats.frames_per_second, 30u);
+  EXPECT_EQ(stats.bits_per_second, (14u * 135u + 160u) * 2u);
+  EXPECT_EQ(stats.utilization_dpct, stats.bits_per_second * 1000 / 500000);
+  EXPECT_EQ(stats.id_count, 3);
+  EXPECT_EQ(stats.id_rates[0].id, 0x100u);
+  EXPECT_FALSE(stats.id_rates[0].ext_ID);
+  EXPECT_EQ(stats.id_rates[0].rx_per_second, 20);
+  EXPECT_EQ(stats.id_rates[1].id, 0x200u);
+  EXPECT_EQ(stats.id_rates[1].tx_per_second, 8);
+  EXPECT_EQ(stats.id_rates[2].id, 0x100u);
+  EXPECT_TRUE(stats.id_rates[2].ext_ID);
+  EXPECT_EQ(stats.id_rates[3].rx_per_second, 0);
+
+  // Counting starts anew after a sample
+  counters.sample(stats, 1000);
+  EXPECT_EQ(stats.frames_per_second, 0u);
+  EXPECT_EQ(stats.id_count, 0);
+  EXPECT_EQ(stats.id_rates[0].rx_per_second, 0);
+}
+
+TEST(CanBusStatsTests, AbsorbMergesCountsOfTheOtherDirection) {
+  CanBusStats rx;
+  CanBusStats tx;
+  rx.count(frame_with_id(0x300), false);
+  tx.count(frame_with_id(0x300), true);
+  tx.count(frame_with_id(0x301), true);
+  rx.absorb(tx);
+
+  DATALAYER_CAN_BUS_STATS_TYPE stats;
+  rx.sample(stats, 1000);
+  EXPECT_EQ(stats.frames_per_second, 3u);
+  EXPECT_EQ(stats.id_count, 2);
+  EXPECT_EQ(stats.id_rates[0].id, 0x300u);
+  EXPECT_EQ(stats.id_rates[0].rx_per_second, 1);
+  EXPECT_EQ(stats.id_rates[0].tx_per_second, 1);
+
+  tx.sample(stats, 1000);
+  EXPECT_EQ(stats.frames_per_second, 0u);
+}
+
+TEST(CanBusStatsTests, UtilizationIsCappedAtFullLoad) {
+  CanBusStats counters;
+  for (uint32_t id = 0; id < 200; id++) {
+    counters.count(frame_with_id(id), false);
+  }
+  DATALAYER_CAN_BUS_STATS_TYPE stats;
+  stats.bitrate = 1000;
+  counters.sample(stats, 1000);
+  EXPECT_EQ(stats.utilization_dpct, 1000);
+  // More IDs than hash slots, the table still lists the busiest that fit
+  EXPECT_GE(stats.id_count, CAN_ID_RATE_TABLE_SIZE);
+  EXPECT_EQ(stats.id_rates[CAN_ID_RATE_TABLE_SIZE - 1].rx_per_second, 1);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include "../utils/utils.h"
+
+#include "../../Software/src/battery/BYD-ATTO-3-BATTERY.h"
+#include "../../Software/src/communication/can/CanDispatchTable.h"
+#include "../../Software/src/communication/can/CanReceiver.h"
+
+// Receiver that just counts the frames handed to it
+class CountingReceiver : public CanReceiver {
+ public:
+  explicit CountingReceiver(std::function<void(CanIdSet&)> declare) : declare(declare) {}
+  void receive_can_frame(const CAN_frame&) override { frames++; }
+  void declare_can_ids(CanIdSet& ids) override { declare(ids); }
+
+  int frames = 0;
+
+ private:
+  std::function<void(CanIdSet&)> declare;
+};
+
+static CAN_frame frame_with_id(uint32_t id, bool ext_ID = false) {
+  CAN_frame frame = {};
+  frame.ID = id;
+  frame.ext_ID = ext_ID;
+  frame.DLC = 8;
+  return frame;
+}
+
+TEST(CanIdSetTests, RangeIsSplitIntoAlignedBlocks) {
+  CanIdSet ids;
+  ids.add_range(0x100, 0x1FF);
+  ASSERT_EQ(ids.get_blocks().size(), 1u);
+  EXPECT_EQ(ids.get_blocks()[0].mask, 0x700u);
+
+  CanIdSet odd;
+  odd.add_range(0x0FF, 0x102);
+  EXPECT_EQ(odd.get_blocks().size(), 3u);
+  for (uint32_t id = 0; id <= CAN_STD_ID_MASK; id++) {
+    EXPECT_EQ(odd.contains(id, false), id >= 0x0FF && id <= 0x102) << std::hex << id;
+  }
+}
+
+TEST(CanIdSetTests, FormatIsInferredFromId) {
+  CanIdSet ids;
+  ids.add_id(0x351);
+  ids.add_id(0x4200);
+  EXPECT_TRUE(ids.contains(0x351, false));
+  EXPECT_FALSE(ids.contains(0x351, true));
+  EXPECT_TRUE(ids.contains(0x4200, true));
+  EXPECT_TRUE(ids.has_format(false));
+  EXPECT_TRUE(ids.has_format(true));
+}
+
+TEST(CanIdSetTests, ReducedFiltersCoverEveryDeclaredId) {
+  CanIdSet ids;
+  const uint32_t declared[] = {0x091, 0x0D1, 0x111, 0x151, 0x244, 0x245, 0x286, 0x334, 0x524, 0x7EF};
+  for (auto id : declared) {
+    ids.add_id(id);
+  }
+
+  for (size_t max_count : {1, 2, 4, 6, 16}) {
+    auto blocks = ids.reduce(false, max_count);
+    EXPECT_LE(blocks.size(), max_count);
+    for (auto id : declared) {
+      bool covered = false;
+      for (auto& block : blocks) {
+        covered |= block.matches(id);
+      }
+      EXPECT_TRUE(covered) << "ID " << std::hex << id << " lost with " << std::dec << max_count << " filters";
+    }
+  }
+
+  // With enough filters nothing else should get through
+  EXPECT_EQ(ids.reduce(false, 16).size(), std::size(declared));
+  EXPECT_TRUE(ids.reduce(true, 16).empty());
+}
+
+TEST(CanDispatchTableTests, FramesOnlyReachInterestedReceivers) {
+  CountingReceiver battery([](CanIdSet& ids) { ids.add_range(0x200, 0x2FF); });
+  CountingReceiver inverter([](CanIdSet& ids) { ids.add_id(0x4200); });
+  CountingReceiver logger([](CanIdSet& ids) { ids.add_all(); });
+
+  CanDispatchTable table;
+  ASSERT_TRUE(table.add_receiver(&battery));
+  ASSERT_TRUE(table.add_receiver(&inverter));
+  ASSERT_TRUE(table.add_receiver(&logger));
+
+  for (uint32_t id : {0x1FF, 0x200, 0x2AA, 0x300}) {
+    CAN_frame frame = frame_with_id(id);
+    table.dispatch(frame);
+  }
+  for (int i = 0; i < 3; i++) {
+    CAN_frame frame = frame_with_id(0x4200, true);
+    table.dispatch(frame);
+  }
+  CAN_frame ext_with_std_id = frame_with_id(0x200, true);
+  table.dispatch(ext_with_std_id);
+
+  EXPECT_EQ(battery.frames, 2);
+  EXPECT_EQ(inverter.frames, 3);
+  EXPECT_EQ(logger.frames, 8);
+}
+
+TEST(CanDispatchTableTests, TableIsLimitedToMaxReceivers) {
+  std::vector<CountingReceiver> receivers(CanDispatchTable::MAX_RECEIVERS + 1,
+                                          CountingReceiver([](CanIdSet& ids) { ids.add_all(); }));
+  CanDispatchTable table;
+  for (uint8_t i = 0; i < CanDispatchTable::MAX_RECEIVERS; i++) {
+    EXPECT_TRUE(table.add_receiver(&receivers[i]));
+  }
+  EXPECT_FALSE(table.add_receiver(&receivers.back()));
+}
+
+// Decoding only the frames a battery declared must give the same result as decoding all of them
+TEST(CanDispatchTableTests, BydAtto3DeclarationKeepsDecodedValues) {
+  auto frames = parse_can_log_file(fs::path(TEST_CAN_LOG_DIR) / "5_BydAtto3_base.txt");
+
+  datalayer = DataLayer();
+  BydAttoBattery all_frames;
+  all_frames.setup();
+  for (auto& frame : frames) {
+    all_frames.handle_incoming_can_frame(frame);
+  }
+  all_frames.update_values();
+  const DATALAYER_BATTERY_STATUS_TYPE expected = datalayer.battery.status;
+
+  datalayer = DataLayer();
+  BydAttoBattery declared_frames;
+  declared_frames.setup();
+  CanIdSet ids;
+  declared_frames.declare_can_ids(ids);
+  for (auto& frame : frames) {
+    if (ids.contains(frame.ID, frame.ext_ID)) {
+      declared_frames.handle_incoming_can_frame(frame);
+    }
+  }
+  declared_frames.update_values();
+
+  EXPECT_EQ(datalayer.battery.status.real_soc, expected.real_soc);
+  EXPECT_EQ(datalayer.battery.status.voltage_dV, expected.voltage_dV);
+  EXPECT_EQ(datalayer.battery.status.current_dA, expected.current_dA);
+  EXPECT_EQ(datalayer.battery.status.cell_max_voltage_mV, expected.cell_max_voltage_mV);
+  EXPECT_EQ(datalayer.battery.status.cell_min_voltage_mV, expected.cell_min_voltage_mV);
+  EXPECT_EQ(datalayer.battery.status.temperature_max_dC, expected.temperature_max_dC);
+  EXPECT_EQ(datalayer.battery.status.temperature_min_dC, expected.temperature_min_dC);
+  EXPECT_EQ(datalayer.battery.status.CAN_battery_still_alive, expected.CAN_battery_still_alive);
+}
+
+TEST(CanClassicFrameTests, RoundTripKeepsClassicFrame) {
+  CAN_classic_frame classic = {.FD = false, .ext_ID = true, .DLC = 6, .ID = 0x18FF50E5, .data = {1, 2, 3, 4, 5, 6}};
+  CAN_frame frame = to_can_frame(classic);
+  EXPECT_FALSE(frame.FD);
+  EXPECT_TRUE(frame.ext_ID);
+  EXPECT_EQ(frame.DLC, 6);
+  EXPECT_EQ(frame.ID, 0x18FF50E5u);
+  EXPECT_EQ(frame.data.u8[5], 6);
+  EXPECT_EQ(frame.data.u8[6], 0);
+
+  CAN_classic_frame back = to_classic_frame(frame);
+  EXPECT_EQ(back.ID, classic.ID);
+  EXPECT_EQ(back.DLC, classic.DLC);
+  EXPECT_EQ(back.data.u64, classic.data.u64);
+
+  // FD payloads don't fit, only the first 8 bytes are kept
+  frame.FD = true;
+  frame.DLC = 64;
+  EXPECT_EQ(to_classic_frame(frame).DLC, 8);
+}
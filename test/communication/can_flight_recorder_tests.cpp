@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "../../Software/src/communication/can/CanFlightRecorder.h"
+
+static CAN_frame frame_with_length(uint32_t id, uint8_t length) {
+  CAN_frame frame = {};
+  frame.FD = length > 8;
+  frame.ID = id;
+  frame.DLC = length;
+  for (int i = 0; i < length; i++) {
+    frame.data.u8[i] = (uint8_t)(id + i);
+  }
+  return frame;
+}
+
+// The records of the frozen snapshot, read in pieces as the SD card writer does
+static std::vector<CanLogRecord> snapshot_records(const CanFlightRecorder& recorder) {
+  std::vector<CanLogRecord> records;
+  uint8_t buffer[2 * CAN_LOG_MAX_RECORD_SIZE];
+  uint32_t cursor = 0;
+  size_t size;
+  while ((size = recorder.read(cursor, buffer, sizeof(buffer))) > 0) {
+    size_t position = 0;
+    while (position < size) {
+      const size_t record_size = can_log_record_size(buffer + position);
+      EXPECT_GT(record_size, 0u);
+      if (record_size == 0) {
+        return records;
+      }
+      CanLogRecord record;
+      memcpy(&record, buffer + position, sizeof(record));
+      records.push_back(record);
+      position += record_size;
+    }
+  }
+  return records;
+}
+
+TEST(CanFlightRecorderTests, KeepsTheFramesAroundTheTrigger) {
+  static uint8_t memory[1000 * CAN_LOG_BLOCK_SIZE];
+  CanFlightRecorderConfig config;
+  config.pre_trigger_ms = 100;
+  config.post_trigger_ms = 50;
+  CanFlightRecorder recorder;
+  recorder.begin(memory, sizeof(memory), config);
+  EXPECT_EQ(recorder.state(), CanFlightState::Recording);
+
+  // One frame per millisecond, the event comes at 500 ms
+  for (uint64_t ms = 1; ms <= 600; ms++) {
+    if (ms == 500) {
+      EXPECT_TRUE(recorder.trigger(42, ms * 1000));
+      EXPECT_EQ(recorder.state(), CanFlightState::Triggered);
+    }
+    recorder.record(frame_with_length(0x100 + ms % 16, 8), CAN_NATIVE, MSG_RX, ms * 1000);
+  }
+  ASSERT_EQ(recorder.state(), CanFlightState::Frozen);
+  EXPECT_EQ(recorder.trigger_reason(), 42);
+  EXPECT_EQ(recorder.trigger_time_us(), 500000u);
+
+  const std::vector<CanLogRecord> records = snapshot_records(recorder);
+  ASSERT_EQ(records.size(), 150u);
+  EXPECT_EQ(records.front().timestamp_us, 400000u);
+  EXPECT_EQ(records.back().timestamp_us, 549000u);
+  EXPECT_EQ(recorder.snapshot_size(), 150u * CAN_LOG_BLOCK_SIZE);
+
+  // Frozen until rearmed
+  recorder.record(frame_with_length(0x200, 8), CAN_NATIVE, MSG_RX, 601000);
+  EXPECT_EQ(snapshot_records(recorder).size(), 150u);
+  recorder.rearm();
+  EXPECT_EQ(recorder.state(), CanFlightState::Recording);
+  EXPECT_EQ(recorder.snapshot_size(), 0u);
+}
+
+TEST(CanFlightRecorderTests, PostTriggerFramesKeepHalfOfTheHistory) {
+  static uint8_t memory[100 * CAN_LOG_BLOCK_SIZE];
+  CanFlightRecorderConfig config;
+  config.pre_trigger_ms = 1000;
+  config.post_trigger_ms = 1000;
+  CanFlightRecorder recorder;
+  recorder.begin(memory, sizeof(memory), config);
+
+  for (uint64_t ms = 1; ms <= 300; ms++) {
+    recorder.record(frame_with_length(0x123, 8), CAN_NATIVE, MSG_TX, ms * 1000);
+  }
+  recorder.trigger(1, 300000);
+  for (uint64_t ms = 301; ms <= 600; ms++) {
+    recorder.record(frame_with_length(0x123, 8), CAN_NATIVE, MSG_RX, ms * 1000);
+  }
+  ASSERT_EQ(recorder.state(), CanFlightState::Frozen);
+
+  // The memory held the 100 frames up to the trigger, post-trigger frames took the place of the older half
+  const std::vector<CanLogRecord> records = snapshot_records(recorder);
+  ASSERT_EQ(records.size(), 100u);
+  EXPECT_EQ(records.front().timestamp_us, 251000u);
+  EXPECT_EQ(records.back().timestamp_us, 350000u);
+  EXPECT_NE(records.front().id_flags & CAN_LOG_TX, 0u);
+  EXPECT_EQ(records.back().id_flags & CAN_LOG_TX, 0u);
+}
+
+TEST(CanFlightRecorderTests, WindowCatchesUpAfterAQuietBus) {
+  static uint8_t memory[1000 * CAN_LOG_BLOCK_SIZE];
+  CanFlightRecorderConfig config;
+  config.pre_trigger_ms = 100;
+  config.post_trigger_ms = 10;
+  CanFlightRecorder recorder;
+  recorder.begin(memory, sizeof(memory), config);
+
+  // The history of the first burst is long past when the second one comes, each frame drops only a part of it
+  for (uint64_t ms = 1; ms <= 500; ms++) {
+    recorder.record(frame_with_length(0x100, 8), CAN_NATIVE, MSG_RX, ms * 1000);
+  }
+  for (uint64_t ms = 20000; ms < 20010; ms++) {
+    if (ms == 20005) {
+      recorder.trigger(1, ms * 1000);
+    }
+    recorder.record(frame_with_length(0x200, 8), CAN_NATIVE, MSG_RX, ms * 1000);
+  }
+  recorder.poll(20015000);
+  ASSERT_EQ(recorder.state(), CanFlightState::Frozen);
+
+  const std::vector<CanLogRecord> records = snapshot_records(recorder);
+  ASSERT_EQ(records.size(), 10u);
+  EXPECT_EQ(records.front().timestamp_us, 20000000u);
+  EXPECT_EQ(records.back().timestamp_us, 20009000u);
+  EXPECT_EQ(recorder.snapshot_size(), 10u * CAN_LOG_BLOCK_SIZE);
+}
+
+TEST(CanFlightRecorderTests, LongFramesNeverWrapAroundTheMemory) {
+  // A 64 byte frame takes 4 of the 10 blocks, at the end of the memory it starts over at the beginning
+  static uint8_t memory[10 * CAN_LOG_BLOCK_SIZE];
+  CanFlightRecorderConfig config;
+  config.pre_trigger_ms = 1000;
+  config.post_trigger_ms = 0;
+  CanFlightRecorder recorder;
+  recorder.begin(memory, sizeof(memory), config);
+
+  for (uint64_t ms = 1; ms <= 7; ms++) {
+    recorder.record(frame_with_length(0x300 + ms, ms % 3 ? 64 : 8), CANFD_NATIVE, MSG_RX, ms * 1000);
+  }
+  recorder.trigger(1, 7000);
+  recorder.record(frame_with_length(0x400, 8), CANFD_NATIVE, MSG_RX, 8000);
+  ASSERT_EQ(recorder.state(), CanFlightState::Frozen);
+
+  // The frames that are still whole, the empty block left before the last one is skipped
+  const std::vector<CanLogRecord> records = snapshot_records(recorder);
+  ASSERT_EQ(records.size(), 3u);
+  EXPECT_EQ(records[0].timestamp_us, 5000u);
+  EXPECT_EQ(records[1].timestamp_us, 6000u);
+  EXPECT_EQ(records[1].length, 8);
+  EXPECT_EQ(records.back().timestamp_us, 7000u);
+  EXPECT_EQ(records.back().length, 64);
+  EXPECT_EQ(records.back().id_flags & 0x1FFFFFFF, 0x307u);
+}
+
+TEST(CanFlightRecorderTests, TriggersOnceUntilRearmed) {
+  static uint8_t memory[50 * CAN_LOG_BLOCK_SIZE];
+  CanFlightRecorder recorder;
+  EXPECT_FALSE(recorder.trigger(1, 0));  // Off without memory
+  recorder.begin(memory, sizeof(memory), CanFlightRecorderConfig());
+
+  EXPECT_TRUE(recorder.trigger(7, 1000));
+  EXPECT_FALSE(recorder.trigger(8, 2000));
+  EXPECT_EQ(recorder.trigger_reason(), 7);
+
+  // A quiet bus still ends the post-trigger time
+  recorder.poll(1000 + 4999000);
+  EXPECT_EQ(recorder.state(), CanFlightState::Triggered);
+  recorder.poll(1000 + 5000000);
+  EXPECT_EQ(recorder.state(), CanFlightState::Frozen);
+  EXPECT_FALSE(recorder.trigger(8, 6000000));
+
+  recorder.rearm();
+  EXPECT_TRUE(recorder.trigger(8, 7000000));
+  EXPECT_EQ(recorder.trigger_reason(), 8);
+}
+
+TEST(CanFlightRecorderTests, SelectsTriggerEvents) {
+  CanFlightRecorder recorder;
+  recorder.set_trigger_event(3, true);
+  recorder.set_trigger_event(200, true);
+  recorder.set_trigger_event(CAN_FLIGHT_MAX_EVENTS, true);
+  EXPECT_TRUE(recorder.triggered_by(3));
+  EXPECT_TRUE(recorder.triggered_by(200));
+  EXPECT_FALSE(recorder.triggered_by(4));
+  EXPECT_FALSE(recorder.triggered_by(CAN_FLIGHT_MAX_EVENTS));
+  recorder.set_trigger_event(3, false);
+  EXPECT_FALSE(recorder.triggered_by(3));
+}
+
+TEST(CanFlightRecorderTests, SnapshotStreamConvertsToText) {
+  static uint8_t memory[100 * CAN_LOG_BLOCK_SIZE];
+  CanFlightRecorderConfig config;
+  config.post_trigger_ms = 0;
+  CanFlightRecorder recorder;
+  recorder.begin(memory, sizeof(memory), config);
+  recorder.record(frame_with_length(0x7FF, 8), CAN_NATIVE, MSG_RX, 1000);
+  recorder.record(frame_with_length(0x123, 24), CANFD_NATIVE, MSG_TX, 2000);
+  recorder.trigger(1, 2000);
+  recorder.poll(2000);
+
+  // Read in pieces smaller than a record
+  CanFlightSnapshotStream snapshot(recorder);
+  CanLogTextStream stream([&snapshot](uint8_t* buffer, size_t size) { return snapshot.read(buffer, size); });
+  std::string text;
+  char chunk[7];
+  size_t length;
+  while ((length = stream.fill((uint8_t*)chunk, sizeof(chunk))) > 0) {
+    text.append(chunk, length);
+  }
+  EXPECT_EQ(std::count(text.begin(), text.end(), '\n'), 2);
+  EXPECT_NE(text.find("7FF [8]"), std::string::npos);
+  EXPECT_NE(text.find("123 [24]"), std::string::npos);
+  EXPECT_EQ(stream.skipped_blocks(), 0u);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <random>
+#include <string>
+
+#include "../../Software/src/communication/can/CanFrameText.h"
+
+// The line as the logs used to build it with snprintf
+static std::string snprintf_line(uint64_t timestamp_us, bool tx, uint8_t interface, uint32_t id, const uint8_t* data,
+                                 uint8_t length) {
+  char line[CAN_FRAME_TEXT_MAX_LENGTH];
+  int offset = snprintf(line, sizeof(line), "(%lu.%06lu) %s%d %lX [%u]", (unsigned long)(timestamp_us / 1000000),
+                        (unsigned long)(timestamp_us % 1000000), tx ? "TX" : "RX", interface * 2 + (tx ? 1 : 0),
+                        (unsigned long)id, length);
+  for (uint8_t i = 0; i < length; i++) {
+    offset += snprintf(line + offset, sizeof(line) - offset, " %02X", data[i]);
+  }
+  return std::string(line, offset) + "\n";
+}
+
+TEST(CanFrameTextTests, FormatsACandumpLine) {
+  CAN_frame frame = {};
+  frame.ID = 0x7FF;
+  frame.DLC = 3;
+  frame.data.u8[0] = 0x01;
+  frame.data.u8[1] = 0xAB;
+  frame.data.u8[2] = 0xF0;
+  char line[CAN_FRAME_TEXT_MAX_LENGTH];
+  size_t length = format_can_frame_text(line, frame, CAN_ADDON_MCP2515, MSG_TX, 12000345);
+  EXPECT_EQ(std::string(line, length), "(12.000345) TX5 7FF [3] 01 AB F0\n");
+
+  frame.ID = 0;
+  frame.DLC = 0;
+  length = format_can_frame_text(line, frame, CAN_NATIVE, MSG_RX, 0);
+  EXPECT_EQ(std::string(line, length), "(0.000000) RX0 0 [0]\n");
+}
+
+TEST(CanFrameTextTests, MatchesSnprintfForAnyFrame) {
+  std::mt19937_64 rng(42);
+  uint8_t data[64];
+  char line[CAN_FRAME_TEXT_MAX_LENGTH];
+  for (int i = 0; i < 10000; i++) {
+    const uint64_t timestamp_us = rng() % 4294967296000000ULL;
+    const bool tx = rng() & 1;
+    const uint8_t interface = rng() % 4;
+    const uint32_t id = (rng() & 1) ? rng() % 0x800 : rng() % 0x20000000;
+    const uint8_t length = (rng() & 1) ? rng() % 9 : rng() % 65;
+    for (uint8_t j = 0; j < length; j++) {
+      data[j] = rng();
+    }
+    const size_t size = format_can_frame_text(line, timestamp_us, tx, interface, id, data, length);
+    ASSERT_EQ(std::string(line, size), snprintf_line(timestamp_us, tx, interface, id, data, length));
+  }
+
+  // The longest line fits
+  memset(data, 0xFF, sizeof(data));
+  EXPECT_LE(format_can_frame_text(line, 4294967295999999ULL, true, 3, 0x1FFFFFFF, data, 64),
+            (size_t)CAN_FRAME_TEXT_MAX_LENGTH);
+}
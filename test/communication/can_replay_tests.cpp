@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include "../../Software/src/communication/can/CanReplay.h"
+
+static uint64_t fake_now_us = 0;
+static uint64_t fake_clock_us() {
+  return fake_now_us;
+}
+
+struct SentFrame {
+  uint32_t id;
+  uint64_t at_us;
+};
+
+// An engine replaying records from memory, collecting what it sends
+class CanReplayTests : public ::testing::Test {
+ protected:
+  void SetUp() override { fake_now_us = 1000000; }
+
+  CanReplayEngine make_engine() {
+    return CanReplayEngine(
+        [this](uint8_t* buffer, size_t size) {
+          size = std::min(size, records.size() - position);
+          memcpy(buffer, records.data() + position, size);
+          position += size;
+          return size;
+        },
+        [this]() {
+          position = 0;
+          return true;
+        },
+        [this](const CAN_frame& frame, CAN_Interface, frameDirection) {
+          if (refuse_next > 0) {
+            refuse_next--;
+            return false;
+          }
+          sent.push_back({frame.ID, fake_now_us});
+          return true;
+        },
+        fake_clock_us);
+  }
+
+  void add_frame(uint32_t id, uint64_t timestamp_us) {
+    CAN_frame frame = {};
+    frame.ID = id;
+    frame.DLC = 8;
+    uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+    const size_t size = can_log_encode(frame, CAN_NATIVE, MSG_RX, timestamp_us, record);
+    records.insert(records.end(), record, record + size);
+  }
+
+  // Polls like the replay task does, waking exactly at the returned due time plus latency_us
+  void run(CanReplayEngine& engine, uint64_t latency_us = 0) {
+    uint64_t next;
+    while ((next = engine.poll()) != CAN_REPLAY_DONE) {
+      fake_now_us = std::max(fake_now_us, next + latency_us);
+    }
+  }
+
+  std::vector<uint8_t> records;
+  size_t position = 0;
+  std::vector<SentFrame> sent;
+  // Frames the sender does not take before it takes the next one, like a full queue
+  int refuse_next = 0;
+};
+
+TEST_F(CanReplayTests, LoaderTakesLinesSplitOverPieces) {
+  const std::string text =
+      "(100.000000) RX0 100 [8] 00 01 02 03 04 05 06 07\r\n"
+      "not a frame\n"
+      "\n"
+      "(100.001000) TX1 200 [2] AA BB\n"
+      "(100.002500) RX4 12F [12] 00 11 22 33 44 55 66 77 88 99 AA BB";
+
+  std::vector<uint8_t> loaded;
+  CanReplayLoader loader(loaded);
+  loader.begin(false);
+  for (size_t i = 0; i < text.size(); i += 5) {
+    loader.append((const uint8_t*)text.data() + i, std::min<size_t>(5, text.size() - i));
+  }
+  loader.end();
+  EXPECT_EQ(loader.frames(), 3u);
+  EXPECT_EQ(loader.skipped_lines(), 1u);
+  EXPECT_EQ(loaded.size(), 4u * CAN_LOG_BLOCK_SIZE);
+
+  // A binary log is taken as it is
+  std::vector<uint8_t> binary_copy = loaded;
+  loader.begin(true);
+  loader.append(binary_copy.data(), binary_copy.size());
+  loader.end();
+  EXPECT_EQ(loader.frames(), 3u);
+  EXPECT_EQ(loaded, binary_copy);
+}
+
+TEST_F(CanReplayTests, FramesGoOutAtTheRecordedPace) {
+  add_frame(0x100, 50000000);
+  add_frame(0x101, 50000250);
+  add_frame(0x102, 50010000);
+  CanReplayEngine engine = make_engine();
+
+  engine.start(100, false);
+  run(engine);
+  ASSERT_EQ(sent.size(), 3u);
+  EXPECT_EQ(sent[0].at_us, 1000000u);
+  EXPECT_EQ(sent[1].at_us, 1000250u);
+  EXPECT_EQ(sent[2].at_us, 1010000u);
+  EXPECT_EQ(engine.stats().error_max_us, 0u);
+  EXPECT_FALSE(engine.running());
+
+  // Twice as fast, and a tenth of the pace
+  sent.clear();
+  position = 0;
+  engine.start(200, false);
+  run(engine);
+  EXPECT_EQ(sent[2].at_us - sent[0].at_us, 5000u);
+  sent.clear();
+  position = 0;
+  engine.start(10, false);
+  run(engine);
+  EXPECT_EQ(sent[2].at_us - sent[0].at_us, 100000u);
+
+  // Out of range speeds are clamped
+  sent.clear();
+  position = 0;
+  engine.start(5000, false);
+  EXPECT_EQ(engine.speed(), CAN_REPLAY_MAX_SPEED);
+}
+
+TEST_F(CanReplayTests, LateFramesAreCounted) {
+  for (uint32_t i = 0; i < 10; i++) {
+    add_frame(0x100 + i, i * 10000);
+  }
+  CanReplayEngine engine = make_engine();
+  engine.start(100, false);
+  run(engine, 1500);
+
+  // Each wake up after the first frame was 1.5 ms late, the frames stay on schedule rather than drifting
+  const CanReplayStats& stats = engine.stats();
+  EXPECT_EQ(stats.frames_sent, 10u);
+  EXPECT_EQ(stats.timed_frames, 10u);
+  EXPECT_EQ(stats.error_max_us, 1500u);
+  EXPECT_EQ(stats.late_frames, 9u);
+  EXPECT_EQ(sent[9].at_us - sent[1].at_us, 80000u);
+}
+
+TEST_F(CanReplayTests, AsFastAsPossibleSendsInBatches) {
+  for (uint32_t i = 0; i < 40; i++) {
+    add_frame(0x100 + i, i * 1000000);
+  }
+  CanReplayEngine engine = make_engine();
+  engine.start(CAN_REPLAY_AS_FAST_AS_POSSIBLE, false);
+  EXPECT_EQ(engine.poll(), fake_now_us);
+  EXPECT_EQ(sent.size(), (size_t)CAN_REPLAY_BATCH);
+  run(engine);
+  EXPECT_EQ(sent.size(), 40u);
+  EXPECT_EQ(engine.stats().timed_frames, 0u);
+}
+
+TEST_F(CanReplayTests, LoopingStartsOverRightAfterTheLastFrame) {
+  add_frame(0x100, 1000);
+  add_frame(0x101, 2000);
+  CanReplayEngine engine = make_engine();
+  engine.start(100, true);
+
+  // Stop after the log went round a few times
+  while (sent.size() < 7) {
+    fake_now_us = engine.poll();
+  }
+  engine.stop();
+  EXPECT_EQ(engine.stats().loops, 3u);
+  EXPECT_EQ(sent[2].id, 0x100u);
+  EXPECT_EQ(sent[2].at_us, sent[1].at_us);
+  EXPECT_EQ(sent[3].at_us - sent[2].at_us, 1000u);
+  EXPECT_EQ(engine.poll(), CAN_REPLAY_DONE);
+}
+
+TEST_F(CanReplayTests, TimeGoingBackDoesNotStallTheReplay) {
+  add_frame(0x100, 5000000);
+  add_frame(0x101, 5001000);
+  add_frame(0x102, 1000);  // A second log put behind the first
+  add_frame(0x103, 3000);
+  CanReplayEngine engine = make_engine();
+  engine.start(100, false);
+  run(engine);
+  ASSERT_EQ(sent.size(), 4u);
+  EXPECT_EQ(sent[2].at_us, sent[1].at_us);
+  EXPECT_EQ(sent[3].at_us - sent[2].at_us, 2000u);
+}
+
+TEST_F(CanReplayTests, RefusedFramesAreOfferedAgain) {
+  for (uint32_t i = 0; i < 20; i++) {
+    add_frame(0x100 + i, i * 1000000);
+  }
+  CanReplayEngine engine = make_engine();
+  engine.start(CAN_REPLAY_AS_FAST_AS_POSSIBLE, false);
+  refuse_next = 2;
+  EXPECT_EQ(engine.poll(), fake_now_us + CAN_REPLAY_RETRY_US);
+  EXPECT_TRUE(sent.empty());
+  run(engine);
+  ASSERT_EQ(sent.size(), 20u);
+  EXPECT_EQ(sent[0].id, 0x100u);
+  EXPECT_EQ(engine.stats().retries, 2u);
+
+  // On time, the refused frame goes out late rather than being dropped
+  sent.clear();
+  position = 0;
+  engine.start(100, false);
+  fake_now_us = engine.poll();
+  refuse_next = 1;
+  run(engine);
+  ASSERT_EQ(sent.size(), 20u);
+  EXPECT_EQ(engine.stats().late_frames, 0u);
+  EXPECT_EQ(engine.stats().error_max_us, (uint32_t)CAN_REPLAY_RETRY_US);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "../../Software/src/communication/can/CanScheduler.h"
+#include "../../Software/src/inverter/CanInverterProtocol.h"
+
+static uint16_t peak_planned_load(const CanScheduler& scheduler) {
+  const uint16_t* load = scheduler.planned_load();
+  return *std::max_element(load, load + CanScheduler::CYCLE_MS);
+}
+
+TEST(CanSchedulerTests, JobsRunOncePerPeriodAtTheirPhase) {
+  CanScheduler scheduler;
+  std::vector<unsigned long> runs;
+  uint16_t phase = scheduler.add(&runs, 100, 1, [&](unsigned long now) { runs.push_back(now); }, 30);
+  EXPECT_EQ(phase, 30);
+
+  for (unsigned long ms = 0; ms < 350; ms++) {
+    scheduler.run(ms);
+  }
+  EXPECT_EQ(runs, std::vector<unsigned long>({30, 130, 230, 330}));
+}
+
+TEST(CanSchedulerTests, MissedPeriodsAreSkippedKeepingThePhase) {
+  CanScheduler scheduler;
+  std::vector<unsigned long> runs;
+  scheduler.add(&runs, 100, 1, [&](unsigned long now) { runs.push_back(now); }, 30);
+
+  // Core task held up for a few periods
+  scheduler.run(30);
+  scheduler.run(345);
+  scheduler.run(429);
+  scheduler.run(430);
+  EXPECT_EQ(runs, std::vector<unsigned long>({30, 345, 430}));
+}
+
+TEST(CanSchedulerTests, StaggeringSpreadsGroupsOverTheCycle) {
+  auto register_groups = [](CanScheduler& scheduler) {
+    // Ten 100ms frames and ten 1s frames, like a typical battery
+    for (int i = 0; i < 10; i++) {
+      scheduler.add(&scheduler, 100, 1, [](unsigned long) {});
+      scheduler.add(&scheduler, 1000, 1, [](unsigned long) {});
+    }
+  };
+
+  CanScheduler unstaggered;
+  unstaggered.set_staggering(false);
+  register_groups(unstaggered);
+  EXPECT_EQ(peak_planned_load(unstaggered), 20);
+
+  CanScheduler staggered;
+  register_groups(staggered);
+  EXPECT_EQ(peak_planned_load(staggered), 1);
+}
+
+TEST(CanSchedulerTests, RemovedJobsNoLongerRunOrCount) {
+  CanScheduler scheduler;
+  int kept = 0;
+  int removed = 0;
+  scheduler.add(&kept, 10, 1, [&](unsigned long) { kept++; });
+  scheduler.add(&removed, 10, 4, [&](unsigned long) { removed++; });
+  scheduler.remove(&removed);
+  EXPECT_EQ(scheduler.job_count(), 1u);
+  EXPECT_EQ(peak_planned_load(scheduler), 1);
+
+  for (unsigned long ms = 0; ms < 100; ms++) {
+    scheduler.run(ms);
+  }
+  EXPECT_EQ(kept, 10);
+  EXPECT_EQ(removed, 0);
+}
+
+class ScheduledInverter : public CanInverterProtocol {
+ public:
+  const char* name() { return "Scheduled"; }
+  void update_values() {}
+  void transmit_can(unsigned long) {}
+  void map_can_frame_to_variable(const CAN_frame&) {}
+  void setup_jobs(int& runs) {
+    schedule_can(10, 1, [&runs](unsigned long) { runs++; });
+  }
+};
+
+TEST(CanSchedulerTests, InverterJobsPauseWithCanSending) {
+  ScheduledInverter inverter;
+  int runs = 0;
+  inverter.setup_jobs(runs);
+
+  // Paused like transmit(): the generator does not run, its counters stand still
+  allowed_to_send_CAN = false;
+  for (unsigned long ms = 0; ms < 50; ms++) {
+    can_scheduler.run(ms);
+  }
+  EXPECT_EQ(runs, 0);
+
+  allowed_to_send_CAN = true;
+  for (unsigned long ms = 50; ms < 100; ms++) {
+    can_scheduler.run(ms);
+  }
+  EXPECT_EQ(runs, 5);
+  can_scheduler.remove(&inverter);
+}
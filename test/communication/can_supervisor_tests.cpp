@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include "../../Software/src/battery/TESLA-BATTERY.h"
+#include "../../Software/src/communication/can/CanSupervisor.h"
+
+static CAN_frame frame_with_id(uint32_t id) {
+  CAN_frame frame = {};
+  frame.ID = id;
+  frame.DLC = 8;
+  return frame;
+}
+
+TEST(CanSupervisorTests, CriticalIdMissingForAFewPeriodsHoldsStillAliveAtZero) {
+  uint8_t still_alive = 0;
+  CanSupervisionSet set;
+  set.renew(&still_alive);
+  set.expect(0x132, 20, true);
+  set.expect(0x352, 1000);
+
+  CanSupervisor supervisor;
+  supervisor.add(set, CAN_NATIVE);
+
+  supervisor.frame_received(frame_with_id(0x132), CAN_NATIVE, 1000);
+  EXPECT_EQ(still_alive, CAN_STILL_ALIVE);
+  EXPECT_TRUE(supervisor.fresh(0x132, CAN_NATIVE));
+
+  // Other IDs keep arriving, but the critical one stops
+  for (unsigned long ms = 1010; ms <= 1200; ms += 10) {
+    supervisor.frame_received(frame_with_id(0x352), CAN_NATIVE, ms);
+    supervisor.check(ms);
+  }
+  EXPECT_FALSE(supervisor.fresh(0x132, CAN_NATIVE));
+  EXPECT_TRUE(supervisor.any_critical_missing());
+  EXPECT_EQ(still_alive, 0);
+  EXPECT_EQ(supervisor.find(0x132, false, CAN_NATIVE)->timeouts, 1);
+
+  // Back again
+  supervisor.frame_received(frame_with_id(0x132), CAN_NATIVE, 1210);
+  supervisor.check(1210);
+  EXPECT_TRUE(supervisor.fresh(0x132, CAN_NATIVE));
+  EXPECT_FALSE(supervisor.any_critical_missing());
+  EXPECT_EQ(still_alive, CAN_STILL_ALIVE);
+}
+
+TEST(CanSupervisorTests, TimeoutIsAFewPeriodsWithALowerBound) {
+  CanSupervisionSet set;
+  set.expect(0x100, 10);
+  set.expect(0x200, 100);
+  CanSupervisor supervisor;
+  supervisor.add(set, CAN_NATIVE);
+
+  supervisor.frame_received(frame_with_id(0x100), CAN_NATIVE, 0);
+  supervisor.frame_received(frame_with_id(0x200), CAN_NATIVE, 0);
+  supervisor.check(CanSupervisor::MIN_TIMEOUT_MS);
+  EXPECT_TRUE(supervisor.fresh(0x100, CAN_NATIVE));
+  supervisor.check(CanSupervisor::MIN_TIMEOUT_MS + 1);
+  EXPECT_FALSE(supervisor.fresh(0x100, CAN_NATIVE));
+
+  supervisor.check(100 * CanSupervisor::MISSED_PERIODS);
+  EXPECT_TRUE(supervisor.fresh(0x200, CAN_NATIVE));
+  supervisor.check(100 * CanSupervisor::MISSED_PERIODS + 1);
+  EXPECT_FALSE(supervisor.fresh(0x200, CAN_NATIVE));
+}
+
+TEST(CanSupervisorTests, IdsAreSupervisedPerInterfaceAndNeverSeenIsNotMissing) {
+  CanSupervisionSet set;
+  set.expect(0x100, 10, true);
+  CanSupervisor supervisor;
+  supervisor.add(set, CAN_ADDON_MCP2515);
+
+  supervisor.frame_received(frame_with_id(0x100), CAN_NATIVE, 0);
+  supervisor.check(10000);
+  EXPECT_EQ(supervisor.find(0x100, false, CAN_NATIVE), nullptr);
+  EXPECT_FALSE(supervisor.find(0x100, false, CAN_ADDON_MCP2515)->seen);
+  EXPECT_FALSE(supervisor.any_critical_missing());
+
+  // Timestamps from the receive interrupt can be a little ahead of the checking task
+  supervisor.frame_received(frame_with_id(0x100), CAN_ADDON_MCP2515, 10002);
+  supervisor.check(10000);
+  EXPECT_TRUE(supervisor.fresh(0x100, CAN_ADDON_MCP2515));
+}
+
+TEST(CanSupervisorTests, IdDeclaredByTwoReceiversRenewsBoth) {
+  uint8_t battery_alive = 0;
+  uint8_t inverter_alive = 0;
+  CanSupervisionSet battery_set;
+  battery_set.renew(&battery_alive);
+  battery_set.expect(0x100, 100);
+  battery_set.expect(0x200, 10, true);
+  CanSupervisionSet inverter_set;
+  inverter_set.renew(&inverter_alive);
+  inverter_set.expect(0x100, 20, true);
+
+  CanSupervisor supervisor;
+  EXPECT_TRUE(supervisor.add(battery_set, CAN_NATIVE));
+  EXPECT_TRUE(supervisor.add(inverter_set, CAN_NATIVE));
+  ASSERT_EQ(supervisor.get_entries().size(), 2u);
+  // The shorter period of the two sets the deadline
+  EXPECT_EQ(supervisor.find(0x100, false, CAN_NATIVE)->timeout_ms, 20u * CanSupervisor::MISSED_PERIODS);
+  EXPECT_TRUE(supervisor.find(0x100, false, CAN_NATIVE)->critical);
+
+  supervisor.frame_received(frame_with_id(0x100), CAN_NATIVE, 0);
+  EXPECT_EQ(battery_alive, CAN_STILL_ALIVE);
+  EXPECT_EQ(inverter_alive, CAN_STILL_ALIVE);
+
+  // 0x100 going missing is critical for the inverter only, 0x200 still renews the battery
+  battery_alive = 0;
+  inverter_alive = 0;
+  for (unsigned long ms = 10; ms <= 200; ms += 10) {
+    supervisor.frame_received(frame_with_id(0x200), CAN_NATIVE, ms);
+    supervisor.check(ms);
+  }
+  EXPECT_EQ(battery_alive, CAN_STILL_ALIVE);
+  EXPECT_EQ(inverter_alive, 0);
+
+  supervisor.frame_received(frame_with_id(0x100), CAN_NATIVE, 210);
+  supervisor.check(210);
+  EXPECT_FALSE(supervisor.any_critical_missing());
+  EXPECT_EQ(inverter_alive, CAN_STILL_ALIVE);
+}
+
+TEST(CanSupervisorTests, TeslaBatteryIsRenewedBySupervisionOnly) {
+  datalayer = DataLayer();
+  TeslaModel3YBattery tesla(battery_chemistry_enum::NCA);
+  CanSupervisionSet set;
+  tesla.declare_supervised_can_ids(set);
+  CanSupervisor supervisor;
+  supervisor.add(set, CAN_NATIVE);
+
+  datalayer.battery.status.CAN_battery_still_alive = 0;
+  tesla.handle_incoming_can_frame(frame_with_id(0x132));
+  EXPECT_EQ(datalayer.battery.status.CAN_battery_still_alive, 0);
+
+  supervisor.frame_received(frame_with_id(0x132), CAN_NATIVE, 0);
+  EXPECT_EQ(datalayer.battery.status.CAN_battery_still_alive, CAN_STILL_ALIVE);
+  EXPECT_TRUE(supervisor.find(0x132, false, CAN_NATIVE)->critical);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../../Software/src/communication/can/CanTxQueue.h"
+#include "../../Software/src/devboard/utils/types.h"
+
+typedef CanTxQueue<CAN_classic_frame, 4> SmallQueue;
+
+static CAN_classic_frame frame_with_id(uint32_t id) {
+  CAN_classic_frame frame = {};
+  frame.ID = id;
+  frame.DLC = 8;
+  return frame;
+}
+
+// Drains into a list, the controller accepting at most 'room' frames
+static std::vector<uint32_t> drain_ids(SmallQueue& queue, uint64_t now_us, size_t room = 100) {
+  std::vector<uint32_t> ids;
+  queue.drain(now_us, [&](const CAN_classic_frame& frame) {
+    if (ids.size() >= room) {
+      return false;
+    }
+    ids.push_back(frame.ID);
+    return true;
+  });
+  return ids;
+}
+
+TEST(CanTxQueueTests, HigherPriorityIsSentFirstAndOrderKeptWithinPriority) {
+  SmallQueue queue(50000);
+  queue.enqueue(frame_with_id(0x300), CanTxPriority::Low, 0);
+  queue.enqueue(frame_with_id(0x200), CanTxPriority::Normal, 0);
+  queue.enqueue(frame_with_id(0x201), CanTxPriority::Normal, 0);
+  queue.enqueue(frame_with_id(0x100), CanTxPriority::Safety, 0);
+
+  EXPECT_EQ(drain_ids(queue, 10), std::vector<uint32_t>({0x100, 0x200, 0x201, 0x300}));
+  EXPECT_EQ(queue.depth(), 0);
+  EXPECT_EQ(queue.get_stats().sent, 4u);
+  EXPECT_EQ(queue.get_stats().peak_depth, 4);
+}
+
+TEST(CanTxQueueTests, FullQueueEvictsLowerPriorityOnly) {
+  SmallQueue queue(50000);
+  queue.enqueue(frame_with_id(0x300), CanTxPriority::Low, 0);
+  for (uint32_t id = 0x200; id < 0x203; id++) {
+    EXPECT_TRUE(queue.enqueue(frame_with_id(id), CanTxPriority::Normal, 0));
+  }
+
+  // Room is made by dropping the informational frame
+  EXPECT_FALSE(queue.enqueue(frame_with_id(0x100), CanTxPriority::Safety, 0));
+  EXPECT_EQ(queue.get_stats().dropped, 1u);
+  // Nothing below Normal is left, so the new frame is the one lost
+  EXPECT_FALSE(queue.enqueue(frame_with_id(0x203), CanTxPriority::Normal, 0));
+  EXPECT_EQ(queue.get_stats().dropped, 2u);
+
+  EXPECT_EQ(drain_ids(queue, 10), std::vector<uint32_t>({0x100, 0x200, 0x201, 0x202}));
+}
+
+TEST(CanTxQueueTests, RefusedFrameIsRetriedUntilItExpires) {
+  SmallQueue queue(1000);
+  queue.enqueue(frame_with_id(0x200), CanTxPriority::Normal, 0);
+  queue.enqueue(frame_with_id(0x201), CanTxPriority::Normal, 0);
+
+  // Controller full, the frame stays at the head
+  EXPECT_TRUE(drain_ids(queue, 500, 0).empty());
+  EXPECT_EQ(queue.depth(), 2);
+  EXPECT_EQ(queue.get_stats().retries, 1u);
+
+  // Still refused after the maximum wait, the head frame is given up
+  EXPECT_TRUE(drain_ids(queue, 1500, 0).empty());
+  EXPECT_EQ(queue.get_stats().expired, 1u);
+  EXPECT_EQ(queue.depth(), 1);
+
+  EXPECT_EQ(drain_ids(queue, 1600), std::vector<uint32_t>({0x201}));
+}
+
+TEST(CanTxQueueTests, LatencyIsMeasuredUntilTheControllerAccepts) {
+  SmallQueue queue(50000);
+  queue.enqueue(frame_with_id(0x200), CanTxPriority::Normal, 100);
+  queue.enqueue(frame_with_id(0x201), CanTxPriority::Normal, 300);
+  drain_ids(queue, 700);
+
+  EXPECT_EQ(queue.get_stats().latency_max_us, 600u);
+  EXPECT_EQ(queue.latency_avg_us(), 500u);
+
+  queue.reset_latency();
+  EXPECT_EQ(queue.get_stats().latency_max_us, 0u);
+  EXPECT_EQ(queue.latency_avg_us(), 0u);
+  EXPECT_EQ(queue.get_stats().sent, 2u);
+}
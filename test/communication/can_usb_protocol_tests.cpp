@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../../Software/src/communication/can/CanUsbProtocol.h"
+
+static uint32_t fake_clock_us() {
+  return 0x12345678;
+}
+
+static CAN_frame make_frame(uint32_t id, bool ext_ID, uint8_t length, bool fd = false) {
+  CAN_frame frame = {};
+  frame.ID = id;
+  frame.ext_ID = ext_ID;
+  frame.FD = fd;
+  frame.DLC = length;
+  for (uint8_t i = 0; i < length; i++) {
+    frame.data.u8[i] = 0x10 + i;
+  }
+  return frame;
+}
+
+// Feeds bytes to a session and collects everything it answers
+template <typename Session>
+static std::vector<uint8_t> send(Session& session, const std::vector<uint8_t>& bytes) {
+  std::vector<uint8_t> answer;
+  const CanUsbReply reply = [&](const uint8_t* data, size_t size) { answer.insert(answer.end(), data, data + size); };
+  for (uint8_t byte : bytes) {
+    session.receive(byte, reply);
+  }
+  return answer;
+}
+
+static std::vector<uint8_t> bytes_of(const std::string& text) {
+  return std::vector<uint8_t>(text.begin(), text.end());
+}
+
+TEST(GvretTests, EncodesClassicAndFdFrames) {
+  uint8_t out[CAN_USB_MAX_FRAME_LENGTH];
+  size_t size = gvret_encode_frame(make_frame(0x123, false, 2), 2, 0x01020304, out);
+  EXPECT_EQ(std::vector<uint8_t>(out, out + size),
+            (std::vector<uint8_t>{0xF1, 0x00, 0x04, 0x03, 0x02, 0x01, 0x23, 0x01, 0x00, 0x00, 0x22, 0x10, 0x11, 0x00}));
+
+  size = gvret_encode_frame(make_frame(0x18DAF110, true, 12, true), 1, 0, out);
+  ASSERT_EQ(size, 13u + 12u);
+  EXPECT_EQ(out[1], 20);
+  EXPECT_EQ(out[9], 0x98);  // Extended ID flag
+  EXPECT_EQ(out[10], 12);
+  EXPECT_EQ(out[11], 1);
+  EXPECT_EQ(out[12 + 11], 0x10 + 11);
+}
+
+TEST(GvretTests, AnswersTheHostHandshakeAndSkipsFramesToSend) {
+  GvretSession session(4, fake_clock_us);
+  EXPECT_FALSE(session.streaming());
+
+  EXPECT_TRUE(send(session, {0xE7, 0xE7}).empty());
+  EXPECT_TRUE(session.streaming());
+
+  EXPECT_EQ(send(session, {0xF1, 0x0C}), (std::vector<uint8_t>{0xF1, 0x0C, 4}));
+  EXPECT_EQ(send(session, {0xF1, 0x09}), (std::vector<uint8_t>{0xF1, 0x09, 0xDE, 0xAD}));
+  EXPECT_EQ(send(session, {0xF1, 0x01}), (std::vector<uint8_t>{0xF1, 0x01, 0x78, 0x56, 0x34, 0x12}));
+  EXPECT_EQ(send(session, {0xF1, 0x06}).size(), 12u);
+  EXPECT_EQ(send(session, {0xF1, 0x07}).size(), 8u);
+
+  // A frame the host wants sent, with bytes that look like commands in it, then a keepalive
+  std::vector<uint8_t> answer =
+      send(session, {0xF1, 0x00, 0xF1, 0x09, 0x00, 0x00, 0x00, 0x02, 0xF1, 0x09, 0xF1, 0x00, 0xF1, 0x09});
+  EXPECT_EQ(answer, (std::vector<uint8_t>{0xF1, 0x09, 0xDE, 0xAD}));
+
+  // Bus setup carries 8 bytes of parameters
+  answer = send(session, {0xF1, 0x05, 0xF1, 0x09, 0xF1, 0x09, 0xF1, 0x09, 0xF1, 0x09, 0xF1, 0x0C});
+  EXPECT_EQ(answer, (std::vector<uint8_t>{0xF1, 0x0C, 4}));
+}
+
+TEST(SlcanTests, EncodesClassicAndFdFrames) {
+  uint8_t out[CAN_USB_MAX_FRAME_LENGTH];
+  size_t size = slcan_encode_frame(make_frame(0x7FF, false, 3), -1, out);
+  EXPECT_EQ(std::string((char*)out, size), "t7FF3101112\r");
+
+  size = slcan_encode_frame(make_frame(0x1ABCDEF, true, 0), 0x1234, out);
+  EXPECT_EQ(std::string((char*)out, size), "T01ABCDEF01234\r");
+
+  // 10 bytes do not exist as CAN-FD length, sent as 12 padded with zeros
+  size = slcan_encode_frame(make_frame(0x100, false, 10, true), -1, out);
+  EXPECT_EQ(std::string((char*)out, size), "d1009101112131415161718190000\r");
+}
+
+TEST(SlcanTests, OpensOnCommandAndRefusesToSend) {
+  SlcanSession session;
+  EXPECT_FALSE(session.streaming());
+
+  EXPECT_EQ(send(session, bytes_of("S6\rZ1\rO\r")), bytes_of("\r\r\r"));
+  EXPECT_TRUE(session.streaming());
+  EXPECT_TRUE(session.timestamps());
+  EXPECT_EQ(send(session, bytes_of("V\r")), bytes_of("V1013\r"));
+  EXPECT_EQ(send(session, bytes_of("t1230\r")), (std::vector<uint8_t>{7}));
+
+  EXPECT_EQ(send(session, bytes_of("C\r")), bytes_of("\r"));
+  EXPECT_FALSE(session.streaming());
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Software/src/devboard/utils/deferred_log.h"
+
+// What the logging task would output for the record
+template <typename... Args>
+static std::string render(const char* format, Args... args) {
+  DeferredLogRecord record(0, format, args...);
+  char text[DEFERRED_LOG_MAX_LINE];
+  const size_t length = deferred_log_render(record.data(), text, sizeof(text));
+  EXPECT_EQ(length, strlen(text));
+  return std::string(text, length);
+}
+
+template <typename... Args>
+static std::string direct(const char* format, Args... args) {
+  char text[DEFERRED_LOG_MAX_LINE];
+  snprintf(text, sizeof(text), format, args...);
+  return text;
+}
+
+typedef DeferredLogBuffers<2, 256> SmallBuffers;
+
+static std::string render_all(SmallBuffers& buffers) {
+  std::string text;
+  while (buffers.render_next([&](const char* data, size_t length) { text.append(data, length); })) {
+  }
+  return text;
+}
+
+TEST(DeferredLogTests, RendersLikePrintf) {
+  EXPECT_EQ(render("SOC %d%%, %u cells\n", -5, 96u), direct("SOC %d%%, %u cells\n", -5, 96u));
+  EXPECT_EQ(render("ID %03X [%u] %02x", 0x1Fu, (uint8_t)8, (uint8_t)0xAB),
+            direct("ID %03X [%u] %02x", 0x1Fu, 8u, 0xABu));
+  EXPECT_EQ(render("%.2f V, %8.3e A, %g", 3.14159f, -0.00125, 2.5),
+            direct("%.2f V, %8.3e A, %g", 3.14159, -0.00125, 2.5));
+  EXPECT_EQ(render("%s/%-6s|%c", "bms", "ok", 'x'), direct("%s/%-6s|%c", "bms", "ok", 'x'));
+  EXPECT_EQ(render("[%.*s] %*d", 3, "abcdef", 5, 42), direct("[%.*s] %*d", 3, "abcdef", 5, 42));
+  EXPECT_EQ(render("%lu ms, %lld", 123456ul, -9000000000ll), direct("%lu ms, %lld", 123456ul, -9000000000ll));
+  EXPECT_EQ(render("%hhu %hd", 300, 70000), direct("%hhu %hd", 300, 70000));
+  EXPECT_EQ(render("%d", true), "1");
+}
+
+TEST(DeferredLogTests, MismatchedArgumentsAreShownAsWritten) {
+  EXPECT_EQ(render("%d and %s", 1), "1 and %s");
+  EXPECT_EQ(render("%s", 5), "%s");
+  EXPECT_EQ(render("%d %q", 7, 8), "7 %q");
+}
+
+TEST(DeferredLogTests, StringArgumentsAreCopied) {
+  std::string temporary = "Wi-Fi connected";
+  DeferredLogRecord record(0, "%s!", temporary.c_str());
+  temporary.assign(temporary.size(), '#');
+
+  char text[DEFERRED_LOG_MAX_LINE];
+  deferred_log_render(record.data(), text, sizeof(text));
+  EXPECT_STREQ(text, "Wi-Fi connected!");
+
+  // Long strings are cut
+  const std::string long_string(200, 'a');
+  EXPECT_EQ(render("%s", long_string.c_str()), std::string(DEFERRED_LOG_MAX_STRING, 'a'));
+}
+
+TEST(DeferredLogTests, KeepsLinesWholeAndInTimeOrder) {
+  SmallBuffers buffers;
+  int task_a;
+  int task_b;
+
+  ASSERT_TRUE(buffers.write(&task_a, DeferredLogRecord(1000, "Battery ")));
+  ASSERT_TRUE(buffers.write(&task_b, DeferredLogRecord(1001, "Inverter %d\n", 2)));
+  ASSERT_TRUE(buffers.write(&task_a, DeferredLogRecord(1002, "voltage %d V\n", 350)));
+  ASSERT_TRUE(buffers.write(&task_a, DeferredLogRecord(12345678, "late\n")));
+
+  EXPECT_EQ(render_all(buffers),
+            "       1.000 Battery voltage 350 V\n"
+            "       1.001 Inverter 2\n"
+            "   12345.678 late\n");
+}
+
+TEST(DeferredLogTests, TasksBeyondTheRingsUseTheSharedOne) {
+  SmallBuffers buffers;
+  int tasks[3];
+  EXPECT_TRUE(buffers.write(&tasks[0], DeferredLogRecord(1, "a\n")));
+  EXPECT_TRUE(buffers.write(&tasks[1], DeferredLogRecord(2, "b\n")));
+  EXPECT_FALSE(buffers.write(&tasks[2], DeferredLogRecord(3, "c\n")));
+  buffers.write_shared(DeferredLogRecord(0, "c\n"));
+
+  EXPECT_EQ(render_all(buffers), "       0.000 c\n       0.001 a\n       0.002 b\n");
+}
+
+TEST(DeferredLogTests, FullRingsDropAndCount) {
+  SmallBuffers buffers;
+  int task;
+  for (int i = 0; i < 20; i++) {
+    buffers.write(&task, DeferredLogRecord(i, "message number %d\n", i));
+  }
+  EXPECT_GT(buffers.dropped(), 0u);
+
+  const std::string text = render_all(buffers);
+  EXPECT_EQ(text.find("       0.000 message number 0\n"), 0u);
+  EXPECT_EQ(std::count(text.begin(), text.end(), '\n') + buffers.dropped(), 20u);
+}
+
+// Tasks log at the same time as the logging task renders, like on the device
+TEST(DeferredLogTests, ConcurrentTasksKeepTheirLinesInOrder) {
+  static DeferredLogBuffers<4, 1024> buffers;
+  const int tasks = 4;
+  const int per_task = 20000;
+  std::atomic<int> finished{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < tasks; t++) {
+    threads.emplace_back([t, &finished] {
+      for (int i = 0; i < per_task; i++) {
+        buffers.write(&buffers + t + 1, DeferredLogRecord(i, "task %d line %d\n", t, i));
+      }
+      finished++;
+    });
+  }
+
+  int last[tasks] = {-1, -1, -1, -1};
+  uint32_t lines = 0;
+  bool intact = true;
+  const auto check = [&](const char* text, size_t length) {
+    int t;
+    int i;
+    intact = intact && length > 13 && text[length - 1] == '\n' &&
+             sscanf(text + 13, "task %d line %d", &t, &i) == 2 && t >= 0 && t < tasks && i > last[t];
+    if (intact) {
+      last[t] = i;
+      lines++;
+    }
+  };
+  while (finished < tasks) {
+    buffers.render_next(check);
+  }
+  while (buffers.render_next(check)) {
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_TRUE(intact);
+  EXPECT_EQ(lines + buffers.dropped(), (uint32_t)(tasks * per_task));
+}
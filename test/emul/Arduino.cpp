@@ -14,13 +14,23 @@ void delayMicroseconds(unsigned long us) {}
 int digitalRead(uint8_t pin) {
   return 0;
 }
-void digitalWrite(uint8_t pin, uint8_t val) {}
+void (*emulated_digital_write)(uint8_t pin, uint8_t val) = nullptr;
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (emulated_digital_write) {
+    emulated_digital_write(pin, val);
+  }
+}
 
 unsigned long micros() {
   return 0;
 }
 void pinMode(uint8_t pin, uint8_t mode) {}
 
+float temperatureRead() {
+  return 0;
+}
+
 int max(int a, int b) {
   return (a > b) ? a : b;
 }
@@ -92,6 +92,19 @@ inline const T& max(const T& a, const T& b) {
 void pinMode(uint8_t pin, uint8_t mode);
 void digitalWrite(uint8_t pin, uint8_t val);
 int digitalRead(uint8_t pin);
+// Lets host tools see pin changes, e.g. the chip select of an emulated SPI device
+extern void (*emulated_digital_write)(uint8_t pin, uint8_t val);
+
+#define INPUT_PULLUP 0x05
+#define NOT_AN_INTERRUPT -1
+inline int digitalPinToInterrupt(uint8_t pin) {
+  return pin;
+}
+inline void attachInterrupt(uint8_t interruptNumber, void (*isr)(void), int mode) {}
+inline void detachInterrupt(uint8_t interruptNumber) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
 inline int analogRead(uint8_t pin) {
   (void)pin;
   return 0;  // Return 0 for predictable tests
@@ -122,6 +135,8 @@ void delay(unsigned long ms);
 void delayMicroseconds(unsigned long us);
 int max(int a, int b);
 
+float temperatureRead();
+
 bool ledcAttachChannel(uint8_t pin, uint32_t freq, uint8_t resolution, int8_t channel);
 bool ledcWrite(uint8_t pin, uint32_t duty);
 
@@ -132,6 +147,7 @@ class ESPClass {
     // that retrieves the flash chip size.
     return 4 * 1024 * 1024;  // Example: returning 4MB
   }
+  uint32_t getFreeHeap() { return 0; }
 };
 
 extern ESPClass ESP;
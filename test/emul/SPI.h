@@ -0,0 +1,35 @@
+#ifndef SPI_H
+#define SPI_H
+
+#include <stdint.h>
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+class SPISettings {
+ public:
+  SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0) : clock(clock) {}
+  uint32_t clock;
+};
+
+// Host stand-in for an SPI bus without any device on it. Host tools emulate a device by overriding the transfers.
+class SPIClass {
+ public:
+  virtual ~SPIClass() {}
+  virtual void beginTransaction(SPISettings settings) {}
+  virtual void endTransaction() {}
+  virtual uint8_t transfer(uint8_t data) { return 0; }
+  virtual void transferBytes(const uint8_t* data, uint8_t* out, uint32_t size) {
+    for (uint32_t i = 0; i < size; i++) {
+      const uint8_t in = transfer(data ? data[i] : 0xFF);
+      if (out) {
+        out[i] = in;
+      }
+    }
+  }
+  // Sends the buffer and replaces it with the bytes received
+  void transfer(void* data, uint32_t size) { transferBytes((const uint8_t*)data, (uint8_t*)data, size); }
+  void usingInterrupt(uint8_t interruptNumber) {}
+};
+
+#endif
@@ -1,9 +1,34 @@
 #include "../../Software/src/communication/Transmitter.h"
 #include "../../Software/src/communication/can/comm_can.h"
 
-void transmit_can_frame_to_interface(const CAN_frame* tx_frame, CAN_Interface interface) {}
+// Frames handed to the CAN driver, for host tools measuring what the protocols send
+uint32_t emulated_can_tx_frames = 0;
+
+// Set by host tools that drive the protocols like the core task does
+void (*emulated_can_transmit)(const CAN_frame& frame, CAN_Interface interface) = nullptr;
+void (*emulated_register_can_receiver)(CanReceiver* receiver, CAN_Interface interface) = nullptr;
+void (*emulated_register_transmitter)(Transmitter* transmitter) = nullptr;
+
+void transmit_can_frame_to_interface(const CAN_frame* tx_frame, CAN_Interface interface, CanTxPriority priority) {
+  emulated_can_tx_frames++;
+  if (emulated_can_transmit) {
+    emulated_can_transmit(*tx_frame, interface);
+  }
+}
 
-void register_can_receiver(CanReceiver* receiver, CAN_Interface interface, CAN_Speed speed) {}
+void transmit_can_frame_to_interface(const CAN_classic_frame* tx_frame, CAN_Interface interface,
+                                     CanTxPriority priority) {
+  emulated_can_tx_frames++;
+  if (emulated_can_transmit) {
+    emulated_can_transmit(to_can_frame(*tx_frame), interface);
+  }
+}
+
+void register_can_receiver(CanReceiver* receiver, CAN_Interface interface, CAN_Speed speed) {
+  if (emulated_register_can_receiver) {
+    emulated_register_can_receiver(receiver, interface);
+  }
+}
 
 bool change_can_speed(CAN_Interface interface, CAN_Speed speed) {
   return true;
@@ -17,6 +42,10 @@ char const* getCANInterfaceName(CAN_Interface) {
   return "Foobar";
 }
 
-void register_transmitter(Transmitter* transmitter) {}
+void register_transmitter(Transmitter* transmitter) {
+  if (emulated_register_transmitter) {
+    emulated_register_transmitter(transmitter);
+  }
+}
 
-void dump_can_frame(CAN_frame& frame, CAN_Interface interface, frameDirection msgDir) {}
+void dump_can_frame(const CAN_frame& frame, CAN_Interface interface, frameDirection msgDir) {}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include "../Software/src/devboard/utils/log_levels.h"
+#include "../Software/src/devboard/utils/logging.h"
+
+// Counts how often a log call evaluated its arguments
+static int evaluated = 0;
+static int argument() {
+  return ++evaluated;
+}
+
+class LogLevelsTests : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    for (int module = 0; module < LOG_MODULE_COUNT; module++) {
+      set_log_level((LogModule)module, LOG_LEVEL_INFO);
+    }
+    set_log_output_active(false);
+  }
+};
+
+TEST_F(LogLevelsTests, NothingIsLoggedWithoutAnOutput) {
+  set_log_output_active(false);
+  set_log_level(LOG_MODULE_INVERTER, LOG_LEVEL_VERBOSE);
+  EXPECT_FALSE(log_enabled(LOG_LEVEL_ERROR, LOG_MODULE_INVERTER));
+
+  set_log_output_active(true);
+  EXPECT_TRUE(log_enabled(LOG_LEVEL_ERROR, LOG_MODULE_INVERTER));
+  EXPECT_TRUE(log_enabled(LOG_LEVEL_DEBUG, LOG_MODULE_INVERTER));
+  EXPECT_EQ(get_log_level(LOG_MODULE_INVERTER), LOG_LEVEL_VERBOSE);
+}
+
+TEST_F(LogLevelsTests, EachModuleHasItsOwnThreshold) {
+  set_log_output_active(true);
+  set_log_level(LOG_MODULE_CONTACTORS, LOG_LEVEL_WARNING);
+  set_log_level(LOG_MODULE_CAN, LOG_LEVEL_NONE);
+
+  EXPECT_TRUE(log_enabled(LOG_LEVEL_WARNING, LOG_MODULE_CONTACTORS));
+  EXPECT_FALSE(log_enabled(LOG_LEVEL_INFO, LOG_MODULE_CONTACTORS));
+  EXPECT_FALSE(log_enabled(LOG_LEVEL_ERROR, LOG_MODULE_CAN));
+  EXPECT_TRUE(log_enabled(LOG_LEVEL_INFO, LOG_MODULE_GENERAL));
+  EXPECT_FALSE(log_enabled(LOG_LEVEL_DEBUG, LOG_MODULE_GENERAL));
+}
+
+TEST_F(LogLevelsTests, DisabledCallsDoNotEvaluateTheirArguments) {
+  set_log_output_active(true);
+  set_log_level(LOG_MODULE_BATTERY, LOG_LEVEL_INFO);
+  evaluated = 0;
+
+  LOG_D(BATTERY, "%d\n", argument());
+  EXPECT_EQ(evaluated, 0);
+  LOG_I(BATTERY, "%d\n", argument());
+  LOG_E(BATTERY, "%d\n", argument());
+  EXPECT_EQ(evaluated, 2);
+
+  // Above LOG_COMPILED_LEVEL the call is not there at all, whatever the threshold
+  set_log_level(LOG_MODULE_BATTERY, LOG_LEVEL_VERBOSE);
+  static_assert(LOG_COMPILED_LEVEL < LOG_LEVEL_VERBOSE);
+  LOG_V(BATTERY, "%d\n", argument());
+  EXPECT_EQ(evaluated, 2);
+}
+
+TEST_F(LogLevelsTests, ModulesHaveNamesAndSettings) {
+  for (int module = 0; module < LOG_MODULE_COUNT; module++) {
+    EXPECT_STRNE(log_module_name((LogModule)module), "");
+    // Stored settings keys are limited to 15 characters
+    EXPECT_LE(strlen(log_module_setting((LogModule)module)), 15u);
+  }
+  EXPECT_STREQ(log_module_setting(LOG_MODULE_INVERTER), "LOGINVERTER");
+}
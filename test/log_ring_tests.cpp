@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../Software/src/devboard/sdcard/can_log_record.h"
+#include "../Software/src/devboard/utils/log_ring.h"
+
+typedef LogRing<8> SmallRing;
+
+// Reads everything after since as one string per entry
+static std::vector<std::string> read_all(const SmallRing& ring, uint32_t& since, uint32_t& lost) {
+  std::vector<std::string> entries;
+  since = ring.read(since, lost, [&](LogRingKind, const uint8_t* data, size_t size) {
+    entries.push_back(std::string((const char*)data, size));
+    return true;
+  });
+  return entries;
+}
+
+TEST(LogRingTests, ReadsTheEntriesAfterASequence) {
+  SmallRing ring;
+  uint32_t since = ring.next_sequence();
+  uint32_t lost = 0;
+  EXPECT_TRUE(read_all(ring, since, lost).empty());
+
+  ring.push_text("one", 3);
+  ring.push_text("two", 3);
+  EXPECT_EQ(read_all(ring, since, lost), (std::vector<std::string>{"one", "two"}));
+
+  ring.push_text("three", 5);
+  EXPECT_EQ(read_all(ring, since, lost), (std::vector<std::string>{"three"}));
+  EXPECT_EQ(lost, 0u);
+
+  // Reading stops at the entry the output refuses, and goes on from there the next time
+  ring.push_text("four", 4);
+  ring.push_text("five", 4);
+  std::vector<std::string> entries;
+  since = ring.read(since, lost, [&](LogRingKind, const uint8_t* data, size_t size) {
+    if (!entries.empty()) {
+      return false;
+    }
+    entries.push_back(std::string((const char*)data, size));
+    return true;
+  });
+  EXPECT_EQ(entries, (std::vector<std::string>{"four"}));
+  EXPECT_EQ(read_all(ring, since, lost), (std::vector<std::string>{"five"}));
+}
+
+TEST(LogRingTests, CountsOverwrittenEntriesAsLost) {
+  SmallRing ring;
+  uint32_t since = ring.next_sequence();
+  for (int i = 0; i < 11; i++) {
+    const std::string text = std::to_string(i);
+    ring.push_text(text.c_str(), text.size());
+  }
+  uint32_t lost = 0;
+  EXPECT_EQ(read_all(ring, since, lost), (std::vector<std::string>{"3", "4", "5", "6", "7", "8", "9", "10"}));
+  EXPECT_EQ(lost, 3u);
+
+  // Long text is split into pieces that fit a slot
+  const std::string text(LOG_RING_PAYLOAD + 5, 'x');
+  ring.push_text(text.c_str(), text.size());
+  EXPECT_EQ(read_all(ring, since, lost),
+            (std::vector<std::string>{std::string(LOG_RING_PAYLOAD, 'x'), std::string(5, 'x')}));
+}
+
+TEST(LogRingTests, KeepsFdRecordsWholeOrDropsThem) {
+  SmallRing ring;
+  CAN_frame frame = {};
+  frame.FD = true;
+  frame.DLC = 64;
+  frame.ID = 0x123;
+  for (uint8_t i = 0; i < 64; i++) {
+    frame.data.u8[i] = i;
+  }
+  uint8_t record[CAN_LOG_MAX_RECORD_SIZE];
+  const size_t size = can_log_encode(frame, CAN_NATIVE, MSG_RX, 1000, record);
+  ASSERT_EQ(size, (size_t)CAN_LOG_MAX_RECORD_SIZE);
+
+  uint32_t since = ring.next_sequence();
+  ring.push(LOG_RING_CAN, record, size);
+  ring.push_text("hi", 2);
+
+  uint32_t lost = 0;
+  std::vector<LogRingKind> kinds;
+  std::string line;
+  since = ring.read(since, lost, [&](LogRingKind kind, const uint8_t* data, size_t) {
+    kinds.push_back(kind);
+    if (kind == LOG_RING_CAN) {
+      char text[CAN_LOG_MAX_LINE_LENGTH];
+      line.assign(text, can_log_format_text(data, text));
+    }
+    return true;
+  });
+  EXPECT_EQ(kinds, (std::vector<LogRingKind>{LOG_RING_CAN, LOG_RING_TEXT}));
+  EXPECT_EQ(line.substr(0, 28), "(0.001000) RX0 123 [64] 00 0");
+  EXPECT_EQ(lost, 0u);
+
+  // Only the last part of the record is still there, the reader skips it instead of returning half a frame
+  const uint32_t record_start = ring.next_sequence();
+  ring.push(LOG_RING_CAN, record, size);
+  for (int i = 0; i < 7; i++) {
+    ring.push_text("x", 1);
+  }
+  lost = 0;
+  since = record_start;
+  std::vector<std::string> entries = read_all(ring, since, lost);
+  EXPECT_EQ(entries, std::vector<std::string>(7, "x"));
+  EXPECT_EQ(lost, 4u);
+}
+
+TEST(LogRingTests, StartsOverOnASequenceFromBeforeAReboot) {
+  SmallRing ring;
+  ring.push_text("new", 3);
+  uint32_t since = 1000;
+  uint32_t lost = 0;
+  EXPECT_EQ(read_all(ring, since, lost), (std::vector<std::string>{"new"}));
+  EXPECT_EQ(since, ring.next_sequence());
+  EXPECT_EQ(lost, 0u);
+}
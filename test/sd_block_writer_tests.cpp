@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+#include "../Software/src/devboard/sdcard/sd_block_writer.h"
+
+static uint64_t fake_now_us = 0;
+
+static uint64_t fake_clock_us() {
+  return fake_now_us;
+}
+
+// Files kept in memory, every write is recorded with its size
+class MemoryStorage : public SdLogStorage {
+ public:
+  bool open(const char* path) override {
+    current = path;
+    return true;
+  }
+  void close() override { current.clear(); }
+  uint64_t size() override { return files[current].size(); }
+  size_t write(const uint8_t* data, size_t size) override {
+    fake_now_us += 100;  // Every write takes a while
+    files[current].insert(files[current].end(), data, data + size);
+    writes.push_back(size);
+    return size;
+  }
+  void flush() override { flushes++; }
+  bool exists(const char* path) override { return files.count(path) != 0; }
+  bool rename(const char* from, const char* to) override {
+    files[to] = files[from];
+    files.erase(from);
+    return true;
+  }
+  bool remove(const char* path) override { return files.erase(path) != 0; }
+
+  std::map<std::string, std::vector<uint8_t>> files;
+  std::string current;
+  std::vector<size_t> writes;
+  int flushes = 0;
+};
+
+class SdBlockWriterTests : public ::testing::Test {
+ protected:
+  void SetUp() override { fake_now_us = 1000000; }
+
+  MemoryStorage storage;
+  SdBlockWriter writer{storage, "/canlog.bin", fake_clock_us};
+};
+
+TEST_F(SdBlockWriterTests, WritesWholeBlocksAlignedToTheFileAndFlushesOnTime) {
+  // An existing file that does not end on a block boundary
+  storage.files["/canlog.bin"] = std::vector<uint8_t>(100, 0xAA);
+
+  SdBlockWriterConfig config;
+  config.block_size = 1024;
+  config.flush_interval_ms = 1000;
+  ASSERT_TRUE(writer.begin(config));
+
+  std::vector<uint8_t> record(24, 0x55);
+  for (int i = 0; i < 100; i++) {
+    writer.append(record.data(), record.size());
+    writer.poll();
+  }
+  // 2400 bytes: the first block tops the file up to 1024, then one full block
+  EXPECT_EQ(storage.writes, (std::vector<size_t>{924, 1024}));
+  EXPECT_EQ(storage.flushes, 0);
+
+  fake_now_us += 1000000;
+  writer.poll();
+  EXPECT_EQ(storage.writes.back(), 2400u - 924u - 1024u);
+  EXPECT_EQ(storage.flushes, 1);
+  EXPECT_EQ(storage.files["/canlog.bin"].size(), 2500u);
+  EXPECT_EQ(writer.stats().bytes_written, 2400u);
+  EXPECT_EQ(writer.stats().write_latency_max_us, 100u);
+  EXPECT_EQ(writer.stats().dropped_bytes, 0u);
+
+  // Nothing new, nothing to flush
+  fake_now_us += 5000000;
+  writer.poll();
+  EXPECT_EQ(storage.flushes, 1);
+}
+
+TEST_F(SdBlockWriterTests, RotatesOnSizeBetweenRecordsKeepingBoundedFiles) {
+  SdBlockWriterConfig config;
+  config.block_size = 512;
+  config.rotate_size = 1000;
+  config.retained_files = 2;
+  ASSERT_TRUE(writer.begin(config));
+
+  std::vector<uint8_t> record(24);
+  for (int file = 0; file < 4; file++) {
+    record.assign(24, file);
+    for (int i = 0; i < 42; i++) {  // 1008 bytes
+      writer.append(record.data(), 12);
+      writer.poll(false);  // In the middle of a record
+      writer.append(record.data() + 12, 12);
+      writer.poll();
+    }
+  }
+  writer.close();
+
+  EXPECT_EQ(writer.stats().files_rotated, 4u);
+  EXPECT_EQ(storage.files.size(), 2u);
+  EXPECT_EQ(storage.files["/canlog.1.bin"], std::vector<uint8_t>(1008, 3));
+  EXPECT_EQ(storage.files["/canlog.2.bin"], std::vector<uint8_t>(1008, 2));
+
+  writer.remove_all();
+  EXPECT_TRUE(storage.files.empty());
+}
+
+TEST_F(SdBlockWriterTests, RotatesOnAge) {
+  SdBlockWriterConfig config;
+  config.block_size = 512;
+  config.rotate_interval_ms = 60000;
+  ASSERT_TRUE(writer.begin(config));
+
+  writer.poll();
+  fake_now_us += 120000000;
+  writer.poll();
+  EXPECT_EQ(writer.stats().files_rotated, 0u);  // Nothing was logged yet
+
+  const uint8_t text[] = "hello\n";
+  writer.append(text, sizeof(text) - 1);
+  fake_now_us += 59000000;
+  writer.poll();
+  EXPECT_EQ(writer.stats().files_rotated, 0u);
+  fake_now_us += 1000000;
+  writer.poll();
+  EXPECT_EQ(writer.stats().files_rotated, 1u);
+  EXPECT_EQ(storage.files["/canlog.1.bin"].size(), 6u);
+}
+
+TEST(SdBlockWriterNameTests, NumberGoesBeforeTheExtension) {
+  char name[32];
+  SdBlockWriter::rotated_name("/canlog.bin", 3, name, sizeof(name));
+  EXPECT_STREQ(name, "/canlog.3.bin");
+  SdBlockWriter::rotated_name("/logs.d/log", 1, name, sizeof(name));
+  EXPECT_STREQ(name, "/logs.d/log.1");
+}
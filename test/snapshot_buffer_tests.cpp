@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "../Software/src/datalayer/datalayer.h"
+#include "../Software/src/devboard/utils/snapshot_buffer.h"
+
+// Every word holds the same value, a torn copy mixes two of them
+struct Stamped {
+  uint32_t words[256];
+
+  void fill(uint32_t value) {
+    for (auto& word : words) {
+      word = value;
+    }
+  }
+  bool consistent() const {
+    for (auto word : words) {
+      if (word != words[0]) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+TEST(SnapshotBufferTests, ReadsTheLatestPublishedValue) {
+  SnapshotBuffer<DataLayer> buffer;
+  DataLayer copy;
+  copy.battery.status.voltage_dV = 1234;
+  // Nothing published yet, the copy is left as it was
+  EXPECT_EQ(buffer.read(copy), 0u);
+  EXPECT_EQ(copy.battery.status.voltage_dV, 1234);
+
+  DataLayer live;
+  live.battery.status.voltage_dV = 3700;
+  buffer.publish(live);
+  live.battery.status.voltage_dV = 3710;
+  buffer.publish(live);
+  // Changes after publishing are not seen until the next publish
+  live.battery.status.voltage_dV = 3720;
+
+  EXPECT_EQ(buffer.read(copy), 2u);
+  EXPECT_EQ(copy.battery.status.voltage_dV, 3710);
+  EXPECT_EQ(buffer.generation(), 2u);
+
+  // Or only a part of it
+  DATALAYER_BATTERY_STATUS_TYPE status;
+  EXPECT_EQ(buffer.read_with([&status](const DataLayer& snapshot) { status = snapshot.battery.status; }), 2u);
+  EXPECT_EQ(status.voltage_dV, 3710);
+  EXPECT_EQ(buffer.retries(), 0u);
+}
+
+// A writer publishing as fast as it can, like a core task that never waits, against two reader tasks
+TEST(SnapshotBufferTests, ConcurrentReadersNeverSeeATornSnapshot) {
+  static SnapshotBuffer<Stamped> buffer;
+  static Stamped value;
+  std::atomic<bool> done{false};
+
+  std::thread writer([&] {
+    for (uint32_t i = 1; i <= 200000; i++) {
+      value.fill(i);
+      buffer.publish(value);
+    }
+    done = true;
+  });
+
+  auto reader = [&] {
+    static thread_local Stamped copy;
+    uint32_t previous = 0;
+    uint32_t reads = 0;
+    while (!done || reads == 0) {
+      const uint32_t generation = buffer.read(copy);
+      if (generation == 0) {
+        continue;
+      }
+      ASSERT_TRUE(copy.consistent());
+      ASSERT_EQ(copy.words[0], generation);
+      ASSERT_GE(generation, previous);
+      previous = generation;
+      reads++;
+    }
+  };
+  std::thread other_reader(reader);
+  reader();
+  other_reader.join();
+  writer.join();
+
+  Stamped last;
+  EXPECT_EQ(buffer.read(last), 200000u);
+  EXPECT_EQ(last.words[255], 200000u);
+}
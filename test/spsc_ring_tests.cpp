@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "../Software/src/devboard/utils/spsc_ring.h"
+#include "../Software/src/devboard/utils/types.h"
+
+TEST(SpscRingTests, KeepsOrderAndRefusesWhenFull) {
+  SpscRing<int, 4> ring;
+  int value = 0;
+  EXPECT_FALSE(ring.pop(value));
+
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(ring.push(i));
+  }
+  EXPECT_FALSE(ring.push(4));
+  EXPECT_EQ(ring.count(), 4u);
+  EXPECT_EQ(ring.peak_count(), 4u);
+
+  for (int i = 0; i < 4; i++) {
+    ASSERT_TRUE(ring.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_EQ(ring.peek(), nullptr);
+  EXPECT_EQ(ring.count(), 0u);
+}
+
+TEST(SpscRingTests, SlotsAreFilledAndConsumedInPlace) {
+  SpscRing<CAN_frame, 8> ring;
+  CAN_frame* slot = ring.reserve();
+  ASSERT_NE(slot, nullptr);
+  slot->ID = 0x123;
+  slot->timestamp_us = 42;
+  // Not visible to the consumer before commit
+  EXPECT_EQ(ring.peek(), nullptr);
+  ring.commit();
+
+  const CAN_frame* frame = ring.peek();
+  ASSERT_NE(frame, nullptr);
+  EXPECT_EQ(frame->ID, 0x123u);
+  EXPECT_EQ(frame->timestamp_us, 42u);
+  ring.pop();
+  EXPECT_EQ(ring.peek(), nullptr);
+}
+
+// Producer and consumer in separate threads, like the CAN ingestion task and the core task
+TEST(SpscRingTests, ConcurrentProducerAndConsumerLoseNothing) {
+  static SpscRing<uint32_t, 64> ring;
+  const uint32_t total = 200000;
+
+  std::thread producer([&] {
+    for (uint32_t i = 0; i < total;) {
+      if (ring.push(i)) {
+        i++;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint32_t expected = 0;
+  uint32_t value;
+  while (expected < total) {
+    if (ring.pop(value)) {
+      ASSERT_EQ(value, expected);
+      expected++;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  EXPECT_EQ(ring.count(), 0u);
+  EXPECT_LE(ring.peak_count(), ring.capacity());
+}
+
+TEST(SpscByteRingTests, WritesWholeMessagesOrNothingAcrossTheWrap) {
+  SpscByteRing<16> ring;
+  const uint8_t message[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  const uint8_t* data;
+
+  EXPECT_EQ(ring.peek(data), 0u);
+  EXPECT_TRUE(ring.write(message, 10));
+  EXPECT_FALSE(ring.write(message, 7));  // Does not fit, nothing is written
+  EXPECT_EQ(ring.count(), 10u);
+
+  ASSERT_EQ(ring.peek(data), 10u);
+  EXPECT_EQ(data[9], 10);
+  ring.pop(10);
+
+  // Wraps around the end of the buffer, read back in two contiguous pieces
+  EXPECT_TRUE(ring.write(message, 10));
+  uint8_t copied[16] = {};
+  EXPECT_EQ(ring.copy(copied, sizeof(copied)), 10u);  // Or copied in one go, without consuming
+  EXPECT_EQ(copied[9], 10u);
+  ASSERT_EQ(ring.peek(data), 6u);
+  EXPECT_EQ(data[0], 1);
+  ring.pop(6);
+  ASSERT_EQ(ring.peek(data), 4u);
+  EXPECT_EQ(data[0], 7);
+  EXPECT_EQ(data[3], 10);
+  ring.pop(4);
+
+  EXPECT_EQ(ring.count(), 0u);
+  EXPECT_EQ(ring.peak_count(), 10u);
+}
@@ -0,0 +1,271 @@
+// Drives a battery and an inverter protocol through recorded CAN logs on the host, as fast as it can. The emulated
+// clock follows the timestamps of the log, and the protocols run at the cadences of the core task: the recorded
+// frames are handed to the receivers that declared their IDs, the values are updated and the safety checks run
+// every second, and the protocols send every millisecond. Several logs are played back to back.
+//
+// Writes a CSV time series with a "values" row of the main datalayer fields every second and a "tx" row for every
+// frame the inverter protocol sent, then reports how many frames per second were processed. Comparing the CSV of two
+// builds shows what a change did to the decoding of a log.
+//
+// Build the test project and run
+//   ./replay_runner [-o out.csv] [--battery-can N] [--inverter-can N] <battery> <inverter> <log>...
+// The battery and inverter are the numbers of the settings page or their names, --list shows them. The logs are the
+// text CAN logs of the webserver and the SD card, or binary .bin logs. --battery-can and --inverter-can tell where
+// the battery and the inverter were recorded, as the number after RX in the text log (e.g. 4 for RX4), 0 if not given.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../Software/src/battery/BATTERIES.h"
+#include "../../Software/src/communication/can/CanDispatchTable.h"
+#include "../../Software/src/communication/can/CanReplay.h"
+#include "../../Software/src/communication/can/CanScheduler.h"
+#include "../../Software/src/communication/can/CanSupervisor.h"
+#include "../../Software/src/datalayer/calculated_values.h"
+#include "../../Software/src/datalayer/datalayer.h"
+#include "../../Software/src/devboard/safety/safety.h"
+#include "../../Software/src/inverter/INVERTERS.h"
+
+extern void (*emulated_can_transmit)(const CAN_frame& frame, CAN_Interface interface);
+extern void (*emulated_register_can_receiver)(CanReceiver* receiver, CAN_Interface interface);
+extern void (*emulated_register_transmitter)(Transmitter* transmitter);
+
+// No NVM on the host
+void store_settings_equipment_stop(void) {}
+
+// The battery and the inverter get interfaces of their own, so what the inverter sends can be told apart
+static const CAN_Interface BATTERY_INTERFACE = CAN_NATIVE;
+static const CAN_Interface INVERTER_INTERFACE = CAN_ADDON_MCP2515;
+
+static CanDispatchTable battery_receivers;
+static CanDispatchTable inverter_receivers;
+static std::vector<Transmitter*> transmitters;
+static std::vector<std::pair<CanReceiver*, CAN_Interface>> registrations;
+
+static FILE* csv = stdout;
+static unsigned long now_ms = 0;
+static uint32_t inverter_tx_frames = 0;
+
+static void write_values_row() {
+  const auto& status = datalayer.battery.status;
+  fprintf(csv, "%lu,values,%u,%u,%u,%d,%d,%u,%u,%d,%d,%u,%u,%u,%u,%u,,,\n", now_ms, status.real_soc,
+          status.reported_soc, status.voltage_dV, status.current_dA, (int)status.active_power_W,
+          status.cell_min_voltage_mV, status.cell_max_voltage_mV, status.temperature_min_dC, status.temperature_max_dC,
+          (unsigned)status.max_charge_power_W, (unsigned)status.max_discharge_power_W, status.max_charge_current_dA,
+          status.max_discharge_current_dA, (unsigned)status.bms_status);
+}
+
+static void write_tx_row(const CAN_frame& frame, CAN_Interface interface) {
+  if (interface != INVERTER_INTERFACE) {
+    return;
+  }
+  inverter_tx_frames++;
+  fprintf(csv, "%lu,tx,,,,,,,,,,,,,,,%X,%u,", now_ms, (unsigned)frame.ID, frame.DLC);
+  for (uint8_t i = 0; i < frame.DLC; i++) {
+    fprintf(csv, "%02X", frame.data.u8[i]);
+  }
+  fputc('\n', csv);
+}
+
+// One millisecond of the core task, without the CAN receive part
+static void run_tick(unsigned long ms) {
+  now_ms = ms;
+  set_millis64(ms);
+  if (ms % 10 == 0) {
+    can_supervisor.check(ms);
+  }
+  if (ms % 1000 == 0) {
+    update_pause_state();
+    if (battery) {
+      battery->update_values();
+    }
+    update_calculated_values(ms);
+    update_machineryprotection();
+    if (inverter) {
+      inverter->update_values();
+    }
+    write_values_row();
+  }
+  for (auto transmitter : transmitters) {
+    transmitter->transmit(ms);
+  }
+  can_scheduler.run(ms);
+}
+
+static bool load_log(const char* path, std::vector<uint8_t>& records, uint32_t& skipped_lines) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  const std::vector<uint8_t> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  const size_t length = strlen(path);
+  CanReplayLoader loader(records);
+  loader.begin(length > 4 && strcmp(path + length - 4, ".bin") == 0);
+  loader.append(content.data(), content.size());
+  loader.end();
+  skipped_lines += loader.skipped_lines();
+  return true;
+}
+
+// A number of the settings page or a name, -1 if it is neither
+template <typename T>
+static int parse_type(const char* text, const std::vector<T>& types, const char* (*name)(T)) {
+  char* end;
+  const long number = strtol(text, &end, 10);
+  for (T type : types) {
+    if ((*end == '\0' && number == (long)type) || (name(type) != nullptr && strcasecmp(text, name(type)) == 0)) {
+      return (int)type;
+    }
+  }
+  return -1;
+}
+
+static void list_types() {
+  printf("Batteries:\n");
+  for (BatteryType type : supported_battery_types()) {
+    if (name_for_battery_type(type) == nullptr) {
+      continue;  // Not built into this firmware
+    }
+    printf("  %3d  %s\n", (int)type, name_for_battery_type(type));
+  }
+  printf("Inverters:\n");
+  for (InverterProtocolType type : supported_inverter_protocols()) {
+    printf("  %3d  %s\n", (int)type, name_for_inverter_type(type));
+  }
+}
+
+int main(int argc, char** argv) {
+  const char* output = nullptr;
+  int battery_log_interface = 0;
+  int inverter_log_interface = 0;
+  std::vector<const char*> arguments;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--list") == 0) {
+      list_types();
+      return 0;
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output = argv[++i];
+    } else if (strcmp(argv[i], "--battery-can") == 0 && i + 1 < argc) {
+      battery_log_interface = atoi(argv[++i]) / 2;  // The log numbers RX and TX of each interface in turn
+    } else if (strcmp(argv[i], "--inverter-can") == 0 && i + 1 < argc) {
+      inverter_log_interface = atoi(argv[++i]) / 2;
+    } else {
+      arguments.push_back(argv[i]);
+    }
+  }
+  if (arguments.size() < 3) {
+    fprintf(stderr,
+            "Usage: %s [-o out.csv] [--battery-can N] [--inverter-can N] <battery> <inverter> <log>...\n"
+            "       %s --list\n",
+            argv[0], argv[0]);
+    return 2;
+  }
+
+  const int battery_type = parse_type(arguments[0], supported_battery_types(), name_for_battery_type);
+  const int inverter_type = parse_type(arguments[1], supported_inverter_protocols(), name_for_inverter_type);
+  if (battery_type < 0 || inverter_type < 0) {
+    fprintf(stderr, "Unknown %s %s, see --list\n", battery_type < 0 ? "battery" : "inverter",
+            battery_type < 0 ? arguments[0] : arguments[1]);
+    return 2;
+  }
+
+  std::vector<std::vector<uint8_t>> logs(arguments.size() - 2);
+  uint32_t skipped_lines = 0;
+  for (size_t i = 0; i < logs.size(); i++) {
+    if (!load_log(arguments[i + 2], logs[i], skipped_lines)) {
+      fprintf(stderr, "Cannot read %s\n", arguments[i + 2]);
+      return 1;
+    }
+  }
+  if (output != nullptr && (csv = fopen(output, "w")) == nullptr) {
+    fprintf(stderr, "Cannot write %s\n", output);
+    return 1;
+  }
+
+  // The protocols register their receivers and transmitters while they are constructed, the IDs the receivers want
+  // are asked for once all are set up, as on the device
+  emulated_register_can_receiver = [](CanReceiver* receiver, CAN_Interface interface) {
+    registrations.push_back({receiver, interface});
+  };
+  emulated_register_transmitter = [](Transmitter* transmitter) { transmitters.push_back(transmitter); };
+  emulated_can_transmit = write_tx_row;
+  can_config.battery = BATTERY_INTERFACE;
+  can_config.inverter = INVERTER_INTERFACE;
+  user_selected_battery_type = (BatteryType)battery_type;
+  user_selected_inverter_protocol = (InverterProtocolType)inverter_type;
+  setup_battery();
+  setup_inverter();
+  for (const auto& registration : registrations) {
+    (registration.second == INVERTER_INTERFACE ? inverter_receivers : battery_receivers)
+        .add_receiver(registration.first);
+    can_supervisor.add_receiver(registration.first, registration.second);
+  }
+
+  fprintf(csv,
+          "time_ms,row,real_soc_pptt,reported_soc_pptt,voltage_dV,current_dA,active_power_W,cell_min_mV,cell_max_mV,"
+          "temperature_min_dC,temperature_max_dC,max_charge_power_W,max_discharge_power_W,max_charge_current_dA,"
+          "max_discharge_current_dA,bms_status,id,length,data\n");
+
+  const auto start = std::chrono::steady_clock::now();
+  uint32_t frames = 0;
+  unsigned long next_tick_ms = 0;
+  for (const auto& records : logs) {
+    // Each log starts right after the previous one
+    const unsigned long log_start_ms = next_tick_ms;
+    uint64_t first_timestamp_us = UINT64_MAX;
+    for (size_t position = 0; position + CAN_LOG_BLOCK_SIZE <= records.size();) {
+      const size_t size = can_log_record_size(records.data() + position);
+      if (size == 0 || position + size > records.size()) {
+        position += CAN_LOG_BLOCK_SIZE;
+        continue;
+      }
+      CAN_frame frame;
+      CAN_Interface interface;
+      frameDirection direction;
+      const uint64_t timestamp_us = can_log_decode(records.data() + position, frame, interface, direction);
+      position += size;
+      if (direction == MSG_TX) {
+        continue;  // Sent by the device that recorded the log
+      }
+
+      first_timestamp_us = std::min(first_timestamp_us, timestamp_us);
+      const unsigned long frame_ms = log_start_ms + (timestamp_us - first_timestamp_us) / 1000;
+      while (next_tick_ms < frame_ms) {
+        run_tick(next_tick_ms++);
+      }
+      now_ms = next_tick_ms;
+      set_millis64(now_ms);
+      if (interface == battery_log_interface) {
+        battery_receivers.dispatch(frame);
+        can_supervisor.frame_received(frame, BATTERY_INTERFACE, now_ms);
+      }
+      if (interface == inverter_log_interface) {
+        inverter_receivers.dispatch(frame);
+        can_supervisor.frame_received(frame, INVERTER_INTERFACE, now_ms);
+      }
+      frames++;
+    }
+    // Let the last values of the log come through
+    const unsigned long log_end_ms = next_tick_ms + 1000;
+    while (next_tick_ms <= log_end_ms) {
+      run_tick(next_tick_ms++);
+    }
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (csv != stdout) {
+    fclose(csv);
+  }
+  fprintf(stderr, "%s with %s: %u frames, %.1f s of traffic in %.3f s, %.0f frames/s\n",
+          name_for_battery_type((BatteryType)battery_type), name_for_inverter_type((InverterProtocolType)inverter_type),
+          frames, next_tick_ms / 1000.0, seconds, seconds > 0 ? frames / seconds : 0.0);
+  fprintf(stderr, "%u inverter frames sent, %u log lines skipped\n", inverter_tx_frames, skipped_lines);
+  return 0;
+}